@@ -0,0 +1,821 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonDocument.h"
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonParser.h"
+
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	enum class EDecoder : uint8
+	{
+		Chunked,
+		Engine,
+		Fast,
+		Compact,
+		Num
+	};
+
+	const TCHAR* DecoderNames[] = {TEXT("chunked"), TEXT("engine"), TEXT("fast"), TEXT("compact")};
+
+	enum class EEncoder : uint8
+	{
+		Buffered,
+		Engine,
+		EnginePretty,
+		Num
+	};
+
+	const TCHAR* EncoderNames[] = {TEXT("buffered"), TEXT("engine"), TEXT("engine pretty")};
+
+	/** Json text in both forms the decoders take */
+	struct FJsonText
+	{
+		FString Name;
+		FString Text;
+		TArray<ANSICHAR> Utf8;
+
+		FJsonText(const FString& InName, const FString& InText)
+			: Name(InName)
+			, Text(InText)
+		{
+			const FTCHARToUTF8 Converted(*Text, Text.Len());
+			Utf8.Append((const ANSICHAR*)Converted.Get(), Converted.Length());
+		}
+
+		FJsonText(const FString& InName, const ANSICHAR* InUtf8, int32 Size = INDEX_NONE)
+			: Name(InName)
+			, Utf8(InUtf8, Size == INDEX_NONE ? FCStringAnsi::Strlen(InUtf8) : Size)
+		{
+			const FUTF8ToTCHAR Converted(Utf8.GetData(), Utf8.Num());
+			Text = FString(Converted.Length(), Converted.Get());
+		}
+
+		double GetMegaBytes() const { return Utf8.Num() / (1024.0 * 1024.0); }
+	};
+
+	/** Decodes the text with one of the readers, OutValue gets the FJsonValue tree */
+	bool Decode(EDecoder Decoder, const FJsonText& Json, TSharedPtr<FJsonValue>* OutValue = nullptr)
+	{
+		TSharedPtr<FJsonValue> Value;
+		switch (Decoder)
+		{
+		case EDecoder::Chunked:
+		{
+			// Root has to be an object, the reader doesn't support anything else
+			FJSONReader Reader;
+			if (!Reader.ReadUtf8(Json.Utf8.GetData(), Json.Utf8.Num()) || Reader.State.bError || !Reader.State.Root.IsValid())
+			{
+				return false;
+			}
+			Value = MakeShared<FJsonValueObject>(Reader.State.Root);
+			break;
+		}
+		case EDecoder::Engine:
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json.Text), Value))
+			{
+				return false;
+			}
+			break;
+		case EDecoder::Fast:
+			Value = FVaRestJsonFastParser::Parse(Json.Utf8.GetData(), Json.Utf8.Num());
+			break;
+		case EDecoder::Compact:
+		{
+			const TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> Document = FVaRestJsonDocument::Parse(Json.Utf8.GetData(), Json.Utf8.Num());
+			if (Document.IsValid() && OutValue)
+			{
+				Value = Document->ToJsonValue();
+			}
+			else if (Document.IsValid())
+			{
+				return true;
+			}
+			break;
+		}
+		default:
+			break;
+		}
+
+		if (OutValue)
+		{
+			*OutValue = Value;
+		}
+		return Value.IsValid();
+	}
+
+	/** Encodes the tree with one of the writers, FJSONWriter fills OutBytes and engine ones OutText */
+	int64 Encode(EEncoder Encoder, const TSharedPtr<FJsonValue>& Value, FString& OutText, TArray<uint8>& OutBytes)
+	{
+		switch (Encoder)
+		{
+		case EEncoder::Buffered:
+		{
+			OutBytes.Reset();
+			FMemoryWriter Archive(OutBytes);
+			FJSONWriter Writer(Archive);
+			Writer.Write(*Value);
+			Writer.Flush();
+			return OutBytes.Num();
+		}
+		case EEncoder::Engine:
+		{
+			OutText.Reset();
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutText);
+			if (Value->Type == EJson::Array)
+			{
+				FJsonSerializer::Serialize(Value->AsArray(), Writer);
+			}
+			else
+			{
+				FJsonSerializer::Serialize(Value->AsObject().ToSharedRef(), Writer);
+			}
+			return OutText.Len() * sizeof(TCHAR);
+		}
+		case EEncoder::EnginePretty:
+		{
+			OutText.Reset();
+			const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutText);
+			if (Value->Type == EJson::Array)
+			{
+				FJsonSerializer::Serialize(Value->AsArray(), Writer);
+			}
+			else
+			{
+				FJsonSerializer::Serialize(Value->AsObject().ToSharedRef(), Writer);
+			}
+			return OutText.Len() * sizeof(TCHAR);
+		}
+		default:
+			return 0;
+		}
+	}
+
+	/** Same json data, numbers are compared by value whether they are kept as double or as text */
+	bool IsSameJson(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		if (!A.IsValid() || !B.IsValid() || A->Type != B->Type)
+		{
+			return false;
+		}
+
+		switch (A->Type)
+		{
+		case EJson::Null:
+			return true;
+		case EJson::Boolean:
+			return A->AsBool() == B->AsBool();
+		case EJson::Number:
+			return A->AsNumber() == B->AsNumber();
+		case EJson::String:
+			return A->AsString().Equals(B->AsString(), ESearchCase::CaseSensitive);
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>& ArrayA = A->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& ArrayB = B->AsArray();
+			if (ArrayA.Num() != ArrayB.Num())
+			{
+				return false;
+			}
+			for (int32 i = 0; i < ArrayA.Num(); ++i)
+			{
+				if (!IsSameJson(ArrayA[i], ArrayB[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		case EJson::Object:
+		{
+			const TMap<FString, TSharedPtr<FJsonValue>>& ValuesA = A->AsObject()->Values;
+			const TMap<FString, TSharedPtr<FJsonValue>>& ValuesB = B->AsObject()->Values;
+			if (ValuesA.Num() != ValuesB.Num())
+			{
+				return false;
+			}
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : ValuesA)
+			{
+				const TSharedPtr<FJsonValue>* Other = ValuesB.Find(Pair.Key);
+				if (!Other || !IsSameJson(Pair.Value, *Other))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Allocation tracking
+
+	/**
+	 * Forwards to the allocator it replaces. Counts allocations and live bytes of a single thread,
+	 * the one that owns the counters, so other threads never touch them.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+
+		/** Thread being counted, 0 when nobody is */
+		std::atomic<uint32> OwnerThreadId{0};
+
+		int64 NumAllocations = 0;
+		int64 LiveBytes = 0;
+		int64 LowestLiveBytes = 0;
+		int64 PeakBytes = 0;
+
+		void Begin()
+		{
+			NumAllocations = 0;
+			LiveBytes = 0;
+			LowestLiveBytes = 0;
+			PeakBytes = 0;
+			OwnerThreadId = FPlatformTLS::GetCurrentThreadId();
+		}
+
+		void End()
+		{
+			OwnerThreadId = 0;
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Ptr = Inner->Malloc(Count, Alignment);
+			OnAllocated(Ptr);
+			return Ptr;
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			OnFreed(Original);
+			void* Ptr = Inner->Realloc(Original, Count, Alignment);
+			OnAllocated(Ptr);
+			return Ptr;
+		}
+
+		virtual void Free(void* Original) override
+		{
+			OnFreed(Original);
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("VaRestCountingMalloc"); }
+
+	private:
+		bool IsCounting() const
+		{
+			return OwnerThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId();
+		}
+
+		void OnAllocated(void* Ptr)
+		{
+			if (!Ptr || !IsCounting())
+			{
+				return;
+			}
+
+			++NumAllocations;
+
+			SIZE_T Size = 0;
+			Inner->GetAllocationSize(Ptr, Size);
+			LiveBytes += (int64)Size;
+			PeakBytes = FMath::Max(PeakBytes, LiveBytes - LowestLiveBytes);
+		}
+
+		void OnFreed(void* Ptr)
+		{
+			SIZE_T Size = 0;
+			if (Ptr && IsCounting() && Inner->GetAllocationSize(Ptr, Size))
+			{
+				// Blocks from before the scope take live bytes below zero, growth is measured from the lowest point
+				LiveBytes -= (int64)Size;
+				LowestLiveBytes = FMath::Min(LowestLiveBytes, LiveBytes);
+			}
+		}
+	};
+
+	/**
+	 * Counts allocations made by the calling thread for its lifetime, worker threads of a parallel
+	 * parse are not counted. Peak is the largest growth of live bytes within the scope and needs
+	 * allocator support for GetAllocationSize.
+	 */
+	struct FAllocationScope
+	{
+		FAllocationScope()
+		{
+			// Installed once and never removed: restoring GMalloc would race with threads that
+			// have just read it, so it keeps forwarding when no scope is open
+			static FCountingMalloc* Counting = []()
+			{
+				FCountingMalloc* Installed = new FCountingMalloc();
+				Installed->Inner = GMalloc;
+				FPlatformAtomics::InterlockedExchangePtr((void**)&GMalloc, Installed);
+				return Installed;
+			}();
+			Malloc = Counting;
+
+			SIZE_T Size = 0;
+			void* Probe = GMalloc->Malloc(16, DEFAULT_ALIGNMENT);
+			bTracksSize = GMalloc->GetAllocationSize(Probe, Size);
+			GMalloc->Free(Probe);
+
+			Malloc->Begin();
+		}
+
+		~FAllocationScope()
+		{
+			Malloc->End();
+		}
+
+		int64 GetNumAllocations() const { return Malloc->NumAllocations; }
+
+		/** Negative when the allocator can't report block sizes */
+		int64 GetPeakBytes() const { return bTracksSize ? FMath::Max<int64>(Malloc->PeakBytes, 0) : -1; }
+
+		FCountingMalloc* Malloc;
+		bool bTracksSize;
+	};
+
+	struct FMeasure
+	{
+		double MegaBytesPerSecond = 0.0;
+		double AllocationsPerMegaByte = 0.0;
+		double PeakMegaBytes = -1.0;
+	};
+
+	/** Runs Func long enough to time it, then once more with allocation tracking */
+	template <typename FuncType>
+	FMeasure Measure(double MegaBytes, FuncType&& Func)
+	{
+		// About 16 MB of input for every case, small documents get more rounds
+		const int32 Rounds = FMath::Clamp((int32)(16.0 / FMath::Max(MegaBytes, 1e-6)), 2, 20000);
+
+		FMeasure Result;
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			Func();
+		}
+		Result.MegaBytesPerSecond = MegaBytes * Rounds / FMath::Max(FPlatformTime::Seconds() - Start, 1e-9);
+
+		FAllocationScope Scope;
+		Func();
+		Result.AllocationsPerMegaByte = Scope.GetNumAllocations() / FMath::Max(MegaBytes, 1e-6);
+		if (Scope.GetPeakBytes() >= 0)
+		{
+			Result.PeakMegaBytes = Scope.GetPeakBytes() / (1024.0 * 1024.0);
+		}
+
+		return Result;
+	}
+
+	FString ToString(const FMeasure& Measure)
+	{
+		const FString Peak = Measure.PeakMegaBytes >= 0.0 ? FString::Printf(TEXT("%7.2f MB"), Measure.PeakMegaBytes) : FString(TEXT("    n/a"));
+		return FString::Printf(TEXT("%8.1f MB/s %9.0f allocs/MB peak %s"), Measure.MegaBytesPerSecond, Measure.AllocationsPerMegaByte, *Peak);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Corpus
+
+	const TCHAR* Words[] = {TEXT("alpha"), TEXT("bravo"), TEXT("charlie"), TEXT("delta"), TEXT("echo"), TEXT("foxtrot"), TEXT("golf"), TEXT("hotel")};
+
+	/** Non ascii text, raw and as json escapes */
+	const TCHAR* UnicodeWords[] = {
+		TEXT("\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8"),
+		TEXT("\u4E2D\u6587\u5B57\u7B26\u4E32"),
+		TEXT("\uD55C\uAD6D\uC5B4 \uBB38\uC7A5"),
+		TEXT("\u041F\u0440\u0438\u0432\u0435\u0442, \u043C\u0438\u0440"),
+		TEXT("caf\u00E9 na\u00EFve \u00FCber"),
+		TEXT("\U0001F600\U0001F680\U0001F44D\U0001F3FD"),
+		TEXT("\\u00e9\\u4e2d\\ud83d\\ude80 \\\"quoted\\\""),
+		TEXT("mixed \u6F22\u5B57 and \U0001F389 emoji"),
+	};
+
+	const TCHAR* PickWord(FRandomStream& Random)
+	{
+		return Words[Random.RandHelper(UE_ARRAY_COUNT(Words))];
+	}
+
+	FString MakeRecord(FRandomStream& Random, int32 Id)
+	{
+		FString Tags;
+		for (int32 i = Random.RandRange(1, 4); i > 0; --i)
+		{
+			Tags += FString::Printf(TEXT("%s\"%s\""), Tags.IsEmpty() ? TEXT("") : TEXT(","), PickWord(Random));
+		}
+
+		return FString::Printf(
+			TEXT("{\"id\":%d,\"guid\":\"%08x-%04x-%04x\",\"name\":\"%s %s\",\"email\":\"user%d@example.com\",\"active\":%s,")
+			TEXT("\"balance\":%.2f,\"age\":%d,\"tags\":[%s],\"address\":{\"street\":\"%d %s street\",\"city\":\"%s\",\"zip\":\"%05d\"},\"manager\":null}"),
+			Id, Random.GetUnsignedInt(), Random.RandHelper(0xffff), Random.RandHelper(0xffff), PickWord(Random), PickWord(Random), Id,
+			Random.RandHelper(2) ? TEXT("true") : TEXT("false"), Random.FRandRange(0.0f, 10000.0f), Random.RandRange(18, 90), *Tags,
+			Random.RandRange(1, 999), PickWord(Random), PickWord(Random), Random.RandHelper(100000));
+	}
+
+	FString MakeRecords(FRandomStream& Random, int32 Count)
+	{
+		FString Json(TEXT("["));
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (i > 0)
+			{
+				Json.AppendChar(',');
+			}
+			Json += MakeRecord(Random, i);
+		}
+		Json.AppendChar(']');
+		return Json;
+	}
+
+	/** Chain of objects and arrays Depth levels deep */
+	FString MakeNested(FRandomStream& Random, int32 Depth)
+	{
+		FString Open;
+		FString Close;
+		for (int32 i = 0; i < Depth; ++i)
+		{
+			if (i % 2 == 0)
+			{
+				Open += FString::Printf(TEXT("{\"level\":%d,\"name\":\"%s\",\"child\":"), i, PickWord(Random));
+				Close += TEXT("}");
+			}
+			else
+			{
+				Open += TEXT("[true,");
+				Close += TEXT("]");
+			}
+		}
+		return Open + TEXT("null") + Close.Reverse();
+	}
+
+	void MakeCorpus(TArray<FJsonText>& OutCorpus)
+	{
+		FRandomStream Random(48);
+
+		// Small api responses
+		OutCorpus.Emplace(TEXT("status"), TEXT("{\"ok\":true,\"code\":200,\"message\":\"Success\",\"requestId\":\"b7f3c2a1\",\"data\":null}"));
+		OutCorpus.Emplace(TEXT("profile"), FString::Printf(TEXT("{\"user\":%s,\"session\":{\"token\":\"%08x%08x\",\"expires\":1700000000}}"),
+			*MakeRecord(Random, 7), Random.GetUnsignedInt(), Random.GetUnsignedInt()));
+		OutCorpus.Emplace(TEXT("page"), FString::Printf(TEXT("{\"items\":%s,\"page\":1,\"total\":20}"), *MakeRecords(Random, 20)));
+
+		// Large record arrays, the root array one is parsed in parallel
+		OutCorpus.Emplace(TEXT("records"), FString::Printf(TEXT("{\"records\":%s}"), *MakeRecords(Random, 20000)));
+		OutCorpus.Emplace(TEXT("records root"), MakeRecords(Random, 20000));
+
+		// Numeric heavy
+		FString Matrix(TEXT("{\"matrix\":["));
+		for (int32 Row = 0; Row < 2000; ++Row)
+		{
+			Matrix += Row > 0 ? TEXT(",[") : TEXT("[");
+			for (int32 Column = 0; Column < 50; ++Column)
+			{
+				Matrix += FString::Printf(TEXT("%s%.17g"), Column > 0 ? TEXT(",") : TEXT(""), Random.FRandRange(-1.0f, 1.0f) * FMath::Pow(10.0, (double)Random.RandRange(-6, 6)));
+			}
+			Matrix.AppendChar(']');
+		}
+		Matrix += TEXT("],\"ids\":[");
+		for (int32 i = 0; i < 50000; ++i)
+		{
+			Matrix += FString::Printf(TEXT("%s%lld"), i > 0 ? TEXT(",") : TEXT(""), (int64)Random.GetUnsignedInt() * (int64)Random.RandHelper(1 << 22));
+		}
+		Matrix += TEXT("]}");
+		OutCorpus.Emplace(TEXT("numeric"), Matrix);
+
+		// Deeply nested
+		FString Nested(TEXT("{\"deep\":"));
+		Nested += MakeNested(Random, 500);
+		Nested += TEXT(",\"trees\":[");
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			Nested += i > 0 ? TEXT(",") : TEXT("");
+			Nested += MakeNested(Random, 40);
+		}
+		Nested += TEXT("]}");
+		OutCorpus.Emplace(TEXT("nested"), Nested);
+
+		// Unicode heavy, keys too
+		FString Unicode(TEXT("{\"messages\":["));
+		for (int32 i = 0; i < 20000; ++i)
+		{
+			Unicode += FString::Printf(TEXT("%s{\"id\":%d,\"%s\":\"%s\",\"text\":\"%s %s\"}"), i > 0 ? TEXT(",") : TEXT(""), i,
+				UnicodeWords[i % 3], UnicodeWords[Random.RandHelper(UE_ARRAY_COUNT(UnicodeWords))],
+				UnicodeWords[Random.RandHelper(UE_ARRAY_COUNT(UnicodeWords))], UnicodeWords[Random.RandHelper(UE_ARRAY_COUNT(UnicodeWords))]);
+		}
+		Unicode += TEXT("]}");
+		OutCorpus.Emplace(TEXT("unicode"), Unicode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Conformance
+
+	/** Documents every json parser must accept, in the spirit of JSONTestSuite y_ cases */
+	const ANSICHAR* ValidCases[] = {
+		"[]",
+		"{}",
+		" [1] ",
+		"[null]",
+		"[true,false]",
+		"[0]",
+		"[-0]",
+		"[1E22]",
+		"[1e-2]",
+		"[-1.5E+3]",
+		"[123e65]",
+		"[0.5e-100]",
+		"[1.0e+0]",
+		"\"asd\"",
+		"42",
+		"null",
+		"[[[[[]]]]]",
+		"[1,\n2\t,\r3]",
+		"[\"\\u0060\\u012a\\u12AB\"]",
+		"[\"\\ud83d\\ude00\"]",
+		"[\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"]",
+		"[\"\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\",\"\xF0\x9F\x98\x80\",\"\xC3\xA9\"]",
+		"{\"\":0}",
+		"{\"a\":\"b\",\"a\":\"c\"}",
+		"{\"a\":[],\"b\":{}}",
+		"{\"\xC3\xA9\":1}",
+		"{\"a\" : 1 , \"b\" :[ 2 ]}",
+		"{\"id\":9007199254740993,\"min\":-9223372036854775808}",
+	};
+
+	/** Documents every json parser must reject, JSONTestSuite n_ cases */
+	const ANSICHAR* InvalidCases[] = {
+		"",
+		"[",
+		"{",
+		"[1,]",
+		"[,1]",
+		"[1,,2]",
+		"[1 2]",
+		"[1}",
+		"{\"a\":1,}",
+		"{,}",
+		"{\"a\"}",
+		"{\"a\":}",
+		"{\"a\" 1}",
+		"{\"a\":1 \"b\":2}",
+		"{\"a\":1]",
+		"{a:1}",
+		"{'a':1}",
+		"['a']",
+		"[01]",
+		"[-01]",
+		"[1.]",
+		"[.5]",
+		"[+1]",
+		"[1e]",
+		"[1e+]",
+		"[1.5e]",
+		"[-]",
+		"[--1]",
+		"[0x10]",
+		"[NaN]",
+		"[Infinity]",
+		"[tru]",
+		"[True]",
+		"[nul]",
+		"[\"a\nb\"]",
+		"[\"\t\"]",
+		"[\"\\x\"]",
+		"[\"\\u12\"]",
+		"[\"\\uZZZZ\"]",
+		"[\"abc",
+		"[\"\xC3\x28\"]",
+		"[\"\xC0\xAF\"]",
+		"[\"\xED\xA0\x80\"]",
+		"[\"\xF4\x90\x80\x80\"]",
+		"[\"\xE2\x82\"]",
+		"[1]\xFF",
+		"[1] [2]",
+		"{} x",
+	};
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonConformanceTest, "VaRest.Json.Engines.Conformance",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVaRestJsonConformanceTest::RunTest(const FString& Parameters)
+{
+	// Fast and compact readers are strict. Chunked reader is lenient by design and only reads
+	// object roots, engine reader has its own quirks: both are reported, not enforced.
+	int32 LenientValid[(int32)EDecoder::Num] = {};
+	int32 LenientInvalid[(int32)EDecoder::Num] = {};
+
+	for (const ANSICHAR* Case : ValidCases)
+	{
+		const FJsonText Json(TEXT("y"), Case);
+		const FString Label = FString::Printf(TEXT("y %s"), *Json.Text.ReplaceCharWithEscapedChar());
+
+		TSharedPtr<FJsonValue> Fast;
+		TSharedPtr<FJsonValue> Compact;
+		TestTrue(Label + TEXT(" fast"), Decode(EDecoder::Fast, Json, &Fast));
+		TestTrue(Label + TEXT(" compact"), Decode(EDecoder::Compact, Json, &Compact));
+		TestTrue(Label + TEXT(" fast and compact agree"), IsSameJson(Fast, Compact));
+
+		for (EDecoder Decoder : {EDecoder::Chunked, EDecoder::Engine})
+		{
+			TSharedPtr<FJsonValue> Value;
+			if (Decode(Decoder, Json, &Value) && IsSameJson(Value, Fast))
+			{
+				++LenientValid[(int32)Decoder];
+			}
+		}
+	}
+
+	for (const ANSICHAR* Case : InvalidCases)
+	{
+		const FJsonText Json(TEXT("n"), Case);
+		const FString Label = FString::Printf(TEXT("n %s"), *Json.Text.ReplaceCharWithEscapedChar());
+
+		TestFalse(Label + TEXT(" fast"), Decode(EDecoder::Fast, Json));
+		TestFalse(Label + TEXT(" compact"), Decode(EDecoder::Compact, Json));
+
+		for (EDecoder Decoder : {EDecoder::Chunked, EDecoder::Engine})
+		{
+			if (!Decode(Decoder, Json))
+			{
+				++LenientInvalid[(int32)Decoder];
+			}
+		}
+	}
+
+	for (EDecoder Decoder : {EDecoder::Chunked, EDecoder::Engine})
+	{
+		AddInfo(FString::Printf(TEXT("%s reader: %d of %d valid documents read as fast parser does, %d of %d invalid rejected"),
+			DecoderNames[(int32)Decoder], LenientValid[(int32)Decoder], (int32)UE_ARRAY_COUNT(ValidCases),
+			LenientInvalid[(int32)Decoder], (int32)UE_ARRAY_COUNT(InvalidCases)));
+	}
+
+	// Whole corpus: all VaRest readers agree, every writer output reads back the same
+	TArray<FJsonText> Corpus;
+	MakeCorpus(Corpus);
+
+	for (const FJsonText& Json : Corpus)
+	{
+		TSharedPtr<FJsonValue> Fast;
+		if (!TestTrue(Json.Name + TEXT(" fast"), Decode(EDecoder::Fast, Json, &Fast)))
+		{
+			continue;
+		}
+
+		for (EDecoder Decoder : {EDecoder::Chunked, EDecoder::Compact, EDecoder::Engine})
+		{
+			if (Decoder == EDecoder::Chunked && Fast->Type != EJson::Object)
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonValue> Value;
+			const bool bSame = Decode(Decoder, Json, &Value) && IsSameJson(Value, Fast);
+			if (Decoder == EDecoder::Engine)
+			{
+				if (!bSame)
+				{
+					AddWarning(FString::Printf(TEXT("%s: engine reader disagrees with fast parser"), *Json.Name));
+				}
+			}
+			else
+			{
+				TestTrue(FString::Printf(TEXT("%s %s"), *Json.Name, DecoderNames[(int32)Decoder]), bSame);
+			}
+		}
+
+		for (int32 Encoder = 0; Encoder < (int32)EEncoder::Num; ++Encoder)
+		{
+			FString Text;
+			TArray<uint8> Bytes;
+			Encode((EEncoder)Encoder, Fast, Text, Bytes);
+
+			const FJsonText Encoded = (EEncoder)Encoder == EEncoder::Buffered ? FJsonText(Json.Name, (const ANSICHAR*)Bytes.GetData(), Bytes.Num()) : FJsonText(Json.Name, Text);
+
+			TSharedPtr<FJsonValue> Value;
+			TestTrue(FString::Printf(TEXT("%s %s writer round trip"), *Json.Name, EncoderNames[Encoder]),
+				Decode(EDecoder::Fast, Encoded, &Value) && IsSameJson(Value, Fast));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonParallelErrorTest, "VaRest.Json.Engines.ParallelErrors",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVaRestJsonParallelErrorTest::RunTest(const FString& Parameters)
+{
+	// Root array large enough to be split into runs, bad elements have the same length as good ones
+	// so that every error offset is the same with or without the other bad elements
+	const int32 NumElements = 100000;
+	const ANSICHAR* Good = "{\"a\":1},";
+	const ANSICHAR* Bad = "{\"a\" 1},";
+	const int32 ElementSize = FCStringAnsi::Strlen(Good);
+
+	const auto MakeArray = [&](const TArray<int32>& BadElements)
+	{
+		TArray<ANSICHAR> Utf8;
+		Utf8.Reserve(NumElements * ElementSize + 2);
+		Utf8.Add('[');
+		for (int32 Element = 0; Element < NumElements; ++Element)
+		{
+			const ANSICHAR* Text = BadElements.Contains(Element) ? Bad : Good;
+			Utf8.Append(Text, ElementSize);
+		}
+		Utf8.Last() = ']';
+		return Utf8;
+	};
+
+	const auto GetErrors = [](const TArray<ANSICHAR>& Utf8, FString& OutFast, FString& OutCompact)
+	{
+		const bool bFast = FVaRestJsonFastParser::Parse(Utf8.GetData(), Utf8.Num(), &OutFast).IsValid();
+		const bool bCompact = FVaRestJsonDocument::Parse(Utf8.GetData(), Utf8.Num(), &OutCompact).IsValid();
+		return !bFast && !bCompact;
+	};
+
+	const int32 Firsts[] = {0, NumElements / 10, NumElements / 2};
+	for (const int32 First : Firsts)
+	{
+		FString Fast, Compact, ExpectedFast, ExpectedCompact;
+		TestTrue(FString::Printf(TEXT("Element %d alone rejected"), First), GetErrors(MakeArray({First}), ExpectedFast, ExpectedCompact));
+
+		// Later runs fail sooner than the first one and must not win
+		TestTrue(FString::Printf(TEXT("Element %d and later rejected"), First), GetErrors(MakeArray({First, NumElements - 1, First + NumElements / 3}), Fast, Compact));
+		TestEqual(FString::Printf(TEXT("Element %d fast error"), First), Fast, ExpectedFast);
+		TestEqual(FString::Printf(TEXT("Element %d compact error"), First), Compact, ExpectedCompact);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonEngineBenchmark, "VaRest.Json.Engines.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVaRestJsonEngineBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FJsonText> Corpus;
+	MakeCorpus(Corpus);
+
+	// Rates are in megabytes of utf-8 document text for every engine, decode and encode alike.
+	// Allocations are those of the calling thread, large root arrays are parsed on workers as well.
+	for (const FJsonText& Json : Corpus)
+	{
+		const double MegaBytes = Json.GetMegaBytes();
+		AddInfo(FString::Printf(TEXT("%s, %.3f MB"), *Json.Name, MegaBytes));
+
+		TSharedPtr<FJsonValue> Value;
+		if (!TestTrue(Json.Name + TEXT(" decoded"), Decode(EDecoder::Fast, Json, &Value)))
+		{
+			continue;
+		}
+
+		for (int32 Decoder = 0; Decoder < (int32)EDecoder::Num; ++Decoder)
+		{
+			if ((EDecoder)Decoder == EDecoder::Chunked && Value->Type != EJson::Object)
+			{
+				continue;
+			}
+
+			const FMeasure Result = Measure(MegaBytes, [&Json, Decoder]() { Decode((EDecoder)Decoder, Json); });
+			AddInfo(FString::Printf(TEXT("  decode %-14s %s"), DecoderNames[Decoder], *ToString(Result)));
+		}
+
+		for (int32 Encoder = 0; Encoder < (int32)EEncoder::Num; ++Encoder)
+		{
+			FString Text;
+			TArray<uint8> Bytes;
+			const FMeasure Result = Measure(MegaBytes, [&Value, &Text, &Bytes, Encoder]() { Encode((EEncoder)Encoder, Value, Text, Bytes); });
+			AddInfo(FString::Printf(TEXT("  encode %-14s %s"), EncoderNames[Encoder], *ToString(Result)));
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
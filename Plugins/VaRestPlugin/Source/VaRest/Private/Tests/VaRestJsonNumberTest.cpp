@@ -0,0 +1,260 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonNumber.h"
+#include "VaRestJsonParser.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	bool ParseAll(const ANSICHAR* Text, FVaRestJsonNumber& OutNumber)
+	{
+		const ANSICHAR* Ptr = Text;
+		const ANSICHAR* End = Text + FCStringAnsi::Strlen(Text);
+		return FVaRestJsonNumber::Parse(Ptr, End, OutNumber) && Ptr == End;
+	}
+
+	bool IsSameDouble(double A, double B)
+	{
+		return FMemory::Memcmp(&A, &B, sizeof(double)) == 0;
+	}
+
+	double RandomDouble(FRandomStream& Random)
+	{
+		// Any finite bit pattern, covers subnormals and both ends of exponent range
+		for (;;)
+		{
+			const uint64 Bits = ((uint64)(uint32)Random.GetUnsignedInt() << 32) | (uint32)Random.GetUnsignedInt();
+			double Value;
+			FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+			if (FMath::IsFinite(Value))
+			{
+				return Value;
+			}
+		}
+	}
+
+	/** {"values":[...]} with Count numbers of given kind */
+	FString MakeNumericPayload(FRandomStream& Random, int32 Count, int32 Kind)
+	{
+		FString Json;
+		Json.Reserve(Count * 24);
+		Json += TEXT("{\"values\":[");
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (i > 0)
+			{
+				Json.AppendChar(',');
+			}
+
+			switch (Kind)
+			{
+			case 0: // ids and counters
+				Json += LexToString((int64)Random.RandHelper(MAX_int32) * (int64)Random.RandHelper(1000));
+				break;
+			case 1: // coordinates
+				Json += FString::Printf(TEXT("%.6f"), Random.FRandRange(-180.0f, 180.0f));
+				break;
+			default: // telemetry written at full precision
+				Json += FString::Printf(TEXT("%.17g"), Random.FRandRange(-1.0f, 1.0f) * FMath::Pow(10.0, (double)Random.RandRange(-8, 8)));
+				break;
+			}
+		}
+		Json += TEXT("]}");
+		return Json;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonNumberTest, "VaRest.Json.Numbers.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVaRestJsonNumberTest::RunTest(const FString& Parameters)
+{
+	struct FCase
+	{
+		const ANSICHAR* Text;
+		double Expected;
+	};
+
+	const FCase Cases[] = {
+		{"0", 0.0},
+		{"-0", -0.0},
+		{"0.1", 0.1},
+		{"1e5", 1e5},
+		{"1E+2", 1e2},
+		{"-1.0e-0", -1.0},
+		{"123456789012345678", 123456789012345678.0},
+		{"0.30000000000000004", 0.30000000000000004},
+		{"2.2250738585072011e-308", 2.2250738585072011e-308},
+		{"2.2250738585072014e-308", 2.2250738585072014e-308},
+		{"4.9406564584124654e-324", 4.9406564584124654e-324},
+		{"1.7976931348623157e308", 1.7976931348623157e308},
+		{"9007199254740993", 9007199254740992.0},
+		{"1e-400", 0.0},
+		{"3.14159265358979323846264338327950288", 3.14159265358979323846},
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		FVaRestJsonNumber Number;
+		if (TestTrue(FString::Printf(TEXT("parse %s"), ANSI_TO_TCHAR(Case.Text)), ParseAll(Case.Text, Number)))
+		{
+			TestTrue(FString::Printf(TEXT("value %s"), ANSI_TO_TCHAR(Case.Text)), IsSameDouble(Number.Value, Case.Expected));
+		}
+	}
+
+	FVaRestJsonNumber Number;
+	TestTrue(TEXT("infinity"), ParseAll("1e999", Number) && !FMath::IsFinite(Number.Value));
+
+	TestTrue(TEXT("int64 max"), ParseAll("9223372036854775807", Number) && Number.bInteger && Number.Integer == MAX_int64);
+	TestTrue(TEXT("int64 min"), ParseAll("-9223372036854775808", Number) && Number.bInteger && Number.Integer == MIN_int64);
+	TestTrue(TEXT("above int64"), ParseAll("9223372036854775808", Number) && !Number.bInteger);
+	TestTrue(TEXT("above 2^53"), ParseAll("9007199254740993", Number) && Number.NeedsInt64() && Number.Integer == 9007199254740993ll);
+	TestTrue(TEXT("exponent is not integer"), ParseAll("1e2", Number) && !Number.bInteger);
+
+	const ANSICHAR* Invalid[] = {"", "-", "01", "1.", ".5", "+1", "1e", "1e+", "--1", "0x10", "1.e5"};
+	for (const ANSICHAR* Text : Invalid)
+	{
+		TestFalse(FString::Printf(TEXT("reject '%s'"), ANSI_TO_TCHAR(Text)), ParseAll(Text, Number));
+	}
+
+	// Shortest round trip text and truncated decimals against platform strtod
+	FRandomStream Random(45);
+	ANSICHAR Buffer[64];
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		const double Value = RandomDouble(Random);
+		if (i % 2 == 0)
+		{
+			FCStringAnsi::Sprintf(Buffer, "%.17g", Value);
+		}
+		else
+		{
+			FCStringAnsi::Sprintf(Buffer, "%.*e", Random.RandRange(0, 16), Value);
+		}
+
+		if (!ParseAll(Buffer, Number) || !IsSameDouble(Number.Value, FCStringAnsi::Atod(Buffer)))
+		{
+			AddError(FString::Printf(TEXT("round trip %s"), ANSI_TO_TCHAR(Buffer)));
+			break;
+		}
+	}
+
+	// Both readers keep integers above 2^53 and accept short exponents
+	const FString Json = TEXT("{\"id\":9007199254740993,\"big\":-9223372036854775808,\"small\":1e5,\"pi\":3.141592653589793}");
+	const FTCHARToUTF8 Utf8(*Json);
+
+	FJSONReader Reader;
+	Reader.ReadUtf8((const ANSICHAR*)Utf8.Get(), Utf8.Length());
+	const TSharedPtr<FJsonValue> Fast = FVaRestJsonFastParser::Parse((const ANSICHAR*)Utf8.Get(), Utf8.Length());
+
+	const TSharedPtr<FJsonObject> Objects[] = {Reader.State.Root, Fast.IsValid() ? Fast->AsObject() : TSharedPtr<FJsonObject>()};
+	for (const TSharedPtr<FJsonObject>& Object : Objects)
+	{
+		if (!TestTrue(TEXT("decoded"), Object.IsValid()))
+		{
+			continue;
+		}
+
+		int64 Integer = 0;
+		TestTrue(TEXT("id"), Object->TryGetNumberField(TEXT("id"), Integer) && Integer == 9007199254740993ll);
+		TestTrue(TEXT("big"), Object->TryGetNumberField(TEXT("big"), Integer) && Integer == MIN_int64);
+		TestEqual(TEXT("small"), Object->GetNumberField(TEXT("small")), 1e5);
+		TestEqual(TEXT("pi"), Object->GetNumberField(TEXT("pi")), 3.141592653589793);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonNumberBenchmark, "VaRest.Json.Numbers.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVaRestJsonNumberBenchmark::RunTest(const FString& Parameters)
+{
+	const TCHAR* KindNames[] = {TEXT("integers"), TEXT("coordinates"), TEXT("doubles")};
+	const int32 Count = 200000;
+	const int32 Rounds = 3;
+
+	FRandomStream Random(42);
+
+	for (int32 Kind = 0; Kind < (int32)UE_ARRAY_COUNT(KindNames); ++Kind)
+	{
+		const FString Json = MakeNumericPayload(Random, Count, Kind);
+		const FTCHARToUTF8 Utf8(*Json);
+		const ANSICHAR* Bytes = (const ANSICHAR*)Utf8.Get();
+		const double MegaBytes = Utf8.Length() / (1024.0 * 1024.0);
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			FJSONReader Reader;
+			Reader.ReadUtf8(Bytes, Utf8.Length());
+			TestTrue(TEXT("chunked reader"), Reader.State.Root.IsValid());
+		}
+		const double ChunkedTime = (FPlatformTime::Seconds() - Start) / Rounds;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			TestTrue(TEXT("fast parser"), FVaRestJsonFastParser::Parse(Bytes, Utf8.Length()).IsValid());
+		}
+		const double FastTime = (FPlatformTime::Seconds() - Start) / Rounds;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			TSharedPtr<FJsonObject> Object;
+			TestTrue(TEXT("engine reader"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object));
+		}
+		const double EngineTime = (FPlatformTime::Seconds() - Start) / Rounds;
+
+		// Conversion alone, numbers are split by commas in place
+		TArray<ANSICHAR> Text(Bytes, Utf8.Length() + 1);
+		TArray<const ANSICHAR*> Numbers;
+		for (int32 i = 11; i < Utf8.Length() - 2; ++i)
+		{
+			Numbers.Add(Text.GetData() + i);
+			while (Text[i] != ',' && Text[i] != ']')
+			{
+				++i;
+			}
+			Text[i] = '\0';
+		}
+
+		double Checksum = 0.0;
+		double AtodChecksum = 0.0;
+		Start = FPlatformTime::Seconds();
+		for (const ANSICHAR* Ptr : Numbers)
+		{
+			const ANSICHAR* End = Ptr + FCStringAnsi::Strlen(Ptr);
+			FVaRestJsonNumber Number;
+			FVaRestJsonNumber::Parse(Ptr, End, Number);
+			Checksum += Number.Value;
+		}
+		const double NumberTime = FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		for (const ANSICHAR* Ptr : Numbers)
+		{
+			AtodChecksum += FCStringAnsi::Atod(Ptr);
+		}
+		const double AtodTime = FPlatformTime::Seconds() - Start;
+
+		TestEqual(FString::Printf(TEXT("%s checksum"), KindNames[Kind]), Checksum, AtodChecksum);
+
+		AddInfo(FString::Printf(TEXT("%-12s %6.2f MB: chunked %7.1f MB/s, fast %7.1f MB/s, engine %7.1f MB/s; conversion %5.1f ns, Atod %5.1f ns"),
+			KindNames[Kind], MegaBytes,
+			MegaBytes / FMath::Max(ChunkedTime, 1e-9), MegaBytes / FMath::Max(FastTime, 1e-9), MegaBytes / FMath::Max(EngineTime, 1e-9),
+			NumberTime * 1e9 / Numbers.Num(), AtodTime * 1e9 / Numbers.Num()));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
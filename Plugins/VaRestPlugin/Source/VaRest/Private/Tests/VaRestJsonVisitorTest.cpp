@@ -0,0 +1,185 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonVisitor.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Writes every event as a token, stops after StopAfter events when it is set */
+	struct FEventRecorder : public FVaRestJsonVisitor
+	{
+		TArray<FString> Events;
+		int32 StopAfter = INDEX_NONE;
+
+		bool Record(const FString& Event)
+		{
+			Events.Add(Event);
+			return StopAfter == INDEX_NONE || Events.Num() < StopAfter;
+		}
+
+		virtual bool OnStartObject() override { return Record(TEXT("{")); }
+		virtual bool OnEndObject() override { return Record(TEXT("}")); }
+		virtual bool OnStartArray() override { return Record(TEXT("[")); }
+		virtual bool OnEndArray() override { return Record(TEXT("]")); }
+		virtual bool OnKey(const FString& Key) override { return Record(TEXT("k:") + Key); }
+		virtual bool OnString(const FString& Value) override { return Record(TEXT("s:") + Value); }
+		virtual bool OnNumber(double Value) override { return Record(FString::Printf(TEXT("n:%g"), Value)); }
+		virtual bool OnInt64(int64 Value) override { return Record(FString::Printf(TEXT("i:%lld"), Value)); }
+		virtual bool OnBoolean(bool bValue) override { return Record(bValue ? TEXT("true") : TEXT("false")); }
+		virtual bool OnNull() override { return Record(TEXT("null")); }
+	};
+
+	/** Elements visited at Path, each one serialized as text */
+	struct FElements
+	{
+		int32 Count = 0;
+		TArray<FString> Values;
+		FString Error;
+	};
+
+	FElements CollectElements(const FString& Json, const FString& Path, int32 StopAt = INDEX_NONE)
+	{
+		FElements Result;
+		const FTCHARToUTF8 Converted(*Json);
+
+		Result.Count = FVaRestJsonVisitor::ForEachArrayElement((const ANSICHAR*)Converted.Get(), Converted.Length(), Path,
+			[&Result, StopAt](int32 Index, const TSharedPtr<FJsonValue>& Value) {
+				FString Text;
+				switch (Value->Type)
+				{
+				case EJson::Number:
+					Text = FString::Printf(TEXT("%g"), Value->AsNumber());
+					break;
+				case EJson::Array:
+					Text = FString::Printf(TEXT("[%d]"), Value->AsArray().Num());
+					break;
+				case EJson::Object:
+					Text = FString::Printf(TEXT("{%d}"), Value->AsObject()->Values.Num());
+					break;
+				default:
+					Text = Value->AsString();
+					break;
+				}
+				Result.Values.Add(FString::Printf(TEXT("%d=%s"), Index, *Text));
+				return Index != StopAt;
+			},
+			&Result.Error);
+
+		return Result;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonVisitorEventsTest, "VaRest.Json.Visitor.Events",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVaRestJsonVisitorEventsTest::RunTest(const FString& Parameters)
+{
+	const FString Json = TEXT("{\"a\":[1,\"x\",true,null,{\"b\":{}}],\"c\":{\"d\":[]},\"id\":9007199254740993,\"f\":-2.5,\"\\u00e9\":false}");
+	const FString Expected = TEXT("{ k:a [ n:1 s:x true null { k:b { } } ] k:c { k:d [ ] } k:id i:9007199254740993 k:f n:-2.5 k:\u00e9 false }");
+
+	{
+		FEventRecorder Recorder;
+		FString Error;
+		TestTrue(TEXT("Nested document visited"), Recorder.Visit(Json, &Error));
+		TestEqual(TEXT("Event sequence"), FString::Join(Recorder.Events, TEXT(" ")), Expected);
+		TestTrue(TEXT("No error"), Error.IsEmpty());
+	}
+
+	{
+		// Integers above 2^53 fall back to the nearest double unless OnInt64 is overridden
+		struct FNumberRecorder : public FVaRestJsonVisitor
+		{
+			TArray<double> Numbers;
+			virtual bool OnNumber(double Value) override
+			{
+				Numbers.Add(Value);
+				return true;
+			}
+		} Recorder;
+
+		TestTrue(TEXT("Large integer visited"), Recorder.Visit(TEXT("[9007199254740993,12]")));
+		TestEqual(TEXT("Large integer as double"), Recorder.Numbers.Num() == 2 ? Recorder.Numbers[0] : 0.0, 9007199254740992.0);
+	}
+
+	{
+		// Every prefix of the sequence, stopping on each kind of event
+		TArray<FString> All;
+		Expected.ParseIntoArray(All, TEXT(" "));
+		for (int32 StopAfter = 1; StopAfter <= All.Num(); ++StopAfter)
+		{
+			FEventRecorder Recorder;
+			Recorder.StopAfter = StopAfter;
+			FString Error;
+
+			const bool bCompleted = Recorder.Visit(Json, &Error);
+			TestEqual(FString::Printf(TEXT("Stopped after %d events"), StopAfter), Recorder.Events.Num(), StopAfter);
+			TestEqual(FString::Printf(TEXT("Result when stopped after %d events"), StopAfter), bCompleted, false);
+			TestTrue(FString::Printf(TEXT("Stop after %d events is no error"), StopAfter), Error.IsEmpty());
+		}
+	}
+
+	{
+		FEventRecorder Recorder;
+		FString Error;
+		TestFalse(TEXT("Malformed document"), Recorder.Visit(TEXT("{\"a\":[1,}"), &Error));
+		TestFalse(TEXT("Malformed document error"), Error.IsEmpty());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVaRestJsonVisitorArrayTest, "VaRest.Json.Visitor.ForEachArrayElement",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVaRestJsonVisitorArrayTest::RunTest(const FString& Parameters)
+{
+	const FString Json = TEXT("{\"data\":{\"other\":[9],\"items\":[{\"v\":1},2,[3,4],\"s\"]},\"x/y\":[5,6],\"n\":1}");
+	const TArray<FString> Items = {TEXT("0={1}"), TEXT("1=2"), TEXT("2=[2]"), TEXT("3=s")};
+
+	// Both path syntaxes go through the same reader
+	const TCHAR* ItemPaths[] = {TEXT("/data/items"), TEXT("data.items"), TEXT(".data..items.")};
+	for (const TCHAR* Path : ItemPaths)
+	{
+		const FElements Result = CollectElements(Json, Path);
+		TestEqual(FString::Printf(TEXT("%s count"), Path), Result.Count, Items.Num());
+		TestTrue(FString::Printf(TEXT("%s elements"), Path), Result.Values == Items);
+		TestTrue(FString::Printf(TEXT("%s no error"), Path), Result.Error.IsEmpty());
+	}
+
+	// Array index and pointer escape as path segments
+	const FElements Nested = CollectElements(Json, TEXT("/data/items/2"));
+	TestTrue(TEXT("Nested by pointer"), Nested.Values == TArray<FString>{TEXT("0=3"), TEXT("1=4")});
+	TestTrue(TEXT("Nested by dotted path"), CollectElements(Json, TEXT("data.items.2")).Values == Nested.Values);
+	TestEqual(TEXT("Escaped pointer"), CollectElements(Json, TEXT("/x~1y")).Count, 2);
+	TestEqual(TEXT("Slash in dotted key"), CollectElements(Json, TEXT("x/y")).Count, 2);
+
+	// Root array
+	TestEqual(TEXT("Root"), CollectElements(TEXT("[[1],{},3]"), TEXT("")).Count, 3);
+
+	// Callback stops the walk, elements seen so far are counted
+	const FElements Stopped = CollectElements(Json, TEXT("data.items"), 1);
+	TestEqual(TEXT("Stopped count"), Stopped.Count, 2);
+	TestEqual(TEXT("Stopped elements"), Stopped.Values.Num(), 2);
+	TestTrue(TEXT("Stopped no error"), Stopped.Error.IsEmpty());
+
+	const TCHAR* MissingPaths[] = {TEXT("data.missing"), TEXT("/data/missing"), TEXT("/data/items/7"), TEXT("/x/y")};
+	for (const TCHAR* Path : MissingPaths)
+	{
+		const FElements Missing = CollectElements(Json, Path);
+		TestEqual(FString::Printf(TEXT("%s missing"), Path), Missing.Count, (int32)INDEX_NONE);
+		TestEqual(FString::Printf(TEXT("%s missing error"), Path), Missing.Error, FString::Printf(TEXT("Path not found: %s"), Path));
+		TestEqual(FString::Printf(TEXT("%s no callback"), Path), Missing.Values.Num(), 0);
+	}
+
+	const FElements NotArray = CollectElements(Json, TEXT("data"));
+	TestEqual(TEXT("Not an array"), NotArray.Count, (int32)INDEX_NONE);
+	TestEqual(TEXT("Not an array error"), NotArray.Error, FString(TEXT("Value at path is not an array")));
+	TestEqual(TEXT("Scalar is not an array"), CollectElements(Json, TEXT("n")).Count, (int32)INDEX_NONE);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
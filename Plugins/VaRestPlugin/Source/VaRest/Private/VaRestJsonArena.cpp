@@ -0,0 +1,67 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonArena.h"
+
+namespace
+{
+	/** Blocks grow up to this size as the document gets larger */
+	constexpr int32 MAX_BLOCK_SIZE = 1024 * 1024;
+}
+
+FVaRestJsonArena::FVaRestJsonArena(int32 InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+FVaRestJsonArena::~FVaRestJsonArena()
+{
+	Reset();
+}
+
+void* FVaRestJsonArena::AllocateSlow(SIZE_T Size, SIZE_T Alignment)
+{
+	// Oversized requests get a block of their own, current block keeps being filled
+	if (Size + Alignment > (SIZE_T)BlockSize / 4)
+	{
+		uint8* Block = (uint8*)FMemory::Malloc(Size, Alignment);
+		Blocks.Add(Block);
+		AllocatedSize += Size;
+		return Block;
+	}
+
+	uint8* Block = (uint8*)FMemory::Malloc(BlockSize);
+	Blocks.Add(Block);
+	AllocatedSize += BlockSize;
+
+	Cursor = Block;
+	BlockEnd = Block + BlockSize;
+	BlockSize = FMath::Min(BlockSize * 2, MAX_BLOCK_SIZE);
+
+	uint8* Result = Align(Cursor, Alignment);
+	Cursor = Result + Size;
+	return Result;
+}
+
+void FVaRestJsonArena::Adopt(FVaRestJsonArena& Other)
+{
+	Blocks.Append(Other.Blocks);
+	AllocatedSize += Other.AllocatedSize;
+
+	Other.Blocks.Reset();
+	Other.Cursor = nullptr;
+	Other.BlockEnd = nullptr;
+	Other.AllocatedSize = 0;
+}
+
+void FVaRestJsonArena::Reset()
+{
+	for (uint8* Block : Blocks)
+	{
+		FMemory::Free(Block);
+	}
+
+	Blocks.Reset();
+	Cursor = nullptr;
+	BlockEnd = nullptr;
+	AllocatedSize = 0;
+}
@@ -0,0 +1,70 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bump allocator for json documents.
+ *
+ * Memory is handed out from large blocks and released all at once, individual
+ * allocations are never freed and destructors are never run.
+ */
+class FVaRestJsonArena
+{
+public:
+	explicit FVaRestJsonArena(int32 InBlockSize = 64 * 1024);
+	~FVaRestJsonArena();
+
+	FVaRestJsonArena(const FVaRestJsonArena&) = delete;
+	FVaRestJsonArena& operator=(const FVaRestJsonArena&) = delete;
+
+	FORCEINLINE void* Allocate(SIZE_T Size, SIZE_T Alignment = 8)
+	{
+		uint8* Result = Align(Cursor, Alignment);
+		if (Result == nullptr || Result + Size > BlockEnd)
+		{
+			return AllocateSlow(Size, Alignment);
+		}
+
+		Cursor = Result + Size;
+		return Result;
+	}
+
+	/** Uninitialized storage for Num trivially destructible elements */
+	template <typename T>
+	FORCEINLINE T* NewArray(int32 Num)
+	{
+		static_assert(TIsTriviallyDestructible<T>::Value, "Arena never runs destructors");
+		return Num > 0 ? (T*)Allocate(sizeof(T) * Num, alignof(T)) : nullptr;
+	}
+
+	FORCEINLINE const ANSICHAR* CopyString(const ANSICHAR* String, int32 Len)
+	{
+		if (Len == 0)
+		{
+			return nullptr;
+		}
+
+		ANSICHAR* Result = (ANSICHAR*)Allocate(Len, 1);
+		FMemory::Memcpy(Result, String, Len);
+		return Result;
+	}
+
+	/** Takes over all blocks of Other, pointers into them stay valid */
+	void Adopt(FVaRestJsonArena& Other);
+
+	/** Frees all blocks */
+	void Reset();
+
+	SIZE_T GetAllocatedSize() const { return AllocatedSize; }
+
+private:
+	void* AllocateSlow(SIZE_T Size, SIZE_T Alignment);
+
+	TArray<uint8*> Blocks;
+	uint8* Cursor = nullptr;
+	uint8* BlockEnd = nullptr;
+	int32 BlockSize;
+	SIZE_T AllocatedSize = 0;
+};
@@ -0,0 +1,379 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonDocument.h"
+
+#include "VaRestJsonParser.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Builds compact nodes from parser events */
+	struct FCompactBuilder
+	{
+		FVaRestJsonArena& Arena;
+		FVaRestJsonKeyTable& Keys;
+		FVaRestJsonNode Root;
+
+		/** Values of all open containers, each with the key it was read under */
+		TArray<FVaRestJsonMember> Pending;
+
+		struct FFrame
+		{
+			int32 Start;
+			FVaRestJsonMember Header;
+		};
+
+		TArray<FFrame, TInlineAllocator<64>> Frames;
+		FVaRestJsonMember Key;
+
+		FCompactBuilder(FVaRestJsonArena& InArena, FVaRestJsonKeyTable& InKeys)
+			: Arena(InArena)
+			, Keys(InKeys)
+		{
+			Pending.Reserve(1024);
+			Key.Key = nullptr;
+		}
+
+		FORCEINLINE void Push(const FVaRestJsonNode& Node, const FVaRestJsonMember& WithKey)
+		{
+			if (Frames.Num() == 0)
+			{
+				Root = Node;
+				return;
+			}
+
+			FVaRestJsonMember& Member = Pending.Add_GetRef(WithKey);
+			Member.Value = Node;
+		}
+
+		FORCEINLINE void Push(const FVaRestJsonNode& Node)
+		{
+			Push(Node, Key);
+		}
+
+		FORCEINLINE void Open()
+		{
+			FFrame& Frame = Frames.AddDefaulted_GetRef();
+			Frame.Start = Pending.Num();
+			Frame.Header = Key;
+		}
+
+		bool OnStartObject()
+		{
+			Open();
+			return true;
+		}
+
+		bool OnEndObject()
+		{
+			const FFrame Frame = Frames.Pop(false);
+			const int32 Count = Pending.Num() - Frame.Start;
+
+			FVaRestJsonMember* Members = Arena.NewArray<FVaRestJsonMember>(Count);
+			if (Count > 0)
+			{
+				FMemory::Memcpy(Members, Pending.GetData() + Frame.Start, sizeof(FVaRestJsonMember) * Count);
+			}
+			Pending.SetNum(Frame.Start, false);
+
+			FVaRestJsonNode Node;
+			Node.Type = EVaRestJsonNodeType::Object;
+			Node.Num = (uint32)Count;
+			Node.Members = Members;
+			Push(Node, Frame.Header);
+			return true;
+		}
+
+		bool OnStartArray()
+		{
+			Open();
+			return true;
+		}
+
+		bool OnEndArray()
+		{
+			const FFrame Frame = Frames.Pop(false);
+			const int32 Count = Pending.Num() - Frame.Start;
+
+			FVaRestJsonNode* Elements = Arena.NewArray<FVaRestJsonNode>(Count);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Elements[i] = Pending[Frame.Start + i].Value;
+			}
+			Pending.SetNum(Frame.Start, false);
+
+			FVaRestJsonNode Node;
+			Node.Type = EVaRestJsonNodeType::Array;
+			Node.Num = (uint32)Count;
+			Node.Elements = Elements;
+			Push(Node, Frame.Header);
+			return true;
+		}
+
+		bool OnKey(const FVaRestJsonStringRef& String)
+		{
+			Key.Key = Keys.Intern(String);
+			return true;
+		}
+
+		bool OnString(const FVaRestJsonStringRef& String)
+		{
+			FVaRestJsonNode Node;
+			Node.Type = EVaRestJsonNodeType::String;
+			Node.bAscii = String.bAscii;
+			Node.Num = (uint32)String.Len;
+			Node.String = Arena.CopyString(String.Data, String.Len);
+			Push(Node);
+			return true;
+		}
+
+		bool OnNumber(double Value, const ANSICHAR* Text, int32 Len)
+		{
+			FVaRestJsonNode Node;
+			Node.Type = EVaRestJsonNodeType::Number;
+			Node.Number = Value;
+
+			// Same as FVaRestJsonDomBuilder, large integers are kept exact
+			if (Len > 15)
+			{
+				const ANSICHAR* Ptr = Text;
+				FVaRestJsonNumber Number;
+				if (FVaRestJsonNumber::Parse(Ptr, Text + Len, Number) && Number.NeedsInt64())
+				{
+					Node.bInteger = true;
+					Node.Integer = Number.Integer;
+				}
+			}
+
+			Push(Node);
+			return true;
+		}
+
+		bool OnBoolean(bool bValue)
+		{
+			FVaRestJsonNode Node;
+			Node.Type = EVaRestJsonNodeType::Boolean;
+			Node.bBoolean = bValue;
+			Push(Node);
+			return true;
+		}
+
+		bool OnNull()
+		{
+			Push(FVaRestJsonNode());
+			return true;
+		}
+	};
+} // namespace
+
+const FVaRestJsonNode* FVaRestJsonNode::FindField(const ANSICHAR* Key, int32 KeyLen) const
+{
+	const TArrayView<const FVaRestJsonMember> Fields = GetMembers();
+	for (int32 i = Fields.Num() - 1; i >= 0; --i)
+	{
+		if (Fields[i].Key->Len == KeyLen && FMemory::Memcmp(Fields[i].Key->Data, Key, KeyLen) == 0)
+		{
+			return &Fields[i].Value;
+		}
+	}
+	return nullptr;
+}
+
+const FVaRestJsonNode* FVaRestJsonNode::FindField(const FVaRestJsonKey* Key) const
+{
+	const TArrayView<const FVaRestJsonMember> Fields = GetMembers();
+	for (int32 i = Fields.Num() - 1; i >= 0; --i)
+	{
+		if (Fields[i].Key == Key)
+		{
+			return &Fields[i].Value;
+		}
+	}
+	return nullptr;
+}
+
+TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> FVaRestJsonDocument::Parse(const ANSICHAR* Data, int32 Size, FString* OutError)
+{
+	FVaRestJsonFastParser::SkipBOM(Data, Size);
+
+	FVaRestJsonStructuralIndex Index;
+	if (!Index.Build(Data, Size))
+	{
+		if (OutError != nullptr)
+		{
+			*OutError = Index.GetError();
+		}
+		return nullptr;
+	}
+
+	const TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> Document = MakeShared<FVaRestJsonDocument, ESPMode::ThreadSafe>();
+
+	TArray<int32> Bounds;
+	if (FVaRestJsonFastParser::SplitRootArray(Data, Size, Index, Bounds))
+	{
+		return Document->ParseRootArray(Data, Size, Index, Bounds, OutError) ? Document : nullptr;
+	}
+
+	FCompactBuilder Builder(Document->Arena, Document->Keys);
+	if (!FVaRestJsonFastParser::Walk(Data, Size, Index, Builder, OutError))
+	{
+		return nullptr;
+	}
+
+	Document->Root = Builder.Root;
+	return Document;
+}
+
+bool FVaRestJsonDocument::ParseRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, const TArray<int32>& Bounds, FString* OutError)
+{
+	const int32 NumElements = Bounds.Num() - 1;
+	const int32 NumRuns = FVaRestJsonFastParser::GetNumParallelRuns(NumElements);
+
+	TArray<TUniquePtr<FCompactRun>> Runs;
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		Runs.Add(MakeUnique<FCompactRun>());
+	}
+	volatile int32 FirstFailedRun = NumRuns;
+
+	ParallelFor(NumRuns, [&](int32 Run)
+	{
+		const int32 FirstElement = (int32)((int64)NumElements * Run / NumRuns);
+		const int32 LastElement = (int32)((int64)NumElements * (Run + 1) / NumRuns);
+
+		FCompactRun& Result = *Runs[Run];
+		Result.Elements.Reserve(LastElement - FirstElement);
+
+		FCompactBuilder Builder(Result.Arena, Result.Keys);
+		for (int32 Element = FirstElement; Element < LastElement && FPlatformAtomics::AtomicRead(&FirstFailedRun) > Run; ++Element)
+		{
+			if (!FVaRestJsonFastParser::WalkRange(Data, Size, Index, Bounds[Element], Bounds[Element + 1] - 1, Builder, &Result.Error))
+			{
+				FVaRestJsonFastParser::MarkFailedRun(FirstFailedRun, Run);
+				return;
+			}
+			Result.Elements.Add(Builder.Root);
+		}
+	});
+
+	if (FirstFailedRun < NumRuns)
+	{
+		if (OutError != nullptr)
+		{
+			*OutError = Runs[FirstFailedRun]->Error;
+		}
+		return false;
+	}
+
+	// Keys of every run are interned into the document, distinct keys are few so this is cheap
+	TArray<const FVaRestJsonKey*> RunKeys;
+	for (const TUniquePtr<FCompactRun>& Run : Runs)
+	{
+		Run->Keys.GetKeys(RunKeys);
+		Run->KeyMap.Reserve(RunKeys.Num());
+		for (const FVaRestJsonKey* Key : RunKeys)
+		{
+			FVaRestJsonStringRef String;
+			String.Data = Key->Data;
+			String.Len = Key->Len;
+			String.bAscii = Key->bAscii;
+			Run->KeyMap.Add(Key, Keys.Intern(String));
+		}
+	}
+
+	ParallelFor(NumRuns, [&](int32 Run)
+	{
+		for (const FVaRestJsonNode& Element : Runs[Run]->Elements)
+		{
+			RemapKeys(Element, Runs[Run]->KeyMap);
+		}
+	});
+
+	// Nodes stay where they were built, only element list of the root is new
+	FVaRestJsonNode* Elements = Arena.NewArray<FVaRestJsonNode>(NumElements);
+	int32 Num = 0;
+	for (const TUniquePtr<FCompactRun>& Run : Runs)
+	{
+		FMemory::Memcpy(Elements + Num, Run->Elements.GetData(), sizeof(FVaRestJsonNode) * Run->Elements.Num());
+		Num += Run->Elements.Num();
+		Arena.Adopt(Run->Arena);
+	}
+
+	Root = FVaRestJsonNode();
+	Root.Type = EVaRestJsonNodeType::Array;
+	Root.Num = (uint32)NumElements;
+	Root.Elements = Elements;
+	return true;
+}
+
+void FVaRestJsonDocument::RemapKeys(const FVaRestJsonNode& Node, const TMap<const FVaRestJsonKey*, const FVaRestJsonKey*>& KeyMap)
+{
+	if (Node.Type == EVaRestJsonNodeType::Object)
+	{
+		for (const FVaRestJsonMember& Member : Node.GetMembers())
+		{
+			// Members were built by this document, they are only const to readers
+			const_cast<FVaRestJsonMember&>(Member).Key = KeyMap.FindChecked(Member.Key);
+			RemapKeys(Member.Value, KeyMap);
+		}
+	}
+	else if (Node.Type == EVaRestJsonNodeType::Array)
+	{
+		for (const FVaRestJsonNode& Element : Node.GetElements())
+		{
+			RemapKeys(Element, KeyMap);
+		}
+	}
+}
+
+TSharedPtr<FJsonValue> FVaRestJsonDocument::ToJsonValue(const FVaRestJsonNode& Node)
+{
+	switch (Node.Type)
+	{
+	case EVaRestJsonNodeType::Boolean:
+		return MakeShared<FJsonValueBoolean>(Node.bBoolean);
+
+	case EVaRestJsonNodeType::Number:
+		if (Node.bInteger)
+		{
+			return MakeShared<FJsonValueNumberString>(LexToString(Node.Integer));
+		}
+		return MakeShared<FJsonValueNumber>(Node.Number);
+
+	case EVaRestJsonNodeType::String:
+		return MakeShared<FJsonValueString>(Node.GetStringRef().ToString());
+
+	case EVaRestJsonNodeType::Array:
+	{
+		const TSharedRef<FJsonValueNonConstArray> Array = MakeShared<FJsonValueNonConstArray>(TArray<TSharedPtr<FJsonValue>>());
+		TArray<TSharedPtr<FJsonValue>>& Values = Array->AsNonConstArray();
+		Values.Reserve(Node.Num);
+		for (const FVaRestJsonNode& Element : Node.GetElements())
+		{
+			Values.Add(ToJsonValue(Element));
+		}
+		return Array;
+	}
+
+	case EVaRestJsonNodeType::Object:
+		return MakeShared<FJsonValueObject>(ToJsonObject(Node));
+
+	default:
+		return MakeShared<FJsonValueNull>();
+	}
+}
+
+TSharedRef<FJsonObject> FVaRestJsonDocument::ToJsonObject(const FVaRestJsonNode& Node)
+{
+	const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->Values.Reserve(Node.Num);
+
+	for (const FVaRestJsonMember& Member : Node.GetMembers())
+	{
+		// Key is converted and hashed once per document
+		Object->Values.AddByHash(Member.Key->NameHash, Member.Key->ToString(), ToJsonValue(Member.Value));
+	}
+
+	return Object;
+}
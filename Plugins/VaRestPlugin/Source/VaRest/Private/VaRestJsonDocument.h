@@ -0,0 +1,139 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#include "VaRestJsonArena.h"
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonKeyTable.h"
+
+enum class EVaRestJsonNodeType : uint8
+{
+	Null,
+	Boolean,
+	Number,
+	String,
+	Array,
+	Object,
+};
+
+struct FVaRestJsonMember;
+
+/** Json value living in FVaRestJsonDocument arena (16 bytes) */
+struct FVaRestJsonNode
+{
+	EVaRestJsonNodeType Type;
+
+	/** String has no byte above 0x7f */
+	bool bAscii;
+
+	/** Number is an integer double can't hold, it is kept in Integer */
+	bool bInteger;
+
+	/** String length in bytes, number of array elements or object members */
+	uint32 Num;
+
+	union
+	{
+		double Number;
+		int64 Integer;
+		bool bBoolean;
+		const ANSICHAR* String;
+		const FVaRestJsonNode* Elements;
+		const FVaRestJsonMember* Members;
+	};
+
+	FVaRestJsonNode()
+		: Type(EVaRestJsonNodeType::Null)
+		, bAscii(true)
+		, bInteger(false)
+		, Num(0)
+		, Number(0.0)
+	{
+	}
+
+	FVaRestJsonStringRef GetStringRef() const
+	{
+		FVaRestJsonStringRef Result;
+		Result.Data = String;
+		Result.Len = (int32)Num;
+		Result.bAscii = bAscii;
+		return Result;
+	}
+
+	TArrayView<const FVaRestJsonNode> GetElements() const
+	{
+		return Type == EVaRestJsonNodeType::Array ? TArrayView<const FVaRestJsonNode>(Elements, Num) : TArrayView<const FVaRestJsonNode>();
+	}
+
+	TArrayView<const FVaRestJsonMember> GetMembers() const
+	{
+		return Type == EVaRestJsonNodeType::Object ? TArrayView<const FVaRestJsonMember>(Members, Num) : TArrayView<const FVaRestJsonMember>();
+	}
+
+	/** Object member value by utf-8 key, last one wins like in FJsonObject */
+	const FVaRestJsonNode* FindField(const ANSICHAR* Key, int32 KeyLen) const;
+
+	/** Object member value by key interned in the same document, keys are compared by pointer */
+	const FVaRestJsonNode* FindField(const FVaRestJsonKey* Key) const;
+};
+
+/** Object member, key is shared with all members of the document having the same one */
+struct FVaRestJsonMember
+{
+	const FVaRestJsonKey* Key;
+	FVaRestJsonNode Value;
+};
+
+/**
+ * Compact json DOM.
+ *
+ * Nodes, strings and child arrays of the whole document live in one arena, children of a
+ * container are stored contiguously. Building it costs a handful of large allocations,
+ * destroying it frees them in one go. Object keys are interned per document. FJsonValue
+ * tree is built on request only.
+ */
+class FVaRestJsonDocument
+{
+public:
+	/** Parses utf-8 text, nullptr on error */
+	static TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> Parse(const ANSICHAR* Data, int32 Size, FString* OutError = nullptr);
+
+	const FVaRestJsonNode& GetRoot() const { return Root; }
+
+	/** Interned key for FVaRestJsonNode::FindField, nullptr if no object has it */
+	const FVaRestJsonKey* FindKey(const ANSICHAR* Key, int32 KeyLen) const { return Keys.Find(Key, KeyLen); }
+
+	TSharedPtr<FJsonValue> ToJsonValue() const { return ToJsonValue(Root); }
+
+	static TSharedPtr<FJsonValue> ToJsonValue(const FVaRestJsonNode& Node);
+
+	/** Node has to be an object */
+	static TSharedRef<FJsonObject> ToJsonObject(const FVaRestJsonNode& Node);
+
+	SIZE_T GetAllocatedSize() const { return Arena.GetAllocatedSize() + Keys.GetAllocatedSize(); }
+
+private:
+	/** Elements of root array built on one worker thread */
+	struct FCompactRun
+	{
+		FVaRestJsonArena Arena;
+		FVaRestJsonKeyTable Keys;
+		TArray<FVaRestJsonNode> Elements;
+		TMap<const FVaRestJsonKey*, const FVaRestJsonKey*> KeyMap;
+		FString Error;
+	};
+
+	/** Builds root array in parallel from elements found by FVaRestJsonFastParser::SplitRootArray */
+	bool ParseRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, const TArray<int32>& Bounds, FString* OutError);
+
+	/** Points members to keys of this document */
+	static void RemapKeys(const FVaRestJsonNode& Node, const TMap<const FVaRestJsonKey*, const FVaRestJsonKey*>& KeyMap);
+
+	FVaRestJsonArena Arena;
+	FVaRestJsonKeyTable Keys;
+	FVaRestJsonNode Root;
+};
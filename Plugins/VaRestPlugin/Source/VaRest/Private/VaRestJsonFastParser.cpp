@@ -0,0 +1,1153 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonFastParser.h"
+
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define VAREST_JSON_NEON 1
+	#define VAREST_JSON_SSE 0
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+	#define VAREST_JSON_NEON 0
+	#define VAREST_JSON_SSE 1
+#else
+	#define VAREST_JSON_NEON 0
+	#define VAREST_JSON_SSE 0
+#endif
+
+namespace
+{
+	constexpr uint64 ODD_BITS = 0xAAAAAAAAAAAAAAAAull;
+
+	struct FBlockMasks
+	{
+		uint64 Quote;
+		uint64 Backslash;
+		uint64 Op;
+		uint64 Space;
+		uint64 High;
+	};
+
+#if VAREST_JSON_SSE
+	FORCEINLINE uint64 MoveMask(__m128i V0, __m128i V1, __m128i V2, __m128i V3)
+	{
+		return (uint64)(uint32)_mm_movemask_epi8(V0)
+			| ((uint64)(uint32)_mm_movemask_epi8(V1) << 16)
+			| ((uint64)(uint32)_mm_movemask_epi8(V2) << 32)
+			| ((uint64)(uint32)_mm_movemask_epi8(V3) << 48);
+	}
+
+	FORCEINLINE uint64 Equal(const __m128i* V, __m128i Char)
+	{
+		return MoveMask(_mm_cmpeq_epi8(V[0], Char), _mm_cmpeq_epi8(V[1], Char), _mm_cmpeq_epi8(V[2], Char), _mm_cmpeq_epi8(V[3], Char));
+	}
+
+	FORCEINLINE void Classify(const uint8* Block, FBlockMasks& Out)
+	{
+		__m128i V[4];
+		__m128i Lower[4];
+		for (int32 i = 0; i < 4; ++i)
+		{
+			V[i] = _mm_loadu_si128((const __m128i*)(Block + i * 16));
+			// '[' and ']' differ from '{' and '}' by the 0x20 bit only
+			Lower[i] = _mm_or_si128(V[i], _mm_set1_epi8(0x20));
+		}
+
+		Out.Quote = Equal(V, _mm_set1_epi8('"'));
+		Out.Backslash = Equal(V, _mm_set1_epi8('\\'));
+		Out.Op = Equal(Lower, _mm_set1_epi8('{')) | Equal(Lower, _mm_set1_epi8('}')) | Equal(V, _mm_set1_epi8(':')) | Equal(V, _mm_set1_epi8(','));
+		Out.Space = Equal(V, _mm_set1_epi8(' ')) | Equal(V, _mm_set1_epi8('\n')) | Equal(V, _mm_set1_epi8('\r')) | Equal(V, _mm_set1_epi8('\t'));
+		Out.High = MoveMask(V[0], V[1], V[2], V[3]);
+	}
+#elif VAREST_JSON_NEON
+	FORCEINLINE uint64 MoveMask(uint8x16_t V0, uint8x16_t V1, uint8x16_t V2, uint8x16_t V3)
+	{
+		const uint8x16_t Bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+		uint8x16_t Sum0 = vpaddq_u8(vandq_u8(V0, Bits), vandq_u8(V1, Bits));
+		const uint8x16_t Sum1 = vpaddq_u8(vandq_u8(V2, Bits), vandq_u8(V3, Bits));
+		Sum0 = vpaddq_u8(Sum0, Sum1);
+		Sum0 = vpaddq_u8(Sum0, Sum0);
+		return vgetq_lane_u64(vreinterpretq_u64_u8(Sum0), 0);
+	}
+
+	FORCEINLINE uint64 Equal(const uint8x16_t* V, uint8x16_t Char)
+	{
+		return MoveMask(vceqq_u8(V[0], Char), vceqq_u8(V[1], Char), vceqq_u8(V[2], Char), vceqq_u8(V[3], Char));
+	}
+
+	FORCEINLINE void Classify(const uint8* Block, FBlockMasks& Out)
+	{
+		uint8x16_t V[4];
+		uint8x16_t Lower[4];
+		for (int32 i = 0; i < 4; ++i)
+		{
+			V[i] = vld1q_u8(Block + i * 16);
+			// '[' and ']' differ from '{' and '}' by the 0x20 bit only
+			Lower[i] = vorrq_u8(V[i], vdupq_n_u8(0x20));
+		}
+
+		Out.Quote = Equal(V, vdupq_n_u8('"'));
+		Out.Backslash = Equal(V, vdupq_n_u8('\\'));
+		Out.Op = Equal(Lower, vdupq_n_u8('{')) | Equal(Lower, vdupq_n_u8('}')) | Equal(V, vdupq_n_u8(':')) | Equal(V, vdupq_n_u8(','));
+		Out.Space = Equal(V, vdupq_n_u8(' ')) | Equal(V, vdupq_n_u8('\n')) | Equal(V, vdupq_n_u8('\r')) | Equal(V, vdupq_n_u8('\t'));
+		const uint8x16_t High = vdupq_n_u8(0x80);
+		Out.High = MoveMask(vcgeq_u8(V[0], High), vcgeq_u8(V[1], High), vcgeq_u8(V[2], High), vcgeq_u8(V[3], High));
+	}
+#else
+	FORCEINLINE void Classify(const uint8* Block, FBlockMasks& Out)
+	{
+		Out = FBlockMasks{0, 0, 0, 0, 0};
+		for (int32 i = 0; i < 64; ++i)
+		{
+			const uint64 Bit = 1ull << i;
+			switch (Block[i])
+			{
+			case '"': Out.Quote |= Bit; break;
+			case '\\': Out.Backslash |= Bit; break;
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case ':':
+			case ',': Out.Op |= Bit; break;
+			case ' ':
+			case '\n':
+			case '\r':
+			case '\t': Out.Space |= Bit; break;
+			default: Out.High |= Block[i] >= 0x80 ? Bit : 0; break;
+			}
+		}
+	}
+#endif
+
+	/**
+	 * Utf-8 check carried across blocks, ascii blocks are skipped by their high byte mask.
+	 * Overlong forms, surrogates and code points above U+10FFFF are rejected by the allowed
+	 * range of the second byte.
+	 */
+	struct FUtf8Validator
+	{
+		int32 Pending = 0;
+		uint8 Min = 0x80;
+		uint8 Max = 0xBF;
+
+		/** Returns offset of first invalid byte in Block, INDEX_NONE if there is none */
+		int32 Validate(const uint8* Block, int32 Num)
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				const uint8 Char = Block[i];
+				if (Pending > 0)
+				{
+					if (Char < Min || Char > Max)
+					{
+						return i;
+					}
+					Min = 0x80;
+					Max = 0xBF;
+					--Pending;
+				}
+				else if (Char >= 0x80)
+				{
+					if (Char >= 0xC2 && Char <= 0xDF)
+					{
+						Pending = 1;
+					}
+					else if (Char >= 0xE0 && Char <= 0xEF)
+					{
+						Pending = 2;
+						Min = Char == 0xE0 ? 0xA0 : 0x80;
+						Max = Char == 0xED ? 0x9F : 0xBF;
+					}
+					else if (Char >= 0xF0 && Char <= 0xF4)
+					{
+						Pending = 3;
+						Min = Char == 0xF0 ? 0x90 : 0x80;
+						Max = Char == 0xF4 ? 0x8F : 0xBF;
+					}
+					else
+					{
+						return i;
+					}
+				}
+			}
+			return INDEX_NONE;
+		}
+	};
+
+	/** Marks characters preceded by an odd run of backslashes */
+	FORCEINLINE uint64 FindEscaped(uint64 Backslash, uint64& NextIsEscaped)
+	{
+		if (Backslash == 0)
+		{
+			const uint64 Escaped = NextIsEscaped;
+			NextIsEscaped = 0;
+			return Escaped;
+		}
+
+		// Subtracting a run of backslashes from the odd bit pattern flips the bit after the run
+		// exactly when the run starts on an even position and has odd length (and vice versa)
+		const uint64 PotentialEscape = Backslash & ~NextIsEscaped;
+		const uint64 MaybeEscaped = PotentialEscape << 1;
+		const uint64 EscapeAndTerminal = ((MaybeEscaped | ODD_BITS) - PotentialEscape) ^ ODD_BITS;
+		const uint64 Escaped = EscapeAndTerminal ^ (Backslash | NextIsEscaped);
+		const uint64 Escape = EscapeAndTerminal & Backslash;
+		NextIsEscaped = Escape >> 63;
+		return Escaped;
+	}
+
+	/** Each bit becomes xor of itself and all lower bits: set between opening and closing quote */
+	FORCEINLINE uint64 PrefixXor(uint64 Bits)
+	{
+		Bits ^= Bits << 1;
+		Bits ^= Bits << 2;
+		Bits ^= Bits << 4;
+		Bits ^= Bits << 8;
+		Bits ^= Bits << 16;
+		Bits ^= Bits << 32;
+		return Bits;
+	}
+
+	FORCEINLINE void Flatten(TArray<uint32>& Positions, uint32 Base, uint64 Bits)
+	{
+		if (Bits == 0)
+		{
+			return;
+		}
+
+		const int32 Count = FPlatformMath::CountBits(Bits);
+		const int32 Start = Positions.AddUninitialized(Count);
+		uint32* Out = Positions.GetData() + Start;
+		while (Bits != 0)
+		{
+			*Out++ = Base + (uint32)FPlatformMath::CountTrailingZeros64(Bits);
+			Bits &= Bits - 1;
+		}
+	}
+
+	/** Returns first quote, backslash or control character */
+	FORCEINLINE const uint8* ScanStringRun(const uint8* Ptr, const uint8* End, bool& bAscii)
+	{
+#if VAREST_JSON_SSE
+		const __m128i Quote = _mm_set1_epi8('"');
+		const __m128i Backslash = _mm_set1_epi8('\\');
+		const __m128i Control = _mm_set1_epi8(0x1f);
+		while (Ptr + 16 <= End)
+		{
+			const __m128i V = _mm_loadu_si128((const __m128i*)Ptr);
+			const __m128i Special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(V, Quote), _mm_cmpeq_epi8(V, Backslash)), _mm_cmpeq_epi8(_mm_max_epu8(V, Control), Control));
+			const uint32 SpecialMask = (uint32)_mm_movemask_epi8(Special);
+			const uint32 HighMask = (uint32)_mm_movemask_epi8(V);
+			if (SpecialMask != 0)
+			{
+				const uint32 First = FPlatformMath::CountTrailingZeros(SpecialMask);
+				bAscii &= (HighMask & ((1u << First) - 1)) == 0;
+				return Ptr + First;
+			}
+			bAscii &= HighMask == 0;
+			Ptr += 16;
+		}
+#elif VAREST_JSON_NEON
+		const uint8x16_t Quote = vdupq_n_u8('"');
+		const uint8x16_t Backslash = vdupq_n_u8('\\');
+		const uint8x16_t Space = vdupq_n_u8(0x20);
+		while (Ptr + 16 <= End)
+		{
+			const uint8x16_t V = vld1q_u8(Ptr);
+			const uint8x16_t Special = vorrq_u8(vorrq_u8(vceqq_u8(V, Quote), vceqq_u8(V, Backslash)), vcltq_u8(V, Space));
+			if (vmaxvq_u8(Special) != 0)
+			{
+				break;
+			}
+			bAscii &= vmaxvq_u8(V) < 0x80;
+			Ptr += 16;
+		}
+#endif
+		while (Ptr < End)
+		{
+			const uint8 Char = *Ptr;
+			if (Char == '"' || Char == '\\' || Char < 0x20)
+			{
+				return Ptr;
+			}
+			bAscii &= Char < 0x80;
+			++Ptr;
+		}
+		return End;
+	}
+
+	FORCEINLINE int32 HexDigit(ANSICHAR Char)
+	{
+		if (Char >= '0' && Char <= '9')
+		{
+			return Char - '0';
+		}
+		if (Char >= 'a' && Char <= 'f')
+		{
+			return Char - 'a' + 10;
+		}
+		if (Char >= 'A' && Char <= 'F')
+		{
+			return Char - 'A' + 10;
+		}
+		return -1;
+	}
+
+	FORCEINLINE bool ReadHex4(const ANSICHAR* Ptr, const ANSICHAR* End, uint32& OutCode)
+	{
+		if (End - Ptr < 4)
+		{
+			return false;
+		}
+
+		OutCode = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const int32 Digit = HexDigit(Ptr[i]);
+			if (Digit < 0)
+			{
+				return false;
+			}
+			OutCode = (OutCode << 4) | (uint32)Digit;
+		}
+		return true;
+	}
+
+	FORCEINLINE void AppendUtf8(TArray<ANSICHAR>& Out, uint32 Codepoint)
+	{
+		if (Codepoint < 0x80)
+		{
+			Out.Add((ANSICHAR)Codepoint);
+		}
+		else if (Codepoint < 0x800)
+		{
+			Out.Add((ANSICHAR)(0xC0 | (Codepoint >> 6)));
+			Out.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+		else if (Codepoint < 0x10000)
+		{
+			Out.Add((ANSICHAR)(0xE0 | (Codepoint >> 12)));
+			Out.Add((ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add((ANSICHAR)(0xF0 | (Codepoint >> 18)));
+			Out.Add((ANSICHAR)(0x80 | ((Codepoint >> 12) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Out.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+	}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Stage 1
+
+bool FVaRestJsonStructuralIndex::Build(const ANSICHAR* Data, int32 Size)
+{
+	Positions.Reset();
+	Positions.Reserve(Size / 6 + 64);
+	Error = nullptr;
+	ErrorOffset = 0;
+
+	FUtf8Validator Utf8;
+	uint64 NextIsEscaped = 0;
+	uint64 PrevInString = 0;
+	uint64 PrevScalar = 0;
+
+	FBlockMasks Masks;
+	uint8 Tail[64];
+
+	for (int32 Base = 0; Base < Size; Base += 64)
+	{
+		const uint8* Block = (const uint8*)Data + Base;
+		if (Size - Base < 64)
+		{
+			// Pad last block with spaces, they never produce structurals
+			FMemory::Memset(Tail, ' ', sizeof(Tail));
+			FMemory::Memcpy(Tail, Block, Size - Base);
+			Block = Tail;
+		}
+
+		Classify(Block, Masks);
+
+		if (Masks.High != 0 || Utf8.Pending != 0)
+		{
+			const int32 Invalid = Utf8.Validate(Block, FMath::Min(Size - Base, 64));
+			if (Invalid != INDEX_NONE)
+			{
+				Error = TEXT("Invalid utf-8");
+				ErrorOffset = Base + Invalid;
+				return false;
+			}
+		}
+
+		const uint64 Escaped = FindEscaped(Masks.Backslash, NextIsEscaped);
+		const uint64 Quote = Masks.Quote & ~Escaped;
+
+		// Opening quote is inside, closing one is outside of the string
+		const uint64 InString = PrefixXor(Quote) ^ PrevInString;
+		PrevInString = (uint64)((int64)InString >> 63);
+
+		// Scalar starts are non-operator, non-space characters following an operator or space
+		const uint64 NonQuoteScalar = ~(Masks.Op | Masks.Space | Quote);
+		const uint64 FollowsScalar = (NonQuoteScalar << 1) | PrevScalar;
+		PrevScalar = NonQuoteScalar >> 63;
+		const uint64 ScalarStart = NonQuoteScalar & ~FollowsScalar;
+
+		const uint64 Structurals = ((Masks.Op | ScalarStart) & ~InString) | (Quote & InString);
+		Flatten(Positions, (uint32)Base, Structurals);
+	}
+
+	Positions.Add((uint32)Size);
+
+	if (Utf8.Pending != 0)
+	{
+		Error = TEXT("Invalid utf-8");
+		ErrorOffset = Size;
+		return false;
+	}
+	if (PrevInString != 0)
+	{
+		Error = TEXT("Unterminated string");
+		ErrorOffset = Size;
+		return false;
+	}
+	return true;
+}
+
+FString FVaRestJsonStructuralIndex::GetError() const
+{
+	return FString::Printf(TEXT("%s at offset %d"), Error, ErrorOffset);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Stage 2
+
+FString FVaRestJsonStringRef::ToString() const
+{
+	FString Result;
+	ToString(Result);
+	return Result;
+}
+
+void FVaRestJsonStringRef::ToString(FString& Out) const
+{
+	TArray<TCHAR>& Chars = Out.GetCharArray();
+	Chars.Reset();
+
+	if (Len == 0)
+	{
+		return;
+	}
+
+	if (bAscii)
+	{
+		Chars.SetNumUninitialized(Len + 1, false);
+
+		TCHAR* Dest = Chars.GetData();
+		for (int32 i = 0; i < Len; ++i)
+		{
+			Dest[i] = (TCHAR)Data[i];
+		}
+		Dest[Len] = TEXT('\0');
+		return;
+	}
+
+	const FUTF8ToTCHAR Converted(Data, Len);
+	Chars.SetNumUninitialized(Converted.Length() + 1, false);
+	FMemory::Memcpy(Chars.GetData(), Converted.Get(), Converted.Length() * sizeof(TCHAR));
+	Chars[Converted.Length()] = TEXT('\0');
+}
+
+TSharedPtr<FJsonValue> FVaRestJsonFastParser::Parse(const ANSICHAR* Data, int32 Size, FString* OutError)
+{
+	SkipBOM(Data, Size);
+
+	FVaRestJsonStructuralIndex Index;
+	if (!Index.Build(Data, Size))
+	{
+		SetError(OutError, Index.Error, Index.ErrorOffset);
+		return nullptr;
+	}
+
+	TArray<int32> Bounds;
+	if (SplitRootArray(Data, Size, Index, Bounds))
+	{
+		return ParseRootArray(Data, Size, Index, Bounds, OutError);
+	}
+
+	FVaRestJsonDomBuilder Builder;
+	if (!Walk(Data, Size, Index, Builder, OutError))
+	{
+		return nullptr;
+	}
+
+	return Builder.Root;
+}
+
+void FVaRestJsonFastParser::SkipBOM(const ANSICHAR*& Data, int32& Size)
+{
+	if (Size >= 3 && (uint8)Data[0] == 0xEF && (uint8)Data[1] == 0xBB && (uint8)Data[2] == 0xBF)
+	{
+		Data += 3;
+		Size -= 3;
+	}
+}
+
+bool FVaRestJsonFastParser::DecodeString(const ANSICHAR*& Ptr, const ANSICHAR* End, TArray<ANSICHAR>& Scratch, FVaRestJsonStringRef& OutString)
+{
+	const ANSICHAR* Start = Ptr + 1;
+	bool bAscii = true;
+
+	// Common case: no escapes, string is referenced in place
+	const ANSICHAR* Run = (const ANSICHAR*)ScanStringRun((const uint8*)Start, (const uint8*)End, bAscii);
+	if (Run < End && *Run == '"')
+	{
+		OutString.Data = Start;
+		OutString.Len = (int32)(Run - Start);
+		OutString.bAscii = bAscii;
+		Ptr = Run + 1;
+		return true;
+	}
+
+	Scratch.Reset();
+	Scratch.Append(Start, (int32)(Run - Start));
+
+	while (Run < End)
+	{
+		const ANSICHAR Char = *Run;
+		if (Char == '"')
+		{
+			OutString.Data = Scratch.GetData();
+			OutString.Len = Scratch.Num();
+			OutString.bAscii = bAscii;
+			Ptr = Run + 1;
+			return true;
+		}
+
+		if (Char != '\\' || Run + 1 >= End)
+		{
+			// Raw control characters are not allowed in json strings
+			return false;
+		}
+
+		const ANSICHAR Escape = Run[1];
+		Run += 2;
+		switch (Escape)
+		{
+		case '"': Scratch.Add('"'); break;
+		case '\\': Scratch.Add('\\'); break;
+		case '/': Scratch.Add('/'); break;
+		case 'b': Scratch.Add('\b'); break;
+		case 'f': Scratch.Add('\f'); break;
+		case 'n': Scratch.Add('\n'); break;
+		case 'r': Scratch.Add('\r'); break;
+		case 't': Scratch.Add('\t'); break;
+		case 'u':
+		{
+			uint32 Codepoint = 0;
+			if (!ReadHex4(Run, End, Codepoint))
+			{
+				return false;
+			}
+			Run += 4;
+
+			if (StringConv::IsHighSurrogate(Codepoint))
+			{
+				uint32 Low = 0;
+				if (End - Run >= 6 && Run[0] == '\\' && Run[1] == 'u' && ReadHex4(Run + 2, End, Low) && StringConv::IsLowSurrogate(Low))
+				{
+					Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (Low - 0xDC00);
+					Run += 6;
+				}
+				else
+				{
+					Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+				}
+			}
+			else if (StringConv::IsLowSurrogate(Codepoint))
+			{
+				Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+			}
+
+			bAscii &= Codepoint < 0x80;
+			AppendUtf8(Scratch, Codepoint);
+			break;
+		}
+		default:
+			return false;
+		}
+
+		const ANSICHAR* RunStart = Run;
+		Run = (const ANSICHAR*)ScanStringRun((const uint8*)Run, (const uint8*)End, bAscii);
+		Scratch.Append(RunStart, (int32)(Run - RunStart));
+	}
+
+	return false;
+}
+
+bool FVaRestJsonFastParser::ParseNumber(const ANSICHAR*& Ptr, const ANSICHAR* End, double& OutValue)
+{
+	FVaRestJsonNumber Number;
+	if (!FVaRestJsonNumber::Parse(Ptr, End, Number))
+	{
+		return false;
+	}
+
+	OutValue = Number.Value;
+	return true;
+}
+
+bool FVaRestJsonFastParser::ParseLiteral(const ANSICHAR*& Ptr, const ANSICHAR* End, const ANSICHAR* Literal, int32 LiteralLen)
+{
+	if (End - Ptr < LiteralLen || FCStringAnsi::Strncmp(Ptr, Literal, LiteralLen) != 0)
+	{
+		return false;
+	}
+
+	Ptr += LiteralLen;
+	return true;
+}
+
+void FVaRestJsonFastParser::SetError(FString* OutError, const TCHAR* Reason, int32 Offset)
+{
+	if (OutError != nullptr)
+	{
+		*OutError = FString::Printf(TEXT("%s at offset %d"), Reason, Offset);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Parallel parsing
+
+namespace
+{
+	/** Smaller documents are parsed on the calling thread */
+	constexpr int32 PARALLEL_MIN_SIZE = 512 * 1024;
+
+	/** Fewer elements are not worth a task */
+	constexpr int32 PARALLEL_MIN_ELEMENTS = 16;
+} // namespace
+
+bool FVaRestJsonFastParser::SplitRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, TArray<int32>& OutBounds)
+{
+	const int32 NumPositions = Index.Num();
+	if (Size < PARALLEL_MIN_SIZE || NumPositions < 3 || !FApp::ShouldUseThreadingForPerformance())
+	{
+		return false;
+	}
+
+	const uint32* Positions = Index.Positions.GetData();
+	if (Data[Positions[0]] != '[' || Data[Positions[NumPositions - 1]] != ']')
+	{
+		return false;
+	}
+
+	// Strings are a single structural, so only brackets change depth
+	OutBounds.Reset();
+	OutBounds.Add(1);
+
+	int32 Depth = 0;
+	for (int32 i = 1; i < NumPositions - 1; ++i)
+	{
+		switch (Data[Positions[i]])
+		{
+		case '{':
+		case '[':
+			++Depth;
+			break;
+
+		case '}':
+		case ']':
+			if (--Depth < 0)
+			{
+				return false;
+			}
+			break;
+
+		case ',':
+			if (Depth == 0)
+			{
+				OutBounds.Add(i + 1);
+			}
+			break;
+		}
+	}
+
+	OutBounds.Add(NumPositions);
+	return Depth == 0 && OutBounds.Num() - 1 >= PARALLEL_MIN_ELEMENTS * 2;
+}
+
+int32 FVaRestJsonFastParser::GetNumParallelRuns(int32 NumElements)
+{
+	// A few runs per core keep workers busy when elements differ in size
+	return FMath::Clamp(NumElements / PARALLEL_MIN_ELEMENTS, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4);
+}
+
+void FVaRestJsonFastParser::MarkFailedRun(volatile int32& FirstFailedRun, int32 Run)
+{
+	int32 Current = FPlatformAtomics::AtomicRead(&FirstFailedRun);
+	while (Run < Current)
+	{
+		const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&FirstFailedRun, Run, Current);
+		if (Previous == Current)
+		{
+			break;
+		}
+		Current = Previous;
+	}
+}
+
+TSharedPtr<FJsonValue> FVaRestJsonFastParser::ParseRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, const TArray<int32>& Bounds, FString* OutError)
+{
+	const int32 NumElements = Bounds.Num() - 1;
+	const int32 NumRuns = GetNumParallelRuns(NumElements);
+
+	TArray<TArray<TSharedPtr<FJsonValue>>> Runs;
+	TArray<FString> Errors;
+	Runs.SetNum(NumRuns);
+	Errors.SetNum(NumRuns);
+	volatile int32 FirstFailedRun = NumRuns;
+
+	ParallelFor(NumRuns, [&](int32 Run)
+	{
+		const int32 FirstElement = (int32)((int64)NumElements * Run / NumRuns);
+		const int32 LastElement = (int32)((int64)NumElements * (Run + 1) / NumRuns);
+
+		TArray<TSharedPtr<FJsonValue>>& Values = Runs[Run];
+		Values.Reserve(LastElement - FirstElement);
+
+		FVaRestJsonDomBuilder Builder;
+		for (int32 Element = FirstElement; Element < LastElement && FPlatformAtomics::AtomicRead(&FirstFailedRun) > Run; ++Element)
+		{
+			Builder.Reset();
+			if (!WalkRange(Data, Size, Index, Bounds[Element], Bounds[Element + 1] - 1, Builder, &Errors[Run]))
+			{
+				MarkFailedRun(FirstFailedRun, Run);
+				return;
+			}
+			Values.Add(MoveTemp(Builder.Root));
+		}
+	});
+
+	if (FirstFailedRun < NumRuns)
+	{
+		if (OutError != nullptr)
+		{
+			*OutError = Errors[FirstFailedRun];
+		}
+		return nullptr;
+	}
+
+	// Runs are stitched in order
+	const TSharedRef<FJsonValueNonConstArray> Array = MakeShared<FJsonValueNonConstArray>(TArray<TSharedPtr<FJsonValue>>());
+	TArray<TSharedPtr<FJsonValue>>& Values = Array->AsNonConstArray();
+	Values.Reserve(NumElements);
+	for (TArray<TSharedPtr<FJsonValue>>& Run : Runs)
+	{
+		Values.Append(MoveTemp(Run));
+	}
+
+	return Array;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Array streaming
+
+namespace
+{
+	/** Walk handler following path segments and building elements of the array found there one at a time */
+	struct FArrayElementHandler
+	{
+		/** Cursor at every path segment, indexed by depth */
+		const TArray<FVaRestJsonPathCursor>& Segments;
+		TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> Callback;
+
+		struct FFrame
+		{
+			bool bObject;
+
+			/** Container is the value at first Depth path segments */
+			bool bOnPath;
+
+			/** Number of array elements seen */
+			int32 Index;
+		};
+
+		enum class EPlace : uint8
+		{
+			Skip,
+			OnPath,
+			Target,
+			Element,
+		};
+
+		TArray<FFrame, TInlineAllocator<64>> Stack;
+		bool bKeyOnPath = false;
+
+		FVaRestJsonDomBuilder Element;
+		int32 ElementIndex = 0;
+
+		/** Open containers of current element */
+		int32 ElementDepth = 0;
+
+		int32 Count = 0;
+		bool bFound = false;
+		bool bFinished = false;
+		const TCHAR* Error = nullptr;
+
+		FArrayElementHandler(const TArray<FVaRestJsonPathCursor>& InSegments, TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> InCallback)
+			: Segments(InSegments)
+			, Callback(InCallback)
+		{
+		}
+
+		/** Where the value starting now belongs to */
+		EPlace Locate()
+		{
+			if (Stack.Num() == 0)
+			{
+				return Segments.Num() == 0 ? EPlace::Target : EPlace::OnPath;
+			}
+
+			FFrame& Top = Stack.Last();
+			const int32 Index = Top.bObject ? 0 : Top.Index++;
+			if (!Top.bOnPath)
+			{
+				return EPlace::Skip;
+			}
+
+			const int32 Depth = Stack.Num() - 1;
+			if (Depth == Segments.Num())
+			{
+				ElementIndex = Index;
+				return EPlace::Element;
+			}
+
+			const bool bMatch = Top.bObject ? bKeyOnPath : Index == Segments[Depth].GetIndex();
+			if (!bMatch)
+			{
+				return EPlace::Skip;
+			}
+
+			return Depth + 1 == Segments.Num() ? EPlace::Target : EPlace::OnPath;
+		}
+
+		bool Emit()
+		{
+			++Count;
+			if (!Callback(ElementIndex, Element.Root))
+			{
+				bFinished = true;
+				return false;
+			}
+
+			Element.Reset();
+			return true;
+		}
+
+		bool StartContainer(bool bObject)
+		{
+			if (ElementDepth > 0)
+			{
+				++ElementDepth;
+				return bObject ? Element.OnStartObject() : Element.OnStartArray();
+			}
+
+			switch (Locate())
+			{
+			case EPlace::Element:
+				ElementDepth = 1;
+				return bObject ? Element.OnStartObject() : Element.OnStartArray();
+
+			case EPlace::Target:
+				if (bObject)
+				{
+					Error = TEXT("Value at path is not an array");
+					return false;
+				}
+				bFound = true;
+				Stack.Add(FFrame{bObject, true, 0});
+				return true;
+
+			case EPlace::OnPath:
+				Stack.Add(FFrame{bObject, true, 0});
+				return true;
+
+			default:
+				Stack.Add(FFrame{bObject, false, 0});
+				return true;
+			}
+		}
+
+		bool EndContainer(bool bObject)
+		{
+			if (ElementDepth > 0)
+			{
+				if (!(bObject ? Element.OnEndObject() : Element.OnEndArray()))
+				{
+					return false;
+				}
+				return --ElementDepth > 0 || Emit();
+			}
+
+			const FFrame Frame = Stack.Pop(false);
+			if (Frame.bOnPath && Stack.Num() == Segments.Num())
+			{
+				// Target array is closed, rest of the text is of no interest
+				bFinished = true;
+				return false;
+			}
+			return true;
+		}
+
+		template <typename BuildType>
+		FORCEINLINE bool Scalar(BuildType&& Build)
+		{
+			if (ElementDepth > 0)
+			{
+				return Build();
+			}
+
+			switch (Locate())
+			{
+			case EPlace::Element:
+				return Build() && Emit();
+
+			case EPlace::Target:
+				Error = TEXT("Value at path is not an array");
+				return false;
+
+			default:
+				return true;
+			}
+		}
+
+		bool OnStartObject()
+		{
+			return StartContainer(true);
+		}
+
+		bool OnEndObject()
+		{
+			return EndContainer(true);
+		}
+
+		bool OnStartArray()
+		{
+			return StartContainer(false);
+		}
+
+		bool OnEndArray()
+		{
+			return EndContainer(false);
+		}
+
+		bool OnKey(const FVaRestJsonStringRef& String)
+		{
+			if (ElementDepth > 0)
+			{
+				return Element.OnKey(String);
+			}
+
+			const int32 Depth = Stack.Num() - 1;
+			bKeyOnPath = false;
+			if (Stack.Last().bOnPath && Depth < Segments.Num())
+			{
+				bKeyOnPath = Segments[Depth].MatchesKey(String.Data, String.Len);
+			}
+			return true;
+		}
+
+		bool OnString(const FVaRestJsonStringRef& String)
+		{
+			return Scalar([&]() { return Element.OnString(String); });
+		}
+
+		bool OnNumber(double Value, const ANSICHAR* Text, int32 Len)
+		{
+			return Scalar([&]() { return Element.OnNumber(Value, Text, Len); });
+		}
+
+		bool OnBoolean(bool bValue)
+		{
+			return Scalar([&]() { return Element.OnBoolean(bValue); });
+		}
+
+		bool OnNull()
+		{
+			return Scalar([&]() { return Element.OnNull(); });
+		}
+	};
+} // namespace
+
+FVaRestJsonPathCursor::FVaRestJsonPathCursor(const FString& InPath)
+	: Path(*InPath)
+	, PathLen(InPath.Len())
+	, bPointer(InPath.Len() > 0 && InPath[0] == TEXT('/'))
+	, bDone(InPath.IsEmpty())
+{
+	NextStart = bPointer ? 1 : 0;
+}
+
+bool FVaRestJsonPathCursor::Next()
+{
+	if (bPointer)
+	{
+		// Empty keys are valid in json pointer, every slash starts a segment
+		if (bDone)
+		{
+			return false;
+		}
+
+		SegmentStart = NextStart;
+		SegmentEnd = SegmentStart;
+		while (SegmentEnd < PathLen && Path[SegmentEnd] != TEXT('/'))
+		{
+			++SegmentEnd;
+		}
+
+		bDone = SegmentEnd == PathLen;
+		NextStart = SegmentEnd + 1;
+		return true;
+	}
+
+	while (NextStart < PathLen && Path[NextStart] == TEXT('.'))
+	{
+		++NextStart;
+	}
+
+	if (NextStart >= PathLen)
+	{
+		return false;
+	}
+
+	SegmentStart = NextStart;
+	SegmentEnd = SegmentStart;
+	while (SegmentEnd < PathLen && Path[SegmentEnd] != TEXT('.'))
+	{
+		++SegmentEnd;
+	}
+
+	NextStart = SegmentEnd;
+	return true;
+}
+
+bool FVaRestJsonPathCursor::MatchesKey(const ANSICHAR* Key, int32 Len) const
+{
+	int32 KeyPos = 0;
+	for (int32 i = SegmentStart; i < SegmentEnd; ++i)
+	{
+		uint32 Codepoint = (uint32)Path[i];
+		if (bPointer && Codepoint == '~' && i + 1 < SegmentEnd && (Path[i + 1] == TEXT('0') || Path[i + 1] == TEXT('1')))
+		{
+			Codepoint = Path[++i] == TEXT('0') ? '~' : '/';
+		}
+		else if (StringConv::IsHighSurrogate(Codepoint) && i + 1 < SegmentEnd && StringConv::IsLowSurrogate((uint32)Path[i + 1]))
+		{
+			Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + ((uint32)Path[++i] - 0xDC00);
+		}
+
+		// Key is compared as utf-8 right away, nothing is converted up front
+		ANSICHAR Encoded[4];
+		int32 EncodedLen;
+		if (Codepoint < 0x80)
+		{
+			Encoded[0] = (ANSICHAR)Codepoint;
+			EncodedLen = 1;
+		}
+		else if (Codepoint < 0x800)
+		{
+			Encoded[0] = (ANSICHAR)(0xC0 | (Codepoint >> 6));
+			Encoded[1] = (ANSICHAR)(0x80 | (Codepoint & 0x3F));
+			EncodedLen = 2;
+		}
+		else if (Codepoint < 0x10000)
+		{
+			Encoded[0] = (ANSICHAR)(0xE0 | (Codepoint >> 12));
+			Encoded[1] = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+			Encoded[2] = (ANSICHAR)(0x80 | (Codepoint & 0x3F));
+			EncodedLen = 3;
+		}
+		else
+		{
+			Encoded[0] = (ANSICHAR)(0xF0 | (Codepoint >> 18));
+			Encoded[1] = (ANSICHAR)(0x80 | ((Codepoint >> 12) & 0x3F));
+			Encoded[2] = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+			Encoded[3] = (ANSICHAR)(0x80 | (Codepoint & 0x3F));
+			EncodedLen = 4;
+		}
+
+		if (KeyPos + EncodedLen > Len || FMemory::Memcmp(Key + KeyPos, Encoded, EncodedLen) != 0)
+		{
+			return false;
+		}
+		KeyPos += EncodedLen;
+	}
+
+	return KeyPos == Len;
+}
+
+int32 FVaRestJsonPathCursor::GetIndex() const
+{
+	const int32 Len = SegmentEnd - SegmentStart;
+	if (Len <= 0 || Len >= 10)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Index = 0;
+	for (int32 i = SegmentStart; i < SegmentEnd; ++i)
+	{
+		if (!FChar::IsDigit(Path[i]))
+		{
+			return INDEX_NONE;
+		}
+		Index = Index * 10 + (Path[i] - TEXT('0'));
+	}
+	return Index;
+}
+
+int32 FVaRestJsonFastParser::ForEachArrayElement(const ANSICHAR* Data, int32 Size, const FString& Path, TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> Callback, FString* OutError)
+{
+	SkipBOM(Data, Size);
+
+	FVaRestJsonStructuralIndex Index;
+	if (!Index.Build(Data, Size))
+	{
+		SetError(OutError, Index.Error, Index.ErrorOffset);
+		return INDEX_NONE;
+	}
+
+	TArray<FVaRestJsonPathCursor> Segments;
+	for (FVaRestJsonPathCursor Segment(Path); Segment.Next();)
+	{
+		Segments.Add(Segment);
+	}
+
+	FArrayElementHandler Handler(Segments, Callback);
+	if (!Walk(Data, Size, Index, Handler, OutError) && !Handler.bFinished)
+	{
+		if (Handler.Error != nullptr && OutError != nullptr)
+		{
+			*OutError = Handler.Error;
+		}
+		return INDEX_NONE;
+	}
+
+	if (!Handler.bFound)
+	{
+		if (OutError != nullptr)
+		{
+			*OutError = FString::Printf(TEXT("Path not found: %s"), *Path);
+		}
+		return INDEX_NONE;
+	}
+
+	return Handler.Count;
+}
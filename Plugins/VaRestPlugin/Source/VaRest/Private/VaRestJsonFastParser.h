@@ -0,0 +1,504 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#include "VaRestJsonKeyTable.h"
+#include "VaRestJsonNumber.h"
+#include "VaRestJsonParser.h"
+
+/**
+ * Structural index of utf-8 json text (stage 1 of FVaRestJsonFastParser).
+ *
+ * Input is classified 64 bytes at a time into quote, backslash, operator and whitespace
+ * bitmasks with vector compares. Escaped quotes and string contents are masked out with
+ * carry propagating bit arithmetic, so no byte is visited by a branchy state machine. Only
+ * blocks holding bytes above 0x7f go through a scalar utf-8 check.
+ */
+struct FVaRestJsonStructuralIndex
+{
+	/** Offsets of operators, opening quotes and scalar starts, followed by input size */
+	TArray<uint32> Positions;
+
+	/** Number of structural characters (without the trailing input size) */
+	int32 Num() const { return Positions.Num() - 1; }
+
+	/** Why Build failed and where */
+	const TCHAR* Error = nullptr;
+	int32 ErrorOffset = 0;
+
+	/** Builds index for Data, false if text isn't valid utf-8 or ends inside a string */
+	bool Build(const ANSICHAR* Data, int32 Size);
+
+	/** Error formatted as the parsers report it */
+	FString GetError() const;
+};
+
+/** String slice handed out by the parser, points into input or into parser scratch */
+struct FVaRestJsonStringRef
+{
+	const ANSICHAR* Data = nullptr;
+	int32 Len = 0;
+
+	/** No byte above 0x7f, string can be widened without utf-8 decoding */
+	bool bAscii = true;
+
+	FString ToString() const;
+
+	/** Converts into Out reusing its allocation */
+	void ToString(FString& Out) const;
+};
+
+/** Walk handler building FJsonValue tree */
+struct FVaRestJsonDomBuilder
+{
+	TSharedPtr<FJsonValue> Root;
+
+	struct FFrame
+	{
+		FJsonObject* Object;
+		TArray<TSharedPtr<FJsonValue>>* Array;
+	};
+
+	TArray<FFrame, TInlineAllocator<64>> Stack;
+	const FVaRestJsonKey* Key = nullptr;
+
+	/** Keys of all objects built, they are kept across Reset */
+	FVaRestJsonKeyTable Keys;
+
+	/** Prepares builder for the next value, Root is released */
+	void Reset()
+	{
+		Root.Reset();
+		Stack.Reset();
+		Key = nullptr;
+	}
+
+	FORCEINLINE void Add(TSharedPtr<FJsonValue>&& Value)
+	{
+		if (Stack.Num() == 0)
+		{
+			Root = MoveTemp(Value);
+			return;
+		}
+
+		const FFrame& Top = Stack.Last();
+		if (Top.Object != nullptr)
+		{
+			Top.Object->Values.AddByHash(Key->NameHash, Key->ToString(), MoveTemp(Value));
+			Key = nullptr;
+		}
+		else
+		{
+			Top.Array->Add(MoveTemp(Value));
+		}
+	}
+
+	bool OnStartObject()
+	{
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Add(MakeShared<FJsonValueObject>(Object));
+		Stack.Add(FFrame{&Object.Get(), nullptr});
+		return true;
+	}
+
+	bool OnEndObject()
+	{
+		Stack.Pop(false);
+		return true;
+	}
+
+	bool OnStartArray()
+	{
+		const TSharedRef<FJsonValueNonConstArray> Array = MakeShared<FJsonValueNonConstArray>(TArray<TSharedPtr<FJsonValue>>());
+		Add(Array);
+		Stack.Add(FFrame{nullptr, &Array->AsNonConstArray()});
+		return true;
+	}
+
+	bool OnEndArray()
+	{
+		Stack.Pop(false);
+		return true;
+	}
+
+	bool OnKey(const FVaRestJsonStringRef& String)
+	{
+		Key = Keys.Intern(String);
+		return true;
+	}
+
+	bool OnString(const FVaRestJsonStringRef& String)
+	{
+		Add(MakeShared<FJsonValueString>(String.ToString()));
+		return true;
+	}
+
+	bool OnNumber(double Value, const ANSICHAR* Text, int32 Len)
+	{
+		// Integers double can't hold have at least 16 digits, only those are parsed again
+		if (Len > 15)
+		{
+			const ANSICHAR* Ptr = Text;
+			FVaRestJsonNumber Number;
+			if (FVaRestJsonNumber::Parse(Ptr, Text + Len, Number) && Number.NeedsInt64())
+			{
+				Add(Number.ToJsonValue());
+				return true;
+			}
+		}
+
+		Add(MakeShared<FJsonValueNumber>(Value));
+		return true;
+	}
+
+	bool OnBoolean(bool bValue)
+	{
+		Add(MakeShared<FJsonValueBoolean>(bValue));
+		return true;
+	}
+
+	bool OnNull()
+	{
+		Add(MakeShared<FJsonValueNull>());
+		return true;
+	}
+};
+
+/**
+ * Steps through segments of json pointer ("/data/items/3") or dotted path ("data.items.3") in place,
+ * empty path is the root. The only reader of path syntax, every path lookup goes through it.
+ */
+struct FVaRestJsonPathCursor
+{
+	explicit FVaRestJsonPathCursor(const FString& InPath);
+
+	/** Moves to the next segment, false past the last one */
+	bool Next();
+
+	/** Compares current segment, pointer escapes resolved, with utf-8 key */
+	bool MatchesKey(const ANSICHAR* Key, int32 Len) const;
+
+	/** Array index of current segment, INDEX_NONE if it is not a number */
+	int32 GetIndex() const;
+
+private:
+	const TCHAR* Path;
+	int32 PathLen;
+	bool bPointer;
+	bool bDone;
+
+	int32 SegmentStart = 0;
+	int32 SegmentEnd = 0;
+	int32 NextStart = 0;
+};
+
+/**
+ * Two stage json parser.
+ *
+ * Stage 1 builds FVaRestJsonStructuralIndex, stage 2 walks the index and reports values to
+ * a handler. Handler implements OnStartObject, OnEndObject, OnStartArray, OnEndArray, OnKey,
+ * OnString, OnNumber, OnBoolean and OnNull, each returns false to stop the walk.
+ */
+class FVaRestJsonFastParser
+{
+public:
+	/** Parses utf-8 text into json value of any type, nullptr on error */
+	static TSharedPtr<FJsonValue> Parse(const ANSICHAR* Data, int32 Size, FString* OutError = nullptr);
+
+	/**
+	 * Calls Callback for every element of array at Path, one element is built at a time and
+	 * released after the callback. Other values are skipped without creating json objects.
+	 * Returns number of visited elements or INDEX_NONE on error.
+	 */
+	static int32 ForEachArrayElement(const ANSICHAR* Data, int32 Size, const FString& Path, TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> Callback, FString* OutError = nullptr);
+
+	/** Walks indexed text and reports every value to Handler */
+	template <typename HandlerType>
+	static FORCEINLINE bool Walk(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, HandlerType& Handler, FString* OutError = nullptr)
+	{
+		return WalkRange(Data, Size, Index, 0, Index.Num(), Handler, OutError);
+	}
+
+	/** Walks structurals from First up to Last, they have to hold exactly one value */
+	template <typename HandlerType>
+	static bool WalkRange(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, int32 First, int32 Last, HandlerType& Handler, FString* OutError = nullptr);
+
+	/**
+	 * Finds elements of root array for parsing them in parallel. Element i spans structurals from
+	 * OutBounds[i] up to OutBounds[i + 1] - 1 (its comma or the closing bracket). False if root
+	 * is not an array or text is too small to be worth splitting.
+	 */
+	static bool SplitRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, TArray<int32>& OutBounds);
+
+	/** Number of element runs parsed in parallel for NumElements elements */
+	static int32 GetNumParallelRuns(int32 NumElements);
+
+	/**
+	 * Lowers FirstFailedRun to Run. Runs stop once an earlier run has failed, later ones keep going,
+	 * so the error of the lowest failed run is the first one in document order.
+	 */
+	static void MarkFailedRun(volatile int32& FirstFailedRun, int32 Run);
+
+	/** Skips utf-8 byte order mark */
+	static void SkipBOM(const ANSICHAR*& Data, int32& Size);
+
+	/** Decodes string starting at opening quote, Ptr is moved past closing quote */
+	static bool DecodeString(const ANSICHAR*& Ptr, const ANSICHAR* End, TArray<ANSICHAR>& Scratch, FVaRestJsonStringRef& OutString);
+
+	/** Parses number starting at Ptr, Ptr is moved past the last digit */
+	static bool ParseNumber(const ANSICHAR*& Ptr, const ANSICHAR* End, double& OutValue);
+
+	/** Checks literal (true, false or null) starting at Ptr, Ptr is moved past it */
+	static bool ParseLiteral(const ANSICHAR*& Ptr, const ANSICHAR* End, const ANSICHAR* Literal, int32 LiteralLen);
+
+	/** True for whitespace and operators, the only characters allowed after a scalar */
+	static FORCEINLINE bool IsScalarEnd(ANSICHAR Char)
+	{
+		switch (Char)
+		{
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+		case ',':
+		case ':':
+		case '[':
+		case ']':
+		case '{':
+		case '}':
+			return true;
+		}
+		return false;
+	}
+
+private:
+	/** Builds elements of root array on worker threads, every run of elements has its own builder */
+	static TSharedPtr<FJsonValue> ParseRootArray(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, const TArray<int32>& Bounds, FString* OutError);
+
+	static void SetError(FString* OutError, const TCHAR* Reason, int32 Offset);
+};
+
+template <typename HandlerType>
+bool FVaRestJsonFastParser::WalkRange(const ANSICHAR* Data, int32 Size, const FVaRestJsonStructuralIndex& Index, int32 First, int32 Last, HandlerType& Handler, FString* OutError)
+{
+	const uint32* Positions = Index.Positions.GetData() + First;
+	const int32 NumPositions = Last - First;
+	const ANSICHAR* End = Data + Size;
+
+	if (NumPositions <= 0)
+	{
+		SetError(OutError, First == 0 ? TEXT("Empty document") : TEXT("Value expected"), Positions[0]);
+		return false;
+	}
+
+	// true for object, false for array
+	TArray<bool, TInlineAllocator<64>> Containers;
+	TArray<ANSICHAR> Scratch;
+	Scratch.Reserve(256);
+
+	int32 Cursor = 0;
+	auto Peek = [&]() -> ANSICHAR
+	{
+		return Cursor < NumPositions ? Data[Positions[Cursor]] : '\0';
+	};
+
+	FVaRestJsonStringRef String;
+
+ReadValue:
+	{
+		const uint32 Offset = Positions[Cursor];
+		const ANSICHAR* Ptr = Data + Offset;
+
+		switch (*Ptr)
+		{
+		case '{':
+			if (!Handler.OnStartObject())
+			{
+				return false;
+			}
+			++Cursor;
+			if (Peek() == '}')
+			{
+				++Cursor;
+				if (!Handler.OnEndObject())
+				{
+					return false;
+				}
+				goto ReadNext;
+			}
+			Containers.Add(true);
+			goto ReadKey;
+
+		case '[':
+			if (!Handler.OnStartArray())
+			{
+				return false;
+			}
+			++Cursor;
+			if (Peek() == ']')
+			{
+				++Cursor;
+				if (!Handler.OnEndArray())
+				{
+					return false;
+				}
+				goto ReadNext;
+			}
+			Containers.Add(false);
+			if (Cursor >= NumPositions)
+			{
+				SetError(OutError, TEXT("Unexpected end of array"), Size);
+				return false;
+			}
+			goto ReadValue;
+
+		case '"':
+			if (!DecodeString(Ptr, End, Scratch, String))
+			{
+				SetError(OutError, TEXT("Invalid string"), Offset);
+				return false;
+			}
+			if (!Handler.OnString(String))
+			{
+				return false;
+			}
+			++Cursor;
+			goto ReadNext;
+
+		case 't':
+		case 'f':
+		case 'n':
+		{
+			const bool bTrue = *Ptr == 't';
+			const bool bNull = *Ptr == 'n';
+			const bool bValid = bNull ? ParseLiteral(Ptr, End, "null", 4) : (bTrue ? ParseLiteral(Ptr, End, "true", 4) : ParseLiteral(Ptr, End, "false", 5));
+			if (!bValid || (Ptr < End && !IsScalarEnd(*Ptr)))
+			{
+				SetError(OutError, TEXT("Invalid literal"), Offset);
+				return false;
+			}
+			if (!(bNull ? Handler.OnNull() : Handler.OnBoolean(bTrue)))
+			{
+				return false;
+			}
+			++Cursor;
+			goto ReadNext;
+		}
+
+		default:
+		{
+			double Number = 0.0;
+			const ANSICHAR* NumberStart = Ptr;
+			if (!ParseNumber(Ptr, End, Number) || (Ptr < End && !IsScalarEnd(*Ptr)))
+			{
+				SetError(OutError, TEXT("Invalid value"), Offset);
+				return false;
+			}
+			if (!Handler.OnNumber(Number, NumberStart, (int32)(Ptr - NumberStart)))
+			{
+				return false;
+			}
+			++Cursor;
+			goto ReadNext;
+		}
+		}
+	}
+
+ReadKey:
+	{
+		if (Peek() != '"')
+		{
+			SetError(OutError, TEXT("Object key expected"), Cursor < NumPositions ? Positions[Cursor] : Size);
+			return false;
+		}
+
+		const ANSICHAR* Ptr = Data + Positions[Cursor];
+		if (!DecodeString(Ptr, End, Scratch, String))
+		{
+			SetError(OutError, TEXT("Invalid object key"), Positions[Cursor]);
+			return false;
+		}
+		if (!Handler.OnKey(String))
+		{
+			return false;
+		}
+
+		++Cursor;
+		if (Peek() != ':')
+		{
+			SetError(OutError, TEXT("Colon expected"), Cursor < NumPositions ? Positions[Cursor] : Size);
+			return false;
+		}
+
+		++Cursor;
+		if (Cursor >= NumPositions)
+		{
+			SetError(OutError, TEXT("Value expected"), Size);
+			return false;
+		}
+		goto ReadValue;
+	}
+
+ReadNext:
+	{
+		if (Containers.Num() == 0)
+		{
+			if (Cursor != NumPositions)
+			{
+				SetError(OutError, TEXT("Unexpected data after root value"), Positions[Cursor]);
+				return false;
+			}
+			return true;
+		}
+
+		const ANSICHAR Char = Peek();
+		if (Containers.Last())
+		{
+			if (Char == ',')
+			{
+				++Cursor;
+				goto ReadKey;
+			}
+			if (Char == '}')
+			{
+				++Cursor;
+				Containers.Pop(false);
+				if (!Handler.OnEndObject())
+				{
+					return false;
+				}
+				goto ReadNext;
+			}
+		}
+		else
+		{
+			if (Char == ',')
+			{
+				++Cursor;
+				if (Cursor >= NumPositions)
+				{
+					SetError(OutError, TEXT("Value expected"), Size);
+					return false;
+				}
+				goto ReadValue;
+			}
+			if (Char == ']')
+			{
+				++Cursor;
+				Containers.Pop(false);
+				if (!Handler.OnEndArray())
+				{
+					return false;
+				}
+				goto ReadNext;
+			}
+		}
+
+		SetError(OutError, TEXT("Comma or closing bracket expected"), Cursor < NumPositions ? Positions[Cursor] : Size);
+		return false;
+	}
+}
@@ -0,0 +1,121 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonKeyTable.h"
+
+#include "VaRestJsonFastParser.h"
+
+#include "Hash/CityHash.h"
+
+namespace
+{
+	constexpr int32 MIN_SLOTS = 64;
+}
+
+FVaRestJsonKeyTable::FVaRestJsonKeyTable()
+	: Arena(4 * 1024)
+{
+}
+
+const FVaRestJsonKey* FVaRestJsonKeyTable::Intern(const FVaRestJsonStringRef& String)
+{
+	// Kept at most half full
+	if (Count * 2 >= Slots.Num())
+	{
+		Grow();
+	}
+
+	const uint32 Hash = CityHash32(String.Data, String.Len);
+	const uint32 Mask = (uint32)Slots.Num() - 1;
+
+	for (uint32 Slot = Hash & Mask;; Slot = (Slot + 1) & Mask)
+	{
+		const FVaRestJsonKey* Key = Slots[Slot];
+		if (Key == nullptr)
+		{
+			return Add(String, Hash, (int32)Slot);
+		}
+
+		if (Key->Hash == Hash && Key->Len == String.Len && FMemory::Memcmp(Key->Data, String.Data, String.Len) == 0)
+		{
+			return Key;
+		}
+	}
+}
+
+const FVaRestJsonKey* FVaRestJsonKeyTable::Find(const ANSICHAR* Data, int32 Len) const
+{
+	if (Count == 0)
+	{
+		return nullptr;
+	}
+
+	const uint32 Hash = CityHash32(Data, Len);
+	const uint32 Mask = (uint32)Slots.Num() - 1;
+
+	for (uint32 Slot = Hash & Mask;; Slot = (Slot + 1) & Mask)
+	{
+		const FVaRestJsonKey* Key = Slots[Slot];
+		if (Key == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (Key->Hash == Hash && Key->Len == Len && FMemory::Memcmp(Key->Data, Data, Len) == 0)
+		{
+			return Key;
+		}
+	}
+}
+
+void FVaRestJsonKeyTable::GetKeys(TArray<const FVaRestJsonKey*>& OutKeys) const
+{
+	OutKeys.Reset(Count);
+	for (const FVaRestJsonKey* Key : Slots)
+	{
+		if (Key != nullptr)
+		{
+			OutKeys.Add(Key);
+		}
+	}
+}
+
+const FVaRestJsonKey* FVaRestJsonKeyTable::Add(const FVaRestJsonStringRef& String, uint32 Hash, int32 Slot)
+{
+	const FString Name = String.ToString();
+
+	TCHAR* NameData = (TCHAR*)Arena.Allocate(sizeof(TCHAR) * (Name.Len() + 1), alignof(TCHAR));
+	FMemory::Memcpy(NameData, *Name, sizeof(TCHAR) * (Name.Len() + 1));
+
+	FVaRestJsonKey* Key = Arena.NewArray<FVaRestJsonKey>(1);
+	Key->Data = Arena.CopyString(String.Data, String.Len);
+	Key->Len = String.Len;
+	Key->bAscii = String.bAscii;
+	Key->Hash = Hash;
+	Key->Name = NameData;
+	Key->NameLen = Name.Len();
+	Key->NameHash = GetTypeHash(Name);
+
+	Slots[Slot] = Key;
+	++Count;
+	return Key;
+}
+
+void FVaRestJsonKeyTable::Grow()
+{
+	TArray<FVaRestJsonKey*> OldSlots = MoveTemp(Slots);
+	Slots.SetNumZeroed(FMath::Max(MIN_SLOTS, OldSlots.Num() * 2));
+
+	const uint32 Mask = (uint32)Slots.Num() - 1;
+	for (FVaRestJsonKey* Key : OldSlots)
+	{
+		if (Key != nullptr)
+		{
+			uint32 Slot = Key->Hash & Mask;
+			while (Slots[Slot] != nullptr)
+			{
+				Slot = (Slot + 1) & Mask;
+			}
+			Slots[Slot] = Key;
+		}
+	}
+}
@@ -0,0 +1,75 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "VaRestJsonArena.h"
+
+struct FVaRestJsonStringRef;
+
+/** Object key shared by all members of a document having it */
+struct FVaRestJsonKey
+{
+	/** Utf-8 text, not terminated */
+	const ANSICHAR* Data;
+	int32 Len;
+
+	/** Text has no byte above 0x7f */
+	bool bAscii;
+
+	/** Hash of utf-8 text */
+	uint32 Hash;
+
+	/** Converted key, terminated */
+	const TCHAR* Name;
+	int32 NameLen;
+
+	/** Hash of Name as FJsonObject::Values computes it */
+	uint32 NameHash;
+
+	FString ToString() const { return FString(NameLen, Name); }
+};
+
+/**
+ * Intern table of object keys.
+ *
+ * Records of one response repeat the same handful of keys, each distinct key is stored
+ * and converted once and is then found by its utf-8 bytes. Interned keys of one table
+ * can be compared by pointer.
+ */
+class FVaRestJsonKeyTable
+{
+public:
+	FVaRestJsonKeyTable();
+
+	FVaRestJsonKeyTable(const FVaRestJsonKeyTable&) = delete;
+	FVaRestJsonKeyTable& operator=(const FVaRestJsonKeyTable&) = delete;
+
+	/** Key with text of String, added on first use */
+	const FVaRestJsonKey* Intern(const FVaRestJsonStringRef& String);
+
+	/** Key with utf-8 text, nullptr if it was never interned */
+	const FVaRestJsonKey* Find(const ANSICHAR* Data, int32 Len) const;
+
+	/** Number of distinct keys */
+	int32 Num() const { return Count; }
+
+	/** All keys in no particular order */
+	void GetKeys(TArray<const FVaRestJsonKey*>& OutKeys) const;
+
+	SIZE_T GetAllocatedSize() const { return Arena.GetAllocatedSize() + Slots.GetAllocatedSize(); }
+
+private:
+	const FVaRestJsonKey* Add(const FVaRestJsonStringRef& String, uint32 Hash, int32 Slot);
+
+	void Grow();
+
+	/** Keys with their texts */
+	FVaRestJsonArena Arena;
+
+	/** Open addressing with linear probing, size is a power of two */
+	TArray<FVaRestJsonKey*> Slots;
+
+	int32 Count = 0;
+};
@@ -0,0 +1,455 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonLazyDocument.h"
+
+#include "VaRestDefines.h"
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonObject.h"
+
+namespace
+{
+	/** What may follow in structural validation */
+	enum class EExpect : uint8
+	{
+		Value,
+		ValueOrEnd,
+		Key,
+		KeyOrEnd,
+		Colon,
+		CommaOrEnd,
+	};
+
+	FORCEINLINE bool IsScalarStart(ANSICHAR Char)
+	{
+		return Char == '"' || Char == 't' || Char == 'f' || Char == 'n' || Char == '-' || (Char >= '0' && Char <= '9');
+	}
+	EVaJson GetValueType(ANSICHAR Char)
+	{
+		switch (Char)
+		{
+		case '{':
+			return EVaJson::Object;
+		case '[':
+			return EVaJson::Array;
+		case '"':
+			return EVaJson::String;
+		case 't':
+		case 'f':
+			return EVaJson::Boolean;
+		case 'n':
+			return EVaJson::Null;
+		default:
+			return EVaJson::Number;
+		}
+	}
+} // namespace
+
+UVaRestJsonLazyDocument::UVaRestJsonLazyDocument(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UVaRestJsonLazyDocument::Reset()
+{
+	Content.Empty();
+	Positions.Empty();
+	Closers.Empty();
+}
+
+bool UVaRestJsonLazyDocument::DecodeJson(const FString& JsonString)
+{
+	const FTCHARToUTF8 Converted(*JsonString);
+	return SetContent((const ANSICHAR*)Converted.Get(), Converted.Length());
+}
+
+bool UVaRestJsonLazyDocument::SetContent(const ANSICHAR* Data, int32 Size)
+{
+	Reset();
+
+	FVaRestJsonFastParser::SkipBOM(Data, Size);
+
+	Content.SetNumUninitialized(Size + 1);
+	FMemory::Memcpy(Content.GetData(), Data, Size);
+	Content[Size] = '\0';
+
+	FVaRestJsonStructuralIndex Index;
+	if (!Index.Build(Content.GetData(), Size))
+	{
+		UE_LOG(LogVaRest, Error, TEXT("%s: Json decoding failed: %s"), *VA_FUNC_LINE, *Index.GetError());
+		Reset();
+		return false;
+	}
+
+	Positions = MoveTemp(Index.Positions);
+
+	// Only structure is checked here, strings and scalars are decoded when they are read
+	const int32 NumPositions = Positions.Num() - 1;
+	Closers.SetNumZeroed(NumPositions);
+
+	TArray<int32, TInlineAllocator<64>> Open;
+	EExpect Expect = EExpect::Value;
+	int32 Failed = INDEX_NONE;
+
+	for (int32 i = 0; i < NumPositions && Failed == INDEX_NONE; ++i)
+	{
+		const ANSICHAR Char = *GetChar(i);
+		const bool bInObject = Open.Num() > 0 && *GetChar(Open.Last()) == '{';
+
+		switch (Expect)
+		{
+		case EExpect::Value:
+		case EExpect::ValueOrEnd:
+			if (Char == '{' || Char == '[')
+			{
+				Open.Add(i);
+				Expect = Char == '{' ? EExpect::KeyOrEnd : EExpect::ValueOrEnd;
+			}
+			else if (Char == ']' && Expect == EExpect::ValueOrEnd)
+			{
+				Closers[Open.Pop(false)] = (uint32)i;
+				Expect = EExpect::CommaOrEnd;
+			}
+			else if (IsScalarStart(Char))
+			{
+				Expect = EExpect::CommaOrEnd;
+			}
+			else
+			{
+				Failed = i;
+			}
+			break;
+
+		case EExpect::Key:
+		case EExpect::KeyOrEnd:
+			if (Char == '"')
+			{
+				Expect = EExpect::Colon;
+			}
+			else if (Char == '}' && Expect == EExpect::KeyOrEnd)
+			{
+				Closers[Open.Pop(false)] = (uint32)i;
+				Expect = EExpect::CommaOrEnd;
+			}
+			else
+			{
+				Failed = i;
+			}
+			break;
+
+		case EExpect::Colon:
+			Expect = EExpect::Value;
+			Failed = Char == ':' ? INDEX_NONE : i;
+			break;
+
+		case EExpect::CommaOrEnd:
+			if (Char == ',' && Open.Num() > 0)
+			{
+				Expect = bInObject ? EExpect::Key : EExpect::Value;
+			}
+			else if ((Char == '}' && bInObject) || (Char == ']' && Open.Num() > 0 && !bInObject))
+			{
+				Closers[Open.Pop(false)] = (uint32)i;
+			}
+			else
+			{
+				Failed = i;
+			}
+			break;
+		}
+	}
+
+	if (Failed == INDEX_NONE && (Open.Num() > 0 || Expect != EExpect::CommaOrEnd))
+	{
+		Failed = NumPositions;
+	}
+
+	if (Failed != INDEX_NONE)
+	{
+		UE_LOG(LogVaRest, Error, TEXT("%s: Json decoding failed: Unexpected character at offset %d"), *VA_FUNC_LINE, (int32)Positions[Failed]);
+		Reset();
+		return false;
+	}
+
+	return true;
+}
+
+SIZE_T UVaRestJsonLazyDocument::GetAllocatedSize() const
+{
+	return Content.GetAllocatedSize() + Positions.GetAllocatedSize() + Closers.GetAllocatedSize();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Path access
+
+int32 UVaRestJsonLazyDocument::SkipValue(int32 Cursor) const
+{
+	const ANSICHAR Char = *GetChar(Cursor);
+	return (Char == '{' || Char == '[') ? (int32)Closers[Cursor] + 1 : Cursor + 1;
+}
+
+int32 UVaRestJsonLazyDocument::Resolve(const FString& Path) const
+{
+	if (Positions.Num() <= 1)
+	{
+		return INDEX_NONE;
+	}
+
+	// Path is stepped through in place, keys without escapes are compared straight in the text
+	FVaRestJsonPathCursor Segment(Path);
+	TArray<ANSICHAR> Scratch;
+	int32 Cursor = 0;
+
+	while (Segment.Next())
+	{
+		const ANSICHAR Char = *GetChar(Cursor);
+		if (Char == '{')
+		{
+			// Members are: key, colon, value and comma or closing bracket. Last duplicate wins like in FJsonObject
+			int32 Found = INDEX_NONE;
+			int32 Item = Cursor + 1;
+			while (*GetChar(Item) == '"')
+			{
+				const ANSICHAR* Ptr = GetChar(Item);
+				FVaRestJsonStringRef Key;
+				if (FVaRestJsonFastParser::DecodeString(Ptr, GetEnd(), Scratch, Key) && Segment.MatchesKey(Key.Data, Key.Len))
+				{
+					Found = Item + 2;
+				}
+
+				Item = SkipValue(Item + 2);
+				if (*GetChar(Item) == ',')
+				{
+					++Item;
+				}
+			}
+
+			if (Found == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			Cursor = Found;
+		}
+		else if (Char == '[')
+		{
+			const int32 ElementIndex = Segment.GetIndex();
+
+			int32 Item = Cursor + 1;
+			if (ElementIndex == INDEX_NONE || *GetChar(Item) == ']')
+			{
+				return INDEX_NONE;
+			}
+
+			for (int32 i = 0; i < ElementIndex; ++i)
+			{
+				Item = SkipValue(Item);
+				if (*GetChar(Item) != ',')
+				{
+					return INDEX_NONE;
+				}
+				++Item;
+			}
+			Cursor = Item;
+		}
+		else
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	return Cursor;
+}
+
+bool UVaRestJsonLazyDocument::HasPath(const FString& Path) const
+{
+	return Resolve(Path) != INDEX_NONE;
+}
+
+EVaJson UVaRestJsonLazyDocument::GetPathType(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	return Cursor == INDEX_NONE ? EVaJson::None : GetValueType(*GetChar(Cursor));
+}
+
+float UVaRestJsonLazyDocument::GetNumber(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || GetValueType(*GetChar(Cursor)) != EVaJson::Number)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type Number"), *Path);
+		return 0.0f;
+	}
+
+	const ANSICHAR* Ptr = GetChar(Cursor);
+	double Value = 0.0;
+	if (!FVaRestJsonFastParser::ParseNumber(Ptr, GetEnd(), Value))
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("Invalid number at path %s"), *Path);
+		return 0.0f;
+	}
+	return (float)Value;
+}
+
+int32 UVaRestJsonLazyDocument::GetInteger(const FString& Path) const
+{
+	return (int32)GetInt64(Path);
+}
+
+int64 UVaRestJsonLazyDocument::GetInt64(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || GetValueType(*GetChar(Cursor)) != EVaJson::Number)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type Number"), *Path);
+		return 0;
+	}
+
+	const ANSICHAR* Ptr = GetChar(Cursor);
+	FVaRestJsonNumber Number;
+	if (!FVaRestJsonNumber::Parse(Ptr, GetEnd(), Number))
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("Invalid number at path %s"), *Path);
+		return 0;
+	}
+	return Number.bInteger ? Number.Integer : (int64)Number.Value;
+}
+
+FString UVaRestJsonLazyDocument::GetString(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || GetValueType(*GetChar(Cursor)) != EVaJson::String)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type String"), *Path);
+		return FString();
+	}
+
+	const ANSICHAR* Ptr = GetChar(Cursor);
+	TArray<ANSICHAR> Scratch;
+	FVaRestJsonStringRef String;
+	if (!FVaRestJsonFastParser::DecodeString(Ptr, GetEnd(), Scratch, String))
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("Invalid string at path %s"), *Path);
+		return FString();
+	}
+	return String.ToString();
+}
+
+bool UVaRestJsonLazyDocument::GetBool(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || GetValueType(*GetChar(Cursor)) != EVaJson::Boolean)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type Boolean"), *Path);
+		return false;
+	}
+
+	const ANSICHAR* Ptr = GetChar(Cursor);
+	if (!FVaRestJsonFastParser::ParseLiteral(Ptr, GetEnd(), "true", 4))
+	{
+		const ANSICHAR* FalsePtr = GetChar(Cursor);
+		if (!FVaRestJsonFastParser::ParseLiteral(FalsePtr, GetEnd(), "false", 5))
+		{
+			UE_LOG(LogVaRest, Warning, TEXT("Invalid boolean at path %s"), *Path);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+int32 UVaRestJsonLazyDocument::GetArrayLength(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || *GetChar(Cursor) != '[')
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Count = 0;
+	int32 Item = Cursor + 1;
+	if (*GetChar(Item) != ']')
+	{
+		++Count;
+		for (Item = SkipValue(Item); *GetChar(Item) == ','; Item = SkipValue(Item + 1))
+		{
+			++Count;
+		}
+	}
+
+	return Count;
+}
+
+TArray<FString> UVaRestJsonLazyDocument::GetFieldNames(const FString& Path) const
+{
+	TArray<FString> Result;
+
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE || *GetChar(Cursor) != '{')
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type Object"), *Path);
+		return Result;
+	}
+
+	TArray<ANSICHAR> Scratch;
+	int32 Item = Cursor + 1;
+	while (*GetChar(Item) == '"')
+	{
+		const ANSICHAR* Ptr = GetChar(Item);
+		FVaRestJsonStringRef Key;
+		if (FVaRestJsonFastParser::DecodeString(Ptr, GetEnd(), Scratch, Key))
+		{
+			Result.Add(Key.ToString());
+		}
+
+		Item = SkipValue(Item + 2);
+		if (*GetChar(Item) == ',')
+		{
+			++Item;
+		}
+	}
+
+	return Result;
+}
+
+TSharedPtr<FJsonValue> UVaRestJsonLazyDocument::GetJsonValue(const FString& Path) const
+{
+	const int32 Cursor = Resolve(Path);
+	if (Cursor == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	// Only text of the value is parsed
+	const ANSICHAR Char = *GetChar(Cursor);
+	const uint32 Start = Positions[Cursor];
+	const uint32 End = (Char == '{' || Char == '[') ? Positions[Closers[Cursor]] + 1 : Positions[Cursor + 1];
+
+	return FVaRestJsonFastParser::Parse(Content.GetData() + Start, (int32)(End - Start));
+}
+
+UVaRestJsonValue* UVaRestJsonLazyDocument::GetValue(const FString& Path) const
+{
+	TSharedPtr<FJsonValue> Value = GetJsonValue(Path);
+	if (!Value.IsValid())
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s"), *Path);
+		return nullptr;
+	}
+
+	UVaRestJsonValue* NewValue = NewObject<UVaRestJsonValue>();
+	NewValue->SetRootValue(Value);
+	return NewValue;
+}
+
+UVaRestJsonObject* UVaRestJsonLazyDocument::GetJsonObject(const FString& Path) const
+{
+	const TSharedPtr<FJsonValue> Value = GetJsonValue(Path);
+	if (!Value.IsValid() || Value->Type != EJson::Object)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("No value at path %s of type Object"), *Path);
+		return nullptr;
+	}
+
+	UVaRestJsonObject* NewObj = NewObject<UVaRestJsonObject>();
+	NewObj->SetRootObject(Value->AsObject());
+	return NewObj;
+}
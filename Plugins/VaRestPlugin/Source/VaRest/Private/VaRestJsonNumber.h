@@ -0,0 +1,42 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+
+/**
+ * Json number parsed from text.
+ *
+ * Strict json grammar is accepted. Value is correctly rounded: integers and short decimals are
+ * converted exactly, other numbers with up to 19 significant digits use Eisel-Lemire algorithm,
+ * longer ones fall back to Atod. Integers without fraction and exponent also keep exact int64 value.
+ */
+struct FVaRestJsonNumber
+{
+	/** Nearest double to the number */
+	double Value = 0.0;
+
+	/** Exact value, valid when bInteger is set */
+	int64 Integer = 0;
+
+	/** Number is written as an integer that fits int64 */
+	bool bInteger = false;
+
+	/** Parses number starting at Ptr, Ptr is moved past the last character of it */
+	static bool Parse(const ANSICHAR*& Ptr, const ANSICHAR* End, FVaRestJsonNumber& OutNumber);
+	static bool Parse(const TCHAR*& Ptr, const TCHAR* End, FVaRestJsonNumber& OutNumber);
+
+	/** True when double can't hold the integer exactly */
+	FORCEINLINE bool NeedsInt64() const
+	{
+		return bInteger && (Integer > (1ll << 53) || Integer < -(1ll << 53));
+	}
+
+	/** Json value for the number, large integers keep their text to stay exact */
+	TSharedRef<FJsonValue> ToJsonValue() const;
+
+	/** Number value as int64, exact for integers kept as text */
+	static int64 GetInt64(const FJsonValue& JsonValue);
+};
@@ -3,6 +3,9 @@
 #include "VaRestJsonObject.h"
 
 #include "VaRestDefines.h"
+#include "VaRestJsonDocument.h"
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonNumber.h"
 #include "VaRestJsonParser.h"
 #include "VaRestJsonValue.h"
 
@@ -15,6 +18,139 @@
 typedef TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FCondensedJsonStringWriterFactory;
 typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FCondensedJsonStringWriter;
 
+namespace
+{
+	/** DecodeFromArchive reads files in blocks of this size */
+	constexpr int32 ARCHIVE_BLOCK_SIZE = 64 * 1024;
+
+	enum class EArchiveEncoding : uint8
+	{
+		Utf8,
+		Utf16LE,
+		Utf16BE,
+	};
+
+	/** Encoding by byte order mark, returns mark size. Without one text is utf-16 if its first character has a zero byte */
+	int32 DetectArchiveEncoding(const uint8* Data, int32 Size, EArchiveEncoding& OutEncoding)
+	{
+		if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+		{
+			OutEncoding = EArchiveEncoding::Utf8;
+			return 3;
+		}
+
+		if (Size >= 2 && Data[0] == 0xFF && Data[1] == 0xFE)
+		{
+			OutEncoding = EArchiveEncoding::Utf16LE;
+			return 2;
+		}
+
+		if (Size >= 2 && Data[0] == 0xFE && Data[1] == 0xFF)
+		{
+			OutEncoding = EArchiveEncoding::Utf16BE;
+			return 2;
+		}
+
+		if (Size >= 2 && (Data[0] == 0) != (Data[1] == 0))
+		{
+			OutEncoding = Data[0] == 0 ? EArchiveEncoding::Utf16BE : EArchiveEncoding::Utf16LE;
+		}
+		else
+		{
+			OutEncoding = EArchiveEncoding::Utf8;
+		}
+		return 0;
+	}
+
+	/** Number of trailing bytes that start a utf-8 sequence not complete in the buffer */
+	int32 GetIncompleteUtf8Size(const uint8* Data, int32 Size)
+	{
+		for (int32 Back = 1; Back <= FMath::Min(3, Size); ++Back)
+		{
+			const uint8 Byte = Data[Size - Back];
+			if ((Byte & 0xC0) != 0x80)
+			{
+				const int32 Length = Byte >= 0xF0 ? 4 : Byte >= 0xE0 ? 3 : Byte >= 0xC0 ? 2 : 1;
+				return Length > Back ? Back : 0;
+			}
+		}
+		return 0;
+	}
+
+	/**
+	 * Converts utf-16 bytes to utf-8, unpaired surrogates become U+FFFD.
+	 * Returns number of trailing bytes left for the next block: odd byte and high surrogate.
+	 */
+	int32 ConvertUtf16ToUtf8(const uint8* Data, int32 Size, bool bBigEndian, bool bLastBlock, TArray<ANSICHAR>& OutUtf8)
+	{
+		const int32 High = bBigEndian ? 0 : 1;
+		const int32 Low = bBigEndian ? 1 : 0;
+
+		OutUtf8.SetNumUninitialized(Size / 2 * 3, false);
+		ANSICHAR* Out = OutUtf8.GetData();
+
+		int32 i = 0;
+		for (; i + 1 < Size; i += 2)
+		{
+			uint32 Codepoint = ((uint32)Data[i + High] << 8) | Data[i + Low];
+			if (Codepoint < 0x80)
+			{
+				*Out++ = (ANSICHAR)Codepoint;
+				continue;
+			}
+
+			if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF)
+			{
+				if (i + 3 >= Size)
+				{
+					if (!bLastBlock)
+					{
+						break;
+					}
+					Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+				}
+				else
+				{
+					const uint32 Next = ((uint32)Data[i + 2 + High] << 8) | Data[i + 2 + Low];
+					if (Next >= 0xDC00 && Next <= 0xDFFF)
+					{
+						Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (Next - 0xDC00);
+						i += 2;
+					}
+					else
+					{
+						Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+					}
+				}
+			}
+			else if (Codepoint >= 0xDC00 && Codepoint <= 0xDFFF)
+			{
+				Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+			}
+
+			if (Codepoint < 0x800)
+			{
+				*Out++ = (ANSICHAR)(0xC0 | (Codepoint >> 6));
+			}
+			else if (Codepoint < 0x10000)
+			{
+				*Out++ = (ANSICHAR)(0xE0 | (Codepoint >> 12));
+				*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+			}
+			else
+			{
+				*Out++ = (ANSICHAR)(0xF0 | (Codepoint >> 18));
+				*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 12) & 0x3F));
+				*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+			}
+			*Out++ = (ANSICHAR)(0x80 | (Codepoint & 0x3F));
+		}
+
+		OutUtf8.SetNum((int32)(Out - OutUtf8.GetData()), false);
+		return Size - i;
+	}
+} // namespace
+
 UVaRestJsonObject::UVaRestJsonObject(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, JsonObj(MakeShared<FJsonObject>())
@@ -24,10 +160,12 @@ UVaRestJsonObject::UVaRestJsonObject(const FObjectInitializer& ObjectInitializer
 void UVaRestJsonObject::Reset()
 {
 	JsonObj = MakeShared<FJsonObject>();
+	PendingDocument.Reset();
 }
 
 TSharedRef<FJsonObject>& UVaRestJsonObject::GetRootObject()
 {
+	GetJsonObj();
 	return JsonObj;
 }
 
@@ -36,6 +174,7 @@ void UVaRestJsonObject::SetRootObject(const TSharedPtr<FJsonObject>& JsonObject)
 	if (JsonObject.IsValid())
 	{
 		JsonObj = JsonObject.ToSharedRef();
+		PendingDocument.Reset();
 	}
 	else
 	{
@@ -44,6 +183,25 @@ void UVaRestJsonObject::SetRootObject(const TSharedPtr<FJsonObject>& JsonObject)
 	}
 }
 
+void UVaRestJsonObject::SetRootDocument(const TSharedPtr<const FVaRestJsonDocument, ESPMode::ThreadSafe>& Document)
+{
+	if (Document.IsValid() && Document->GetRoot().Type == EVaRestJsonNodeType::Object)
+	{
+		PendingDocument = Document;
+	}
+	else
+	{
+		UE_LOG(LogVaRest, Error, TEXT("%s: Trying to set document without root object. Reset now."), *VA_FUNC_LINE);
+		Reset();
+	}
+}
+
+void UVaRestJsonObject::MaterializeDocument() const
+{
+	JsonObj = FVaRestJsonDocument::ToJsonObject(PendingDocument->GetRoot());
+	PendingDocument.Reset();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Serialization
 
@@ -51,7 +209,7 @@ FString UVaRestJsonObject::EncodeJson() const
 {
 	FString OutputString;
 	const auto Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(JsonObj, Writer);
+	FJsonSerializer::Serialize(GetJsonObj(), Writer);
 
 	return OutputString;
 }
@@ -60,7 +218,7 @@ FString UVaRestJsonObject::EncodeJsonToSingleString() const
 {
 	FString OutputString;
 	const auto Writer = FCondensedJsonStringWriterFactory::Create(&OutputString);
-	FJsonSerializer::Serialize(JsonObj, Writer);
+	FJsonSerializer::Serialize(GetJsonObj(), Writer);
 
 	return OutputString;
 }
@@ -83,7 +241,7 @@ bool UVaRestJsonObject::DecodeJson(const FString& JsonString, bool bUseIncrement
 		TSharedPtr<FJsonObject> OutJsonObj;
 		if (FJsonSerializer::Deserialize(Reader, OutJsonObj))
 		{
-			JsonObj = OutJsonObj.ToSharedRef();
+			SetRootObject(OutJsonObj);
 			return true;
 		}
 	}
@@ -101,27 +259,27 @@ bool UVaRestJsonObject::DecodeJson(const FString& JsonString, bool bUseIncrement
 
 FString UVaRestJsonObject::GetFieldTypeString(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Null>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Null>(FieldName))
 	{
 		return TEXT("Null");
 	}
-	else if (!JsonObj->HasTypedField<EJson::String>(FieldName))
+	else if (!GetJsonObj()->HasTypedField<EJson::String>(FieldName))
 	{
 		return TEXT("String");
 	}
-	else if (!JsonObj->HasTypedField<EJson::Number>(FieldName))
+	else if (!GetJsonObj()->HasTypedField<EJson::Number>(FieldName))
 	{
 		return TEXT("Number");
 	}
-	else if (!JsonObj->HasTypedField<EJson::Boolean>(FieldName))
+	else if (!GetJsonObj()->HasTypedField<EJson::Boolean>(FieldName))
 	{
 		return TEXT("Boolean");
 	}
-	else if (!JsonObj->HasTypedField<EJson::Object>(FieldName))
+	else if (!GetJsonObj()->HasTypedField<EJson::Object>(FieldName))
 	{
 		return TEXT("Object");
 	}
-	else if (!JsonObj->HasTypedField<EJson::Array>(FieldName))
+	else if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName))
 	{
 		return TEXT("Array");
 	}
@@ -133,7 +291,7 @@ FString UVaRestJsonObject::GetFieldTypeString(const FString& FieldName) const
 TArray<FString> UVaRestJsonObject::GetFieldNames() const
 {
 	TArray<FString> Result;
-	JsonObj->Values.GetKeys(Result);
+	GetJsonObj()->Values.GetKeys(Result);
 
 	return Result;
 }
@@ -145,7 +303,7 @@ bool UVaRestJsonObject::HasField(const FString& FieldName) const
 		return false;
 	}
 
-	return JsonObj->HasField(FieldName);
+	return GetJsonObj()->HasField(FieldName);
 }
 
 void UVaRestJsonObject::RemoveField(const FString& FieldName)
@@ -155,7 +313,7 @@ void UVaRestJsonObject::RemoveField(const FString& FieldName)
 		return;
 	}
 
-	JsonObj->RemoveField(FieldName);
+	GetJsonObj()->RemoveField(FieldName);
 }
 
 UVaRestJsonValue* UVaRestJsonObject::GetField(const FString& FieldName) const
@@ -165,7 +323,7 @@ UVaRestJsonValue* UVaRestJsonObject::GetField(const FString& FieldName) const
 		return nullptr;
 	}
 
-	TSharedPtr<FJsonValue> NewVal = JsonObj->TryGetField(FieldName);
+	TSharedPtr<FJsonValue> NewVal = GetJsonObj()->TryGetField(FieldName);
 	if (NewVal.IsValid())
 	{
 		UVaRestJsonValue* NewValue = NewObject<UVaRestJsonValue>();
@@ -184,7 +342,7 @@ void UVaRestJsonObject::SetField(const FString& FieldName, UVaRestJsonValue* Jso
 		return;
 	}
 
-	JsonObj->SetField(FieldName, JsonValue->GetRootValue());
+	GetJsonObj()->SetField(FieldName, JsonValue->GetRootValue());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -192,13 +350,13 @@ void UVaRestJsonObject::SetField(const FString& FieldName, UVaRestJsonValue* Jso
 
 float UVaRestJsonObject::GetNumberField(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Number>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Number>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("No field with name %s of type Number"), *FieldName);
 		return 0.0f;
 	}
 
-	return JsonObj->GetNumberField(FieldName);
+	return GetJsonObj()->GetNumberField(FieldName);
 }
 
 void UVaRestJsonObject::SetNumberField(const FString& FieldName, float Number)
@@ -208,7 +366,7 @@ void UVaRestJsonObject::SetNumberField(const FString& FieldName, float Number)
 		return;
 	}
 
-	JsonObj->SetNumberField(FieldName, Number);
+	GetJsonObj()->SetNumberField(FieldName, Number);
 }
 
 void UVaRestJsonObject::SetNumberFieldDouble(const FString& FieldName, double Number)
@@ -218,18 +376,18 @@ void UVaRestJsonObject::SetNumberFieldDouble(const FString& FieldName, double Nu
 		return;
 	}
 
-	JsonObj->SetNumberField(FieldName, Number);
+	GetJsonObj()->SetNumberField(FieldName, Number);
 }
 
 int32 UVaRestJsonObject::GetIntegerField(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Number>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Number>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("No field with name %s of type Number"), *FieldName);
 		return 0;
 	}
 
-	return JsonObj->GetIntegerField(FieldName);
+	return GetJsonObj()->GetIntegerField(FieldName);
 }
 
 void UVaRestJsonObject::SetIntegerField(const FString& FieldName, int32 Number)
@@ -239,18 +397,18 @@ void UVaRestJsonObject::SetIntegerField(const FString& FieldName, int32 Number)
 		return;
 	}
 
-	JsonObj->SetNumberField(FieldName, Number);
+	GetJsonObj()->SetNumberField(FieldName, Number);
 }
 
 int64 UVaRestJsonObject::GetInt64Field(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Number>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Number>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("No field with name %s of type Number"), *FieldName);
 		return 0;
 	}
 
-	return static_cast<int64>(JsonObj->GetNumberField(FieldName));
+	return FVaRestJsonNumber::GetInt64(*GetJsonObj()->GetField<EJson::Number>(FieldName));
 }
 
 void UVaRestJsonObject::SetInt64Field(const FString& FieldName, int64 Number)
@@ -260,18 +418,22 @@ void UVaRestJsonObject::SetInt64Field(const FString& FieldName, int64 Number)
 		return;
 	}
 
-	JsonObj->SetNumberField(FieldName, Number);
+	FVaRestJsonNumber Value;
+	Value.Value = (double)Number;
+	Value.Integer = Number;
+	Value.bInteger = true;
+	GetJsonObj()->SetField(FieldName, Value.ToJsonValue());
 }
 
 FString UVaRestJsonObject::GetStringField(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::String>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::String>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("No field with name %s of type String"), *FieldName);
 		return TEXT("");
 	}
 
-	return JsonObj->GetStringField(FieldName);
+	return GetJsonObj()->GetStringField(FieldName);
 }
 
 void UVaRestJsonObject::SetStringField(const FString& FieldName, const FString& StringValue)
@@ -281,18 +443,18 @@ void UVaRestJsonObject::SetStringField(const FString& FieldName, const FString&
 		return;
 	}
 
-	JsonObj->SetStringField(FieldName, StringValue);
+	GetJsonObj()->SetStringField(FieldName, StringValue);
 }
 
 bool UVaRestJsonObject::GetBoolField(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Boolean>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Boolean>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("No field with name %s of type Boolean"), *FieldName);
 		return false;
 	}
 
-	return JsonObj->GetBoolField(FieldName);
+	return GetJsonObj()->GetBoolField(FieldName);
 }
 
 void UVaRestJsonObject::SetBoolField(const FString& FieldName, bool InValue)
@@ -302,7 +464,7 @@ void UVaRestJsonObject::SetBoolField(const FString& FieldName, bool InValue)
 		return;
 	}
 
-	JsonObj->SetBoolField(FieldName, InValue);
+	GetJsonObj()->SetBoolField(FieldName, InValue);
 }
 
 TArray<UVaRestJsonValue*> UVaRestJsonObject::GetArrayField(const FString& FieldName) const
@@ -313,13 +475,13 @@ TArray<UVaRestJsonValue*> UVaRestJsonObject::GetArrayField(const FString& FieldN
 		return OutArray;
 	}
 
-	if (!JsonObj->HasTypedField<EJson::Array>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Array"), *VA_FUNC_LINE, *FieldName);
 		return OutArray;
 	}
 
-	TArray<TSharedPtr<FJsonValue>> ValArray = JsonObj->GetArrayField(FieldName);
+	TArray<TSharedPtr<FJsonValue>> ValArray = GetJsonObj()->GetArrayField(FieldName);
 	for (auto Value : ValArray)
 	{
 		UVaRestJsonValue* NewValue = NewObject<UVaRestJsonValue>();
@@ -382,7 +544,7 @@ void UVaRestJsonObject::SetArrayField(const FString& FieldName, const TArray<UVa
 		}
 	}
 
-	JsonObj->SetArrayField(FieldName, ValArray);
+	GetJsonObj()->SetArrayField(FieldName, ValArray);
 }
 
 void UVaRestJsonObject::MergeJsonObject(UVaRestJsonObject* InJsonObject, bool Overwrite)
@@ -407,13 +569,13 @@ void UVaRestJsonObject::MergeJsonObject(UVaRestJsonObject* InJsonObject, bool Ov
 
 UVaRestJsonObject* UVaRestJsonObject::GetObjectField(const FString& FieldName) const
 {
-	if (!JsonObj->HasTypedField<EJson::Object>(FieldName))
+	if (!GetJsonObj()->HasTypedField<EJson::Object>(FieldName))
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Object"), *VA_FUNC_LINE, *FieldName);
 		return nullptr;
 	}
 
-	const TSharedPtr<FJsonObject> JsonObjField = JsonObj->GetObjectField(FieldName);
+	const TSharedPtr<FJsonObject> JsonObjField = GetJsonObj()->GetObjectField(FieldName);
 
 	UVaRestJsonObject* OutRestJsonObj = NewObject<UVaRestJsonObject>();
 	OutRestJsonObj->SetRootObject(JsonObjField);
@@ -428,7 +590,7 @@ void UVaRestJsonObject::SetObjectField(const FString& FieldName, UVaRestJsonObje
 		return;
 	}
 
-	JsonObj->SetObjectField(FieldName, JsonObject->GetRootObject());
+	GetJsonObj()->SetObjectField(FieldName, JsonObject->GetRootObject());
 }
 
 void UVaRestJsonObject::SetMapFields_string(const TMap<FString, FString>& Fields)
@@ -486,7 +648,7 @@ void UVaRestJsonObject::SetNumberArrayField(const FString& FieldName, const TArr
 		EntriesArray.Add(MakeShareable(new FJsonValueNumber(Number)));
 	}
 
-	JsonObj->SetArrayField(FieldName, EntriesArray);
+	GetJsonObj()->SetArrayField(FieldName, EntriesArray);
 }
 
 void UVaRestJsonObject::SetNumberArrayFieldDouble(const FString& FieldName, const TArray<double>& NumberArray)
@@ -503,19 +665,19 @@ void UVaRestJsonObject::SetNumberArrayFieldDouble(const FString& FieldName, cons
 		EntriesArray.Add(MakeShareable(new FJsonValueNumber(Number)));
 	}
 
-	JsonObj->SetArrayField(FieldName, EntriesArray);
+	GetJsonObj()->SetArrayField(FieldName, EntriesArray);
 }
 
 TArray<FString> UVaRestJsonObject::GetStringArrayField(const FString& FieldName) const
 {
 	TArray<FString> StringArray;
-	if (!JsonObj->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
+	if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Array"), *VA_FUNC_LINE, *FieldName);
 		return StringArray;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = JsonObj->GetArrayField(FieldName);
+	const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = GetJsonObj()->GetArrayField(FieldName);
 	for (TArray<TSharedPtr<FJsonValue>>::TConstIterator It(JsonArrayValues); It; ++It)
 	{
 		const auto Value = (*It).Get();
@@ -543,19 +705,19 @@ void UVaRestJsonObject::SetStringArrayField(const FString& FieldName, const TArr
 		EntriesArray.Add(MakeShareable(new FJsonValueString(String)));
 	}
 
-	JsonObj->SetArrayField(FieldName, EntriesArray);
+	GetJsonObj()->SetArrayField(FieldName, EntriesArray);
 }
 
 TArray<bool> UVaRestJsonObject::GetBoolArrayField(const FString& FieldName) const
 {
 	TArray<bool> BoolArray;
-	if (!JsonObj->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
+	if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Array"), *VA_FUNC_LINE, *FieldName);
 		return BoolArray;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = JsonObj->GetArrayField(FieldName);
+	const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = GetJsonObj()->GetArrayField(FieldName);
 	for (TArray<TSharedPtr<FJsonValue>>::TConstIterator It(JsonArrayValues); It; ++It)
 	{
 		const auto Value = (*It).Get();
@@ -583,19 +745,19 @@ void UVaRestJsonObject::SetBoolArrayField(const FString& FieldName, const TArray
 		EntriesArray.Add(MakeShareable(new FJsonValueBoolean(Boolean)));
 	}
 
-	JsonObj->SetArrayField(FieldName, EntriesArray);
+	GetJsonObj()->SetArrayField(FieldName, EntriesArray);
 }
 
 TArray<UVaRestJsonObject*> UVaRestJsonObject::GetObjectArrayField(const FString& FieldName) const
 {
 	TArray<UVaRestJsonObject*> OutArray;
-	if (!JsonObj->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
+	if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
 	{
 		UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Array"), *VA_FUNC_LINE, *FieldName);
 		return OutArray;
 	}
 
-	TArray<TSharedPtr<FJsonValue>> ValArray = JsonObj->GetArrayField(FieldName);
+	TArray<TSharedPtr<FJsonValue>> ValArray = GetJsonObj()->GetArrayField(FieldName);
 	for (const auto& Value : ValArray)
 	{
 		if (Value->Type != EJson::Object)
@@ -630,7 +792,7 @@ void UVaRestJsonObject::SetObjectArrayField(const FString& FieldName, const TArr
 		EntriesArray.Add(MakeShareable(new FJsonValueObject(Value->GetRootObject())));
 	}
 
-	JsonObj->SetArrayField(FieldName, EntriesArray);
+	GetJsonObj()->SetArrayField(FieldName, EntriesArray);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -639,24 +801,40 @@ void UVaRestJsonObject::SetObjectArrayField(const FString& FieldName, const TArr
 int32 UVaRestJsonObject::DeserializeFromUTF8Bytes(const ANSICHAR* Bytes, int32 Size)
 {
 	FJSONReader Reader;
+	Reader.ReadUtf8(Bytes, Size);
 
-	const ANSICHAR* EndByte = Bytes + Size;
-	while (Bytes < EndByte)
+	SetRootObject(Reader.State.Root);
+	return Reader.State.Size;
+}
+
+int32 UVaRestJsonObject::DeserializeFromUTF8BytesFast(const ANSICHAR* Bytes, int32 Size)
+{
+	FString Error;
+	const TSharedPtr<FJsonValue> Value = FVaRestJsonFastParser::Parse(Bytes, Size, &Error);
+	if (!Value.IsValid() || Value->Type != EJson::Object)
 	{
-		TCHAR Char = FUtf8Helper::CodepointFromUtf8(Bytes, EndByte - Bytes);
-		if (Char > 0xFFFF)
-		{
-			Char = UNICODE_BOGUS_CHAR_CODEPOINT;
-		}
+		UE_LOG(LogVaRest, Error, TEXT("%s: Json decoding failed: %s"), *VA_FUNC_LINE, Value.IsValid() ? TEXT("root is not an object") : *Error);
+		Reset();
+		return 0;
+	}
 
-		if (!Reader.Read(Char))
-		{
-			break;
-		}
+	SetRootObject(Value->AsObject());
+	return Size;
+}
+
+int32 UVaRestJsonObject::DeserializeFromUTF8BytesCompact(const ANSICHAR* Bytes, int32 Size)
+{
+	FString Error;
+	const TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> Document = FVaRestJsonDocument::Parse(Bytes, Size, &Error);
+	if (!Document.IsValid() || Document->GetRoot().Type != EVaRestJsonNodeType::Object)
+	{
+		UE_LOG(LogVaRest, Error, TEXT("%s: Json decoding failed: %s"), *VA_FUNC_LINE, Document.IsValid() ? TEXT("root is not an object") : *Error);
+		Reset();
+		return 0;
 	}
 
-	SetRootObject(Reader.State.Root);
-	return Reader.State.Size;
+	SetRootDocument(Document);
+	return Size;
 }
 
 int32 UVaRestJsonObject::DeserializeFromTCHARBytes(const TCHAR* Bytes, int32 Size)
@@ -676,69 +854,84 @@ int32 UVaRestJsonObject::DeserializeFromTCHARBytes(const TCHAR* Bytes, int32 Siz
 	return Reader.State.Size;
 }
 
-void UVaRestJsonObject::DecodeFromArchive(TUniquePtr<FArchive>& Reader)
+bool UVaRestJsonObject::DecodeFromArchive(TUniquePtr<FArchive>& Reader)
 {
-	FArchive& Ar = (*Reader.Get());
-	uint8 SymbolBytes[2];
+	FArchive& Ar = *Reader.Get();
 
-	// Read first two bytes
-	Ar << SymbolBytes[0];
-	Ar << SymbolBytes[1];
+	// Room for a block and the tail of the previous one
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(ARCHIVE_BLOCK_SIZE + 4);
+	TArray<ANSICHAR> Utf8;
 
-	bool bIsIntelByteOrder = true;
-
-	if (SymbolBytes[0] == 0xff && SymbolBytes[1] == 0xfe)
-	{
-		// Unicode Intel byte order. Less 1 for the FFFE header, additional 1 for null terminator.
-		bIsIntelByteOrder = true;
-	}
-	else if (SymbolBytes[0] == 0xfe && SymbolBytes[1] == 0xff)
-	{
-		// Unicode non-Intel byte order. Less 1 for the FFFE header, additional 1 for null terminator.
-		bIsIntelByteOrder = false;
-	}
+	EArchiveEncoding Encoding = EArchiveEncoding::Utf8;
+	int32 Pending = 0;
+	bool bFirstBlock = true;
+	bool bParsing = true;
 
 	FJSONReader JsonReader;
-	TCHAR Char;
 
-	while (!Ar.AtEnd())
+	while (bParsing)
 	{
-		Ar << SymbolBytes[0];
+		const int32 Count = (int32)FMath::Min<int64>(ARCHIVE_BLOCK_SIZE, Ar.TotalSize() - Ar.Tell());
+		if (Count <= 0)
+		{
+			break;
+		}
 
-		if (Ar.AtEnd())
+		Ar.Serialize(Buffer.GetData() + Pending, Count);
+		if (Ar.IsError())
 		{
+			UE_LOG(LogVaRest, Error, TEXT("%s: Can't read %s"), *VA_FUNC_LINE, *Ar.GetArchiveName());
+			bParsing = false;
 			break;
 		}
 
-		Ar << SymbolBytes[1];
+		const uint8* Data = Buffer.GetData();
+		int32 Size = Pending + Count;
+		if (bFirstBlock)
+		{
+			const int32 BOMSize = DetectArchiveEncoding(Data, Size, Encoding);
+			Data += BOMSize;
+			Size -= BOMSize;
+			bFirstBlock = false;
+		}
 
-		if (bIsIntelByteOrder)
+		// Sequence cut by the block end is completed by the next one
+		const bool bLastBlock = Ar.Tell() >= Ar.TotalSize();
+		if (Encoding == EArchiveEncoding::Utf8)
 		{
-			Char = CharCast<TCHAR>(static_cast<UCS2CHAR>(static_cast<uint16>(SymbolBytes[0]) + static_cast<uint16>(SymbolBytes[1]) * 256));
+			Pending = bLastBlock ? 0 : GetIncompleteUtf8Size(Data, Size);
+			bParsing = JsonReader.ReadUtf8((const ANSICHAR*)Data, Size - Pending);
 		}
 		else
 		{
-			Char = CharCast<TCHAR>(static_cast<UCS2CHAR>(static_cast<uint16>(SymbolBytes[1]) + static_cast<uint16>(SymbolBytes[0]) * 256));
+			Pending = ConvertUtf16ToUtf8(Data, Size, Encoding == EArchiveEncoding::Utf16BE, bLastBlock, Utf8);
+			bParsing = JsonReader.ReadUtf8(Utf8.GetData(), Utf8.Num());
 		}
 
-		if (!JsonReader.Read(Char))
-		{
-			break;
-		}
+		FMemory::Memmove(Buffer.GetData(), Data + Size - Pending, Pending);
 	}
 
-	SetRootObject(JsonReader.State.Root);
-
 	if (!Ar.Close())
 	{
 		UE_LOG(LogVaRest, Error, TEXT("UVaRestJsonObject::DecodeFromArchive: Error! Can't close file!"));
 	}
+
+	// Root object is popped from the stack on its closing bracket
+	if (!bParsing || !JsonReader.State.Root.IsValid() || JsonReader.State.Objects.Num() > 0)
+	{
+		Reset();
+		return false;
+	}
+
+	SetRootObject(JsonReader.State.Root);
+	return true;
 }
 
 //////////////////////////////////////////////////////////////////////////
 // Serialize
 
-bool UVaRestJsonObject::WriteToFile(const FString& Path) const
+bool UVaRestJsonObject::WriteToFile(const FString& Path, bool bUseUtf16) const
 {
 	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Path));
 	if (!FileWriter)
@@ -746,50 +939,16 @@ bool UVaRestJsonObject::WriteToFile(const FString& Path) const
 		return false;
 	}
 
-	FArchive& Ar = *FileWriter.Get();
-
-	UCS2CHAR BOM = UNICODE_BOM;
-	Ar.Serialize(&BOM, sizeof(UCS2CHAR));
-
-	FString Str = FString(TEXT("{"));
-	WriteStringToArchive(Ar, *Str, Str.Len());
-
-	int32 ElementCount = 0;
-	FJSONWriter JsonWriter;
-	for (auto JsonObjectValuePair : JsonObj->Values)
-	{
-		Str = FString(TEXT("\""));
-		WriteStringToArchive(Ar, *Str, Str.Len());
-
-		const TCHAR* BufferPtr = *JsonObjectValuePair.Key;
-		for (int i = 0; i < JsonObjectValuePair.Key.Len(); ++i)
-		{
-			Str = FString(1, &BufferPtr[i]);
-			WriteStringToArchive(Ar, *Str, Str.Len());
-		}
-
-		Str = FString(TEXT("\""));
-		WriteStringToArchive(Ar, *Str, Str.Len());
-
-		Str = FString(TEXT(":"));
-		WriteStringToArchive(Ar, *Str, Str.Len());
-
-		++ElementCount;
-
-		JsonWriter.Write(JsonObjectValuePair.Value, FileWriter.Get(), ElementCount >= JsonObj->Values.Num());
-	}
-
-	Str = FString(TEXT("}"));
-	WriteStringToArchive(Ar, *Str, Str.Len());
-
-	FileWriter->Close();
+	FJSONWriter JsonWriter(*FileWriter, bUseUtf16);
+	JsonWriter.Write(*GetJsonObj());
+	JsonWriter.Flush();
 
-	return true;
+	return FileWriter->Close();
 }
 
-bool UVaRestJsonObject::WriteToFilePath(const FString& Path, const bool bIsRelativeToProjectDir)
+bool UVaRestJsonObject::WriteToFilePath(const FString& Path, const bool bIsRelativeToProjectDir, const bool bUseUtf16)
 {
-	return WriteToFile(bIsRelativeToProjectDir ? FPaths::ProjectDir() / Path : Path);
+	return WriteToFile(bIsRelativeToProjectDir ? FPaths::ProjectDir() / Path : Path, bUseUtf16);
 }
 
 bool UVaRestJsonObject::WriteStringToArchive(FArchive& Ar, const TCHAR* StrPtr, int64 Len)
@@ -2,11 +2,29 @@
 
 #include "VaRestJsonParser.h"
 
-#include "VaRestJsonObject.h"
+#include "VaRestJsonNumber.h"
 
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 
+namespace
+{
+	/** FJSONWriter flushes its buffer to archive once it holds this much */
+	constexpr int32 WRITER_BLOCK_SIZE = 64 * 1024;
+
+	/** Escape character for ascii characters json strings can't hold as is, 'u' for \u00XX */
+	constexpr ANSICHAR EscapeTable[128] = {
+		'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+		'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+		0, 0, '"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+} // namespace
+
 uint32 FUtf8Helper::CodepointFromUtf8(const ANSICHAR*& SourceString, const uint32 SourceLengthRemaining)
 {
 	checkSlow(SourceLengthRemaining > 0);
@@ -238,6 +256,10 @@ FJSONState::FJSONState()
 	, bEscape(false)
 	, bError(false)
 	, Quote(UNICODE_BOGUS_CHAR_CODEPOINT)
+	, bUtf8(false)
+	, UnicodeDigits(0)
+	, Unicode(0)
+	, HighSurrogate(0)
 {
 	Key.Reserve(1024);
 	Data.Reserve(4096);
@@ -321,7 +343,7 @@ void FJSONState::PopValue(bool bCheckType)
 {
 	if (Objects.Num() > 0)
 	{
-		const auto Value = Objects.Last(0);
+		TSharedPtr<FJsonValue> Value = Objects.Last(0);
 		if (Value->Type == EJson::Object || Value->Type == EJson::Array)
 		{
 			if (bCheckType)
@@ -355,36 +377,20 @@ void FJSONState::PopValue(bool bCheckType)
 				}
 				case EJson::Number:
 				{
-					const FString LowerCase = Data.ToLower();
-					int32 ePosition = INDEX_NONE;
-					LowerCase.FindChar('e', ePosition);
-					if (ePosition == INDEX_NONE)
+					const TCHAR* Ptr = *Data;
+					const TCHAR* End = Ptr + Data.Len();
+					FVaRestJsonNumber Number;
+					if (!FVaRestJsonNumber::Parse(Ptr, End, Number) || Ptr != End)
 					{
-						if (LowerCase.IsNumeric())
-						{
-							((FJsonValueNonConstNumber*)Value.Get())->AsNonConstNumber() = FCString::Atod(*LowerCase);
-						}
-						else
-						{
-							bError = true;
-						}
+						bError = true;
 					}
-					else if (LowerCase.Len() > ePosition + 2)
+					else if (Number.NeedsInt64())
 					{
-						const FString Left = LowerCase.Left(ePosition);
-						const FString Rigth = LowerCase.Right(LowerCase.Len() - ePosition - 1);
-						if (Left.IsNumeric() && Rigth.IsNumeric())
-						{
-							((FJsonValueNonConstNumber*)Value.Get())->AsNonConstNumber() = FCString::Atod(*Left) * FMath::Pow(10.f, FCString::Atoi(*Rigth));
-						}
-						else
-						{
-							bError = true;
-						}
+						Value = Number.ToJsonValue();
 					}
 					else
 					{
-						bError = true;
+						((FJsonValueNonConstNumber*)Value.Get())->AsNonConstNumber() = Number.Value;
 					}
 					break;
 				}
@@ -419,11 +425,7 @@ void FJSONState::PopValue(bool bCheckType)
 				{
 					if (Key.Len() > 0)
 					{
-						FString KeyCopy = Key;
-						KeyCopy.Shrink();
-						Container->AsObject()->SetField(KeyCopy, Value);
-						Size += KeyCopy.GetAllocatedSize();
-						ClearKey();
+						SetField(*Container->AsObject(), Value);
 					}
 					else
 					{
@@ -550,6 +552,17 @@ void FJSONState::ClearKey()
 	Key.Reset();
 }
 
+void FJSONState::SetField(FJsonObject& Object, const TSharedPtr<FJsonValue>& Value)
+{
+	// FJsonObject owns a copy of every key, keep it exactly sized
+	FString FieldKey = Key;
+	FieldKey.Shrink();
+	Size += FieldKey.GetAllocatedSize();
+
+	Object.Values.Add(MoveTemp(FieldKey), Value);
+	ClearKey();
+}
+
 void FJSONState::DataToKey()
 {
 	ClearKey();
@@ -557,6 +570,92 @@ void FJSONState::DataToKey()
 	ClearData();
 }
 
+void FJSONState::AppendCodepoint(uint32 Codepoint)
+{
+	if (bUtf8)
+	{
+		if (Codepoint < 0x80)
+		{
+			Utf8Data.Add((ANSICHAR)Codepoint);
+		}
+		else if (Codepoint < 0x800)
+		{
+			Utf8Data.Add((ANSICHAR)(0xC0 | (Codepoint >> 6)));
+			Utf8Data.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+		else if (Codepoint < 0x10000)
+		{
+			Utf8Data.Add((ANSICHAR)(0xE0 | (Codepoint >> 12)));
+			Utf8Data.Add((ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Utf8Data.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+		else
+		{
+			Utf8Data.Add((ANSICHAR)(0xF0 | (Codepoint >> 18)));
+			Utf8Data.Add((ANSICHAR)(0x80 | ((Codepoint >> 12) & 0x3F)));
+			Utf8Data.Add((ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Utf8Data.Add((ANSICHAR)(0x80 | (Codepoint & 0x3F)));
+		}
+	}
+	else if (Codepoint > 0xFFFF)
+	{
+		Data.AppendChar((TCHAR)(0xD800 + ((Codepoint - 0x10000) >> 10)));
+		Data.AppendChar((TCHAR)(0xDC00 + ((Codepoint - 0x10000) & 0x3FF)));
+	}
+	else
+	{
+		Data.AppendChar((TCHAR)Codepoint);
+	}
+}
+
+void FJSONState::AppendEscapedUnicode(uint32 CodeUnit)
+{
+	if (StringConv::IsHighSurrogate(CodeUnit))
+	{
+		FlushSurrogate();
+		HighSurrogate = CodeUnit;
+	}
+	else if (StringConv::IsLowSurrogate(CodeUnit))
+	{
+		if (HighSurrogate != 0)
+		{
+			AppendCodepoint(0x10000 + ((HighSurrogate - 0xD800) << 10) + (CodeUnit - 0xDC00));
+			HighSurrogate = 0;
+		}
+		else
+		{
+			AppendCodepoint(UNICODE_BOGUS_CHAR_CODEPOINT);
+		}
+	}
+	else
+	{
+		FlushSurrogate();
+		AppendCodepoint(CodeUnit);
+	}
+}
+
+void FJSONState::FlushSurrogate()
+{
+	// Unpaired surrogate can't be represented, replace it
+	if (HighSurrogate != 0)
+	{
+		HighSurrogate = 0;
+		AppendCodepoint(UNICODE_BOGUS_CHAR_CODEPOINT);
+	}
+}
+
+void FJSONState::FlushUtf8()
+{
+	FlushSurrogate();
+
+	if (Utf8Data.Num() > 0)
+	{
+		const FUTF8ToTCHAR Converted(Utf8Data.GetData(), Utf8Data.Num());
+		Data.AppendChars(Converted.Get(), Converted.Length());
+		Utf8Data.Reset();
+	}
+}
+
 void FJSONState::Error()
 {
 	bError = true;
@@ -576,6 +675,11 @@ bool FJSONReader::IsSpace(const TCHAR& Char)
 	return IsNewLine(Char) || Char == ' ' || Char == '\t' || Char == '\r';
 }
 
+bool FJSONReader::IsNumberChar(const TCHAR& Char)
+{
+	return (Char >= '0' && Char <= '9') || Char == '-' || Char == '.' || Char == '+' || Char == 'e' || Char == 'E';
+}
+
 bool FJSONReader::FindToken(const TCHAR& Char)
 {
 	if (State.bEscape)
@@ -629,8 +733,7 @@ void FJSONReader::UpdateNotation()
 				const auto Value = State.GetObject();
 				if (Value != nullptr)
 				{
-					Value->AsObject()->SetField(State.Key, State.PushObject());
-					State.ClearKey();
+					State.SetField(*Value->AsObject(), State.PushObject());
 				}
 				else
 				{
@@ -711,8 +814,7 @@ void FJSONReader::UpdateNotation()
 				const auto Value = State.GetObject();
 				if (Value != nullptr)
 				{
-					Value->AsObject()->SetField(State.Key, State.PushArray());
-					State.ClearKey();
+					State.SetField(*Value->AsObject(), State.PushArray());
 				}
 				else
 				{
@@ -814,7 +916,7 @@ void FJSONReader::UpdateNotation()
 	}
 }
 
-void FJSONReader::ReadAsString(const TCHAR& Char)
+void FJSONReader::ReadAsString(TCHAR Char)
 {
 	if (IsNewLine(Char))
 	{
@@ -822,8 +924,47 @@ void FJSONReader::ReadAsString(const TCHAR& Char)
 		return;
 	}
 
+	if (State.UnicodeDigits > 0)
+	{
+		int32 Digit = -1;
+		if (Char >= '0' && Char <= '9')
+		{
+			Digit = Char - '0';
+		}
+		else if (Char >= 'a' && Char <= 'f')
+		{
+			Digit = Char - 'a' + 10;
+		}
+		else if (Char >= 'A' && Char <= 'F')
+		{
+			Digit = Char - 'A' + 10;
+		}
+
+		if (Digit < 0)
+		{
+			State.Error();
+			return;
+		}
+
+		State.Unicode = (State.Unicode << 4) | (uint32)Digit;
+		if (--State.UnicodeDigits == 0)
+		{
+			State.AppendEscapedUnicode(State.Unicode);
+		}
+		return;
+	}
+
 	if (!State.bEscape && State.Quote == Char)
 	{
+		if (State.bUtf8)
+		{
+			State.FlushUtf8();
+		}
+		else
+		{
+			State.FlushSurrogate();
+		}
+
 		State.Quote = UNICODE_BOGUS_CHAR_CODEPOINT;
 		State.Notation = EJSONNotation::SKIP;
 	}
@@ -833,15 +974,20 @@ void FJSONReader::ReadAsString(const TCHAR& Char)
 		{
 			switch (Char)
 			{
-			case 'n': State.Data.AppendChar('\n'); break;
-			case 't': State.Data.AppendChar('\t'); break;
-			default: State.Data.AppendChar(Char); break;
+			case 'u':
+				State.UnicodeDigits = 4;
+				State.Unicode = 0;
+				return;
+			case 'n': Char = '\n'; break;
+			case 't': Char = '\t'; break;
+			case 'r': Char = '\r'; break;
+			case 'b': Char = '\b'; break;
+			case 'f': Char = '\f'; break;
 			}
 		}
-		else
-		{
-			State.Data.AppendChar(Char);
-		}
+
+		State.FlushSurrogate();
+		State.AppendCodepoint(Char);
 	}
 }
 
@@ -864,7 +1010,7 @@ void FJSONReader::ReadAsNumber(const TCHAR& Char)
 		return;
 	}
 
-	if ((Char >= '0' && Char <= '9') || Char == '-' || Char == '.' || Char == '+' || Char == 'e' || Char == 'E')
+	if (IsNumberChar(Char))
 	{
 		State.Data.AppendChar(Char);
 	}
@@ -998,153 +1144,313 @@ bool FJSONReader::Read(const TCHAR Char)
 	return true;
 }
 
-FJSONWriter::FJSONWriter()
+bool FJSONReader::ReadUtf8(const ANSICHAR* Bytes, int32 Size)
 {
-}
+	State.bUtf8 = true;
 
-bool FJSONWriter::GetStartChar(const TSharedPtr<FJsonValue>& JsonValue, FString& Str)
-{
-	switch (JsonValue->Type)
+	const ANSICHAR* Ptr = Bytes;
+	const ANSICHAR* End = Bytes + Size;
+	while (Ptr < End)
 	{
-	case EJson::Object:
-		Str = FString(TEXT("{"));
-		break;
-	case EJson::Array:
-		Str = FString(TEXT("["));
-		break;
-	case EJson::String:
-		Str = FString(TEXT("\""));
-		break;
-	default:
-		return false;
-		break;
+		// Inside a string everything up to quote, escape or line break is copied as is
+		if (State.Notation == EJSONNotation::STRING && !State.bEscape && State.UnicodeDigits == 0)
+		{
+			const ANSICHAR Quote = (ANSICHAR)State.Quote;
+			const ANSICHAR* Run = Ptr;
+			while (Run < End && *Run != Quote && *Run != '\\' && *Run != '\n')
+			{
+				++Run;
+			}
+
+			if (Run > Ptr)
+			{
+				State.FlushSurrogate();
+				State.Utf8Data.Append(Ptr, (int32)(Run - Ptr));
+				Ptr = Run;
+				continue;
+			}
+		}
+
+		// Number characters are copied as a run, the number is validated once it is complete
+		if (State.Notation == EJSONNotation::NUMBER && !State.bEscape)
+		{
+			const ANSICHAR* Run = Ptr;
+			while (Run < End && IsNumberChar(*Run))
+			{
+				++Run;
+			}
+
+			if (Run > Ptr)
+			{
+				State.Data.Append(Ptr, (int32)(Run - Ptr));
+				Ptr = Run;
+				continue;
+			}
+		}
+
+		TCHAR Char;
+		if ((uint8)*Ptr < 0x80)
+		{
+			Char = (TCHAR)*Ptr++;
+		}
+		else
+		{
+			const uint32 Codepoint = FUtf8Helper::CodepointFromUtf8(Ptr, End - Ptr);
+			Char = Codepoint > 0xFFFF ? UNICODE_BOGUS_CHAR_CODEPOINT : (TCHAR)Codepoint;
+		}
+
+		if (!Read(Char))
+		{
+			return false;
+		}
 	}
 
 	return true;
 }
 
-bool FJSONWriter::GetEndChar(const TSharedPtr<FJsonValue>& JsonValue, FString& Str)
+FJSONWriter::FJSONWriter(FArchive& InArchive, bool bInUtf16)
+	: Archive(InArchive)
+	, bUtf16(bInUtf16)
 {
-	switch (JsonValue->Type)
+	Buffer.Reserve(WRITER_BLOCK_SIZE * 2);
+
+	if (bUtf16)
 	{
-	case EJson::Object:
-		Str = FString(TEXT("}"));
-		break;
-	case EJson::Array:
-		Str = FString(TEXT("]"));
-		break;
-	case EJson::String:
-		Str = FString(TEXT("\""));
-		break;
-	default:
-		return false;
-		break;
+		UTF16CHAR BOM = UNICODE_BOM;
+		Archive.Serialize(&BOM, sizeof(BOM));
 	}
+}
 
-	return true;
+FJSONWriter::~FJSONWriter()
+{
+	Flush();
 }
 
-void FJSONWriter::Write(TSharedPtr<FJsonValue> JsonValue, FArchive* Writer, bool IsLastElement)
+void FJSONWriter::Write(const FJsonObject& Object)
 {
-	FString Str;
-	FArchive& Ar = *Writer;
+	WriteChar('{');
 
-	if (GetStartChar(JsonValue, Str))
+	bool bFirst = true;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
 	{
-		UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+		if (!bFirst)
+		{
+			WriteChar(',');
+		}
+		bFirst = false;
+
+		WriteString(Pair.Key);
+		WriteChar(':');
+
+		if (Pair.Value.IsValid())
+		{
+			Write(*Pair.Value);
+		}
+		else
+		{
+			WriteRaw("null", 4);
+		}
 	}
 
-	switch (JsonValue->Type)
+	WriteChar('}');
+}
+
+void FJSONWriter::Write(const FJsonValue& JsonValue)
+{
+	switch (JsonValue.Type)
 	{
 	case EJson::Object:
 	{
-		int ElementsCount = 0;
-		auto Values = JsonValue->AsObject()->Values;
-
-		for (auto& ChildJsonPair : Values)
+		const TSharedPtr<FJsonObject>& Object = JsonValue.AsObject();
+		if (Object.IsValid())
 		{
-			Str = FString(TEXT("\""));
-			UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+			Write(*Object);
+		}
+		else
+		{
+			WriteRaw("null", 4);
+		}
+		break;
+	}
+	case EJson::Array:
+	{
+		WriteChar('[');
 
-			const TCHAR* BufferPtr = *ChildJsonPair.Key;
-			for (int i = 0; i < ChildJsonPair.Key.Len(); ++i)
+		const TArray<TSharedPtr<FJsonValue>>& Array = JsonValue.AsArray();
+		for (int32 i = 0; i < Array.Num(); ++i)
+		{
+			if (i > 0)
 			{
-				Str = FString(1, &ChildJsonPair.Key[i]);
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+				WriteChar(',');
 			}
 
-			Str = FString(TEXT("\""));
-			UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-
-			Str = FString(TEXT(":"));
-			UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-
-			++ElementsCount;
-
-			Write(ChildJsonPair.Value, Writer, ElementsCount >= Values.Num());
+			if (Array[i].IsValid())
+			{
+				Write(*Array[i]);
+			}
+			else
+			{
+				WriteRaw("null", 4);
+			}
 		}
+
+		WriteChar(']');
 		break;
 	}
-	case EJson::Array:
-	{
-		int ElementsCount = 0;
-		auto Array = JsonValue->AsArray();
-
-		for (auto& ChildJsonValue : Array)
+	case EJson::String: WriteString(JsonValue.AsString()); break;
+	case EJson::Number: WriteNumber(JsonValue); break;
+	case EJson::Boolean:
+		if (JsonValue.AsBool())
+		{
+			WriteRaw("true", 4);
+		}
+		else
 		{
-			++ElementsCount;
-			Write(ChildJsonValue, Writer, ElementsCount >= Array.Num());
+			WriteRaw("false", 5);
 		}
 		break;
+	default: WriteRaw("null", 4); break;
+	}
+
+	if (Buffer.Num() >= WRITER_BLOCK_SIZE)
+	{
+		Flush();
 	}
-	default:
+}
+
+void FJSONWriter::Flush()
+{
+	if (Buffer.Num() == 0)
 	{
-		const FString Value = JsonValue->AsString();
+		return;
+	}
 
-		const TCHAR* BufferPtr = *Value;
-		for (int i = 0; i < Value.Len(); ++i)
+	if (bUtf16)
+	{
+		// Buffer is flushed between values only, so it always holds whole utf-8 sequences
+		const FUTF8ToTCHAR Converted(Buffer.GetData(), Buffer.Num());
+		const auto Utf16 = StringCast<UTF16CHAR>(Converted.Get(), Converted.Length());
+		Archive.Serialize(const_cast<UTF16CHAR*>(Utf16.Get()), Utf16.Length() * sizeof(UTF16CHAR));
+	}
+	else
+	{
+		Archive.Serialize(Buffer.GetData(), Buffer.Num());
+	}
+
+	Buffer.Reset();
+}
+
+void FJSONWriter::WriteString(const FString& String)
+{
+	static const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+	// Every character takes up to 6 bytes when escaped as \u00XX
+	const int32 Len = String.Len();
+	const int32 Start = Buffer.AddUninitialized(Len * 6 + 2);
+	const TCHAR* Src = *String;
+	ANSICHAR* Out = Buffer.GetData() + Start;
+
+	*Out++ = '"';
+	for (int32 i = 0; i < Len; ++i)
+	{
+		uint32 Codepoint = (uint32)Src[i];
+		if (Codepoint < 0x80)
 		{
-			Str = FString(1, &BufferPtr[i]);
-			if (Str == TEXT("\""))
+			const ANSICHAR Escape = EscapeTable[Codepoint];
+			if (Escape == 0)
 			{
-				Str = FString(TEXT("\\"));
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-				Str = FString(1, &BufferPtr[i]);
+				*Out++ = (ANSICHAR)Codepoint;
 			}
-			if (Str == TEXT("\n"))
+			else if (Escape != 'u')
 			{
-				Str = FString(TEXT("\\"));
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-				Str = FString(TEXT("n"));
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-				Str = FString(1, &BufferPtr[i]);
-			}
-			else if (Str == TEXT("\t"))
-			{
-				Str = FString(TEXT("\\"));
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-				Str = FString(TEXT("t"));
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
-				Str = FString(1, &BufferPtr[i]);
+				*Out++ = '\\';
+				*Out++ = Escape;
 			}
 			else
 			{
-				UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+				*Out++ = '\\';
+				*Out++ = 'u';
+				*Out++ = '0';
+				*Out++ = '0';
+				*Out++ = HexDigits[Codepoint >> 4];
+				*Out++ = HexDigits[Codepoint & 0xF];
 			}
+			continue;
 		}
 
-		break;
+		if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF && i + 1 < Len && (uint32)Src[i + 1] >= 0xDC00 && (uint32)Src[i + 1] <= 0xDFFF)
+		{
+			Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + ((uint32)Src[++i] - 0xDC00);
+		}
+		else if (Codepoint >= 0xD800 && Codepoint <= 0xDFFF)
+		{
+			Codepoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+		}
+
+		if (Codepoint < 0x800)
+		{
+			*Out++ = (ANSICHAR)(0xC0 | (Codepoint >> 6));
+		}
+		else if (Codepoint < 0x10000)
+		{
+			*Out++ = (ANSICHAR)(0xE0 | (Codepoint >> 12));
+			*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+		}
+		else
+		{
+			*Out++ = (ANSICHAR)(0xF0 | (Codepoint >> 18));
+			*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 12) & 0x3F));
+			*Out++ = (ANSICHAR)(0x80 | ((Codepoint >> 6) & 0x3F));
+		}
+		*Out++ = (ANSICHAR)(0x80 | (Codepoint & 0x3F));
 	}
+	*Out++ = '"';
+
+	Buffer.SetNum((int32)(Out - Buffer.GetData()), false);
+}
+
+void FJSONWriter::WriteNumber(const FJsonValue& JsonValue)
+{
+	const double Number = JsonValue.AsNumber();
+	if (!FMath::IsFinite(Number))
+	{
+		// Json has no infinity or NaN
+		WriteRaw("null", 4);
+		return;
 	}
 
-	if (GetEndChar(JsonValue, Str))
+	// Integers are written exactly, large ones may be kept as text by the value
+	int64 Integer = 0;
+	bool bInteger = false;
+	if (FMath::Abs(Number) >= (double)(1ll << 53))
 	{
-		UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+		bInteger = JsonValue.TryGetNumber(Integer) && (double)Integer == Number;
+	}
+	else if (Number == FMath::FloorToDouble(Number) && !(Number == 0.0 && FMath::IsNegativeOrNegativeZero(Number)))
+	{
+		Integer = (int64)Number;
+		bInteger = true;
 	}
 
-	if (!IsLastElement)
+	ANSICHAR Text[32];
+	if (bInteger)
+	{
+		uint64 Magnitude = Integer < 0 ? 0ull - (uint64)Integer : (uint64)Integer;
+		ANSICHAR* Digits = Text + UE_ARRAY_COUNT(Text);
+		do
+		{
+			*--Digits = (ANSICHAR)('0' + Magnitude % 10);
+			Magnitude /= 10;
+		} while (Magnitude > 0);
+
+		if (Integer < 0)
+		{
+			*--Digits = '-';
+		}
+		WriteRaw(Digits, (int32)(Text + UE_ARRAY_COUNT(Text) - Digits));
+	}
+	else
 	{
-		Str = FString(TEXT(","));
-		UVaRestJsonObject::WriteStringToArchive(Ar, *Str, Str.Len());
+		WriteRaw(Text, FCStringAnsi::Sprintf(Text, "%.17g", Number));
 	}
 }
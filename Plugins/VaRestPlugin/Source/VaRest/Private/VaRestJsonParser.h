@@ -111,6 +111,21 @@ struct FJSONState
 	/** Las quote for string */
 	TCHAR Quote;
 
+	/** String is accumulated as utf-8 and converted to Data once it is closed */
+	bool bUtf8;
+
+	/** Utf-8 bytes of current string */
+	TArray<ANSICHAR> Utf8Data;
+
+	/** Hex digits left in current \u escape */
+	int32 UnicodeDigits;
+
+	/** Code unit of current \u escape */
+	uint32 Unicode;
+
+	/** High surrogate waiting for its pair */
+	uint32 HighSurrogate;
+
 	/** Size */
 	int32 Size;
 
@@ -159,6 +174,16 @@ struct FJSONState
 
 	FORCEINLINE void DataToKey();
 
+	FORCEINLINE void SetField(FJsonObject& Object, const TSharedPtr<FJsonValue>& Value);
+
+	FORCEINLINE void AppendCodepoint(uint32 Codepoint);
+
+	FORCEINLINE void AppendEscapedUnicode(uint32 CodeUnit);
+
+	FORCEINLINE void FlushSurrogate();
+
+	FORCEINLINE void FlushUtf8();
+
 	FORCEINLINE void Error();
 };
 
@@ -175,11 +200,13 @@ private:
 
 	FORCEINLINE bool IsSpace(const TCHAR& Char);
 
+	FORCEINLINE bool IsNumberChar(const TCHAR& Char);
+
 	FORCEINLINE bool FindToken(const TCHAR& Char);
 
 	FORCEINLINE void UpdateNotation();
 
-	FORCEINLINE void ReadAsString(const TCHAR& Char);
+	FORCEINLINE void ReadAsString(TCHAR Char);
 
 	FORCEINLINE void ReadAsStringSpecial(const TCHAR& Char);
 
@@ -195,16 +222,42 @@ private:
 
 public:
 	bool Read(const TCHAR Char); // @Pushkin
+
+	/** Reads utf-8 text, string contents are copied in runs. Can be fed consecutive chunks */
+	bool ReadUtf8(const ANSICHAR* Bytes, int32 Size);
 };
 
+/** Condensed json writer, text is built in a buffer and written to archive in blocks */
 struct FJSONWriter
 {
-	FJSONWriter();
+	/** Text is utf-8, or utf-16 with byte order mark */
+	FJSONWriter(FArchive& InArchive, bool bInUtf16 = false);
 
-	FORCEINLINE bool GetStartChar(const TSharedPtr<FJsonValue>& JsonValue, FString& Char);
+	/** Writes what is left in the buffer */
+	~FJSONWriter();
 
-	FORCEINLINE bool GetEndChar(const TSharedPtr<FJsonValue>& JsonValue, FString& Char);
+	void Write(const FJsonObject& Object);
 
-public:
-	void Write(TSharedPtr<FJsonValue> JsonValue, FArchive* Writer, bool IsLastElement); // @Pushkin
+	void Write(const FJsonValue& JsonValue);
+
+	/** Writes buffered text to archive */
+	void Flush();
+
+private:
+	FORCEINLINE void WriteChar(ANSICHAR Char) { Buffer.Add(Char); }
+
+	FORCEINLINE void WriteRaw(const ANSICHAR* Text, int32 Len) { Buffer.Append(Text, Len); }
+
+	/** Quoted and escaped string */
+	void WriteString(const FString& String);
+
+	/** Shortest exact form for integers, 17 significant digits otherwise */
+	void WriteNumber(const FJsonValue& JsonValue);
+
+	FArchive& Archive;
+
+	bool bUtf16;
+
+	/** Utf-8 text not written yet, capacity is kept between blocks */
+	TArray<ANSICHAR> Buffer;
 };
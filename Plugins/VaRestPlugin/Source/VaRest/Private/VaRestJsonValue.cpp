@@ -3,6 +3,7 @@
 #include "VaRestJsonValue.h"
 
 #include "VaRestDefines.h"
+#include "VaRestJsonNumber.h"
 #include "VaRestJsonObject.h"
 
 UVaRestJsonValue::UVaRestJsonValue(const FObjectInitializer& ObjectInitializer)
@@ -138,7 +139,7 @@ int64 UVaRestJsonValue::AsInt64() const
 		return 0.f;
 	}
 
-	return static_cast<int64>(JsonVal->AsNumber());
+	return FVaRestJsonNumber::GetInt64(*JsonVal);
 }
 
 FString UVaRestJsonValue::AsString() const
@@ -0,0 +1,85 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#include "VaRestJsonVisitor.h"
+
+#include "VaRestJsonFastParser.h"
+
+namespace
+{
+	/** Forwards walk events to visitor, strings are converted into one reused buffer */
+	struct FVisitorAdapter
+	{
+		FVaRestJsonVisitor& Visitor;
+		FString Buffer;
+
+		explicit FVisitorAdapter(FVaRestJsonVisitor& InVisitor)
+			: Visitor(InVisitor)
+		{
+			Buffer.Reserve(256);
+		}
+
+		bool OnStartObject() { return Visitor.OnStartObject(); }
+		bool OnEndObject() { return Visitor.OnEndObject(); }
+		bool OnStartArray() { return Visitor.OnStartArray(); }
+		bool OnEndArray() { return Visitor.OnEndArray(); }
+		bool OnBoolean(bool bValue) { return Visitor.OnBoolean(bValue); }
+		bool OnNull() { return Visitor.OnNull(); }
+
+		bool OnNumber(double Value, const ANSICHAR* Text, int32 Len)
+		{
+			// Same as FVaRestJsonDomBuilder, large integers are kept exact
+			if (Len > 15)
+			{
+				const ANSICHAR* Ptr = Text;
+				FVaRestJsonNumber Number;
+				if (FVaRestJsonNumber::Parse(Ptr, Text + Len, Number) && Number.NeedsInt64())
+				{
+					return Visitor.OnInt64(Number.Integer);
+				}
+			}
+
+			return Visitor.OnNumber(Value);
+		}
+
+		bool OnKey(const FVaRestJsonStringRef& String)
+		{
+			String.ToString(Buffer);
+			return Visitor.OnKey(Buffer);
+		}
+
+		bool OnString(const FVaRestJsonStringRef& String)
+		{
+			String.ToString(Buffer);
+			return Visitor.OnString(Buffer);
+		}
+	};
+} // namespace
+
+bool FVaRestJsonVisitor::Visit(const ANSICHAR* Data, int32 Size, FString* OutError)
+{
+	FVaRestJsonFastParser::SkipBOM(Data, Size);
+
+	FVaRestJsonStructuralIndex Index;
+	if (!Index.Build(Data, Size))
+	{
+		if (OutError != nullptr)
+		{
+			*OutError = Index.GetError();
+		}
+		return false;
+	}
+
+	FVisitorAdapter Adapter(*this);
+	return FVaRestJsonFastParser::Walk(Data, Size, Index, Adapter, OutError);
+}
+
+bool FVaRestJsonVisitor::Visit(const FString& Text, FString* OutError)
+{
+	const FTCHARToUTF8 Converted(*Text);
+	return Visit((const ANSICHAR*)Converted.Get(), Converted.Length(), OutError);
+}
+
+int32 FVaRestJsonVisitor::ForEachArrayElement(const ANSICHAR* Data, int32 Size, const FString& Path, TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> Callback, FString* OutError)
+{
+	return FVaRestJsonFastParser::ForEachArrayElement(Data, Size, Path, Callback, OutError);
+}
@@ -4,6 +4,8 @@
 
 #include "VaRest.h"
 #include "VaRestDefines.h"
+#include "VaRestJsonValue.h"
+#include "VaRestJsonVisitor.h"
 #include "VaRestRequestJSON.h"
 
 #include "Engine/World.h"
@@ -99,3 +101,33 @@ FVaRestURL UVaRestLibrary::GetWorldURL(UObject* WorldContextObject)
 
 	return FVaRestURL();
 }
+
+int32 UVaRestLibrary::ForEachJsonArrayElement(const FString& JsonString, const FString& Path, const FVaRestArrayElementDelegate& Callback)
+{
+	const FTCHARToUTF8 Converted(*JsonString);
+
+	// one wrapper for all elements, only the value it points to changes
+	UVaRestJsonValue* JsonValue = NewObject<UVaRestJsonValue>();
+
+	const auto ForwardElement = [&Callback, JsonValue](int32 Index, const TSharedPtr<FJsonValue>& Value)
+	{
+		TSharedPtr<FJsonValue> Element = Value;
+		JsonValue->SetRootValue(Element);
+
+		Callback.ExecuteIfBound(Index, JsonValue);
+		return true;
+	};
+
+	FString Error;
+	const int32 Count = FVaRestJsonVisitor::ForEachArrayElement((const ANSICHAR*)Converted.Get(), Converted.Length(), Path, ForwardElement, &Error);
+
+	if (Count == INDEX_NONE)
+	{
+		UE_LOG(LogVaRest, Error, TEXT("%s: %s"), *VA_FUNC_LINE, *Error);
+	}
+
+	TSharedPtr<FJsonValue> Released;
+	JsonValue->SetRootValue(Released);
+
+	return Count;
+}
@@ -3,18 +3,32 @@
 #include "VaRestRequestJSON.h"
 
 #include "VaRestDefines.h"
+#include "VaRestJsonDocument.h"
+#include "VaRestJsonFastParser.h"
+#include "VaRestJsonLazyDocument.h"
 #include "VaRestJsonObject.h"
 #include "VaRestJsonValue.h"
 #include "VaRestLibrary.h"
+#include "VaRestResponseStream.h"
 #include "VaRestSettings.h"
 
 #include "Engine/Engine.h"
 #include "Engine/LatentActionManager.h"
 #include "Engine/World.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/EngineVersionComparison.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
+namespace
+{
+	FString ContentToString(const TArray<uint8>& Bytes)
+	{
+		const FUTF8ToTCHAR Converted((const ANSICHAR*)Bytes.GetData(), Bytes.Num());
+		return FString(Converted.Length(), Converted.Get());
+	}
+} // namespace
+
 FString UVaRestRequestJSON::DeprecatedResponseString(TEXT("DEPRECATED: Please use GetResponseContentAsString() instead"));
 
 template <class T>
@@ -32,6 +46,7 @@ UVaRestRequestJSON::UVaRestRequestJSON(const class FObjectInitializer& PCIP)
 	, BinaryContentType(TEXT("application/octet-stream"))
 {
 	ContinueAction = nullptr;
+	bLazyResponse = false;
 
 	RequestVerb = EVaRestRequestVerb::GET;
 	RequestContentType = EVaRestRequestContentType::x_www_form_urlencoded_url;
@@ -121,6 +136,16 @@ void UVaRestRequestJSON::ResetResponseData()
 		ResponseJsonValue = NewObject<UVaRestJsonValue>();
 	}
 
+	// Only lazy requests need the document
+	if (ResponseLazyDocument != nullptr)
+	{
+		ResponseLazyDocument->Reset();
+	}
+	else if (bLazyResponse)
+	{
+		ResponseLazyDocument = NewObject<UVaRestJsonLazyDocument>();
+	}
+
 	ResponseHeaders.Empty();
 	ResponseCode = -1;
 	ResponseSize = 0;
@@ -132,6 +157,8 @@ void UVaRestRequestJSON::ResetResponseData()
 
 	ResponseBytes.Empty();
 	ResponseContentLength = 0;
+
+	ResponseStream.Reset();
 }
 
 void UVaRestRequestJSON::Cancel()
@@ -184,6 +211,26 @@ UVaRestJsonValue* UVaRestRequestJSON::GetResponseValue() const
 	return ResponseJsonValue;
 }
 
+void UVaRestRequestJSON::SetLazyResponse(bool bLazy)
+{
+	bLazyResponse = bLazy;
+
+	if (bLazyResponse && ResponseLazyDocument == nullptr)
+	{
+		ResponseLazyDocument = NewObject<UVaRestJsonLazyDocument>();
+	}
+}
+
+UVaRestJsonLazyDocument* UVaRestRequestJSON::GetResponseLazyDocument() const
+{
+	if (ResponseLazyDocument == nullptr)
+	{
+		UE_LOG(LogVaRest, Warning, TEXT("%s: Lazy response is not enabled, call SetLazyResponse first"), *VA_FUNC_LINE);
+	}
+
+	return ResponseLazyDocument;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 // Response data access
 
@@ -304,6 +351,18 @@ void UVaRestRequestJSON::ProcessRequest()
 	// Force add to root once request is launched
 	AddToRoot();
 
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	// Receive stream can't be detached from the request, so a previously streamed one is replaced
+	const bool bStreamResponse = UVaRestLibrary::GetVaRestSettings()->bParseWhileDownloading && !bLazyResponse;
+	if (bResponseStreamAttached && !bStreamResponse)
+	{
+		const FString Url = HttpRequest->GetURL();
+		HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetURL(Url);
+	}
+	bResponseStreamAttached = bStreamResponse;
+#endif
+
 	// Set verb
 	switch (RequestVerb)
 	{
@@ -471,6 +530,16 @@ void UVaRestRequestJSON::ProcessRequest()
 		HttpRequest->SetHeader(It.Key(), It.Value());
 	}
 
+	// Parse response body while it downloads, fresh stream for every run
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	ResponseStream.Reset();
+	if (bStreamResponse)
+	{
+		ResponseStream = MakeShared<FVaRestResponseStream>();
+		HttpRequest->SetResponseBodyReceiveStream(ResponseStream.ToSharedRef());
+	}
+#endif
+
 	// Bind event
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UVaRestRequestJSON::OnProcessRequestComplete);
 
@@ -486,6 +555,9 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 	// Remove from root on completion
 	RemoveFromRoot();
 
+	// Stream of this run, response data reset drops it
+	const TSharedPtr<FVaRestResponseStream> Stream = ResponseStream;
+
 	// Be sure that we have no data from previous response
 	ResetResponseData();
 
@@ -500,6 +572,11 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 	{
 		UE_LOG(LogVaRest, Error, TEXT("Request failed (%d): %s"), ResponseCode, *Request->GetURL());
 
+		if (Stream.IsValid())
+		{
+			Stream->Release();
+		}
+
 		// Broadcast the result event
 		OnRequestFail.Broadcast(this);
 		OnStaticRequestFail.Broadcast(this);
@@ -507,9 +584,12 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 		return;
 	}
 
+	// Streamed body is kept by the stream only
+	const TArray<uint8>& Bytes = Stream.IsValid() ? Stream->Bytes : Response->GetContent();
+
 #if PLATFORM_DESKTOP
 	// Log response state
-	UE_LOG(LogVaRest, Log, TEXT("Response (%d): %sJSON(%s%s%s)JSON"), ResponseCode, LINE_TERMINATOR, LINE_TERMINATOR, *Response->GetContentAsString(), LINE_TERMINATOR);
+	UE_LOG(LogVaRest, Log, TEXT("Response (%d): %sJSON(%s%s%s)JSON"), ResponseCode, LINE_TERMINATOR, LINE_TERMINATOR, *ContentToString(Bytes), LINE_TERMINATOR);
 #endif
 
 	// Process response headers
@@ -524,10 +604,62 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 		}
 	}
 
-	if (UVaRestLibrary::GetVaRestSettings()->bUseChunkedParser)
+	if (bLazyResponse)
+	{
+		// Keep raw text only, fields are extracted on demand
+		if (ResponseLazyDocument->SetContent((const ANSICHAR*)Bytes.GetData(), Bytes.Num()))
+		{
+			ResponseSize = Bytes.Num();
+		}
+	}
+	else if (Stream.IsValid() && Stream->IsParsed())
+	{
+		// Body has been parsed while downloading
+		ResponseJsonObj->SetRootObject(Stream->Reader.State.Root);
+		ResponseSize = Stream->Reader.State.Size;
+	}
+	else if (UVaRestLibrary::GetVaRestSettings()->bUseFastParser && UVaRestLibrary::GetVaRestSettings()->bUseCompactDocument)
+	{
+		// Keep parsed response in arena, objects are built when blueprint reads them
+		FString Error;
+		const TSharedPtr<FVaRestJsonDocument, ESPMode::ThreadSafe> Document = FVaRestJsonDocument::Parse((const ANSICHAR*)Bytes.GetData(), Bytes.Num(), &Error);
+		if (!Document.IsValid())
+		{
+			UE_LOG(LogVaRest, Warning, TEXT("JSON could not be decoded: %s"), *Error);
+		}
+		else if (Document->GetRoot().Type == EVaRestJsonNodeType::Object)
+		{
+			ResponseJsonObj->SetRootDocument(Document);
+			ResponseSize = Bytes.Num();
+		}
+		else
+		{
+			ResponseJsonValue->SetRootValue(Document->ToJsonValue());
+		}
+	}
+	else if (UVaRestLibrary::GetVaRestSettings()->bUseFastParser)
+	{
+		// Parse raw utf-8 bytes with structural index, any json value is accepted as root
+		FString Error;
+		const TSharedPtr<FJsonValue> OutJsonValue = FVaRestJsonFastParser::Parse((const ANSICHAR*)Bytes.GetData(), Bytes.Num(), &Error);
+		if (OutJsonValue.IsValid())
+		{
+			ResponseJsonValue->SetRootValue(OutJsonValue);
+
+			if (ResponseJsonValue->GetType() == EVaJson::Object)
+			{
+				ResponseJsonObj->SetRootObject(OutJsonValue->AsObject());
+				ResponseSize = Bytes.Num();
+			}
+		}
+		else
+		{
+			UE_LOG(LogVaRest, Warning, TEXT("JSON could not be decoded: %s"), *Error);
+		}
+	}
+	else if (UVaRestLibrary::GetVaRestSettings()->bUseChunkedParser)
 	{
 		// Try to deserialize data to JSON
-		const TArray<uint8>& Bytes = Response->GetContent();
 		ResponseSize = ResponseJsonObj->DeserializeFromUTF8Bytes((const ANSICHAR*)Bytes.GetData(), Bytes.Num());
 
 		// Log errors
@@ -541,7 +673,7 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 	else
 	{
 		// Use default unreal one
-		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(*Response->GetContentAsString());
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ContentToString(Bytes));
 		TSharedPtr<FJsonValue> OutJsonValue;
 		if (FJsonSerializer::Deserialize(Reader, OutJsonValue))
 		{
@@ -550,7 +682,7 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 			if (ResponseJsonValue->GetType() == EVaJson::Object)
 			{
 				ResponseJsonObj->SetRootObject(ResponseJsonValue->GetRootValue()->AsObject());
-				ResponseSize = Response->GetContentLength();
+				ResponseSize = Bytes.Num();
 			}
 		}
 	}
@@ -561,11 +693,17 @@ void UVaRestRequestJSON::OnProcessRequestComplete(FHttpRequestPtr Request, FHttp
 	if (!bIsValidJsonResponse)
 	{
 		// Save response data as a string
-		ResponseContent = Response->GetContentAsString();
+		ResponseContent = ContentToString(Bytes);
 		ResponseSize = ResponseContent.GetAllocatedSize();
 
-		ResponseBytes = Response->GetContent();
-		ResponseContentLength = Response->GetContentLength();
+		ResponseBytes = Bytes;
+		ResponseContentLength = Bytes.Num();
+	}
+
+	// Parsed data has been taken over, stream buffers are not needed anymore
+	if (Stream.IsValid())
+	{
+		Stream->Release();
 	}
 
 	// Broadcast the result events on next tick
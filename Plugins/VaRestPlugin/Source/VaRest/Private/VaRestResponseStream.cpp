@@ -0,0 +1,51 @@
+// Copyright 2014-2019 Vladimir Alyamkin. All Rights Reserved.
+
+#include "VaRestResponseStream.h"
+
+FVaRestResponseStream::FVaRestResponseStream()
+	: bParsing(true)
+{
+	SetIsSaving(true);
+	SetIsPersistent(false);
+}
+
+void FVaRestResponseStream::Serialize(void* Data, int64 Num)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	const int32 Start = Bytes.Num();
+	Bytes.Append((const uint8*)Data, (int32)Num);
+
+	if (!bParsing)
+	{
+		return;
+	}
+
+	const ANSICHAR* Chunk = (const ANSICHAR*)Bytes.GetData() + Start;
+	int32 ChunkSize = (int32)Num;
+
+	// Skip utf-8 byte order mark at the beginning of the body
+	if (Start == 0 && ChunkSize >= 3 && (uint8)Chunk[0] == 0xEF && (uint8)Chunk[1] == 0xBB && (uint8)Chunk[2] == 0xBF)
+	{
+		Chunk += 3;
+		ChunkSize -= 3;
+	}
+
+	bParsing = Reader.ReadUtf8(Chunk, ChunkSize);
+}
+
+bool FVaRestResponseStream::IsParsed() const
+{
+	// Root object is created on its opening bracket and popped from the stack on the closing one
+	return bParsing && Reader.State.Root.IsValid() && Reader.State.Objects.Num() == 0;
+}
+
+void FVaRestResponseStream::Release()
+{
+	Bytes.Empty();
+	Reader = FJSONReader();
+	bParsing = true;
+}
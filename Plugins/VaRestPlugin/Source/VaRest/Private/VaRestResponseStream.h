@@ -0,0 +1,42 @@
+// Copyright 2014-2019 Vladimir Alyamkin. All Rights Reserved.
+
+#pragma once
+
+#include "VaRestJsonParser.h"
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+/**
+ * Receives response body while it downloads and feeds it to the chunked parser.
+ *
+ * Serialize() is called on the http thread, results may only be read once the request is complete.
+ */
+class FVaRestResponseStream : public FArchive
+{
+public:
+	FVaRestResponseStream();
+
+	//~ Begin FArchive Interface
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual int64 Tell() override { return Bytes.Num(); }
+	virtual int64 TotalSize() override { return Bytes.Num(); }
+	virtual FString GetArchiveName() const override { return TEXT("FVaRestResponseStream"); }
+	//~ End FArchive Interface
+
+	/** True if the body was a complete json object */
+	bool IsParsed() const;
+
+	/** Frees received data, http request keeps a reference to the stream until the next run */
+	void Release();
+
+	/** Raw response body */
+	TArray<uint8> Bytes;
+
+	/** Parser state, root object is valid once IsParsed() */
+	FJSONReader Reader;
+
+private:
+	/** Parser has not failed yet */
+	bool bParsing;
+};
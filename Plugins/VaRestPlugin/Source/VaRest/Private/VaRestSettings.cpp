@@ -7,4 +7,7 @@ UVaRestSettings::UVaRestSettings(const FObjectInitializer& ObjectInitializer)
 {
 	bExtendedLog = false;
 	bUseChunkedParser = false;
+	bUseFastParser = false;
+	bUseCompactDocument = false;
+	bParseWhileDownloading = false;
 }
@@ -6,7 +6,7 @@
 #include "VaRestJsonObject.h"
 #include "VaRestJsonValue.h"
 
-#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
 #include "Misc/Paths.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -196,10 +196,10 @@ class UVaRestJsonObject* UVaRestSubsystem::LoadJsonFromFile(const FString& Path,
 {
 	auto* Json = ConstructVaRestJsonObject();
 
-	FString JSONString;
-	if (FFileHelper::LoadFileToString(JSONString, *(bIsRelativeToContentDir ? FPaths::ProjectContentDir() / Path : Path)))
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*(bIsRelativeToContentDir ? FPaths::ProjectContentDir() / Path : Path)));
+	if (Reader)
 	{
-		if (Json->DecodeJson(JSONString))
+		if (Json->DecodeFromArchive(Reader))
 		{
 			return Json;
 		}
@@ -0,0 +1,114 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "VaRestJsonValue.h"
+
+#include "VaRestJsonLazyDocument.generated.h"
+
+class UVaRestJsonObject;
+
+/**
+ * Json text with structural index, values are extracted on demand.
+ *
+ * Paths are json pointers ("/data/items/3/name") or dotted ("data.items.3.name"), empty path
+ * is the root. Unrelated subtrees are skipped through the index without allocations.
+ *
+ * Indexing only checks structure (brackets, keys, colons and commas). Strings, numbers and
+ * literals are checked when they are read, an invalid one reads as default with a warning.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class VAREST_API UVaRestJsonLazyDocument : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	/** Reset all internal data */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
+	void Reset();
+
+	/** Index json string, false if its structure is not valid json */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
+	bool DecodeJson(const FString& JsonString);
+
+	/** Index utf-8 text, false if its structure is not valid json */
+	bool SetContent(const ANSICHAR* Data, int32 Size);
+
+	/** Size of kept text and index in bytes */
+	SIZE_T GetAllocatedSize() const;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Path access
+
+	/** Checks that value exists at Path */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	bool HasPath(const FString& Path) const;
+
+	/** Type of value at Path, None if there is no value */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	EVaJson GetPathType(const FString& Path) const;
+
+	/** Get number at Path. Attn.!! float used instead of double to make the function blueprintable! */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	float GetNumber(const FString& Path) const;
+
+	/** Get number at Path as an Integer */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	int32 GetInteger(const FString& Path) const;
+
+	/** Get number at Path as an Int64, integers are read from text without precision loss */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	int64 GetInt64(const FString& Path) const;
+
+	/** Get string at Path */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	FString GetString(const FString& Path) const;
+
+	/** Get boolean at Path */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	bool GetBool(const FString& Path) const;
+
+	/** Number of elements of array at Path, -1 if there is no array */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	int32 GetArrayLength(const FString& Path) const;
+
+	/** Field names of object at Path */
+	UFUNCTION(BlueprintPure, Category = "VaRest|Json")
+	TArray<FString> GetFieldNames(const FString& Path) const;
+
+	/** Builds Json value at Path, nullptr if there is no value */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
+	UVaRestJsonValue* GetValue(const FString& Path) const;
+
+	/** Builds Json object at Path, nullptr if there is no object */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
+	UVaRestJsonObject* GetJsonObject(const FString& Path) const;
+
+	/** Builds FJsonValue at Path */
+	TSharedPtr<FJsonValue> GetJsonValue(const FString& Path) const;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Data
+
+private:
+	/** Structural position of value at Path, INDEX_NONE if there is none */
+	int32 Resolve(const FString& Path) const;
+
+	/** Structural position following the value at Cursor */
+	int32 SkipValue(int32 Cursor) const;
+
+	/** First character of structural at Cursor */
+	FORCEINLINE const ANSICHAR* GetChar(int32 Cursor) const { return Content.GetData() + Positions[Cursor]; }
+
+	/** End of the text */
+	FORCEINLINE const ANSICHAR* GetEnd() const { return Content.GetData() + Content.Num() - 1; }
+
+	/** Utf-8 text with terminating zero */
+	TArray<ANSICHAR> Content;
+
+	/** Offsets of structural characters followed by text size */
+	TArray<uint32> Positions;
+
+	/** Position of matching closing bracket for every opening one */
+	TArray<uint32> Closers;
+};
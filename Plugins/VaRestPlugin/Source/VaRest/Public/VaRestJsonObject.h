@@ -10,6 +10,7 @@
 #include "VaRestJsonObject.generated.h"
 
 class UVaRestJsonValue;
+class FVaRestJsonDocument;
 
 /**
  * Blueprintable FJsonObject wrapper
@@ -30,6 +31,9 @@ public:
 	/** Set the root Json object */
 	void SetRootObject(const TSharedPtr<FJsonObject>& JsonObject);
 
+	/** Set compact document as root, Json object is built from it on first access */
+	void SetRootDocument(const TSharedPtr<const FVaRestJsonDocument, ESPMode::ThreadSafe>& Document);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Serialization
 
@@ -184,13 +188,13 @@ private:
 	TArray<T> GetTypeArrayField(const FString& FieldName) const
 	{
 		TArray<T> NumberArray;
-		if (!JsonObj->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
+		if (!GetJsonObj()->HasTypedField<EJson::Array>(FieldName) || FieldName.IsEmpty())
 		{
 			UE_LOG(LogVaRest, Warning, TEXT("%s: No field with name %s of type Array"), *VA_FUNC_LINE, *FieldName);
 			return NumberArray;
 		}
 
-		const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = JsonObj->GetArrayField(FieldName);
+		const TArray<TSharedPtr<FJsonValue>> JsonArrayValues = GetJsonObj()->GetArrayField(FieldName);
 		for (TArray<TSharedPtr<FJsonValue>>::TConstIterator It(JsonArrayValues); It; ++It)
 		{
 			const auto Value = (*It).Get();
@@ -257,26 +261,33 @@ public:
 	/** Deserialize byte content to json */
 	int32 DeserializeFromUTF8Bytes(const ANSICHAR* Bytes, int32 Size);
 
+	/** Deserialize utf-8 byte content to json with two stage structural index parser */
+	int32 DeserializeFromUTF8BytesFast(const ANSICHAR* Bytes, int32 Size);
+
+	/** Deserialize utf-8 byte content to compact document, Json object is built on first access */
+	int32 DeserializeFromUTF8BytesCompact(const ANSICHAR* Bytes, int32 Size);
+
 	/** Deserialize byte content to json */
 	int32 DeserializeFromTCHARBytes(const TCHAR* Bytes, int32 Size);
 
-	/** Deserialize byte stream from reader */
-	void DecodeFromArchive(TUniquePtr<FArchive>& Reader);
+	/** Deserialize byte stream from reader in blocks, utf-8 or utf-16 by byte order mark. True if a complete object was read */
+	bool DecodeFromArchive(TUniquePtr<FArchive>& Reader);
 
 	//////////////////////////////////////////////////////////////////////////
 	// Serialize
 
 public:
-	/** Save json to file */
-	bool WriteToFile(const FString& Path) const;
+	/** Save json to file as utf-8, or as utf-16 with byte order mark */
+	bool WriteToFile(const FString& Path, bool bUseUtf16 = false) const;
 
 	/**
 	 * Blueprint Save json to filepath
 	 *
 	 * @param bIsRelativeToProjectDir If set to 'false' path is treated as absolute
+	 * @param bUseUtf16 Write utf-16 with byte order mark instead of utf-8
 	 */
 	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
-	bool WriteToFilePath(const FString& Path, const bool bIsRelativeToProjectDir = true);
+	bool WriteToFilePath(const FString& Path, const bool bIsRelativeToProjectDir = true, const bool bUseUtf16 = false);
 
 	static bool WriteStringToArchive(FArchive& Ar, const TCHAR* StrPtr, int64 Len);
 
@@ -284,6 +295,20 @@ public:
 	// Data
 
 private:
-	/** Internal JSON data */
-	TSharedRef<FJsonObject> JsonObj;
+	/** Internal JSON data, use GetJsonObj() to read it */
+	mutable TSharedRef<FJsonObject> JsonObj;
+
+	/** Document JsonObj is built from on first access */
+	mutable TSharedPtr<const FVaRestJsonDocument, ESPMode::ThreadSafe> PendingDocument;
+
+	FORCEINLINE const TSharedRef<FJsonObject>& GetJsonObj() const
+	{
+		if (PendingDocument.IsValid())
+		{
+			MaterializeDocument();
+		}
+		return JsonObj;
+	}
+
+	void MaterializeDocument() const;
 };
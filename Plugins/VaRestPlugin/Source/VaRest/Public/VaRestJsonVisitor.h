@@ -0,0 +1,47 @@
+// Copyright 2015-2019 Mail.Ru Group. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Receives json values in document order, no json objects are created while parsing.
+ *
+ * Strings are passed in a buffer reused between calls, copy them to keep.
+ * Every callback returns false to stop parsing.
+ *
+ * The text is indexed up front like in the other fast paths. The index takes 4 bytes per
+ * structural character, so memory stays linear in the text size even though no value is built.
+ */
+class VAREST_API FVaRestJsonVisitor
+{
+public:
+	virtual ~FVaRestJsonVisitor() = default;
+
+	virtual bool OnStartObject() { return true; }
+	virtual bool OnEndObject() { return true; }
+	virtual bool OnStartArray() { return true; }
+	virtual bool OnEndArray() { return true; }
+	virtual bool OnKey(const FString& Key) { return true; }
+	virtual bool OnString(const FString& Value) { return true; }
+	virtual bool OnNumber(double Value) { return true; }
+
+	/** Integer double can't hold exactly (beyond 2^53), such as large ids. Reported as nearest double unless overridden */
+	virtual bool OnInt64(int64 Value) { return OnNumber((double)Value); }
+	virtual bool OnBoolean(bool bValue) { return true; }
+	virtual bool OnNull() { return true; }
+
+	/** Parses utf-8 text and reports every value, false on error or when stopped by callback */
+	bool Visit(const ANSICHAR* Data, int32 Size, FString* OutError = nullptr);
+
+	/** Parses text and reports every value, false on error or when stopped by callback */
+	bool Visit(const FString& Text, FString* OutError = nullptr);
+
+	/**
+	 * Calls Callback for every element of array at Path (json pointer "/data/items" or dotted
+	 * "data.items", empty for root). Only one element exists as FJsonValue at a time, parsing
+	 * stops as soon as the array is closed. Returns number of elements or INDEX_NONE on error.
+	 */
+	static int32 ForEachArrayElement(const ANSICHAR* Data, int32 Size, const FString& Path, TFunctionRef<bool(int32, const TSharedPtr<FJsonValue>&)> Callback, FString* OutError = nullptr);
+};
@@ -9,6 +9,9 @@
 #include "VaRestLibrary.generated.h"
 
 class UVaRestSettings;
+class UVaRestJsonValue;
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FVaRestArrayElementDelegate, int32, Index, UVaRestJsonValue*, Value);
 
 /**
  * Useful tools for REST communications
@@ -106,4 +109,21 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "VaRest|Utility", meta = (WorldContext = "WorldContextObject"))
 	static FVaRestURL GetWorldURL(UObject* WorldContextObject);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Json Streaming
+
+public:
+	/**
+	 * Calls Callback for every element of json array at Path without building the whole document
+	 *
+	 * The same Json Value object is passed for every element and repointed before each call, so
+	 * don't keep the reference past the callback. Take what you need out of it (Get Object, As String...)
+	 * instead. The parser still indexes the whole text up front, memory is linear in its size.
+	 *
+	 * @param Path		Json pointer ("/data/items") or dotted path ("data.items"), empty for root array
+	 * @return			Number of elements, -1 if text is invalid or there is no array at Path
+	 */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Json")
+	static int32 ForEachJsonArrayElement(const FString& JsonString, const FString& Path, const FVaRestArrayElementDelegate& Callback);
 };
@@ -14,7 +14,9 @@
 
 class UVaRestJsonValue;
 class UVaRestJsonObject;
+class UVaRestJsonLazyDocument;
 class UVaRestSettings;
+class FVaRestResponseStream;
 
 /**
  * @author Original latent action class by https://github.com/unktomi
@@ -162,6 +164,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "VaRest|Response")
 	UVaRestJsonValue* GetResponseValue() const;
 
+	/** Keep response as lazy document: fields are read from raw text on demand, Json objects are not built */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Request")
+	void SetLazyResponse(bool bLazy);
+
+	/** Get the Response lazy document, filled when SetLazyResponse is enabled. nullptr if it never was */
+	UFUNCTION(BlueprintCallable, Category = "VaRest|Response")
+	UVaRestJsonLazyDocument* GetResponseLazyDocument() const;
+
 	///////////////////////////////////////////////////////////////////////////
 	// Request/response data access
 
@@ -319,6 +329,12 @@ protected:
 	TArray<uint8> ResponseBytes;
 	int32 ResponseContentLength;
 
+	/** Receives response body while it downloads when bParseWhileDownloading is set */
+	TSharedPtr<FVaRestResponseStream> ResponseStream;
+
+	/** Http request has been given a receive stream, it keeps it for all later runs */
+	bool bResponseStreamAttached = false;
+
 	/** Used for special cases when used wants to have plain string data in request.
 	 * Attn.! Content-type x-www-form-urlencoded only. */
 	FString StringRequestContent;
@@ -331,6 +347,13 @@ protected:
 	UPROPERTY()
 	UVaRestJsonValue* ResponseJsonValue;
 
+	/** Response text with structural index, created once lazy response is enabled */
+	UPROPERTY()
+	UVaRestJsonLazyDocument* ResponseLazyDocument;
+
+	/** Response is kept as lazy document only */
+	bool bLazyResponse;
+
 	/** Verb for making request (GET,POST,etc) */
 	EVaRestRequestVerb RequestVerb;
 
@@ -14,7 +14,19 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "VaRest")
 	bool bExtendedLog;
 
-	/** Use custom chunked parses (best for memory, but has issues with hex-encoded utf-8) */
+	/** Use custom chunked parses (best for memory) */
 	UPROPERTY(Config, EditAnywhere, Category = "VaRest")
 	bool bUseChunkedParser;
+
+	/** Use two stage structural index parser (fastest for large responses, takes precedence over chunked parser) */
+	UPROPERTY(Config, EditAnywhere, Category = "VaRest")
+	bool bUseFastParser;
+
+	/** Keep responses of fast parser in compact arena document and build Json objects on first access */
+	UPROPERTY(Config, EditAnywhere, Category = "VaRest", meta = (EditCondition = "bUseFastParser"))
+	bool bUseCompactDocument;
+
+	/** Feed response body to chunked parser as it downloads, so parsing overlaps network time (object root only) */
+	UPROPERTY(Config, EditAnywhere, Category = "VaRest")
+	bool bParseWhileDownloading;
 };
@@ -1,94 +1,133 @@
 // Copyright Ilgar Lunin. All Rights Reserved.
 
 #include "DecompressSound.h"
-#include "Audio.h"
+#include "Async/Async.h"
 #include "Sound/SoundWave.h"
-#include "VoskSoundUtils.h"
+#include "UObject/ObjectKey.h"
+#include "VoskSoundPipeline.h"
+#include "VoskPCMCache.h"
 
 
-void StereoToMono(TArray<uint8> StereoWavBytes, TArray<uint8>& MonoWavBytes)
+namespace
 {
-	for (int i = 0; i < 44; i++) {
-		if (i == 22) {
-			short NumChannels = (*reinterpret_cast<short*>(&StereoWavBytes[i])) / 2;
-			MonoWavBytes.Append(reinterpret_cast<uint8*>(&NumChannels), sizeof(NumChannels));
-			i++;
-		} else if (i == 28) {
-			int ByteRate = (*reinterpret_cast<int*>(&StereoWavBytes[i])) / 2;
-			MonoWavBytes.Append(reinterpret_cast<uint8*>(&ByteRate), sizeof(ByteRate));
-			i += 3;
-		} else if (i == 32) {
-			short BlockAlign = (*reinterpret_cast<short*>(&StereoWavBytes[i])) / 2;
-			MonoWavBytes.Append(reinterpret_cast<uint8*>(&BlockAlign), sizeof(BlockAlign));
-			i++;
-		} else if (i == 40) {
-			int SubChunkSize = (*reinterpret_cast<int*>(&StereoWavBytes[i])) / 2;
-			MonoWavBytes.Append(reinterpret_cast<uint8*>(&SubChunkSize), sizeof(SubChunkSize));
-			i += 3;
-		} else
-			MonoWavBytes.Add(StereoWavBytes[i]);
-	}
+	/** Larger chunks than live recognition, nothing waits on the first one */
+	constexpr int32 DECODE_CHUNK_SAMPLES = 16384;
 
-	//Copies only the left channel and ignores the right channel
-	for (int i = 44; i < StereoWavBytes.Num(); i += 4) {
-		MonoWavBytes.Add(StereoWavBytes[i]);
-		MonoWavBytes.Add(StereoWavBytes[i+1]);
-	}
+	/** Decode of one asset at one sample rate, shared by every node asking for it meanwhile */
+	struct FDecodeJob
+	{
+		TSharedPtr<FVoskSoundPipeline, ESPMode::ThreadSafe> Pipeline;
+		TArray<TWeakObjectPtr<UDecompressSound>> Waiters;
+	};
+
+	typedef TPair<FObjectKey, int32> FDecodeKey;
+
+	/** Game thread only */
+	TMap<FDecodeKey, FDecodeJob> InFlightDecodes;
 }
 
 
-UDecompressSound* UDecompressSound::DecompressSound(USoundWave* Sound, bool StopDeviceSounds)
+UDecompressSound* UDecompressSound::DecompressSound(USoundWave* Sound, bool StopDeviceSounds, int32 SampleRate)
 {
 	UDecompressSound* BPNode = NewObject<UDecompressSound>();
 	BPNode->Sound = Sound;
 	BPNode->StopDeviceSounds = StopDeviceSounds;
+	BPNode->SampleRate = FMath::Max(0, SampleRate);
 	return BPNode;
 }
 
+void UDecompressSound::SetDecodedSoundCacheBudget(int32 Megabytes)
+{
+	FVoskPCMCache::Get().SetBudget((int64)FMath::Max(0, Megabytes) * 1024 * 1024);
+}
+
+void UDecompressSound::ClearDecodedSoundCache()
+{
+	FVoskPCMCache::Get().Clear();
+}
+
 void UDecompressSound::Activate() {
 	if (Sound == nullptr)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Null sound was provided. Make sure AudioCapture component Start/Stop was called"));
 		return;
 	}
-	// decompress
-	VoskComponentUtils::EnsureSoundWaveDecompressed(Sound, StopDeviceSounds);
 
-	FWaveModInfo WaveInfo;
-	TArray<uint8> result;
-	
-	const uint8* RawWaveData = (const uint8*)Sound->RawPCMData;
-	int32 RawDataSize = Sound->RawPCMDataSize;
+	if (TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Cached = FVoskPCMCache::Get().Find(Sound, SampleRate))
+	{
+		Finish(*Cached);
+		return;
+	}
 
-	if (!RawWaveData || RawDataSize == 0) {
-		UE_LOG(LogTemp, Warning, TEXT("LPCM data failed to load for sound %s"), *Sound->GetFullName());
+	// kept alive, together with the sound it references, until decoding is done
+	AddToRoot();
 
-	} else if (!WaveInfo.ReadWaveHeader(RawWaveData, RawDataSize, 0)) {
-		// If we failed to parse the wave header, it's either because of an
-		// invalid bitdepth or channel configuration.
-		UE_LOG(LogTemp, Warning,
-			TEXT("Only mono or stereo 16 bit waves allowed: %s (%d bytes)"),
-			*Sound->GetFullName(), RawDataSize);
-
-	} else {
-		result.AddUninitialized(WaveInfo.SampleDataSize);
-		FMemory::Memcpy(result.GetData(), WaveInfo.SampleDataStart, WaveInfo.SampleDataSize);
-		// Convert stereo to mono and unlock sound raw data
-		if (*WaveInfo.pChannels != 1)
+	const FDecodeKey Key(FObjectKey(Sound), SampleRate);
+	if (FDecodeJob* Running = InFlightDecodes.Find(Key))
+	{
+		Running->Waiters.Add(this);
+		return;
+	}
+
+	// decoded into a private buffer, the asset itself is never touched
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Samples = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	TSharedRef<FVoskSoundPipeline, ESPMode::ThreadSafe> Pipeline = MakeShared<FVoskSoundPipeline, ESPMode::ThreadSafe>(SampleRate, DECODE_CHUNK_SAMPLES);
+
+	FDecodeJob& Job = InFlightDecodes.Add(Key);
+	Job.Pipeline = Pipeline;
+	Job.Waiters.Add(this);
+
+	USoundWave* Wave = Sound;
+	const int32 TargetSampleRate = SampleRate;
+
+	auto Sink = [Samples](const uint8* Data, int32 Size) {
+		Samples->Append(Data, Size);
+	};
+
+	auto OnFinished = [Key, Wave, Samples, TargetSampleRate](bool bSuccess) {
+		AsyncTask(ENamedThreads::GameThread, [Key, Wave, Samples, TargetSampleRate, bSuccess]()
 		{
-			TArray<uint8> MonoResult;
-			StereoToMono(result, MonoResult);
-			Finished.Broadcast(MonoResult);
-			return;
-		}
+			FDecodeJob Job;
+			InFlightDecodes.RemoveAndCopyValue(Key, Job);
+
+			if (bSuccess && Samples->Num() > 0)
+			{
+				Samples->Shrink();
+				FVoskPCMCache::Get().Add(Wave, TargetSampleRate, Samples);
+			}
+			else
+			{
+				Samples->Empty();
+			}
+
+			for (const TWeakObjectPtr<UDecompressSound>& Waiter : Job.Waiters)
+			{
+				if (Waiter.IsValid())
+				{
+					Waiter->RemoveFromRoot();
+					Waiter->Finish(*Samples);
+				}
+			}
+		});
+	};
+
+	if (!Pipeline->Start(Sound, MoveTemp(Sink), MoveTemp(OnFinished)))
+	{
+		InFlightDecodes.Remove(Key);
+		RemoveFromRoot();
+		Finish(TArray<uint8>());
 	}
+}
 
-	if (!result.Num())
+void UDecompressSound::Finish(const TArray<uint8>& Samples)
+{
+	if (!Samples.Num())
 	{
 		UE_LOG(LogTemp, Warning,
 			TEXT("Can't cook %s because there is no source LPCM data"), *Sound->GetFullName());
 	}
 
 	// output result
-	Finished.Broadcast(result);
+	Finished.Broadcast(Samples);
+	SetReadyToDestroy();
 }
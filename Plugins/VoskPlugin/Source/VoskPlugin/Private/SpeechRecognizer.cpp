@@ -1,9 +1,10 @@
 // Copyright Ilgar Lunin. All Rights Reserved.
 
 #include "SpeechRecognizer.h"
-#include "Voice.h"
-#include "Serialization/JsonSerializer.h"
-#include <string>
+#include "VoskLocalRecognizer.h"
+#include "VoskVoiceCapture.h"
+#include "VoskSoundPipeline.h"
+#include "Async/Async.h"
 
 // Sets default values for this component's properties
 USpeechRecognizer::USpeechRecognizer()
@@ -12,7 +13,8 @@ USpeechRecognizer::USpeechRecognizer()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
 
-	// ...
+	recognizer_ = MakeShared<FVoskLocalRecognizer>();
+	recognizer_->OnResult.AddUObject(this, &USpeechRecognizer::DecodeRresult);
 }
 
 
@@ -22,120 +24,97 @@ void USpeechRecognizer::BeginPlay()
 	Super::BeginPlay();
 
 	// ...
-	
+
 }
 
 void USpeechRecognizer::EndPlay(const EEndPlayReason::Type EndPlayReason) {
-	if (_voice_capture.IsValid())
-		_voice_capture->Stop();
+	if (_capture.IsValid())
+		_capture->Stop();
 	bIsCaptureActive = false;
 
 	Uninitialize();
 }
 
+bool USpeechRecognizer::IsRecognizerLoaded() const
+{
+	return recognizer_->IsLoaded();
+}
+
 void USpeechRecognizer::ParseRawResultAndDecode(const uint8* data, int32 size)
 {
 	// process audio and fire events
-	const char* voice_data = reinterpret_cast<const char*>(data);
-
-	FString recognition_result;
 	if (want_final_result_) {
-		recognition_result = UTF8_TO_TCHAR(vosk_recognizer_final_result(recognizer_));
+		recognizer_->FinalResult();
 		want_final_result_ = false;
 	}
-	else if (vosk_recognizer_accept_waveform(recognizer_, voice_data, size)) {
-		recognition_result = UTF8_TO_TCHAR(vosk_recognizer_result(recognizer_));
-	}
 	else {
-		recognition_result = UTF8_TO_TCHAR(vosk_recognizer_partial_result(recognizer_));
+		recognizer_->AcceptWaveform(data, size);
 	}
-
-	DecodeRresult(recognition_result);
 }
 
-void USpeechRecognizer::DecodeRresult(const FString& raw)
+void USpeechRecognizer::DecodeRresult(const FVoskRecognitionResult& result)
 {
-	TSharedPtr<FJsonObject> result;
-	TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(raw);
+	// sound pipeline recognizes on worker thread
+	if (!IsInGameThread())
+	{
+		TWeakObjectPtr<USpeechRecognizer> Self = this;
+		AsyncTask(ENamedThreads::GameThread, [Self, result]() {
+			if (Self.IsValid())
+				Self->DecodeRresult(result);
+		});
+		return;
+	}
 
-	if (FJsonSerializer::Deserialize(reader, result))
+	if (result.Type == EVoskResultType::Partial)
 	{
-		FString _res;
-		if (result->TryGetStringField(TEXT("partial"), _res))
-		{
-			OnPartialResultReceived.Broadcast(_res);
-		}
-		else if (result->TryGetStringField(TEXT("text"), _res))
+		OnPartialResultReceived.Broadcast(result.Text);
+	}
+	else if (result.Type == EVoskResultType::Final)
+	{
+		OnFinalResultReceived.Broadcast(result.Text);
+
+		if (transcribing_)
 		{
-			OnFinalResultReceived.Broadcast(_res);
+			FVoskTranscriptSegment Segment;
+			Segment.Text = result.Text;
+			Segment.Start = segment_start_;
+			Segment.End = FMath::Max(result.AudioTime, segment_start_);
+			segment_start_ = Segment.End;
+
+			if (!Segment.Text.IsEmpty())
+				OnTranscriptSegment.Broadcast(Segment);
 		}
 	}
 }
 
 void USpeechRecognizer::Initialize(const FString& PathToLanguageModel) {
 
-	if (model_ != nullptr || recognizer_ != nullptr) {
-		Uninitialize();
-	}
-
 	// TODO: this is blocking call, mote to async
-	std::string model_path = std::string(TCHAR_TO_UTF8(*PathToLanguageModel));
-	model_ = vosk_model_new(model_path.c_str());
-	recognizer_ = vosk_recognizer_new(model_, 16000);
-	vosk_recognizer_set_max_alternatives(recognizer_, 0);
-	vosk_recognizer_set_words(recognizer_, false);
+	recognizer_->Load(PathToLanguageModel, _sample_rate);
 }
 
 void USpeechRecognizer::Uninitialize()
 {
-	if (recognizer_ != nullptr) {
-		vosk_recognizer_free(recognizer_);
-		recognizer_ = nullptr;
-	}
-
-	if (model_ != nullptr) {
-		vosk_model_free(model_);
-		model_ = nullptr;
-	}
-	
+	CancelRecognizeSound();
+	recognizer_->Unload();
 }
 
 void USpeechRecognizer::ResetRecognizer()
 {
-	if (recognizer_) {
-		vosk_recognizer_reset(recognizer_);
-	}
+	recognizer_->Reset();
 }
 
 bool USpeechRecognizer::BeginCapture()
 {
 	if (bIsCaptureActive) return false;
 
-	if (!FVoiceModule::Get().DoesPlatformSupportVoiceCapture())
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), TEXT("VoiceCapture is not supported on this platform!"));
-	}
+	if (!_capture.IsValid())
+		_capture = MakeShared<FVoskVoiceCapture>(_sample_rate);
 
-	if (!_voice_capture.IsValid())
-	{
-		_voice_capture = FVoiceModule::Get().CreateVoiceCapture("");
-		if (_voice_capture.IsValid())
-		{
-			FString DeviceName;
-			if (!_voice_capture->Init(DeviceName, _sample_rate, 1))
-				return false;
-			UE_LOG(LogTemp, Log, TEXT("IVoiceCapture initialized"));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to obtain IVoiceCapture, no voice available!"));
-			return false;
-		}
-	}
+	_capture->SetConditioning(bConditionAudio, ConditioningSettings);
+	if (!_capture->Start())
+		return false;
 
-	UE_LOG(LogTemp, Log, TEXT("Capture started"));
-	_recorded_samples.Empty();
-	_voice_capture->Start();
 	bIsCaptureActive = true;
 
 	return true;
@@ -146,20 +125,36 @@ void USpeechRecognizer::RequestFinalResult()
 	want_final_result_ = true;
 }
 
+FVoskAudioConditioningStats USpeechRecognizer::GetConditioningStats() const
+{
+	return _capture.IsValid() ? _capture->GetConditioningStats() : FVoskAudioConditioningStats();
+}
+
 void USpeechRecognizer::FinishCapture(TArray<uint8>& CaptureData, int32& SamplesRecorded)
 {
 	bIsCaptureActive = false;
 
-	SamplesRecorded = _recorded_samples.Num();
-	CaptureData = _recorded_samples;
+	if (!_capture.IsValid())
+	{
+		SamplesRecorded = 0;
+		CaptureData.Empty();
+		return;
+	}
+
+	_capture->Stop();
 
-	if (_voice_capture.IsValid())
-		_voice_capture->Stop();
+	// audio the conditioner held back until now
+	const int32 TailBytes = _capture->Poll(_recorded_chunk);
+	if (TailBytes > 0 && IsRecognizerLoaded() && bSendVoiceDataWhenRecording)
+		ParseRawResultAndDecode(_recorded_chunk.GetData(), TailBytes);
+
+	SamplesRecorded = _capture->GetRecordedSamples().Num();
+	CaptureData = _capture->GetRecordedSamples();
 }
 
 bool USpeechRecognizer::FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 PacketSize)
 {
-	if (recognizer_ == nullptr)
+	if (!IsRecognizerLoaded())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Component is not initialized!"));
 		return false;
@@ -179,7 +174,6 @@ bool USpeechRecognizer::FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 Pac
 	{
 		const uint8* data = VoiceChunk.GetData() + (i * PacketSize);
 		ParseRawResultAndDecode(data, PacketSize);
-		/*Socket->Send(VoiceChunk.GetData() + (i * PacketSize), PacketSize, true);*/
 		BytesSent += PacketSize;
 	}
 
@@ -189,7 +183,6 @@ bool USpeechRecognizer::FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 Pac
 		const size_t remainder = VoiceChunk.Num() - BytesSent;
 		const uint8* data = VoiceChunk.GetData() + BytesSent;
 		ParseRawResultAndDecode(data, remainder);
-		//Socket->Send(VoiceChunk.GetData() + BytesSent, remainder, true);
 		BytesSent += remainder;
 	}
 
@@ -201,37 +194,111 @@ bool USpeechRecognizer::FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 Pac
 	return all_sent;
 }
 
+bool USpeechRecognizer::PreparePipeline()
+{
+	if (!IsRecognizerLoaded())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Component is not initialized!"));
+		return false;
+	}
+
+	if (_pipeline.IsValid() && _pipeline->IsRunning())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Sound recognition is already in progress"));
+		return false;
+	}
+
+	_pipeline = MakeShared<FVoskSoundPipeline, ESPMode::ThreadSafe>(_sample_rate);
+	return true;
+}
+
+bool USpeechRecognizer::RecognizeSound(USoundWave* Sound)
+{
+	if (!PreparePipeline())
+		return false;
+
+	TSharedPtr<FVoskLocalRecognizer> Recognizer = recognizer_;
+	TWeakObjectPtr<USpeechRecognizer> Self = this;
+
+	const bool Started = _pipeline->Start(Sound,
+		[Recognizer](const uint8* Data, int32 Size) {
+			Recognizer->AcceptWaveform(Data, Size);
+		},
+		[Recognizer, Self](bool Success) {
+			if (Success)
+				Recognizer->FinalResult();
+
+			AsyncTask(ENamedThreads::GameThread, [Self]() {
+				if (Self.IsValid())
+					Self->_pipeline_sound = nullptr;
+			});
+		});
+
+	if (Started)
+		_pipeline_sound = Sound;
+
+	return Started;
+}
+
+bool USpeechRecognizer::TranscribeFile(const FString& Path, int32 RawSampleRate, int32 RawNumChannels)
+{
+	if (!PreparePipeline())
+		return false;
+
+	// timestamps count from the start of the file
+	recognizer_->Reset();
+
+	TSharedPtr<FVoskLocalRecognizer> Recognizer = recognizer_;
+	TWeakObjectPtr<USpeechRecognizer> Self = this;
+
+	const bool Started = _pipeline->StartFile(Path, RawSampleRate, RawNumChannels,
+		[Recognizer](const uint8* Data, int32 Size) {
+			Recognizer->AcceptWaveform(Data, Size);
+		},
+		[Recognizer, Self](bool Success) {
+			if (Success)
+				Recognizer->FinalResult();
+
+			// queued after the final result, so the last segment is out before this fires
+			AsyncTask(ENamedThreads::GameThread, [Self, Success]() {
+				if (!Self.IsValid())
+					return;
+
+				Self->transcribing_ = false;
+				Self->OnTranscriptionFinished.Broadcast(Success);
+			});
+		});
+
+	if (Started)
+	{
+		transcribing_ = true;
+		segment_start_ = 0.f;
+	}
+
+	return Started;
+}
+
+void USpeechRecognizer::CancelRecognizeSound()
+{
+	if (_pipeline.IsValid())
+		_pipeline->Cancel();
+}
+
 
 // Called every frame
 void USpeechRecognizer::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (_voice_capture.IsValid() && bIsCaptureActive)
+	if (_capture.IsValid() && bIsCaptureActive)
 	{
-		uint32 VoiceCaptureBytesAvailable = 0;
-		EVoiceCaptureState::Type CaptureState = _voice_capture->GetCaptureState(VoiceCaptureBytesAvailable);
-
-		if (CaptureState == EVoiceCaptureState::Ok && VoiceCaptureBytesAvailable > 0) {
-			uint32 VoiceCaptureReadBytes = 0;
-
-			TArray<uint8> _recorded_chunk;
-			uint32 record_start = _recorded_chunk.AddUninitialized(VoiceCaptureBytesAvailable);
-
-			EVoiceCaptureState::Type microphone_state = _voice_capture->GetVoiceData(_recorded_chunk.GetData(), VoiceCaptureBytesAvailable, VoiceCaptureReadBytes);
-			if (microphone_state == EVoiceCaptureState::Ok) {
-				if (VoiceCaptureReadBytes > 0) {
-					_recorded_samples += _recorded_chunk;
-					if (recognizer_ && bSendVoiceDataWhenRecording) {
-						ParseRawResultAndDecode(_recorded_chunk.GetData(), VoiceCaptureReadBytes);
-					}
-				}
-			}
+		const int32 VoiceCaptureReadBytes = _capture->Poll(_recorded_chunk);
+		if (VoiceCaptureReadBytes > 0 && IsRecognizerLoaded() && bSendVoiceDataWhenRecording) {
+			ParseRawResultAndDecode(_recorded_chunk.GetData(), VoiceCaptureReadBytes);
 		}
-		
-		if (want_final_result_) {
-			const FString RecognitionResult = UTF8_TO_TCHAR(vosk_recognizer_final_result(recognizer_));
-			DecodeRresult(RecognitionResult);
+
+		if (want_final_result_ && IsRecognizerLoaded()) {
+			recognizer_->FinalResult();
 			want_final_result_ = false;
 		}
 	}
@@ -5,10 +5,16 @@
 #include "Components/ActorComponent.h"
 #include "vosk_api.h"
 #include "VoskComponent.h"
+#include "VoskAudioConditioning.h"
+#include "VoskTranscriptSegment.h"
 
 #include "SpeechRecognizer.generated.h"
 
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTranscriptSegment, const FVoskTranscriptSegment&, Segment);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTranscriptionFinished, bool, Success);
+
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class USpeechRecognizer : public UActorComponent
 {
@@ -26,12 +32,26 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SpeechRecognizer")
 		bool bSendVoiceDataWhenRecording = true;
 
+	/** Clean up microphone audio before recognition, applied on BeginCapture */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SpeechRecognizer")
+		bool bConditionAudio = false;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SpeechRecognizer")
+		FVoskAudioConditioningSettings ConditioningSettings;
+
 	UPROPERTY(BlueprintAssignable, Category = "SpeechRecognizer")
 		FOnPartialResultReceived OnPartialResultReceived;
 
 	UPROPERTY(BlueprintAssignable, Category = "SpeechRecognizer")
 		FOnFinalResultReceived OnFinalResultReceived;
 
+	/** Final results of TranscribeFile with their position in the recording */
+	UPROPERTY(BlueprintAssignable, Category = "SpeechRecognizer")
+		FOnTranscriptSegment OnTranscriptSegment;
+
+	UPROPERTY(BlueprintAssignable, Category = "SpeechRecognizer")
+		FOnTranscriptionFinished OnTranscriptionFinished;
+
 	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer")
 		void Uninitialize();
 
@@ -44,6 +64,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer")
 		void RequestFinalResult();
 
+	/** Time spent in each conditioning stage during current capture */
+	UFUNCTION(BlueprintPure, Category = "SpeechRecognizer")
+		FVoskAudioConditioningStats GetConditioningStats() const;
+
 	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer")
 		void FinishCapture(TArray<uint8>& CaptureData, int32& SamplesRecorded);
 
@@ -55,6 +79,29 @@ public:
 		*/
 		bool FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 PacketSize = 4096);
 
+	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer")
+		/**
+		* Decodes, converts and recognizes sound asset chunk by chunk on worker threads.
+		*
+		* Partial results arrive while the asset is still being decoded, final result
+		* is requested once the whole asset was fed.
+		*/
+		bool RecognizeSound(USoundWave* Sound);
+
+	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer", meta = (AdvancedDisplay = "RawSampleRate, RawNumChannels"))
+		/**
+		* Transcribes 16 bit PCM wave or raw file of any length in constant memory.
+		*
+		* File is memory mapped and streamed through the recognizer in windows on worker
+		* threads. Each final result is reported by OnTranscriptSegment, OnTranscriptionFinished
+		* fires after the last one. RawSampleRate and RawNumChannels describe files without header
+		*/
+		bool TranscribeFile(const FString& Path, int32 RawSampleRate = 16000, int32 RawNumChannels = 1);
+
+	/** Stops RecognizeSound or TranscribeFile in progress */
+	UFUNCTION(BlueprintCallable, Category = "SpeechRecognizer")
+		void CancelRecognizeSound();
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -68,15 +115,29 @@ public:
 private:
 	void ParseRawResultAndDecode(const uint8* data, int32 size);
 
-	void DecodeRresult(const FString& raw);
+	void DecodeRresult(const struct FVoskRecognitionResult& result);
 	void Initialize(const FString& PathToLanguageModel);
 
-	VoskModel* model_ = nullptr;
-	VoskRecognizer* recognizer_ = nullptr;
+	bool IsRecognizerLoaded() const;
+
+	/** Common part of RecognizeSound and TranscribeFile, false if pipeline can't be used now */
+	bool PreparePipeline();
+
+	TSharedPtr<class FVoskLocalRecognizer> recognizer_;
+
+	TSharedPtr<class FVoskVoiceCapture> _capture;
+
+	TSharedPtr<class FVoskSoundPipeline, ESPMode::ThreadSafe> _pipeline;
+
+	/** Keeps sound fed by the pipeline alive */
+	UPROPERTY()
+		USoundWave* _pipeline_sound = nullptr;
 
-	TSharedPtr<class IVoiceCapture> _voice_capture;
 	const int32 _sample_rate = 16000;
-	TArray<uint8> _recorded_samples;
+	TArray<uint8> _recorded_chunk;
+
+	bool transcribing_ = false;
+	float segment_start_ = 0.f;
 
 	bool initialization_in_progress = false;
 	bool want_final_result_ = false;
@@ -0,0 +1,274 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskAudioConditioner.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 SAMPLE_RATE = 16000;
+
+	/** Every stage off, tests turn on the one they look at */
+	FVoskAudioConditioningSettings NoStages()
+	{
+		FVoskAudioConditioningSettings Settings;
+		Settings.bRemoveDC = false;
+		Settings.bHighPass = false;
+		Settings.bNoiseGate = false;
+		Settings.bAutoGain = false;
+		return Settings;
+	}
+
+	/** Mixes a sine of Amplitude (full scale 1.0) into Samples[From, From + Num) */
+	void AddTone(TArray<int16>& Samples, float Frequency, float Amplitude, int32 From, int32 Num)
+	{
+		for (int32 i = From; i < From + Num; i++)
+			Samples[i] = (int16)FMath::Clamp(Samples[i] + FMath::RoundToInt32(32768.f * Amplitude * FMath::Sin(2.f * PI * Frequency * i / SAMPLE_RATE)), -32768, 32767);
+	}
+
+	void AddNoise(TArray<int16>& Samples, FRandomStream& Random, float Amplitude, int32 From, int32 Num)
+	{
+		for (int32 i = From; i < From + Num; i++)
+			Samples[i] = (int16)FMath::Clamp(Samples[i] + FMath::RoundToInt32(32768.f * Amplitude * Random.FRandRange(-1.f, 1.f)), -32768, 32767);
+	}
+
+	/** dBFS over Samples[From, From + Num) */
+	float RmsDb(const TArray<int16>& Samples, int32 From, int32 Num)
+	{
+		double Sum = 0.0;
+		for (int32 i = From; i < From + Num; i++)
+			Sum += FMath::Square(Samples[i] / 32768.0);
+
+		return 10.f * FMath::LogX(10.f, (float)(Sum / Num) + 1e-20f);
+	}
+
+	/** Conditions a copy of In in odd sized chunks, the way device buffers arrive */
+	TArray<int16> Condition(const FVoskAudioConditioningSettings& Settings, const TArray<int16>& In)
+	{
+		TArray<int16> Out = In;
+		FVoskAudioConditioner Conditioner(SAMPLE_RATE, Settings);
+		for (int32 Offset = 0; Offset < Out.Num(); Offset += 333)
+			Conditioner.Process(Out.GetData() + Offset, FMath::Min(333, Out.Num() - Offset));
+
+		return Out;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskAudioConditionerFilterTest, "VoskPlugin.AudioConditioner.Filters",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskAudioConditionerFilterTest::RunTest(const FString& Parameters)
+{
+	// measured over the second half, filters have settled by then
+	const int32 From = SAMPLE_RATE / 2;
+	const int32 Num = SAMPLE_RATE / 2;
+
+	{
+		FVoskAudioConditioningSettings Settings = NoStages();
+		Settings.bRemoveDC = true;
+
+		TArray<int16> In;
+		In.Init(8000, SAMPLE_RATE);
+		AddTone(In, 1000.f, 0.1f, 0, In.Num());
+		const TArray<int16> Out = Condition(Settings, In);
+
+		int64 Sum = 0;
+		for (int32 i = From; i < From + Num; i++)
+			Sum += Out[i];
+
+		TestTrue(FString::Printf(TEXT("DC removed (mean %lld)"), Sum / Num), FMath::Abs(Sum / Num) < 8);
+
+		TArray<int16> Tone;
+		Tone.SetNumZeroed(SAMPLE_RATE);
+		AddTone(Tone, 1000.f, 0.1f, 0, Tone.Num());
+		TestEqual(TEXT("DC blocker passes 1 kHz"), RmsDb(Out, From, Num), RmsDb(Tone, From, Num), 0.2f);
+	}
+
+	{
+		FVoskAudioConditioningSettings Settings = NoStages();
+		Settings.bHighPass = true;
+
+		TArray<int16> Hum;
+		Hum.SetNumZeroed(SAMPLE_RATE);
+		AddTone(Hum, 60.f, 0.25f, 0, Hum.Num());
+
+		TArray<int16> Speech;
+		Speech.SetNumZeroed(SAMPLE_RATE);
+		AddTone(Speech, 1000.f, 0.25f, 0, Speech.Num());
+
+		// 2nd order at 80 Hz, -6.2 dB at 60 Hz and flat at 1 kHz
+		const float HumGain = RmsDb(Condition(Settings, Hum), From, Num) - RmsDb(Hum, From, Num);
+		const float SpeechGain = RmsDb(Condition(Settings, Speech), From, Num) - RmsDb(Speech, From, Num);
+		TestTrue(FString::Printf(TEXT("60 Hz rejected (%.2f dB)"), HumGain), HumGain < -5.5f);
+		TestEqual(TEXT("high-pass passes 1 kHz"), SpeechGain, 0.f, 0.2f);
+
+		// raising the cutoff rejects hum harder
+		Settings.HighPassCutoff = 200.f;
+		const float SteepHumGain = RmsDb(Condition(Settings, Hum), From, Num) - RmsDb(Hum, From, Num);
+		TestTrue(FString::Printf(TEXT("60 Hz rejected at 200 Hz cutoff (%.2f dB)"), SteepHumGain), SteepHumGain < -20.f);
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskAudioConditionerAutoGainTest, "VoskPlugin.AudioConditioner.AutoGain",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskAudioConditionerAutoGainTest::RunTest(const FString& Parameters)
+{
+	FVoskAudioConditioningSettings Settings = NoStages();
+	Settings.bAutoGain = true;
+
+	// quiet and hot microphone both end up at TargetLevel, as long as MaxGain allows it
+	const float Amplitudes[] = { 0.02f, 0.5f };
+	for (const float Amplitude : Amplitudes)
+	{
+		TArray<int16> In;
+		In.SetNumZeroed(2 * SAMPLE_RATE);
+		AddTone(In, 440.f, Amplitude, 0, In.Num());
+
+		const TArray<int16> Out = Condition(Settings, In);
+		TestEqual(FString::Printf(TEXT("%.2f amplitude converges to target"), Amplitude), RmsDb(Out, 3 * SAMPLE_RATE / 2, SAMPLE_RATE / 2), Settings.TargetLevel, 0.5f);
+	}
+
+	// too quiet to reach the target, gain stops at MaxGain
+	TArray<int16> In;
+	In.SetNumZeroed(2 * SAMPLE_RATE);
+	AddTone(In, 440.f, 0.005f, 0, In.Num());
+
+	const TArray<int16> Out = Condition(Settings, In);
+	const float Gain = RmsDb(Out, 3 * SAMPLE_RATE / 2, SAMPLE_RATE / 2) - RmsDb(In, 3 * SAMPLE_RATE / 2, SAMPLE_RATE / 2);
+	TestEqual(TEXT("gain limited to MaxGain"), Gain, Settings.MaxGain, 0.5f);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskAudioConditionerNoiseGateTest, "VoskPlugin.AudioConditioner.NoiseGate",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskAudioConditionerNoiseGateTest::RunTest(const FString& Parameters)
+{
+	FVoskAudioConditioningSettings Settings = NoStages();
+	Settings.bNoiseGate = true;
+
+	// two seconds of stationary noise, then a tone over it
+	FRandomStream Random(5);
+	TArray<int16> In;
+	In.SetNumZeroed(3 * SAMPLE_RATE);
+	AddNoise(In, Random, 0.02f, 0, In.Num());
+	AddTone(In, 1000.f, 0.1f, 2 * SAMPLE_RATE, SAMPLE_RATE);
+
+	TArray<int16> Tone;
+	Tone.SetNumZeroed(In.Num());
+	AddTone(Tone, 1000.f, 0.1f, 2 * SAMPLE_RATE, SAMPLE_RATE);
+
+	const TArray<int16> Out = Condition(Settings, In);
+
+	// gate needs a moment to learn the floor, second second is noise only
+	const float NoiseGain = RmsDb(Out, SAMPLE_RATE, SAMPLE_RATE) - RmsDb(In, SAMPLE_RATE, SAMPLE_RATE);
+	TestTrue(FString::Printf(TEXT("stationary noise attenuated (%.2f dB)"), NoiseGain), NoiseGain < -10.f);
+
+	// remaining noise is far below the tone, output is the tone alone
+	const int32 ToneFrom = 2 * SAMPLE_RATE + SAMPLE_RATE / 2;
+	TestEqual(TEXT("tone passes"), RmsDb(Out, ToneFrom, SAMPLE_RATE / 2), RmsDb(Tone, ToneFrom, SAMPLE_RATE / 2), 0.5f);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskAudioConditionerConversionTest, "VoskPlugin.AudioConditioner.Conversion",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskAudioConditionerConversionTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(3);
+
+	// lengths off the vector width so the scalar tail runs too
+	for (int32 Num = 1; Num < 120; Num += 3)
+	{
+		TArray<int16> Samples;
+		Samples.SetNumUninitialized(Num);
+		for (int16& Sample : Samples)
+			Sample = (int16)Random.RandRange(-32768, 32767);
+		Samples[0] = -32768;
+
+		TArray<float> Floats;
+		Floats.SetNumUninitialized(Num);
+		FVoskAudioConditioner::ToFloat(Samples.GetData(), Floats.GetData(), Num);
+
+		int32 FloatMismatches = 0;
+		for (int32 i = 0; i < Num; i++)
+			FloatMismatches += Floats[i] != Samples[i] / 32768.f;
+		TestEqual(FString::Printf(TEXT("%d samples to float"), Num), FloatMismatches, 0);
+
+		// exact halves, values past full scale and plain ones
+		for (int32 i = 0; i < Num; i++)
+		{
+			switch (Random.RandRange(0, 2))
+			{
+			case 0: Floats[i] = (Random.RandRange(-32768, 32767) + 0.5f) / 32768.f; break;
+			case 1: Floats[i] = Random.FRandRange(-4.f, 4.f); break;
+			default: Floats[i] = Random.FRandRange(-1.f, 1.f); break;
+			}
+		}
+
+		FVoskAudioConditioner::ToInt16(Floats.GetData(), Samples.GetData(), Num);
+
+		int32 IntMismatches = 0;
+		for (int32 i = 0; i < Num; i++)
+			IntMismatches += Samples[i] != (int16)FMath::Clamp(FMath::RoundHalfToEven(Floats[i] * 32768.f), -32768.f, 32767.f);
+		TestEqual(FString::Printf(TEXT("%d samples to int16"), Num), IntMismatches, 0);
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskAudioConditionerFlushTest, "VoskPlugin.AudioConditioner.Flush",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskAudioConditionerFlushTest::RunTest(const FString& Parameters)
+{
+	// gate with no attenuation is transparent, output is input delayed by the latency
+	FVoskAudioConditioningSettings Settings = NoStages();
+	Settings.NoiseGateAttenuation = 0.f;
+
+	const bool GateSettings[] = { false, true };
+	for (const bool bNoiseGate : GateSettings)
+	{
+		Settings.bNoiseGate = bNoiseGate;
+		FVoskAudioConditioner Conditioner(SAMPLE_RATE, Settings);
+
+		TArray<int16> Held;
+		Conditioner.Flush(Held);
+		TestEqual(TEXT("nothing to flush before any audio"), Held.Num(), 0);
+
+		TArray<int16> In;
+		In.SetNumUninitialized(1000);
+		for (int32 i = 0; i < In.Num(); i++)
+			In[i] = (int16)(i * 13 % 2000 - 1000);
+
+		TArray<int16> Out = In;
+		Conditioner.Process(Out.GetData(), Out.Num());
+		Conditioner.Flush(Held);
+		Out.Append(Held);
+
+		const int32 Latency = Conditioner.GetLatency();
+		TestEqual(TEXT("latency"), Latency, bNoiseGate ? 2 * FVoskAudioConditioner::HOP_SIZE : FVoskAudioConditioner::HOP_SIZE);
+		TestEqual(TEXT("flushed samples"), Held.Num(), Latency);
+
+		int32 MaxError = 0;
+		for (int32 i = 0; i < In.Num(); i++)
+			MaxError = FMath::Max(MaxError, FMath::Abs(Out[Latency + i] - In[i]));
+		TestTrue(FString::Printf(TEXT("gate %d, every sample comes out (max error %d)"), bNoiseGate, MaxError), MaxError <= 1);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
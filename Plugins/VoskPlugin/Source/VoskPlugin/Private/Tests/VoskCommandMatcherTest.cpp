@@ -0,0 +1,177 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskCommandMatcher.h"
+#include "VoskStringDistance.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Same rule as the matcher, compared lower case with surrounding whitespace trimmed */
+	FString NormalizePhrase(const FString& Phrase)
+	{
+		return Phrase.TrimStartAndEnd().ToLower();
+	}
+
+	/** Scores every known phrase, no tree */
+	TArray<FVoskCommandMatch> BruteForceMatches(const TArray<FString>& Phrases, const FString& Text, float MinScore)
+	{
+		TArray<FVoskCommandMatch> Matches;
+
+		VoskStringDistance::FCodepoints Query, Key;
+		VoskStringDistance::ToCodepoints(NormalizePhrase(Text), Query);
+		if (Query.Num() == 0)
+			return Matches;
+
+		for (const FString& Phrase : Phrases)
+		{
+			VoskStringDistance::ToCodepoints(Phrase, Key);
+			const int32 Distance = VoskStringDistance::Levenshtein(Key.GetData(), Key.Num(), Query.GetData(), Query.Num());
+			const float Score = 1.f - (float)Distance / (float)FMath::Max(Key.Num(), Query.Num());
+			if (Score < MinScore)
+				continue;
+
+			FVoskCommandMatch& Match = Matches.AddDefaulted_GetRef();
+			Match.Phrase = Phrase;
+			Match.Score = Score;
+			Match.Distance = Distance;
+		}
+
+		return Matches;
+	}
+
+	/** Order within equal score and distance is unspecified, phrase breaks the tie */
+	void SortMatches(TArray<FVoskCommandMatch>& Matches)
+	{
+		Matches.Sort([](const FVoskCommandMatch& A, const FVoskCommandMatch& B) {
+			if (A.Score != B.Score)
+				return A.Score > B.Score;
+			if (A.Distance != B.Distance)
+				return A.Distance < B.Distance;
+			return A.Phrase < B.Phrase;
+		});
+	}
+
+	bool SameMatches(const TArray<FVoskCommandMatch>& A, const TArray<FVoskCommandMatch>& B)
+	{
+		if (A.Num() != B.Num())
+			return false;
+
+		for (int32 i = 0; i < A.Num(); i++)
+		{
+			if (A[i].Phrase != B[i].Phrase || A[i].Score != B[i].Score || A[i].Distance != B[i].Distance)
+				return false;
+		}
+
+		return true;
+	}
+
+	FString RandomPhrase(FRandomStream& Random, const TCHAR* Alphabet)
+	{
+		const int32 AlphabetLen = FCString::Strlen(Alphabet);
+		const int32 Len = Random.RandRange(1, 12);
+		FString Out;
+		for (int32 i = 0; i < Len; i++)
+			Out.AppendChar(Alphabet[Random.RandHelper(AlphabetLen)]);
+		return Out;
+	}
+
+	// small alphabets so that many phrases land close to each other and to the queries
+	const TCHAR* Alphabets[] = {TEXT("abcd "), TEXT("打开关灯")};
+	const float Thresholds[] = {0.f, 0.3f, 0.5f, 0.6f, 0.7f, 0.75f, 0.8f, 0.9f, 1.f};
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskCommandMatcherTest, "VoskPlugin.CommandMatcher.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskCommandMatcherTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(77);
+
+	for (const TCHAR* Alphabet : Alphabets)
+	{
+		// duplicates as written, in upper case and padded with whitespace
+		TArray<FString> Input;
+		for (int32 i = 0; i < 300; i++)
+		{
+			Input.Add(RandomPhrase(Random, Alphabet));
+			if (i % 5 == 0)
+				Input.Add(Input.Last());
+			if (i % 7 == 0)
+				Input.Add(TEXT("  ") + Input.Last().ToUpper() + TEXT(" "));
+		}
+		Input.Add(TEXT(""));
+		Input.Add(TEXT("   "));
+
+		// reference keeps first occurrence of each normalized phrase
+		TArray<FString> Phrases;
+		for (const FString& Phrase : Input)
+		{
+			const FString Normalized = NormalizePhrase(Phrase);
+			if (!Normalized.IsEmpty())
+				Phrases.AddUnique(Normalized);
+		}
+
+		UVoskCommandMatcher* Matcher = UVoskCommandMatcher::CreateCommandMatcher(Input);
+		TestEqual(FString::Printf(TEXT("%s phrases"), Alphabet), Matcher->GetNumPhrases(), Phrases.Num());
+		TestFalse(FString::Printf(TEXT("%s duplicate rejected"), Alphabet), Matcher->AddPhrase(Phrases[0].ToUpper()));
+		TestFalse(FString::Printf(TEXT("%s empty rejected"), Alphabet), Matcher->AddPhrase(TEXT(" ")));
+
+		// tree as built, with tombstones, then rebuilt once removals dominate
+		const int32 Removals[] = {0, Phrases.Num() / 3, Phrases.Num() / 3};
+		for (int32 Stage = 0; Stage < UE_ARRAY_COUNT(Removals); Stage++)
+		{
+			for (int32 i = 0; i < Removals[Stage]; i++)
+			{
+				const int32 Index = Random.RandHelper(Phrases.Num());
+				TestTrue(FString::Printf(TEXT("%s removed"), Alphabet), Matcher->RemovePhrase(TEXT(" ") + Phrases[Index].ToUpper()));
+				Phrases.RemoveAtSwap(Index);
+			}
+			TestEqual(FString::Printf(TEXT("%s phrases at stage %d"), Alphabet, Stage), Matcher->GetNumPhrases(), Phrases.Num());
+
+			TArray<FString> Queries = {TEXT(""), TEXT("  "), Phrases[0], Phrases.Last().ToUpper()};
+			for (int32 i = 0; i < 100; i++)
+				Queries.Add(RandomPhrase(Random, Alphabet));
+
+			for (const FString& Query : Queries)
+			{
+				for (const float MinScore : Thresholds)
+				{
+					const FString What = FString::Printf(TEXT("%s stage %d, '%s' at %.2f"), Alphabet, Stage, *Query, MinScore);
+
+					TArray<FVoskCommandMatch> Expected = BruteForceMatches(Phrases, Query, MinScore);
+					TArray<FVoskCommandMatch> Actual = Matcher->FindMatches(Query, MAX_int32, MinScore);
+
+					// already best first, sorting again only settles ties
+					for (int32 i = 1; i < Actual.Num(); i++)
+					{
+						if (Actual[i - 1].Score < Actual[i].Score || (Actual[i - 1].Score == Actual[i].Score && Actual[i - 1].Distance > Actual[i].Distance))
+						{
+							AddError(What + TEXT(" not best first"));
+							return false;
+						}
+					}
+
+					SortMatches(Expected);
+					SortMatches(Actual);
+					if (!TestTrue(What, SameMatches(Actual, Expected)))
+						return false;
+
+					// truncated lookup keeps the best scores
+					const int32 MaxResults = 3;
+					const TArray<FVoskCommandMatch> Best = Matcher->FindMatches(Query, MaxResults, MinScore);
+					TestEqual(What + TEXT(" truncated"), Best.Num(), FMath::Min(MaxResults, Expected.Num()));
+					for (int32 i = 0; i < Best.Num() && i < Expected.Num(); i++)
+						TestEqual(What + TEXT(" truncated score"), Best[i].Score, Expected[i].Score);
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,148 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskDownmix.h"
+#include "VoskSoundUtils.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	TArray<int16> RandomSamples(FRandomStream& Random, int32 Num)
+	{
+		TArray<int16> Samples;
+		Samples.SetNumUninitialized(Num);
+		for (int16& Sample : Samples)
+			Sample = (int16)Random.RandRange(-32768, 32767);
+		return Samples;
+	}
+
+	/** Scalar reference, averages rounded down */
+	TArray<int16> Average(const TArray<int16>& In, int32 NumChannels)
+	{
+		TArray<int16> Out;
+		for (int32 i = 0; i < In.Num() / NumChannels; i++)
+		{
+			int32 Sum = 0;
+			for (int32 c = 0; c < NumChannels; c++)
+				Sum += In[i * NumChannels + c];
+			Out.Add((int16)FMath::FloorToInt((double)Sum / NumChannels));
+		}
+		return Out;
+	}
+
+	TArray<uint8> ToBytes(const TArray<int16>& Samples)
+	{
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Samples.GetData()), Samples.Num() * sizeof(int16));
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskDownmixTest, "VoskPlugin.Downmix.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskDownmixTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+
+	// 37 frames cover the SIMD loop and the scalar tail
+	const int32 NumFrames = 37;
+
+	for (int32 NumChannels = 1; NumChannels <= 6; NumChannels++)
+	{
+		const TArray<int16> In = RandomSamples(Random, NumFrames * NumChannels);
+
+		const TArray<int16> Expected = Average(In, NumChannels);
+
+		TArray<int16> Out;
+		Out.SetNumZeroed(NumFrames);
+		VoskDownmix::Downmix(In.GetData(), Out.GetData(), NumFrames, NumChannels);
+		TestTrue(FString::Printf(TEXT("%d channels"), NumChannels), Out == Expected);
+
+		TArray<int16> InPlace = In;
+		VoskDownmix::Downmix(InPlace.GetData(), InPlace.GetData(), NumFrames, NumChannels);
+		InPlace.SetNum(NumFrames);
+		TestTrue(FString::Printf(TEXT("%d channels in place"), NumChannels), InPlace == Expected);
+
+		TArray<uint8> Bytes = ToBytes(In);
+		VoskDownmix::DownmixInPlace(Bytes, NumChannels);
+		TestTrue(FString::Printf(TEXT("%d channels pcm bytes"), NumChannels), Bytes == ToBytes(Expected));
+
+		// header is patched to mono, samples follow it
+		TArray<uint8> Mono;
+		const TArray<uint8> Wave = VoskComponentUtils::GenerateWaveHeader(ToBytes(In), 16000, NumChannels);
+		TestTrue(FString::Printf(TEXT("%d channels wave"), NumChannels),
+			VoskDownmix::DownmixWave(Wave.GetData(), Wave.Num(), Mono) && Mono == VoskComponentUtils::GenerateWaveHeader(ToBytes(Expected), 16000, 1));
+
+		TArray<float> FloatIn;
+		for (const int16 Sample : In)
+			FloatIn.Add(Sample / 32768.f);
+
+		TArray<float> FloatOut;
+		FloatOut.SetNumZeroed(NumFrames);
+		VoskDownmix::Downmix(FloatIn.GetData(), FloatOut.GetData(), NumFrames, NumChannels);
+
+		bool bFloat = true;
+		for (int32 i = 0; i < NumFrames; i++)
+		{
+			float Sum = 0.f;
+			for (int32 c = 0; c < NumChannels; c++)
+				Sum += FloatIn[i * NumChannels + c];
+			bFloat &= FMath::IsNearlyEqual(FloatOut[i], Sum / NumChannels, 1e-6f);
+		}
+		TestTrue(FString::Printf(TEXT("%d channels float"), NumChannels), bFloat);
+	}
+
+	// odd negative sums round down whatever the channel count
+	const int16 NegativeStereo[] = { -3, 0 };
+	const int16 NegativeQuad[] = { -3, 0, 0, 0 };
+	int16 Rounded[2] = {};
+	VoskDownmix::Downmix(NegativeStereo, Rounded, 1, 2);
+	VoskDownmix::Downmix(NegativeQuad, Rounded + 1, 1, 4);
+	TestEqual(TEXT("stereo rounding"), (int32)Rounded[0], -2);
+	TestEqual(TEXT("quad rounding"), (int32)Rounded[1], -1);
+
+	// left channel only
+	const TArray<int16> Stereo = RandomSamples(Random, NumFrames * 2);
+	const float LeftOnly[] = { 1.f, 0.f };
+	TArray<int16> Left;
+	Left.SetNumZeroed(NumFrames);
+	VoskDownmix::Downmix(Stereo.GetData(), Left.GetData(), NumFrames, 2, LeftOnly);
+
+	bool bLeft = true;
+	for (int32 i = 0; i < NumFrames; i++)
+		bLeft &= Left[i] == Stereo[i * 2];
+	TestTrue(TEXT("weighted"), bLeft);
+
+	TArray<float> FloatStereo;
+	for (const int16 Sample : Stereo)
+		FloatStereo.Add(Sample / 32768.f);
+
+	TArray<float> FloatLeft;
+	FloatLeft.SetNumZeroed(NumFrames);
+	VoskDownmix::Downmix(FloatStereo.GetData(), FloatLeft.GetData(), NumFrames, 2, LeftOnly);
+
+	bool bFloatLeft = true;
+	for (int32 i = 0; i < NumFrames; i++)
+		bFloatLeft &= FloatLeft[i] == FloatStereo[i * 2];
+	TestTrue(TEXT("weighted float"), bFloatLeft);
+
+	// no channels is a no-op rather than a division by zero
+	TArray<int16> Untouched;
+	Untouched.SetNumZeroed(NumFrames);
+	VoskDownmix::Downmix(Stereo.GetData(), Untouched.GetData(), NumFrames, 0);
+
+	bool bUntouched = true;
+	for (const int16 Sample : Untouched)
+		bUntouched &= Sample == 0;
+	TestTrue(TEXT("zero channels"), bUntouched);
+
+	TArray<uint8> NoChannels;
+	const TArray<uint8> Empty = VoskComponentUtils::GenerateWaveHeader(ToBytes(Stereo), 16000, 0);
+	TestFalse(TEXT("zero channel wave"), VoskDownmix::DownmixWave(Empty.GetData(), Empty.Num(), NoChannels));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
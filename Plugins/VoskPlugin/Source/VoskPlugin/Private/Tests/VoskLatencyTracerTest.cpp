@@ -0,0 +1,106 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskLatencyTracer.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskLatencyTracerTest, "VoskPlugin.LatencyTracer.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskLatencyTracerTest::RunTest(const FString& Parameters)
+{
+	// once for each way of breaking the reply order below
+	AddExpectedError(TEXT("latency is no longer traced"), EAutomationExpectedErrorFlags::Contains, 3);
+
+	FVoskLatencyTracer Tracer;
+	const double Now = FPlatformTime::Seconds();
+
+	// one reply per frame, in order
+	{
+		Tracer.BeginSession();
+		const int32 First = (int32)Tracer.OnAudioSent(Now);
+		const int32 Second = (int32)Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("first frame"), Tracer.OnResult(Now, false), First);
+		TestEqual(TEXT("second frame"), Tracer.OnResult(Now, false), Second);
+
+		// final result request answers for the last frame
+		Tracer.OnFinalResultRequested();
+		TestEqual(TEXT("final result"), Tracer.OnResult(Now, true), Second);
+		TestEqual(TEXT("timed results"), Tracer.GetReport().CaptureToResult.Samples, 3);
+	}
+
+	// reset is answered by an acknowledgement or by a result, neither is timed
+	{
+		Tracer.BeginSession();
+		const int32 Before = (int32)Tracer.OnAudioSent(Now);
+		Tracer.OnResetRequested();
+		const int32 After = (int32)Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("frame before reset"), Tracer.OnResult(Now, false), Before);
+		Tracer.OnOtherMessage();
+		TestEqual(TEXT("frame after acknowledged reset"), Tracer.OnResult(Now, false), After);
+
+		Tracer.OnResetRequested();
+		const int32 Next = (int32)Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("reset answered by result"), Tracer.OnResult(Now, true), (int32)INDEX_NONE);
+		TestEqual(TEXT("frame after answered reset"), Tracer.OnResult(Now, false), Next);
+
+		const FVoskLatencyReport Report = Tracer.GetReport();
+		TestEqual(TEXT("resets not timed"), Report.CaptureToResult.Samples, 3);
+		TestFalse(TEXT("still paired after resets"), Report.bPairingDropped);
+	}
+
+	// message in place of a reply, pairing is dropped instead of drifting
+	{
+		Tracer.BeginSession();
+		Tracer.OnAudioSent(Now);
+		Tracer.OnAudioSent(Now);
+		Tracer.OnOtherMessage();
+		TestEqual(TEXT("result after dropped pairing"), Tracer.OnResult(Now, false), (int32)INDEX_NONE);
+
+		Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("new frames are not paired either"), Tracer.OnResult(Now, false), (int32)INDEX_NONE);
+
+		const FVoskLatencyReport Report = Tracer.GetReport();
+		TestTrue(TEXT("pairing dropped"), Report.bPairingDropped);
+		TestEqual(TEXT("unmatched results"), Report.UnmatchedResults, 2);
+		TestEqual(TEXT("no timed results"), Report.CaptureToResult.Samples, 0);
+	}
+
+	// acknowledgement with nothing in flight, e.g. of the config sent on connect, is harmless
+	{
+		Tracer.BeginSession();
+		Tracer.OnOtherMessage();
+		const int32 Frame = (int32)Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("frame after idle acknowledgement"), Tracer.OnResult(Now, false), Frame);
+		TestFalse(TEXT("idle acknowledgement keeps pairing"), Tracer.GetReport().bPairingDropped);
+	}
+
+	// extra result would shift every later pair
+	{
+		Tracer.BeginSession();
+		TestEqual(TEXT("extra result"), Tracer.OnResult(Now, false), (int32)INDEX_NONE);
+		Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("frame after extra result"), Tracer.OnResult(Now, false), (int32)INDEX_NONE);
+		TestTrue(TEXT("extra result drops pairing"), Tracer.GetReport().bPairingDropped);
+	}
+
+	// server answering several frames at once leaves them piling up
+	{
+		Tracer.BeginSession();
+		for (int32 i = 0; i < 2048; i++)
+			Tracer.OnAudioSent(Now);
+		TestTrue(TEXT("unanswered frames drop pairing"), Tracer.GetReport().bPairingDropped);
+	}
+
+	// next session starts paired
+	{
+		Tracer.BeginSession();
+		const int32 Frame = (int32)Tracer.OnAudioSent(Now);
+		TestEqual(TEXT("paired again in new session"), Tracer.OnResult(Now, false), Frame);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskPinyin.h"
+#include "VoskCommandMatcher.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Excerpt of pinyin-data pinyin.txt, plus a line of every kind the parser has to skip */
+	const TCHAR* PinyinData = TEXT(
+		"# version: 0.14.0\n"
+		"U+5F00: kāi  # 开\n"
+		"U+6253: dǎ,dá  # 打\n"
+		"U+706F: dēng  # 灯\n"
+		"U+767B: dēng  # 登\n"
+		"U+5417: ma,má,mǎ  # 吗\n"
+		"U+5973: nǚ,rǔ  # 女\n"
+		"U+20000: hē  # 𠀀\n"
+		"\n"
+		"malformed line\n");
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskPinyinTest, "VoskPlugin.Pinyin.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskPinyinTest::RunTest(const FString& Parameters)
+{
+	const FVoskPinyinTable Table(PinyinData);
+
+	if (!TestFalse(TEXT("table loaded"), Table.IsEmpty()))
+		return false;
+
+	// first reading wins, neutral tone is 5, latin runs stay together
+	TestEqual(TEXT("with tones"), Table.ToPinyin(TEXT("打开灯吗"), true), FString(TEXT("da3 kai1 deng1 ma5")));
+	TestEqual(TEXT("toneless"), Table.ToPinyin(TEXT("打开灯"), false), FString(TEXT("da kai deng")));
+	TestEqual(TEXT("mixed"), Table.ToPinyin(TEXT("打开 tv 灯"), true), FString(TEXT("da3 kai1 tv deng1")));
+	TestEqual(TEXT("umlaut"), Table.ToPinyin(TEXT("女"), true), FString(TEXT("nv3")));
+	TestEqual(TEXT("supplementary"), Table.ToPinyin(TEXT("\U00020000"), true), FString(TEXT("he1")));
+	TestEqual(TEXT("unknown hanzi"), Table.ToPinyin(TEXT("中"), true), FString(TEXT("中")));
+
+	// homophones share a key, characters outside the table keep their codepoint
+	TArray<UTF32CHAR> Lamp, Climb;
+	Table.MakeKey(TEXT("开灯"), true, Lamp);
+	Table.MakeKey(TEXT("开 登"), true, Climb);
+	TestTrue(TEXT("homophone keys"), Lamp == Climb);
+
+	Table.MakeKey(TEXT("中"), true, Lamp);
+	TestTrue(TEXT("unknown key"), Lamp.Num() == 1 && Lamp[0] == 0x4E2D);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskPinyinBuiltInTest, "VoskPlugin.Pinyin.BuiltIn",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskPinyinBuiltInTest::RunTest(const FString& Parameters)
+{
+	if (!TestTrue(TEXT("pinyin available"), UVoskCommandMatcher::IsPinyinAvailable()))
+		return false;
+
+	TestEqual(TEXT("readings"), UVoskCommandMatcher::ConvertToPinyin(TEXT("重庆 重新 打开灯")), FString(TEXT("zhong4 qing4 zhong4 xin1 da3 kai1 deng1")));
+
+	// recognizer picks other hanzi of the same syllables
+	const TArray<FString> Phrases = { TEXT("重庆"), TEXT("重新开始"), TEXT("打开灯") };
+	UVoskCommandMatcher* Matcher = UVoskCommandMatcher::CreateCommandMatcher(Phrases, EVoskMatchMode::Pinyin);
+
+	FVoskCommandMatch Match;
+	TestTrue(TEXT("homophone city"), Matcher->FindBestMatch(TEXT("众庆"), Match, 1.f) && Match.Phrase == TEXT("重庆"));
+	TestTrue(TEXT("homophone restart"), Matcher->FindBestMatch(TEXT("众心开始"), Match, 1.f) && Match.Phrase == TEXT("重新开始"));
+	TestFalse(TEXT("other tone"), Matcher->FindBestMatch(TEXT("中心开始"), Match, 1.f));
+
+	Matcher->SetMatchMode(EVoskMatchMode::PinyinToneless);
+	TestTrue(TEXT("toneless"), Matcher->FindBestMatch(TEXT("中心开始"), Match, 1.f) && Match.Phrase == TEXT("重新开始"));
+
+	Matcher->SetMatchMode(EVoskMatchMode::Text);
+	TestFalse(TEXT("text mode"), Matcher->FindBestMatch(TEXT("众心开始"), Match, 1.f));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,63 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskReplayBuffer.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskReplayBufferTest, "VoskPlugin.ReplayBuffer.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskReplayBufferTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(11);
+	uint8 Next = 0;
+
+	// packets smaller and larger than the buffer, odd sizes included
+	for (int32 Capacity = 0; Capacity <= 48; Capacity += 7)
+	{
+		FVoskReplayBuffer Buffer;
+		Buffer.SetCapacity(Capacity);
+		TestEqual(FString::Printf(TEXT("%d capacity"), Capacity), Buffer.GetCapacity(), Capacity & ~1);
+
+		// reference drops the oldest bytes by moving, in whole samples
+		TArray<uint8> Expected;
+
+		for (int32 Packet = 0; Packet < 40; Packet++)
+		{
+			TArray<uint8> Data;
+			Data.SetNumUninitialized(Random.RandRange(0, 70));
+			for (uint8& Byte : Data)
+				Byte = Next++;
+
+			Buffer.Append(Data.GetData(), Data.Num());
+
+			if (Buffer.GetCapacity() > 0)
+			{
+				Expected.Append(Data);
+				int32 Excess = Expected.Num() - Buffer.GetCapacity();
+				if (Excess > 0)
+				{
+					Excess += Excess & 1;
+					Expected.RemoveAt(0, FMath::Min(Excess, Expected.Num()));
+				}
+			}
+
+			TArray<uint8> Contents;
+			Buffer.CopyTo(Contents);
+			if (!TestTrue(FString::Printf(TEXT("%d capacity, packet %d"), Capacity, Packet), Contents == Expected))
+				break;
+
+			if (Packet % 13 == 12)
+			{
+				Buffer.Reset();
+				Expected.Reset();
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
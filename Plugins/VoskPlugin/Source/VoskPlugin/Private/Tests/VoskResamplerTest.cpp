@@ -0,0 +1,70 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskResampler.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** One second of sine at Frequency, resampled in chunks of ChunkSamples */
+	TArray<int16> ResampleTone(int32 SourceRate, int32 TargetRate, float Frequency, int32 ChunkSamples)
+	{
+		TArray<int16> In;
+		In.SetNumUninitialized(SourceRate);
+		for (int32 i = 0; i < In.Num(); i++)
+			In[i] = (int16)FMath::RoundToInt32(10000.f * FMath::Sin(2.f * PI * Frequency * i / SourceRate));
+
+		FVoskResampler Resampler(SourceRate, TargetRate);
+		TArray<int16> Out;
+		for (int32 Offset = 0; Offset < In.Num(); Offset += ChunkSamples)
+			Resampler.Process(In.GetData() + Offset, FMath::Min(ChunkSamples, In.Num() - Offset), Out);
+		Resampler.Flush(Out);
+
+		return Out;
+	}
+
+	/** Middle half only, keeps the edges of the tone out */
+	double Rms(const TArray<int16>& Samples)
+	{
+		double Sum = 0.0;
+		int32 Count = 0;
+		for (int32 i = Samples.Num() / 4; i < Samples.Num() * 3 / 4; i++, Count++)
+			Sum += (double)Samples[i] * Samples[i];
+
+		return Count > 0 ? FMath::Sqrt(Sum / Count) : 0.0;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskResamplerTest, "VoskPlugin.Resampler.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskResamplerTest::RunTest(const FString& Parameters)
+{
+	const int32 SourceRates[] = { 48000, 44100 };
+
+	for (const int32 SourceRate : SourceRates)
+	{
+		const TArray<int16> Speech = ResampleTone(SourceRate, 16000, 1000.f, 1001);
+		const TArray<int16> High = ResampleTone(SourceRate, 16000, 10000.f, 1001);
+
+		TestEqual(FString::Printf(TEXT("%d output length"), SourceRate), Speech.Num(), 16000);
+
+		// 1 kHz passes untouched, 10 kHz must not fold back to 6 kHz
+		const double SpeechRms = Rms(Speech);
+		const double HighRms = Rms(High);
+		TestTrue(FString::Printf(TEXT("%d passband gain (%.1f)"), SourceRate, SpeechRms), FMath::Abs(SpeechRms / (10000.0 / UE_SQRT_2) - 1.0) < 0.01);
+		TestTrue(FString::Printf(TEXT("%d 10 kHz attenuated (%.2f)"), SourceRate, HighRms), HighRms < SpeechRms * 0.001);
+
+		// chunking doesn't change the result
+		TestTrue(FString::Printf(TEXT("%d chunked"), SourceRate), ResampleTone(SourceRate, 16000, 1000.f, 7) == ResampleTone(SourceRate, 16000, 1000.f, SourceRate));
+	}
+
+	// equal rates are passed through
+	TestEqual(TEXT("passthrough length"), ResampleTone(16000, 16000, 1000.f, 1001).Num(), 16000);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
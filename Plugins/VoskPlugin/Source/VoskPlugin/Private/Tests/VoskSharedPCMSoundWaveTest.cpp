@@ -0,0 +1,56 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskSharedPCMSoundWave.h"
+#include "VoskSoundUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Pulls the wave block by block the way the audio renderer does, until it runs dry */
+	TArray<uint8> Play(UVoskSharedPCMSoundWave* Wave, int32 BlockSamples)
+	{
+		TArray<uint8> Played;
+		Wave->OnBeginGenerate();
+		while (Wave->OnGeneratePCMAudio(Played, BlockSamples) > 0)
+		{
+		}
+		Wave->OnEndGenerate();
+		return Played;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskSharedPCMSoundWaveTest, "VoskPlugin.SharedPCMSoundWave.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskSharedPCMSoundWaveTest::RunTest(const FString& Parameters)
+{
+	// odd length so the last block is a partial one
+	TArray<uint8> Pcm;
+	Pcm.SetNumUninitialized(1001 * sizeof(int16));
+	for (int32 i = 0; i < Pcm.Num(); i++)
+		Pcm[i] = (uint8)(i * 7);
+
+	const FVoskSharedPCM Samples = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(Pcm);
+
+	UVoskSharedPCMSoundWave* Wave = Cast<UVoskSharedPCMSoundWave>(VoskComponentUtils::CreateSoundFromSharedPCM(Samples, 16000, 1));
+	if (!TestNotNull(TEXT("wave created"), Wave))
+		return false;
+
+	TestEqual(TEXT("duration"), Wave->Duration, 1001.f / 16000.f, KINDA_SMALL_NUMBER);
+
+	const TArray<uint8> First = Play(Wave, 256);
+	const TArray<uint8> Second = Play(Wave, 256);
+
+	TestTrue(TEXT("first playback"), First == Pcm);
+	TestTrue(TEXT("second playback"), Second == Pcm);
+
+	// buffer is shared, not copied
+	TestEqual(TEXT("shared"), Samples.GetSharedReferenceCount(), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
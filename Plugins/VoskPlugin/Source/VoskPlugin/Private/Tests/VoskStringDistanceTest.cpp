@@ -0,0 +1,131 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskStringDistance.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Full matrix over codepoints, what CompareStrings used to do minus the byte confusion */
+	int32 ReferenceDistance(const VoskStringDistance::FCodepoints& A, const VoskStringDistance::FCodepoints& B)
+	{
+		TArray<int32> D;
+		const int32 W = B.Num() + 1;
+		D.SetNumUninitialized((A.Num() + 1) * W);
+
+		for (int32 i = 0; i <= A.Num(); i++) D[i * W] = i;
+		for (int32 j = 0; j <= B.Num(); j++) D[j] = j;
+
+		for (int32 i = 1; i <= A.Num(); i++)
+			for (int32 j = 1; j <= B.Num(); j++)
+				D[i * W + j] = FMath::Min3(D[(i - 1) * W + j] + 1, D[i * W + j - 1] + 1, D[(i - 1) * W + j - 1] + (A[i - 1] == B[j - 1] ? 0 : 1));
+
+		return D.Last();
+	}
+
+	FString RandomString(FRandomStream& Random, int32 Len, const TCHAR* Alphabet)
+	{
+		const int32 AlphabetLen = FCString::Strlen(Alphabet);
+		FString Out;
+		Out.Reserve(Len);
+		for (int32 i = 0; i < Len; i++)
+			Out.AppendChar(Alphabet[Random.RandHelper(AlphabetLen)]);
+		return Out;
+	}
+
+	const TCHAR* LatinAlphabet = TEXT("abcdefghij ");
+	const TCHAR* CjkAlphabet = TEXT("打开关闭灯门窗");
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskStringDistanceTest, "VoskPlugin.StringDistance.Correctness",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoskStringDistanceTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("kitten/sitting"), VoskStringDistance::Levenshtein(TEXT("kitten"), TEXT("sitting")), 3);
+	TestEqual(TEXT("empty"), VoskStringDistance::Levenshtein(TEXT(""), TEXT("abc")), 3);
+
+	// one substituted character out of four, not three bytes out of twelve
+	TestEqual(TEXT("cjk similarity"), VoskStringDistance::Similarity(TEXT("打开电灯"), TEXT("打开电门")), 0.75f);
+
+	// surrogate pair is a single codepoint
+	TestEqual(TEXT("surrogates"), VoskStringDistance::Levenshtein(TEXT("a\U0001F600b"), TEXT("ab")), 1);
+
+	FRandomStream Random(1234);
+	VoskStringDistance::FCodepoints A, B;
+
+	for (int32 Iteration = 0; Iteration < 2000; Iteration++)
+	{
+		// cover both the bit-parallel (<= 64) and banded paths
+		const int32 MaxLen = Iteration % 4 == 0 ? 300 : 70;
+		const TCHAR* Alphabet = Iteration % 2 ? CjkAlphabet : LatinAlphabet;
+
+		const FString Left = RandomString(Random, Random.RandHelper(MaxLen), Alphabet);
+		const FString Right = RandomString(Random, Random.RandHelper(MaxLen), Alphabet);
+
+		VoskStringDistance::ToCodepoints(Left, A);
+		VoskStringDistance::ToCodepoints(Right, B);
+
+		if (!TestEqual(FString::Printf(TEXT("random pair %d"), Iteration), VoskStringDistance::Levenshtein(Left, Right), ReferenceDistance(A, B)))
+			break;
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoskStringDistanceBenchmark, "VoskPlugin.StringDistance.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVoskStringDistanceBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Lengths[] = { 8, 24, 64, 200, 1000 };
+	const int32 Pairs = 64;
+
+	FRandomStream Random(42);
+
+	for (const int32 Len : Lengths)
+	{
+		TArray<FString> Left, Right;
+		for (int32 i = 0; i < Pairs; i++)
+		{
+			Left.Add(RandomString(Random, Len, CjkAlphabet));
+			Right.Add(RandomString(Random, Len, CjkAlphabet));
+		}
+
+		// keep total work per length roughly constant
+		const int32 Rounds = FMath::Max(1, 200000 / (Len * Len / 8 + Len));
+
+		VoskStringDistance::FCodepoints A, B;
+		int64 Checksum = 0;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; Round++)
+			for (int32 i = 0; i < Pairs; i++)
+				Checksum += VoskStringDistance::Levenshtein(Left[i], Right[i]);
+		const double FastTime = FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; Round++)
+			for (int32 i = 0; i < Pairs; i++)
+			{
+				VoskStringDistance::ToCodepoints(Left[i], A);
+				VoskStringDistance::ToCodepoints(Right[i], B);
+				Checksum -= ReferenceDistance(A, B);
+			}
+		const double ReferenceTime = FPlatformTime::Seconds() - Start;
+
+		TestEqual(FString::Printf(TEXT("checksum %d"), Len), Checksum, (int64)0);
+
+		const double Calls = (double)Rounds * Pairs;
+		AddInfo(FString::Printf(TEXT("len %4d: %8.3f us/call, full matrix %9.3f us/call (x%.1f)"),
+			Len, FastTime * 1e6 / Calls, ReferenceTime * 1e6 / Calls, ReferenceTime / FMath::Max(FastTime, 1e-9)));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,487 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskAudioConditioner.h"
+#include "Math/VectorRegister.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define VOSK_CONDITIONER_NEON 1
+	#define VOSK_CONDITIONER_SSE 0
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+	#define VOSK_CONDITIONER_NEON 0
+	#define VOSK_CONDITIONER_SSE 1
+#else
+	#define VOSK_CONDITIONER_NEON 0
+	#define VOSK_CONDITIONER_SSE 0
+#endif
+
+
+namespace
+{
+	/** Speech below this RMS is treated as silence and does not steer the gain */
+	const float AGC_SILENCE_LEVEL = 0.001f;
+
+	/** How fast the noise floor estimate may rise while a band is busy */
+	const float NOISE_FLOOR_RISE_DB_PER_SECOND = 6.f;
+
+	/** Per hop decay of a band gain towards attenuation once it falls under the gate */
+	const float GATE_RELEASE = 0.7f;
+
+	/**
+	* Per hop weight of the previous band power. A single periodogram bin of stationary noise
+	* swings by more than the threshold all the time, it only settles once averaged over a few hops
+	*/
+	const float POWER_SMOOTHING = 0.8f;
+
+	struct FStageTimer
+	{
+		uint64& Cycles;
+		const uint64 Start;
+
+		explicit FStageTimer(uint64& InCycles) : Cycles(InCycles), Start(FPlatformTime::Cycles64()) {}
+		~FStageTimer() { Cycles += FPlatformTime::Cycles64() - Start; }
+	};
+
+	FORCEINLINE float DbToAmplitude(float Db)
+	{
+		return FMath::Pow(10.f, Db / 20.f);
+	}
+}
+
+
+FVoskAudioConditioner::FVoskAudioConditioner(int32 InSampleRate, const FVoskAudioConditioningSettings& InSettings)
+	: SampleRate(FMath::Max(1, InSampleRate))
+{
+	HopIn.SetNumZeroed(HOP_SIZE);
+	HopOut.SetNumZeroed(HOP_SIZE);
+
+	Frame.SetNumZeroed(FFT_SIZE);
+	Overlap.SetNumZeroed(FFT_SIZE);
+	Window.SetNumUninitialized(FFT_SIZE);
+	SpectrumRe.SetNumZeroed(FFT_SIZE);
+	SpectrumIm.SetNumZeroed(FFT_SIZE);
+	SmoothedPower.SetNumZeroed(FFT_SIZE);
+	NoiseFloor.SetNumZeroed(FFT_SIZE);
+	BinGain.SetNumZeroed(FFT_SIZE);
+	TwiddleRe.SetNumUninitialized(FFT_SIZE / 2);
+	TwiddleIm.SetNumUninitialized(FFT_SIZE / 2);
+	BitReverse.SetNumUninitialized(FFT_SIZE);
+
+	// sqrt of periodic hann on both analysis and synthesis, squares sum to 1 at 50% overlap
+	for (int32 i = 0; i < FFT_SIZE; i++)
+		Window[i] = FMath::Sqrt(0.5f - 0.5f * FMath::Cos(2.f * PI * i / FFT_SIZE));
+
+	for (int32 k = 0; k < FFT_SIZE / 2; k++)
+	{
+		TwiddleRe[k] = FMath::Cos(2.f * PI * k / FFT_SIZE);
+		TwiddleIm[k] = -FMath::Sin(2.f * PI * k / FFT_SIZE);
+	}
+
+	const int32 Bits = FMath::FloorLog2(FFT_SIZE);
+	for (int32 i = 0; i < FFT_SIZE; i++)
+	{
+		int32 Reversed = 0;
+		for (int32 b = 0; b < Bits; b++)
+			Reversed |= ((i >> b) & 1) << (Bits - 1 - b);
+		BitReverse[i] = Reversed;
+	}
+
+	SetSettings(InSettings);
+	Reset();
+}
+
+void FVoskAudioConditioner::SetSettings(const FVoskAudioConditioningSettings& InSettings)
+{
+	Settings = InSettings;
+
+	// ~10Hz one pole DC blocker
+	DCCoefficient = FMath::Exp(-2.f * PI * 10.f / SampleRate);
+
+	// 2nd order butterworth high-pass
+	const float Cutoff = FMath::Clamp(Settings.HighPassCutoff, 10.f, SampleRate * 0.45f);
+	const float W0 = 2.f * PI * Cutoff / SampleRate;
+	const float CosW0 = FMath::Cos(W0);
+	const float Alpha = FMath::Sin(W0) / (2.f * UE_INV_SQRT_2);
+	const float A0 = 1.f + Alpha;
+
+	HPB0 = (1.f + CosW0) * 0.5f / A0;
+	HPB1 = -(1.f + CosW0) / A0;
+	HPB2 = HPB0;
+	HPA1 = -2.f * CosW0 / A0;
+	HPA2 = (1.f - Alpha) / A0;
+}
+
+void FVoskAudioConditioner::Reset()
+{
+	FMemory::Memzero(HopIn.GetData(), HopIn.Num() * sizeof(float));
+	FMemory::Memzero(HopOut.GetData(), HopOut.Num() * sizeof(float));
+	FMemory::Memzero(Frame.GetData(), Frame.Num() * sizeof(float));
+	FMemory::Memzero(Overlap.GetData(), Overlap.Num() * sizeof(float));
+	HopFill = 0;
+
+	DCLastIn = DCLastOut = 0.f;
+	HPZ1 = HPZ2 = 0.f;
+
+	for (float& G : BinGain)
+		G = 1.f;
+	bNoiseFloorValid = false;
+
+	LevelEnvelope = 0.f;
+	Gain = 1.f;
+
+	FMemory::Memzero(StageCycles, sizeof(StageCycles));
+	SamplesProcessed = 0;
+}
+
+FVoskAudioConditioningStats FVoskAudioConditioner::GetStats() const
+{
+	FVoskAudioConditioningStats Stats;
+	Stats.AudioSeconds = (float)((double)SamplesProcessed / SampleRate);
+	Stats.Convert = (float)FPlatformTime::ToMilliseconds64(StageCycles[Convert]);
+	Stats.DCRemoval = (float)FPlatformTime::ToMilliseconds64(StageCycles[DCRemoval]);
+	Stats.HighPass = (float)FPlatformTime::ToMilliseconds64(StageCycles[HighPass]);
+	Stats.NoiseGate = (float)FPlatformTime::ToMilliseconds64(StageCycles[NoiseGate]);
+	Stats.AutoGain = (float)FPlatformTime::ToMilliseconds64(StageCycles[AutoGain]);
+	Stats.CurrentGain = 20.f * FMath::LogX(10.f, FMath::Max(Gain, 1e-6f));
+	return Stats;
+}
+
+void FVoskAudioConditioner::ToFloat(const int16* In, float* Out, int32 Num)
+{
+	int32 i = 0;
+	const float Scale = 1.f / 32768.f;
+
+#if VOSK_CONDITIONER_SSE
+	const __m128 ScaleV = _mm_set1_ps(Scale);
+	for (; i + 8 <= Num; i += 8)
+	{
+		// interleave with itself and shift back down to sign extend
+		const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + i));
+		const __m128i Lo = _mm_srai_epi32(_mm_unpacklo_epi16(V, V), 16);
+		const __m128i Hi = _mm_srai_epi32(_mm_unpackhi_epi16(V, V), 16);
+		_mm_storeu_ps(Out + i, _mm_mul_ps(_mm_cvtepi32_ps(Lo), ScaleV));
+		_mm_storeu_ps(Out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(Hi), ScaleV));
+	}
+#elif VOSK_CONDITIONER_NEON
+	const float32x4_t ScaleV = vdupq_n_f32(Scale);
+	for (; i + 8 <= Num; i += 8)
+	{
+		const int16x8_t V = vld1q_s16(In + i);
+		vst1q_f32(Out + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(V))), ScaleV));
+		vst1q_f32(Out + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(V))), ScaleV));
+	}
+#endif
+
+	for (; i < Num; i++)
+		Out[i] = In[i] * Scale;
+}
+
+void FVoskAudioConditioner::ToInt16(const float* In, int16* Out, int32 Num)
+{
+	int32 i = 0;
+
+	// vector converts round half to even under the default rounding mode, tail has to match
+#if VOSK_CONDITIONER_SSE
+	const __m128 ScaleV = _mm_set1_ps(32768.f);
+	for (; i + 8 <= Num; i += 8)
+	{
+		// pack saturates, gain never wraps around
+		const __m128i Lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(In + i), ScaleV));
+		const __m128i Hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(In + i + 4), ScaleV));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(Lo, Hi));
+	}
+#elif VOSK_CONDITIONER_NEON
+	const float32x4_t ScaleV = vdupq_n_f32(32768.f);
+	for (; i + 8 <= Num; i += 8)
+	{
+		const int32x4_t Lo = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(In + i), ScaleV));
+		const int32x4_t Hi = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(In + i + 4), ScaleV));
+		vst1q_s16(Out + i, vcombine_s16(vqmovn_s32(Lo), vqmovn_s32(Hi)));
+	}
+#endif
+
+	for (; i < Num; i++)
+		Out[i] = (int16)FMath::Clamp(FMath::RoundHalfToEven(In[i] * 32768.f), -32768.f, 32767.f);
+}
+
+void FVoskAudioConditioner::Process(int16* Samples, int32 NumSamples)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskAudioConditioner::Process);
+
+	while (NumSamples > 0)
+	{
+		const int32 Num = FMath::Min(HOP_SIZE - HopFill, NumSamples);
+
+		{
+			// input is consumed before it is overwritten with the previous hop
+			FStageTimer Timer(StageCycles[Convert]);
+			ToFloat(Samples, HopIn.GetData() + HopFill, Num);
+			ToInt16(HopOut.GetData() + HopFill, Samples, Num);
+		}
+
+		HopFill += Num;
+		Samples += Num;
+		NumSamples -= Num;
+		SamplesProcessed += Num;
+
+		if (HopFill == HOP_SIZE)
+		{
+			ProcessHop();
+			HopFill = 0;
+		}
+	}
+}
+
+void FVoskAudioConditioner::Flush(TArray<int16>& OutSamples)
+{
+	OutSamples.Reset();
+	if (SamplesProcessed == 0)
+		return;
+
+	// silence shifts out whatever the hops and the overlap tail still hold, stats keep counting real audio only
+	OutSamples.SetNumZeroed(GetLatency());
+	Process(OutSamples.GetData(), OutSamples.Num());
+	SamplesProcessed -= OutSamples.Num();
+}
+
+void FVoskAudioConditioner::ProcessHop()
+{
+	if (Settings.bRemoveDC)
+	{
+		FStageTimer Timer(StageCycles[DCRemoval]);
+		RemoveDC(HopIn.GetData(), HOP_SIZE);
+	}
+
+	if (Settings.bHighPass)
+	{
+		FStageTimer Timer(StageCycles[HighPass]);
+		ApplyHighPass(HopIn.GetData(), HOP_SIZE);
+	}
+
+	if (Settings.bNoiseGate)
+	{
+		FStageTimer Timer(StageCycles[NoiseGate]);
+		ApplyNoiseGate(HopIn.GetData(), HopOut.GetData());
+	}
+	else
+	{
+		FMemory::Memcpy(HopOut.GetData(), HopIn.GetData(), HOP_SIZE * sizeof(float));
+	}
+
+	if (Settings.bAutoGain)
+	{
+		FStageTimer Timer(StageCycles[AutoGain]);
+		ApplyAutoGain(HopOut.GetData(), HOP_SIZE);
+	}
+}
+
+void FVoskAudioConditioner::RemoveDC(float* Data, int32 Num)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskAudioConditioner::RemoveDC);
+
+	float LastIn = DCLastIn;
+	float LastOut = DCLastOut;
+
+	for (int32 i = 0; i < Num; i++)
+	{
+		const float In = Data[i];
+		LastOut = In - LastIn + DCCoefficient * LastOut;
+		LastIn = In;
+		Data[i] = LastOut;
+	}
+
+	DCLastIn = LastIn;
+	DCLastOut = LastOut;
+}
+
+void FVoskAudioConditioner::ApplyHighPass(float* Data, int32 Num)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskAudioConditioner::ApplyHighPass);
+
+	// transposed direct form II
+	float Z1 = HPZ1;
+	float Z2 = HPZ2;
+
+	for (int32 i = 0; i < Num; i++)
+	{
+		const float In = Data[i];
+		const float Out = HPB0 * In + Z1;
+		Z1 = HPB1 * In - HPA1 * Out + Z2;
+		Z2 = HPB2 * In - HPA2 * Out;
+		Data[i] = Out;
+	}
+
+	HPZ1 = Z1;
+	HPZ2 = Z2;
+}
+
+void FVoskAudioConditioner::ApplyNoiseGate(const float* In, float* Out)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskAudioConditioner::ApplyNoiseGate);
+
+	float* Re = SpectrumRe.GetData();
+	float* Im = SpectrumIm.GetData();
+
+	// slide analysis frame by one hop
+	FMemory::Memmove(Frame.GetData(), Frame.GetData() + HOP_SIZE, HOP_SIZE * sizeof(float));
+	FMemory::Memcpy(Frame.GetData() + HOP_SIZE, In, HOP_SIZE * sizeof(float));
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	for (int32 i = 0; i < FFT_SIZE; i += 4)
+	{
+		VectorStore(VectorMultiply(VectorLoad(Frame.GetData() + i), VectorLoad(Window.GetData() + i)), Re + i);
+		VectorStore(Zero, Im + i);
+	}
+
+	FFT(Re, Im);
+
+	// seed from the input itself, the floor could take seconds to rise to it otherwise.
+	// Frame is only half filled on the first hop, seed again once it is full
+	if (!bNoiseFloorValid)
+	{
+		for (int32 k = 0; k < FFT_SIZE; k++)
+			SmoothedPower[k] = NoiseFloor[k] = FMath::Max(Re[k] * Re[k] + Im[k] * Im[k], 1e-12f);
+		bNoiseFloorValid = SamplesProcessed >= FFT_SIZE;
+	}
+
+	// floor follows band power down immediately and up slowly, so speech does not drag it along
+	const float Rise = FMath::Pow(10.f, NOISE_FLOOR_RISE_DB_PER_SECOND * HOP_SIZE / SampleRate / 10.f);
+	const float Threshold = FMath::Pow(10.f, Settings.NoiseGateThreshold / 10.f);
+
+	const VectorRegister4Float RiseV = VectorSetFloat1(Rise);
+	const VectorRegister4Float ThresholdV = VectorSetFloat1(Threshold);
+	const VectorRegister4Float MinFloorV = VectorSetFloat1(1e-12f);
+	const VectorRegister4Float OpenV = VectorSetFloat1(1.f);
+	const VectorRegister4Float ClosedV = VectorSetFloat1(DbToAmplitude(Settings.NoiseGateAttenuation));
+	const VectorRegister4Float ReleaseV = VectorSetFloat1(GATE_RELEASE);
+	const VectorRegister4Float AttackV = VectorSetFloat1(1.f - GATE_RELEASE);
+	const VectorRegister4Float SmoothingV = VectorSetFloat1(POWER_SMOOTHING);
+	const VectorRegister4Float NewPowerV = VectorSetFloat1(1.f - POWER_SMOOTHING);
+
+	// conjugate for inverse transform is folded into the gain
+	const VectorRegister4Float Conjugate = VectorSetFloat1(-1.f);
+
+	for (int32 k = 0; k < FFT_SIZE; k += 4)
+	{
+		const VectorRegister4Float BinRe = VectorLoad(Re + k);
+		const VectorRegister4Float BinIm = VectorLoad(Im + k);
+		const VectorRegister4Float BinPower = VectorMultiplyAdd(BinRe, BinRe, VectorMultiply(BinIm, BinIm));
+		const VectorRegister4Float Power = VectorMultiplyAdd(VectorLoad(SmoothedPower.GetData() + k), SmoothingV, VectorMultiply(BinPower, NewPowerV));
+		VectorStore(Power, SmoothedPower.GetData() + k);
+
+		VectorRegister4Float Floor = VectorMultiply(VectorLoad(NoiseFloor.GetData() + k), RiseV);
+		Floor = VectorMax(VectorMin(Floor, Power), MinFloorV);
+		VectorStore(Floor, NoiseFloor.GetData() + k);
+
+		// open instantly, close over a few hops to avoid musical noise
+		const VectorRegister4Float Target = VectorSelect(VectorCompareGT(Power, VectorMultiply(Floor, ThresholdV)), OpenV, ClosedV);
+		const VectorRegister4Float Smoothed = VectorMultiplyAdd(VectorLoad(BinGain.GetData() + k), ReleaseV, VectorMultiply(Target, AttackV));
+		const VectorRegister4Float G = VectorMax(Target, Smoothed);
+		VectorStore(G, BinGain.GetData() + k);
+
+		VectorStore(VectorMultiply(BinRe, G), Re + k);
+		VectorStore(VectorMultiply(BinIm, VectorMultiply(G, Conjugate)), Im + k);
+	}
+
+	FFT(Re, Im);
+
+	// real part of conjugated forward transform is the inverse, scaled by FFT_SIZE
+	const VectorRegister4Float Scale = VectorSetFloat1(1.f / FFT_SIZE);
+	for (int32 i = 0; i < FFT_SIZE; i += 4)
+	{
+		const VectorRegister4Float Windowed = VectorMultiply(VectorMultiply(VectorLoad(Re + i), Scale), VectorLoad(Window.GetData() + i));
+		VectorStore(VectorAdd(VectorLoad(Overlap.GetData() + i), Windowed), Overlap.GetData() + i);
+	}
+
+	FMemory::Memcpy(Out, Overlap.GetData(), HOP_SIZE * sizeof(float));
+	FMemory::Memmove(Overlap.GetData(), Overlap.GetData() + HOP_SIZE, HOP_SIZE * sizeof(float));
+	FMemory::Memzero(Overlap.GetData() + HOP_SIZE, HOP_SIZE * sizeof(float));
+}
+
+void FVoskAudioConditioner::ApplyAutoGain(float* Data, int32 Num)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskAudioConditioner::ApplyAutoGain);
+
+	check(Num % 4 == 0);
+
+	VectorRegister4Float SumV = VectorZeroFloat();
+	for (int32 i = 0; i < Num; i += 4)
+	{
+		const VectorRegister4Float V = VectorLoad(Data + i);
+		SumV = VectorMultiplyAdd(V, V, SumV);
+	}
+
+	float Sum[4];
+	VectorStore(SumV, Sum);
+	const float Level = FMath::Sqrt((Sum[0] + Sum[1] + Sum[2] + Sum[3]) / Num);
+
+	// envelope only follows speech, pauses keep the gain where it was
+	if (Level > AGC_SILENCE_LEVEL)
+	{
+		const float HopSeconds = (float)Num / SampleRate;
+		const float Attack = 1.f - FMath::Exp(-HopSeconds / 0.05f);
+		const float Release = 1.f - FMath::Exp(-HopSeconds / 0.5f);
+		LevelEnvelope += (Level > LevelEnvelope ? Attack : Release) * (Level - LevelEnvelope);
+	}
+
+	float TargetGain = Gain;
+	if (LevelEnvelope > 0.f)
+	{
+		const float MaxGain = DbToAmplitude(Settings.MaxGain);
+		TargetGain = FMath::Clamp(DbToAmplitude(Settings.TargetLevel) / LevelEnvelope, 1.f / MaxGain, MaxGain);
+	}
+
+	// ramp across the hop so gain changes don't click
+	const float Step = (TargetGain - Gain) / Num;
+	VectorRegister4Float GainV = MakeVectorRegisterFloat(Gain + Step, Gain + 2.f * Step, Gain + 3.f * Step, Gain + 4.f * Step);
+	const VectorRegister4Float StepV = VectorSetFloat1(4.f * Step);
+
+	for (int32 i = 0; i < Num; i += 4)
+	{
+		VectorStore(VectorMultiply(VectorLoad(Data + i), GainV), Data + i);
+		GainV = VectorAdd(GainV, StepV);
+	}
+
+	Gain = TargetGain;
+}
+
+void FVoskAudioConditioner::FFT(float* Re, float* Im) const
+{
+	for (int32 i = 0; i < FFT_SIZE; i++)
+	{
+		const int32 j = BitReverse[i];
+		if (j > i)
+		{
+			Swap(Re[i], Re[j]);
+			Swap(Im[i], Im[j]);
+		}
+	}
+
+	for (int32 Size = 2; Size <= FFT_SIZE; Size <<= 1)
+	{
+		const int32 Half = Size >> 1;
+		const int32 Stride = FFT_SIZE / Size;
+
+		for (int32 Start = 0; Start < FFT_SIZE; Start += Size)
+		{
+			for (int32 k = 0; k < Half; k++)
+			{
+				const float Wr = TwiddleRe[k * Stride];
+				const float Wi = TwiddleIm[k * Stride];
+
+				const int32 A = Start + k;
+				const int32 B = A + Half;
+
+				const float Tr = Re[B] * Wr - Im[B] * Wi;
+				const float Ti = Re[B] * Wi + Im[B] * Wr;
+
+				Re[B] = Re[A] - Tr;
+				Im[B] = Im[A] - Ti;
+				Re[A] += Tr;
+				Im[A] += Ti;
+			}
+		}
+	}
+}
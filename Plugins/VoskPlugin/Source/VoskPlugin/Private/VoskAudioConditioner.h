@@ -0,0 +1,96 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoskAudioConditioning.h"
+
+
+/**
+* DC blocker -> high-pass -> spectral noise gate -> AGC chain for mono 16 bit audio.
+*
+* Audio is processed in hops of HOP_SIZE samples, output lags input by one hop,
+* by two with the noise gate on (32ms at 16kHz), Flush() hands out what is held back.
+* All buffers are allocated up front, Process() never allocates. Conversion,
+* gating and gain run on 4 wide vectors, the two IIR filters are inherently serial.
+*/
+class FVoskAudioConditioner
+{
+public:
+	static constexpr int32 FFT_SIZE = 512;
+	static constexpr int32 HOP_SIZE = FFT_SIZE / 2;
+
+	FVoskAudioConditioner(int32 InSampleRate, const FVoskAudioConditioningSettings& InSettings);
+
+	void SetSettings(const FVoskAudioConditioningSettings& InSettings);
+	const FVoskAudioConditioningSettings& GetSettings() const { return Settings; }
+
+	/** Conditions samples in place */
+	void Process(int16* Samples, int32 NumSamples);
+
+	/**
+	* Pushes silence through the chain so the samples it still holds back come out.
+	* OutSamples receives GetLatency() samples, nothing when no audio was processed since Reset()
+	*/
+	void Flush(TArray<int16>& OutSamples);
+
+	/** Samples output currently lags input by, depends on whether the noise gate is on */
+	int32 GetLatency() const { return Settings.bNoiseGate ? 2 * HOP_SIZE : HOP_SIZE; }
+
+	void Reset();
+
+	FVoskAudioConditioningStats GetStats() const;
+
+	/**
+	* Vectorized conversions Process() runs on, full scale is 1.0.
+	* ToInt16 saturates and rounds half to even on every path
+	*/
+	static void ToFloat(const int16* In, float* Out, int32 Num);
+	static void ToInt16(const float* In, int16* Out, int32 Num);
+
+private:
+	enum EStage { Convert, DCRemoval, HighPass, NoiseGate, AutoGain, NumStages };
+
+	void ProcessHop();
+
+	void RemoveDC(float* Data, int32 Num);
+	void ApplyHighPass(float* Data, int32 Num);
+	void ApplyNoiseGate(const float* In, float* Out);
+	void ApplyAutoGain(float* Data, int32 Num);
+
+	void FFT(float* Re, float* Im) const;
+
+	const int32 SampleRate;
+	FVoskAudioConditioningSettings Settings;
+
+	/** Hop being filled by Process() and the conditioned one being handed out */
+	TArray<float> HopIn;
+	TArray<float> HopOut;
+	int32 HopFill = 0;
+
+	float DCCoefficient = 0.f;
+	float DCLastIn = 0.f;
+	float DCLastOut = 0.f;
+
+	float HPB0 = 0.f, HPB1 = 0.f, HPB2 = 0.f, HPA1 = 0.f, HPA2 = 0.f;
+	float HPZ1 = 0.f, HPZ2 = 0.f;
+
+	/** Analysis frame (last FFT_SIZE input samples), overlap-add tail, spectrum and per band state */
+	TArray<float> Frame;
+	TArray<float> Overlap;
+	TArray<float> Window;
+	TArray<float> SpectrumRe;
+	TArray<float> SpectrumIm;
+	TArray<float> SmoothedPower;
+	TArray<float> NoiseFloor;
+	TArray<float> BinGain;
+	TArray<float> TwiddleRe;
+	TArray<float> TwiddleIm;
+	TArray<int32> BitReverse;
+	bool bNoiseFloorValid = false;
+
+	float LevelEnvelope = 0.f;
+	float Gain = 1.f;
+
+	uint64 StageCycles[NumStages];
+	int64 SamplesProcessed = 0;
+};
@@ -0,0 +1,253 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskCommandMatcher.h"
+#include "VoskStringDistance.h"
+#include "VoskPinyin.h"
+
+
+static const int32 MAX_CACHED_QUERIES = 256;
+
+static bool CheckKeysAvailable(EVoskMatchMode MatchMode)
+{
+	if (MatchMode == EVoskMatchMode::Text || UVoskCommandMatcher::IsPinyinAvailable())
+		return true;
+
+	UE_LOG(LogTemp, Error, TEXT("Pinyin table is empty, pinyin match mode compares hanzi as written"));
+	return false;
+}
+
+
+UVoskCommandMatcher* UVoskCommandMatcher::CreateCommandMatcher(const TArray<FString>& Phrases, EVoskMatchMode MatchMode)
+{
+	UVoskCommandMatcher* Matcher = NewObject<UVoskCommandMatcher>();
+	Matcher->MatchMode = MatchMode;
+	CheckKeysAvailable(MatchMode);
+	Matcher->Nodes.Reserve(Phrases.Num());
+
+	for (const FString& Phrase : Phrases)
+		Matcher->AddPhrase(Phrase);
+
+	return Matcher;
+}
+
+bool UVoskCommandMatcher::SetMatchMode(EVoskMatchMode NewMatchMode)
+{
+	if (NewMatchMode == MatchMode)
+		return NewMatchMode == EVoskMatchMode::Text || IsPinyinAvailable();
+
+	const bool bKeysAvailable = CheckKeysAvailable(NewMatchMode);
+
+	MatchMode = NewMatchMode;
+	QueryKeyCache.Reset();
+
+	// distances between phrases change with the key, tree has to be rebuilt
+	for (FNode& Node : Nodes)
+		MakeKey(Node.Phrase, Node.Key);
+
+	Rebuild();
+
+	return bKeysAvailable;
+}
+
+bool UVoskCommandMatcher::AddPhrase(const FString& Phrase)
+{
+	const FString Normalized = Normalize(Phrase);
+	if (Normalized.IsEmpty() || PhraseToNode.Contains(Normalized))
+		return false;
+
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	FNode& Node = Nodes[NodeIndex];
+	Node.Phrase = Normalized;
+	MakeKey(Normalized, Node.Key);
+
+	PhraseToNode.Add(Normalized, NodeIndex);
+	Insert(NodeIndex);
+
+	return true;
+}
+
+bool UVoskCommandMatcher::RemovePhrase(const FString& Phrase)
+{
+	int32 NodeIndex;
+	if (!PhraseToNode.RemoveAndCopyValue(Normalize(Phrase), NodeIndex))
+		return false;
+
+	Nodes[NodeIndex].bRemoved = true;
+	NumRemoved++;
+
+	// tombstones still cost a distance computation each, drop them once they dominate
+	if (NumRemoved > PhraseToNode.Num())
+		Rebuild();
+
+	return true;
+}
+
+bool UVoskCommandMatcher::ContainsPhrase(const FString& Phrase) const
+{
+	return PhraseToNode.Contains(Normalize(Phrase));
+}
+
+TArray<FVoskCommandMatch> UVoskCommandMatcher::FindMatches(const FString& Text, int32 MaxResults, float MinScore) const
+{
+	TArray<FVoskCommandMatch> Matches;
+	if (Nodes.Num() == 0 || MaxResults <= 0)
+		return Matches;
+
+	const TArray<UTF32CHAR>& Query = GetQueryKey(Normalize(Text));
+	if (Query.Num() == 0)
+		return Matches;
+
+	MinScore = FMath::Clamp(MinScore, 0.f, 1.f);
+
+	// score = 1 - d / max(Lq, Lp) and Lp <= Lq + d, so d <= (1 - s) * Lq / s
+	const int32 Radius = MinScore > KINDA_SMALL_NUMBER
+		? FMath::FloorToInt((1.f - MinScore) * Query.Num() / MinScore + KINDA_SMALL_NUMBER)
+		: MAX_int32 / 2;
+
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+
+	while (Stack.Num() > 0)
+	{
+		const FNode& Node = Nodes[Stack.Pop(false)];
+		const int32 Distance = VoskStringDistance::Levenshtein(Node.Key.GetData(), Node.Key.Num(), Query.GetData(), Query.Num());
+
+		if (!Node.bRemoved && Distance <= Radius)
+		{
+			const float Score = 1.f - (float)Distance / (float)FMath::Max(Node.Key.Num(), Query.Num());
+			if (Score >= MinScore)
+			{
+				FVoskCommandMatch& Match = Matches.AddDefaulted_GetRef();
+				Match.Phrase = Node.Phrase;
+				Match.Score = Score;
+				Match.Distance = Distance;
+			}
+		}
+
+		// triangle inequality: only subtrees at |edge - d| <= radius can hold matches
+		for (const TPair<int32, int32>& Child : Node.Children)
+		{
+			if (FMath::Abs(Child.Key - Distance) <= Radius)
+				Stack.Add(Child.Value);
+		}
+	}
+
+	Matches.Sort([](const FVoskCommandMatch& A, const FVoskCommandMatch& B) {
+		return A.Score != B.Score ? A.Score > B.Score : A.Distance < B.Distance;
+	});
+
+	if (Matches.Num() > MaxResults)
+		Matches.SetNum(MaxResults);
+
+	return Matches;
+}
+
+bool UVoskCommandMatcher::FindBestMatch(const FString& Text, FVoskCommandMatch& Match, float MinScore) const
+{
+	TArray<FVoskCommandMatch> Matches = FindMatches(Text, 1, MinScore);
+	if (Matches.Num() == 0)
+		return false;
+
+	Match = MoveTemp(Matches[0]);
+	return true;
+}
+
+FString UVoskCommandMatcher::Normalize(const FString& Phrase)
+{
+	return Phrase.TrimStartAndEnd().ToLower();
+}
+
+FString UVoskCommandMatcher::ConvertToPinyin(const FString& Text, bool bWithTones)
+{
+	return FVoskPinyinTable::Get().ToPinyin(Text, bWithTones);
+}
+
+bool UVoskCommandMatcher::IsPinyinAvailable()
+{
+	return !FVoskPinyinTable::Get().IsEmpty();
+}
+
+void UVoskCommandMatcher::MakeKey(const FString& Normalized, TArray<UTF32CHAR>& OutKey) const
+{
+	if (MatchMode != EVoskMatchMode::Text)
+	{
+		FVoskPinyinTable::Get().MakeKey(Normalized, MatchMode == EVoskMatchMode::Pinyin, OutKey);
+		return;
+	}
+
+	VoskStringDistance::FCodepoints Codepoints;
+	VoskStringDistance::ToCodepoints(Normalized, Codepoints);
+
+	OutKey.Reset(Codepoints.Num());
+	OutKey.Append(Codepoints);
+}
+
+const TArray<UTF32CHAR>& UVoskCommandMatcher::GetQueryKey(const FString& Normalized) const
+{
+	// plain codepoints are cheaper to rebuild than to look up
+	if (MatchMode == EVoskMatchMode::Text)
+	{
+		MakeKey(Normalized, QueryKey);
+		return QueryKey;
+	}
+
+	if (const TArray<UTF32CHAR>* Cached = QueryKeyCache.Find(Normalized))
+		return *Cached;
+
+	if (QueryKeyCache.Num() >= MAX_CACHED_QUERIES)
+		QueryKeyCache.Reset();
+
+	TArray<UTF32CHAR>& Key = QueryKeyCache.Add(Normalized);
+	MakeKey(Normalized, Key);
+	return Key;
+}
+
+void UVoskCommandMatcher::Insert(int32 NodeIndex)
+{
+	// first node is the root
+	if (NodeIndex == 0)
+		return;
+
+	const TArray<UTF32CHAR>& Key = Nodes[NodeIndex].Key;
+
+	int32 Current = 0;
+	for (;;)
+	{
+		FNode& Node = Nodes[Current];
+		const int32 Distance = VoskStringDistance::Levenshtein(Node.Key.GetData(), Node.Key.Num(), Key.GetData(), Key.Num());
+
+		const TPair<int32, int32>* Child = Node.Children.FindByPredicate([Distance](const TPair<int32, int32>& Edge) {
+			return Edge.Key == Distance;
+		});
+
+		if (Child == nullptr)
+		{
+			Node.Children.Emplace(Distance, NodeIndex);
+			return;
+		}
+
+		Current = Child->Value;
+	}
+}
+
+void UVoskCommandMatcher::Rebuild()
+{
+	TArray<FNode> OldNodes = MoveTemp(Nodes);
+	Nodes.Reset(PhraseToNode.Num());
+	PhraseToNode.Reset();
+	NumRemoved = 0;
+
+	for (FNode& Old : OldNodes)
+	{
+		if (Old.bRemoved)
+			continue;
+
+		const int32 NodeIndex = Nodes.AddDefaulted();
+		FNode& Node = Nodes[NodeIndex];
+		Node.Phrase = MoveTemp(Old.Phrase);
+		Node.Key = MoveTemp(Old.Key);
+
+		PhraseToNode.Add(Node.Phrase, NodeIndex);
+		Insert(NodeIndex);
+	}
+}
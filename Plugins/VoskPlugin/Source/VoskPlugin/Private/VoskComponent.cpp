@@ -1,34 +1,15 @@
 // Copyright Ilgar Lunin. All Rights Reserved.
 
 #include "VoskComponent.h"
-#include "Voice.h"
 #include "VoskSoundUtils.h"
-#include "Serialization/JsonSerializer.h"
+#include "VoskServerConnection.h"
+#include "VoskVoiceCapture.h"
+#include "VoskStringDistance.h"
+#include "VoskWavWriter.h"
+#include "VoskSoundPipeline.h"
+#include "Async/Async.h"
 #include "HAL/FileManager.h"
 
-#include <string>
-#include <vector>
-#include <algorithm>
-
-const char* FINAL_RESULT_REQUEST_MESSAGE = "__final_result_request__";
-const char* RESET_RECOGNIZER_MESSAGE = "__reset_recognizer__";
-
-
-static uint32 ComputeLevenshteinDistance(const std::string& s1, const std::string& s2)
-{
-    const std::size_t len1 = s1.size(), len2 = s2.size();
-    std::vector<std::vector<uint32>> d(len1 + 1, std::vector<uint32>(len2 + 1));
-
-    d[0][0] = 0;
-    for (uint32 i = 1; i <= len1; ++i) d[i][0] = i;
-    for (uint32 i = 1; i <= len2; ++i) d[0][i] = i;
-
-    for (uint32 i = 1; i <= len1; ++i)
-        for (uint32 j = 1; j <= len2; ++j)
-            d[i][j] = std::min({ d[i - 1][j] + 1, d[i][j - 1] + 1, d[i - 1][j - 1] + (s1[i - 1] == s2[j - 1] ? 0 : 1) });
-    return d[len1][len2];
-}
-
 
 // Sets default values for this component's properties
 UVoskComponent::UVoskComponent()
@@ -41,31 +22,14 @@ bool UVoskComponent::BeginCapture()
 {
     if (bIsCaptureActive) return false;
 
-    if (!FVoiceModule::Get().DoesPlatformSupportVoiceCapture())
-    {
-        UE_LOG(LogTemp, Log, TEXT("%s"), TEXT("VoiceCapture is not supported on this platform!"));
-    }
+    if (!_capture.IsValid())
+        _capture = MakeShared<FVoskVoiceCapture>(_sample_rate);
 
-    if (!_voice_capture.IsValid())
-    {
-        _voice_capture = FVoiceModule::Get().CreateVoiceCapture("");
-        if (_voice_capture.IsValid())
-        {
-            FString DeviceName;
-            if (!_voice_capture->Init(DeviceName, _sample_rate, 1))
-                return false;
-            UE_LOG(LogTemp, Log, TEXT("IVoiceCapture initialized"));
-        }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("Failed to obtain IVoiceCapture, no voice available!"));
-            return false;
-        }
-    }
+    _capture->bKeepRecordedSamples = bKeepCaptureInMemory;
+    _capture->SetConditioning(bConditionAudio, ConditioningSettings);
+    if (!_capture->Start())
+        return false;
 
-    UE_LOG(LogTemp, Log, TEXT("Capture started"));
-    _recorded_samples.Empty();
-    _voice_capture->Start();
     bIsCaptureActive = true;
 
     return true;
@@ -76,50 +40,33 @@ void UVoskComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    if (_voice_capture.IsValid() && bIsCaptureActive)
+    if (_capture.IsValid() && bIsCaptureActive)
     {
-        uint32 VoiceCaptureBytesAvailable = 0;
-        EVoiceCaptureState::Type CaptureState = _voice_capture->GetCaptureState(VoiceCaptureBytesAvailable);
-
-        if (CaptureState == EVoiceCaptureState::Ok && VoiceCaptureBytesAvailable > 0)
+        const int32 VoiceCaptureReadBytes = _capture->Poll(_recorded_chunk);
+        if (VoiceCaptureReadBytes > 0 && _wav_writer.IsValid())
         {
-            uint32 VoiceCaptureReadBytes = 0;
+            _wav_writer->Append(_recorded_chunk.GetData(), VoiceCaptureReadBytes);
+        }
 
-            TArray<uint8> _recorded_chunk;
-            uint32 record_start = _recorded_chunk.AddUninitialized(VoiceCaptureBytesAvailable);
-            
-            EVoiceCaptureState::Type microphone_state = _voice_capture->GetVoiceData(_recorded_chunk.GetData(), VoiceCaptureBytesAvailable, VoiceCaptureReadBytes);
-            if (microphone_state == EVoiceCaptureState::Ok)
-            {
-                if (VoiceCaptureReadBytes > 0)
-                {
-                    _recorded_samples += _recorded_chunk;
-                    if (IsInitialized() && bSendVoiceDataWhenRecording)
-                        Socket->Send(_recorded_chunk.GetData(), VoiceCaptureReadBytes, true);
-                }
-            }
+        if (VoiceCaptureReadBytes > 0 && IsInitialized() && bSendVoiceDataWhenRecording)
+        {
+            _connection->SendAudio(_recorded_chunk.GetData(), VoiceCaptureReadBytes, _capture->GetLastCaptureTime());
         }
     }
 }
 
-void UVoskComponent::DecodeRresult(const FString& raw)
+void UVoskComponent::DecodeRresult(const FVoskRecognitionResult& result)
 {
-    TSharedPtr<FJsonObject> result;
-    TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(raw);
-
-    if (FJsonSerializer::Deserialize(reader, result))
+    if (result.Type == EVoskResultType::Partial)
     {
-        FString _res;
-        if (result->TryGetStringField(TEXT("partial"), _res))
-        {
-            _res_partial = _res;
-            OnPartialResultReceived.Broadcast(_res_partial);
-        }
-        else if (result->TryGetStringField(TEXT("text"), _res))
-        {
-            _res_final = _res;
-            OnFinalResultReceived.Broadcast(_res_final);
-        }
+        _res_partial = result.Text;
+        OnPartialResultReceived.Broadcast(_res_partial);
+    }
+    else if (result.Type == EVoskResultType::Final)
+    {
+        _res_final = result.Text;
+        _res_final_words = result.Words;
+        OnFinalResultReceived.Broadcast(_res_final);
     }
 }
 
@@ -127,11 +74,47 @@ void UVoskComponent::FinishCapture(TArray<uint8> &CaptureData, int32 &SamplesRec
 {
     bIsCaptureActive = false;
 
-    SamplesRecorded = _recorded_samples.Num();
-    CaptureData = _recorded_samples;
+    if (!_capture.IsValid())
+    {
+        SamplesRecorded = 0;
+        CaptureData.Empty();
+        return;
+    }
+
+    _capture->Stop();
+
+    // audio the conditioner held back until now
+    const int32 TailBytes = _capture->Poll(_recorded_chunk);
+    if (TailBytes > 0 && _wav_writer.IsValid())
+        _wav_writer->Append(_recorded_chunk.GetData(), TailBytes);
+
+    if (TailBytes > 0 && IsInitialized() && bSendVoiceDataWhenRecording)
+        _connection->SendAudio(_recorded_chunk.GetData(), TailBytes, _capture->GetLastCaptureTime());
 
-    if (_voice_capture.IsValid())
-        _voice_capture->Stop();
+    SamplesRecorded = _capture->GetRecordedSamples().Num();
+    CaptureData = _capture->GetRecordedSamples();
+}
+
+bool UVoskComponent::StartRecordingToFile(const FString& Path)
+{
+    StopRecordingToFile();
+
+    TSharedPtr<FVoskWavWriter> writer = MakeShared<FVoskWavWriter>();
+    if (!writer->Open(Path, _sample_rate, 1))
+        return false;
+
+    _wav_writer = writer;
+    return true;
+}
+
+bool UVoskComponent::StopRecordingToFile()
+{
+    if (!_wav_writer.IsValid())
+        return false;
+
+    const bool result = _wav_writer->Close();
+    _wav_writer.Reset();
+    return result;
 }
 
 bool UVoskComponent::SendVoiceDataToLanguageServer(const TArray<uint8>& VoiceChunk, int32 PacketSize)
@@ -154,7 +137,7 @@ bool UVoskComponent::SendVoiceDataToLanguageServer(const TArray<uint8>& VoiceChu
     size_t BytesSent = 0;
     for (int i = 0; i < NumPackets; i++)
     {
-        Socket->Send(VoiceChunk.GetData() + (i * PacketSize), PacketSize, true);
+        _connection->SendAudio(VoiceChunk.GetData() + (i * PacketSize), PacketSize);
         BytesSent += PacketSize;
     }
 
@@ -162,88 +145,126 @@ bool UVoskComponent::SendVoiceDataToLanguageServer(const TArray<uint8>& VoiceChu
     {
         // send remainder
         const size_t remainder = VoiceChunk.Num() - BytesSent;
-        Socket->Send(VoiceChunk.GetData() + BytesSent, remainder, true);
+        _connection->SendAudio(VoiceChunk.GetData() + BytesSent, remainder);
         BytesSent += remainder;
     }
 
     return VoiceChunk.Num() == BytesSent;
 }
 
-void UVoskComponent::ResetRecognizer()
+bool UVoskComponent::SendSoundToLanguageServer(USoundWave* Sound)
 {
-    Socket->Send(RESET_RECOGNIZER_MESSAGE);
+    if (!IsInitialized())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Socket is not initialized!"));
+        return false;
+    }
+
+    if (_pipeline.IsValid() && _pipeline->IsRunning())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Sound is already being sent"));
+        return false;
+    }
+
+    _pipeline = MakeShared<FVoskSoundPipeline, ESPMode::ThreadSafe>(_sample_rate);
+
+    TWeakObjectPtr<UVoskComponent> Self = this;
+    TWeakPtr<FVoskSoundPipeline, ESPMode::ThreadSafe> Pipeline = _pipeline;
+
+    // socket and latency tracer live on game thread, chunks are handed over as they come
+    const bool Started = _pipeline->Start(Sound,
+        [Self, Pipeline](const uint8* Data, int32 Size) {
+            TArray<uint8> Chunk(Data, Size);
+            TFuture<void> Sent = Async(EAsyncExecution::TaskGraphMainThread, [Self, Chunk = MoveTemp(Chunk)]() {
+                if (Self.IsValid() && Self->IsInitialized())
+                    Self->_connection->SendAudio(Chunk.GetData(), Chunk.Num());
+            });
+
+            // chunk slot is recycled only once the chunk is on the socket, that is what bounds the queue.
+            // Cancel blocks the game thread, so stop waiting then
+            while (!Sent.WaitFor(FTimespan::FromMilliseconds(10)))
+            {
+                TSharedPtr<FVoskSoundPipeline, ESPMode::ThreadSafe> Running = Pipeline.Pin();
+                if (!Running.IsValid() || Running->IsCancelled())
+                    return;
+            }
+        },
+        [Self](bool Success) {
+            AsyncTask(ENamedThreads::GameThread, [Self, Success]() {
+                if (!Self.IsValid())
+                    return;
+
+                Self->_pipeline_sound = nullptr;
+                if (Success)
+                    Self->RequestFinalResult();
+            });
+        });
+
+    if (Started)
+        _pipeline_sound = Sound;
+
+    return Started;
 }
 
-void UVoskComponent::Initialize(FString Addr, int32 Port)
+void UVoskComponent::CancelSendSound()
 {
-    if (Addr.ToLower().Equals(TEXT("localhost")))
-        Addr = TEXT("127.0.0.1");
-
-    const FString Protocol("ws");
-    const FString ServerURL = FString::Printf(TEXT("%s://%s:%d/"), *Protocol, *Addr, Port);  // Server URL. You can use ws, wss or wss+insecure.
-    Socket = FWebSocketsModule::Get().CreateWebSocket(ServerURL, Protocol);
+    if (_pipeline.IsValid())
+        _pipeline->Cancel();
+}
 
-    Socket->OnConnected().AddLambda([this]() {
-        OnConnectedToServer.Broadcast();
-    });
+void UVoskComponent::ResetRecognizer()
+{
+    if (_connection.IsValid())
+        _connection->ResetRecognizer();
+}
 
-    Socket->OnConnectionError().AddLambda([&](const FString &error) {
-        OnConnectionError.Broadcast(error);
-    });
+void UVoskComponent::Initialize(FString Addr, int32 Port)
+{
+    if (!_connection.IsValid())
+    {
+        _connection = MakeShared<FVoskServerConnection>();
 
-    Socket->OnClosed().AddLambda([this](int32 StatusCode, const FString& Reason, bool bWasClean) -> void {
-        // This code will run when the connection to the server has been terminated.
-        // Because of an error or a call to Socket->Close().
-        OnConnectionTerminated.Broadcast(StatusCode, Reason, bWasClean);
-    });
+        _connection->OnConnected.AddLambda([this]() {
+            OnConnectedToServer.Broadcast();
+        });
 
-    Socket->OnMessage().AddLambda([this](const FString& Message) -> void {
-        // try to decode partial result
-        DecodeRresult(Message);
-    });
+        _connection->OnConnectionError.AddLambda([this](const FString& error) {
+            OnConnectionError.Broadcast(error);
+        });
 
-    Socket->OnRawMessage().AddLambda([](const void* Data, SIZE_T Size, SIZE_T BytesRemaining) -> void {
-        // This code will run when we receive a raw (binary) message from the server.
-        // UE_LOG(LogTemp, Warning, TEXT("Binary data received: %d - %d"), Size, BytesRemaining);
+        _connection->OnClosed.AddLambda([this](int32 StatusCode, const FString& Reason, bool bWasClean) {
+            OnConnectionTerminated.Broadcast(StatusCode, Reason, bWasClean);
+        });
 
-    });
+        _connection->OnResult.AddUObject(this, &UVoskComponent::DecodeRresult);
+    }
 
-    Socket->OnMessageSent().AddLambda([](const FString& MessageString) -> void {
-        // This code is called after we sent a message to the server.
-    });
+    _connection->bPreferBinaryResults = bPreferBinaryResults;
 
-    // And we finally connect to the server. 
-    Socket->Connect();
+    // And we finally connect to the server.
+    _connection->Connect(Addr, Port);
 }
 
 bool UVoskComponent::IsInitialized()
 {
-    if (!Socket.IsValid())
-    {
-        return false;
-    }
-
-    return Socket->IsConnected();
+    return _connection.IsValid() && _connection->IsConnected();
 }
 
 void UVoskComponent::Uninitialize()
 {
-    if (_voice_capture.IsValid() && bIsCaptureActive)
+    if (_capture.IsValid() && bIsCaptureActive)
     {
-        _voice_capture->Stop();
+        _capture->Stop();
         bIsCaptureActive = false;
     }
 
-    if (IsInitialized())
+    StopRecordingToFile();
+    CancelSendSound();
+
+    if (_connection.IsValid())
     {
-        // disconnect delegates
-        Socket->OnConnected().Clear();
-        Socket->OnConnectionError().Clear();
-        Socket->OnClosed().Clear();
-        Socket->OnMessage().Clear();
-        Socket->OnRawMessage().Clear();
-        Socket->OnMessageSent().Clear();
-        Socket->Close(0, TEXT("End Play"));
+        _connection->LogLatencyReport();
+        _connection->Close();
     }
 }
 
@@ -260,6 +281,7 @@ void UVoskComponent::ResetPartialResult()
 void UVoskComponent::ResetFinalResult()
 {
     _res_final = "";
+    _res_final_words.Reset();
 }
 
 void UVoskComponent::RequestFinalResult()
@@ -267,7 +289,7 @@ void UVoskComponent::RequestFinalResult()
     if (IsInitialized())
     {
         // tell server to send final result
-        Socket->Send(FINAL_RESULT_REQUEST_MESSAGE);
+        _connection->RequestFinalResult();
     }
 }
 
@@ -276,6 +298,21 @@ FString UVoskComponent::GetFinalResult()
     return _res_final;
 }
 
+const TArray<FVoskWordTiming>& UVoskComponent::GetFinalResultWords() const
+{
+    return _res_final_words;
+}
+
+FVoskAudioConditioningStats UVoskComponent::GetConditioningStats() const
+{
+    return _capture.IsValid() ? _capture->GetConditioningStats() : FVoskAudioConditioningStats();
+}
+
+FVoskLatencyReport UVoskComponent::GetLatencyReport() const
+{
+    return _connection.IsValid() ? _connection->GetLatencyReport() : FVoskLatencyReport();
+}
+
 USoundWave* UVoskComponent::SamplesToSound(
     const TArray<uint8>& samples,
     int32 SampleRate,
@@ -326,14 +363,7 @@ void UVoskComponent::CreateProcess(FProcessHandleWrapper& ProcessHandle,
 }
 
 float UVoskComponent::CompareStrings(const FString& left, const FString& right) {
-    if ((left.Len() == 0) || (right.Len() == 0)) return 0.0;
-    if (left == right) return 1.0;
-
-    std::string s1 = TCHAR_TO_UTF8(*left);
-    std::string s2 = TCHAR_TO_UTF8(*right);
-
-    int stepsToSame = ComputeLevenshteinDistance(s1, s2);
-    return (1.0 - ((double)stepsToSame / (double)FMath::Max(left.Len(), right.Len())));
+    return VoskStringDistance::Similarity(left, right);
 }
 
 void UVoskComponent::KillProcess(const FProcessHandleWrapper& processHandle)
@@ -0,0 +1,204 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskDownmix.h"
+#include "Audio.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define VOSK_DOWNMIX_NEON 1
+	#define VOSK_DOWNMIX_SSE 0
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+	#define VOSK_DOWNMIX_NEON 0
+	#define VOSK_DOWNMIX_SSE 1
+#else
+	#define VOSK_DOWNMIX_NEON 0
+	#define VOSK_DOWNMIX_SSE 0
+#endif
+
+
+namespace
+{
+	FORCEINLINE bool HasWeights(TArrayView<const float> Weights, int32 NumChannels)
+	{
+		return Weights.Num() == NumChannels;
+	}
+
+	/** Rounds toward negative infinity like the arithmetic shift of the stereo path */
+	FORCEINLINE int32 FloorDivide(int32 Sum, int32 NumChannels)
+	{
+		const int32 Quotient = Sum / NumChannels;
+		return Quotient * NumChannels > Sum ? Quotient - 1 : Quotient;
+	}
+
+	void StereoAverage(const int16* In, int16* Out, int32 NumFrames)
+	{
+		int32 i = 0;
+
+#if VOSK_DOWNMIX_SSE
+		const __m128i Ones = _mm_set1_epi16(1);
+		for (; i + 8 <= NumFrames; i += 8)
+		{
+			// madd sums each L/R pair into 32 bits, no overflow
+			const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + i * 2));
+			const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + i * 2 + 8));
+			const __m128i SumA = _mm_srai_epi32(_mm_madd_epi16(A, Ones), 1);
+			const __m128i SumB = _mm_srai_epi32(_mm_madd_epi16(B, Ones), 1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(SumA, SumB));
+		}
+#elif VOSK_DOWNMIX_NEON
+		for (; i + 8 <= NumFrames; i += 8)
+		{
+			const int32x4_t SumA = vpaddlq_s16(vld1q_s16(In + i * 2));
+			const int32x4_t SumB = vpaddlq_s16(vld1q_s16(In + i * 2 + 8));
+			vst1q_s16(Out + i, vcombine_s16(vshrn_n_s32(SumA, 1), vshrn_n_s32(SumB, 1)));
+		}
+#endif
+
+		for (; i < NumFrames; i++)
+			Out[i] = (int16)(((int32)In[i * 2] + (int32)In[i * 2 + 1]) >> 1);
+	}
+
+	void StereoWeighted(const float* In, float* Out, int32 NumFrames, float Left, float Right)
+	{
+		int32 i = 0;
+
+		const VectorRegister4Float LeftGain = VectorSetFloat1(Left);
+		const VectorRegister4Float RightGain = VectorSetFloat1(Right);
+
+		for (; i + 4 <= NumFrames; i += 4)
+		{
+			// L0 R0 L1 R1 | L2 R2 L3 R3 -> L0 L1 L2 L3, R0 R1 R2 R3
+			const VectorRegister4Float A = VectorLoad(In + i * 2);
+			const VectorRegister4Float B = VectorLoad(In + i * 2 + 4);
+			const VectorRegister4Float L = VectorShuffle(A, B, 0, 2, 0, 2);
+			const VectorRegister4Float R = VectorShuffle(A, B, 1, 3, 1, 3);
+			VectorStore(VectorMultiplyAdd(L, LeftGain, VectorMultiply(R, RightGain)), Out + i);
+		}
+
+		for (; i < NumFrames; i++)
+			Out[i] = In[i * 2] * Left + In[i * 2 + 1] * Right;
+	}
+}
+
+
+void VoskDownmix::Downmix(const int16* In, int16* Out, int32 NumFrames, int32 NumChannels, TArrayView<const float> Weights)
+{
+	if (NumFrames <= 0 || NumChannels <= 0)
+		return;
+
+	if (!HasWeights(Weights, NumChannels))
+	{
+		if (NumChannels == 1)
+		{
+			if (Out != In)
+				FMemory::Memmove(Out, In, NumFrames * sizeof(int16));
+			return;
+		}
+
+		if (NumChannels == 2)
+		{
+			StereoAverage(In, Out, NumFrames);
+			return;
+		}
+
+		for (int32 i = 0; i < NumFrames; i++)
+		{
+			const int16* Frame = In + i * NumChannels;
+			int32 Sum = 0;
+			for (int32 c = 0; c < NumChannels; c++)
+				Sum += Frame[c];
+			Out[i] = (int16)FloorDivide(Sum, NumChannels);
+		}
+		return;
+	}
+
+	for (int32 i = 0; i < NumFrames; i++)
+	{
+		const int16* Frame = In + i * NumChannels;
+		float Sum = 0.f;
+		for (int32 c = 0; c < NumChannels; c++)
+			Sum += Frame[c] * Weights[c];
+		Out[i] = (int16)FMath::Clamp(FMath::RoundToInt(Sum), -32768, 32767);
+	}
+}
+
+void VoskDownmix::Downmix(const float* In, float* Out, int32 NumFrames, int32 NumChannels, TArrayView<const float> Weights)
+{
+	if (NumFrames <= 0 || NumChannels <= 0)
+		return;
+
+	const bool bWeighted = HasWeights(Weights, NumChannels);
+
+	if (NumChannels == 1)
+	{
+		const float Gain = bWeighted ? Weights[0] : 1.f;
+		for (int32 i = 0; i < NumFrames; i++)
+			Out[i] = In[i] * Gain;
+		return;
+	}
+
+	if (NumChannels == 2)
+	{
+		StereoWeighted(In, Out, NumFrames, bWeighted ? Weights[0] : 0.5f, bWeighted ? Weights[1] : 0.5f);
+		return;
+	}
+
+	const float Average = 1.f / NumChannels;
+	for (int32 i = 0; i < NumFrames; i++)
+	{
+		const float* Frame = In + i * NumChannels;
+		float Sum = 0.f;
+		for (int32 c = 0; c < NumChannels; c++)
+			Sum += Frame[c] * (bWeighted ? Weights[c] : Average);
+		Out[i] = Sum;
+	}
+}
+
+void VoskDownmix::DownmixInPlace(TArray<uint8>& Samples, int32 NumChannels, TArrayView<const float> Weights)
+{
+	if (NumChannels <= 1 && !HasWeights(Weights, NumChannels))
+		return;
+
+	const int32 NumFrames = Samples.Num() / (NumChannels * (int32)sizeof(int16));
+	int16* Data = reinterpret_cast<int16*>(Samples.GetData());
+
+	Downmix(Data, Data, NumFrames, NumChannels, Weights);
+	Samples.SetNum(NumFrames * sizeof(int16), false);
+}
+
+bool VoskDownmix::DownmixWave(const uint8* Wave, int32 Size, TArray<uint8>& OutWave, TArrayView<const float> Weights)
+{
+	FWaveModInfo WaveInfo;
+	if (!WaveInfo.ReadWaveInfo(Wave, Size) || *WaveInfo.pBitsPerSample != 16)
+		return false;
+
+	const int32 NumChannels = *WaveInfo.pChannels;
+	if (NumChannels == 0)
+		return false;
+
+	const int32 HeaderSize = UE_PTRDIFF_TO_INT32(WaveInfo.SampleDataStart - Wave);
+	const int32 NumFrames = WaveInfo.SampleDataSize / (NumChannels * (int32)sizeof(int16));
+	const int32 MonoDataSize = NumFrames * sizeof(int16);
+
+	OutWave.SetNumUninitialized(HeaderSize + MonoDataSize);
+	FMemory::Memcpy(OutWave.GetData(), Wave, HeaderSize);
+
+	// header fields live at the same offsets in the copy
+	auto Patch = [&OutWave, Wave](const void* Field, auto Value) {
+		const int32 Offset = UE_PTRDIFF_TO_INT32(static_cast<const uint8*>(Field) - Wave);
+		FMemory::Memcpy(OutWave.GetData() + Offset, &Value, sizeof(Value));
+	};
+
+	const uint32 SampleRate = *WaveInfo.pSamplesPerSec;
+	Patch(WaveInfo.pChannels, (uint16)1);
+	Patch(WaveInfo.pAvgBytesPerSec, (uint32)(SampleRate * sizeof(int16)));
+	Patch(WaveInfo.pBlockAlign, (uint16)sizeof(int16));
+	Patch(WaveInfo.pWaveDataSize, (uint32)MonoDataSize);
+	Patch(WaveInfo.pMasterSize, (uint32)(*WaveInfo.pMasterSize - (WaveInfo.SampleDataSize - MonoDataSize)));
+
+	Downmix(reinterpret_cast<const int16*>(WaveInfo.SampleDataStart), reinterpret_cast<int16*>(OutWave.GetData() + HeaderSize), NumFrames, NumChannels, Weights);
+
+	return true;
+}
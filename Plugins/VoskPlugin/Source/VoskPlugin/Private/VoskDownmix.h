@@ -0,0 +1,30 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+* Interleaved multi-channel to mono conversion.
+*
+* Out may point to In, output never overtakes input so conversion can run in place.
+* Weights are per channel gains, when not given (or of wrong size) channels are averaged.
+* Averages of 16 bit samples are rounded down, whatever the channel count.
+* Stereo, the common case, runs 8 frames per SIMD iteration.
+*/
+namespace VoskDownmix
+{
+	void Downmix(const int16* In, int16* Out, int32 NumFrames, int32 NumChannels, TArrayView<const float> Weights = TArrayView<const float>());
+
+	void Downmix(const float* In, float* Out, int32 NumFrames, int32 NumChannels, TArrayView<const float> Weights = TArrayView<const float>());
+
+	/** 16 bit pcm bytes without header, converted in place and shrunk */
+	void DownmixInPlace(TArray<uint8>& Samples, int32 NumChannels, TArrayView<const float> Weights = TArrayView<const float>());
+
+	/**
+	* 16 bit wave file to mono wave file. Header is copied once with channel count,
+	* byte rate, block align and sizes patched, samples are written into presized output.
+	* False when the wave isn't 16 bit or has no channels.
+	*/
+	bool DownmixWave(const uint8* Wave, int32 Size, TArray<uint8>& OutWave, TArrayView<const float> Weights = TArrayView<const float>());
+}
@@ -0,0 +1,401 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskHybridRecognizer.h"
+#include "VoskLocalRecognizer.h"
+#include "VoskReplayBuffer.h"
+#include "VoskServerConnection.h"
+#include "VoskVoiceCapture.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+
+
+UVoskHybridRecognizer::UVoskHybridRecognizer()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+
+    ReplayBuffer = MakeShared<FVoskReplayBuffer>();
+}
+
+void UVoskHybridRecognizer::Initialize()
+{
+    if (!Server.IsValid())
+    {
+        Server = MakeShared<FVoskServerConnection>();
+        Server->OnResult.AddUObject(this, &UVoskHybridRecognizer::OnServerResult);
+
+        Server->OnConnected.AddLambda([this]() {
+            UE_LOG(LogTemp, Log, TEXT("Connected to language server"));
+            PendingSendTime = 0.0;
+
+            // fresh server session, catch it up with the utterance in progress
+            TArray<uint8> Replay;
+            ReplayBuffer->CopyTo(Replay);
+            if (Replay.Num() > 0)
+                Server->SendAudio(Replay.GetData(), Replay.Num());
+
+            UpdateActiveBackend();
+        });
+
+        auto OnServerLost = [this]() {
+            // server has to prove itself again before taking over from the local model
+            PendingSendTime = 0.0;
+            FastReplies = 0;
+            bServerTooSlow = true;
+            UpdateActiveBackend();
+        };
+
+        Server->OnConnectionError.AddLambda([OnServerLost](const FString& Error) {
+            UE_LOG(LogTemp, Warning, TEXT("Language server connection error: %s"), *Error);
+            OnServerLost();
+        });
+
+        Server->OnClosed.AddLambda([OnServerLost](int32 StatusCode, const FString& Reason, bool bWasClean) {
+            OnServerLost();
+        });
+    }
+
+    if (!Local.IsValid())
+    {
+        Local = MakeShared<FVoskLocalRecognizer>();
+        Local->OnResult.AddUObject(this, &UVoskHybridRecognizer::OnLocalResult);
+    }
+
+    bWantServer = true;
+    bServerTooSlow = false;
+    ReconnectTimer = 0.f;
+    Server->bPreferBinaryResults = bPreferBinaryResults;
+    Server->Connect(ServerAddress, ServerPort);
+
+    if (PathToModel.IsEmpty() || Local->IsLoaded() || bLocalLoading)
+        return;
+
+    if (!FPaths::DirectoryExists(PathToModel))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Fallback model not found at %s, running server only"), *PathToModel);
+        return;
+    }
+
+    LoadLocalModel();
+}
+
+void UVoskHybridRecognizer::LoadLocalModel()
+{
+    bLocalLoading = true;
+
+    TSharedPtr<FVoskLocalRecognizer> Recognizer = Local;
+    TWeakObjectPtr<UVoskHybridRecognizer> Self = this;
+    const FString ModelPath = PathToModel;
+    const float ModelSampleRate = SampleRate;
+    const uint32 Generation = InitGeneration;
+
+    AsyncThread(
+        [Recognizer, ModelPath, ModelSampleRate]() {
+            Recognizer->Load(ModelPath, ModelSampleRate);
+        },
+        0, TPri_Normal,
+        [Self, Generation]() {
+            // completion runs on the loader thread, backend state is only touched on game thread
+            AsyncTask(ENamedThreads::GameThread, [Self, Generation]() {
+                if (!Self.IsValid())
+                    return;
+
+                Self->OnLocalModelLoaded(Generation);
+            });
+        }
+    );
+}
+
+void UVoskHybridRecognizer::OnLocalModelLoaded(uint32 Generation)
+{
+    bLocalLoading = false;
+
+    if (Generation != InitGeneration)
+    {
+        // uninitialized while loading, the model belongs to a session that is gone
+        Local->Unload();
+
+        // re-initialized in the meantime, that call skipped the load because this one was running
+        if (bWantServer && !PathToModel.IsEmpty() && FPaths::DirectoryExists(PathToModel))
+            LoadLocalModel();
+
+        return;
+    }
+
+    UpdateActiveBackend();
+}
+
+void UVoskHybridRecognizer::Uninitialize()
+{
+    if (Capture.IsValid() && bIsCaptureActive)
+    {
+        Capture->Stop();
+        bIsCaptureActive = false;
+    }
+
+    bWantServer = false;
+    ++InitGeneration;
+
+    if (Server.IsValid())
+    {
+        Server->LogLatencyReport();
+        Server->Close();
+    }
+
+    // model still loading in background is unloaded when it completes
+    if (Local.IsValid() && !bLocalLoading)
+        Local->Unload();
+
+    ReplayBuffer->SetCapacity(0);
+    PendingSendTime = 0.0;
+    SetActiveBackend(EVoskRecognitionBackend::None);
+}
+
+bool UVoskHybridRecognizer::IsServerAvailable() const
+{
+    return Server.IsValid() && Server->IsConnected();
+}
+
+bool UVoskHybridRecognizer::IsLocalAvailable() const
+{
+    return Local.IsValid() && !bLocalLoading && Local->IsLoaded();
+}
+
+FVoskLatencyReport UVoskHybridRecognizer::GetServerLatencyReport() const
+{
+    return Server.IsValid() ? Server->GetLatencyReport() : FVoskLatencyReport();
+}
+
+bool UVoskHybridRecognizer::BeginCapture()
+{
+    if (bIsCaptureActive) return false;
+
+    if (!Capture.IsValid())
+        Capture = MakeShared<FVoskVoiceCapture>(SampleRate);
+
+    Capture->SetConditioning(bConditionAudio, ConditioningSettings);
+    if (!Capture->Start())
+        return false;
+
+    bIsCaptureActive = true;
+
+    return true;
+}
+
+void UVoskHybridRecognizer::FinishCapture(TArray<uint8>& CaptureData, int32& SamplesRecorded)
+{
+    bIsCaptureActive = false;
+
+    if (!Capture.IsValid())
+    {
+        SamplesRecorded = 0;
+        CaptureData.Empty();
+        return;
+    }
+
+    Capture->Stop();
+
+    // audio the conditioner held back until now
+    const int32 TailBytes = Capture->Poll(CaptureChunk);
+    if (TailBytes > 0 && bSendVoiceDataWhenRecording)
+        RouteAudio(CaptureChunk.GetData(), TailBytes, Capture->GetLastCaptureTime());
+
+    SamplesRecorded = Capture->GetRecordedSamples().Num();
+    CaptureData = Capture->GetRecordedSamples();
+}
+
+bool UVoskHybridRecognizer::FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 PacketSize)
+{
+    if (ActiveBackend == EVoskRecognitionBackend::None)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No recognition backend available!"));
+        return false;
+    }
+
+    PacketSize = FMath::Clamp<int32>(PacketSize, 1, TNumericLimits<int32>::Max());
+
+    for (int32 Offset = 0; Offset < VoiceChunk.Num(); Offset += PacketSize)
+    {
+        RouteAudio(VoiceChunk.GetData() + Offset, FMath::Min(PacketSize, VoiceChunk.Num() - Offset));
+    }
+
+    RequestFinalResult();
+
+    return true;
+}
+
+void UVoskHybridRecognizer::RequestFinalResult()
+{
+    if (IsServerAvailable())
+        Server->RequestFinalResult();
+
+    if (ActiveBackend == EVoskRecognitionBackend::Local)
+        Local->QueueFinalResult();
+}
+
+void UVoskHybridRecognizer::ResetRecognizer()
+{
+    if (IsServerAvailable())
+        Server->ResetRecognizer();
+
+    if (IsLocalAvailable())
+        Local->QueueReset();
+
+    ReplayBuffer->Reset();
+}
+
+void UVoskHybridRecognizer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Uninitialize();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UVoskHybridRecognizer::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (bWantServer && Server.IsValid() && !Server->IsConnected() && !Server->IsConnecting())
+    {
+        ReconnectTimer += DeltaTime;
+        if (ReconnectTimer >= ReconnectInterval)
+        {
+            ReconnectTimer = 0.f;
+            Server->Connect(ServerAddress, ServerPort);
+        }
+    }
+
+    // server stopped answering altogether
+    if (PendingSendTime > 0.0 && !bServerTooSlow && FPlatformTime::Seconds() - PendingSendTime > MaxServerLatency)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Language server did not answer in %.2fs"), MaxServerLatency);
+        bServerTooSlow = true;
+        FastReplies = 0;
+    }
+
+    UpdateActiveBackend();
+
+    if (Capture.IsValid() && bIsCaptureActive)
+    {
+        const int32 VoiceCaptureReadBytes = Capture->Poll(CaptureChunk);
+        if (VoiceCaptureReadBytes > 0 && bSendVoiceDataWhenRecording)
+        {
+            RouteAudio(CaptureChunk.GetData(), VoiceCaptureReadBytes, Capture->GetLastCaptureTime());
+        }
+    }
+}
+
+void UVoskHybridRecognizer::RouteAudio(const uint8* Data, int32 Size, double CaptureTime)
+{
+    ReplayBuffer->SetCapacity(FMath::Max(0, FMath::FloorToInt(ReplayBufferSeconds * SampleRate)) * (int32)sizeof(int16));
+    ReplayBuffer->Append(Data, Size);
+
+    // server is fed even while failed over, its replies tell us when it has recovered
+    if (IsServerAvailable() && Server->SendAudio(Data, Size, CaptureTime) && PendingSendTime == 0.0)
+    {
+        PendingSendTime = FPlatformTime::Seconds();
+    }
+
+    // decoding runs on a pool thread like the server does, results come back through OnLocalResult
+    if (ActiveBackend == EVoskRecognitionBackend::Local)
+    {
+        Local->QueueWaveform(Data, Size);
+    }
+}
+
+void UVoskHybridRecognizer::UpdateActiveBackend()
+{
+    EVoskRecognitionBackend Desired = EVoskRecognitionBackend::None;
+
+    if (IsServerAvailable() && !bServerTooSlow)
+        Desired = EVoskRecognitionBackend::Server;
+    else if (IsLocalAvailable())
+        Desired = EVoskRecognitionBackend::Local;
+    else if (IsServerAvailable())
+        Desired = EVoskRecognitionBackend::Server; // slow server is still better than nothing
+
+    SetActiveBackend(Desired);
+}
+
+void UVoskHybridRecognizer::SetActiveBackend(EVoskRecognitionBackend Backend)
+{
+    if (Backend == ActiveBackend)
+        return;
+
+    ActiveBackend = Backend;
+
+    if (Backend == EVoskRecognitionBackend::Local)
+    {
+        // continue the utterance in progress on the local model, without holding up this frame
+        TArray<uint8> Replay;
+        ReplayBuffer->CopyTo(Replay);
+        Local->QueueReset();
+        Local->QueueWaveform(MoveTemp(Replay));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Speech recognition backend: %s"), *UEnum::GetValueAsString(Backend));
+    OnRecognitionBackendChanged.Broadcast(Backend);
+}
+
+void UVoskHybridRecognizer::OnServerResult(const FVoskRecognitionResult& Result)
+{
+    if (PendingSendTime > 0.0)
+    {
+        const float Latency = (float)(FPlatformTime::Seconds() - PendingSendTime);
+        PendingSendTime = 0.0;
+
+        ServerLatency = ServerLatency > 0.f ? FMath::Lerp(ServerLatency, Latency, 0.2f) : Latency;
+
+        if (Latency <= MaxServerLatency)
+        {
+            if (bServerTooSlow && ++FastReplies >= RecoveryReplies)
+            {
+                bServerTooSlow = false;
+                FastReplies = 0;
+                ServerLatency = Latency;
+            }
+        }
+        else
+        {
+            FastReplies = 0;
+        }
+
+        if (ServerLatency > MaxServerLatency)
+            bServerTooSlow = true;
+
+        UpdateActiveBackend();
+    }
+
+    if (ActiveBackend == EVoskRecognitionBackend::Server)
+        BroadcastResult(Result);
+}
+
+void UVoskHybridRecognizer::OnLocalResult(const FVoskRecognitionResult& Result)
+{
+    // local model decodes on a pool thread
+    if (!IsInGameThread())
+    {
+        TWeakObjectPtr<UVoskHybridRecognizer> Self = this;
+        AsyncTask(ENamedThreads::GameThread, [Self, Result]() {
+            if (Self.IsValid())
+                Self->OnLocalResult(Result);
+        });
+        return;
+    }
+
+    if (ActiveBackend == EVoskRecognitionBackend::Local)
+        BroadcastResult(Result);
+}
+
+void UVoskHybridRecognizer::BroadcastResult(const FVoskRecognitionResult& Result)
+{
+    if (Result.Type == EVoskResultType::Partial)
+    {
+        OnPartialResultReceived.Broadcast(Result.Text);
+    }
+    else if (Result.Type == EVoskResultType::Final)
+    {
+        // utterance is closed, nothing left to replay
+        ReplayBuffer->Reset();
+        OnFinalResultReceived.Broadcast(Result.Text);
+    }
+}
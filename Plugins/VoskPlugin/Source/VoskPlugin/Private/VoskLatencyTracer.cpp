@@ -0,0 +1,247 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskLatencyTracer.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+
+TRACE_DECLARE_FLOAT_COUNTER(VoskCaptureToSend, TEXT("Vosk/CaptureToSend (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(VoskSendToResult, TEXT("Vosk/SendToResult (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(VoskDecode, TEXT("Vosk/Decode (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(VoskCaptureToResult, TEXT("Vosk/CaptureToResult (ms)"));
+TRACE_DECLARE_INT_COUNTER(VoskFramesInFlight, TEXT("Vosk/FramesInFlight"));
+
+// server that stopped answering must not grow the queue forever
+static const int32 MAX_FRAMES_IN_FLIGHT = 1024;
+
+
+FVoskLatencyTracer::FVoskLatencyTracer(int32 InMaxSamples)
+	: MaxSamples(FMath::Max(1, InMaxSamples))
+{
+}
+
+void FVoskLatencyTracer::BeginSession()
+{
+	InFlight.Reset();
+	CaptureToSend.Reset();
+	SendToResult.Reset();
+	Decode.Reset();
+	CaptureToResult.Reset();
+	UnmatchedResults = 0;
+	LastCaptureTime = 0.0;
+	bPaired = true;
+
+	TRACE_COUNTER_SET(VoskFramesInFlight, 0);
+}
+
+bool FVoskLatencyTracer::Enqueue(const FInFlightFrame& Frame)
+{
+	if (!bPaired)
+		return false;
+
+	// frames are answered one by one or not at all, either way the queue can't be trusted anymore
+	if (InFlight.Num() >= MAX_FRAMES_IN_FLIGHT)
+	{
+		DropPairing(TEXT("server left too many frames unanswered"));
+		return false;
+	}
+
+	InFlight.Add(Frame);
+	return true;
+}
+
+void FVoskLatencyTracer::DropPairing(const TCHAR* Reason)
+{
+	if (!bPaired)
+		return;
+
+	UE_LOG(LogTemp, Warning, TEXT("Language server latency is no longer traced, %s"), Reason);
+
+	bPaired = false;
+	InFlight.Reset();
+	TRACE_COUNTER_SET(VoskFramesInFlight, 0);
+}
+
+uint32 FVoskLatencyTracer::OnAudioSent(double CaptureTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FInFlightFrame Frame;
+	Frame.Sequence = NextSequence++;
+	Frame.CaptureTime = CaptureTime > 0.0 ? CaptureTime : Now;
+	Frame.SendTime = Now;
+	Frame.bReset = false;
+	LastCaptureTime = Frame.CaptureTime;
+	Enqueue(Frame);
+
+	const float QueueMs = (float)((Frame.SendTime - Frame.CaptureTime) * 1000.0);
+	CaptureToSend.Add(QueueMs, MaxSamples);
+
+	TRACE_COUNTER_SET(VoskCaptureToSend, QueueMs);
+	TRACE_COUNTER_SET(VoskFramesInFlight, InFlight.Num());
+
+	return Frame.Sequence;
+}
+
+void FVoskLatencyTracer::OnFinalResultRequested()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	// final result closes the utterance captured by the last audio frame
+	FInFlightFrame Frame;
+	Frame.Sequence = NextSequence > 0 ? NextSequence - 1 : 0;
+	Frame.CaptureTime = LastCaptureTime > 0.0 ? LastCaptureTime : Now;
+	Frame.SendTime = Now;
+	Frame.bReset = false;
+	Enqueue(Frame);
+}
+
+void FVoskLatencyTracer::OnResetRequested()
+{
+	FInFlightFrame Frame;
+	Frame.Sequence = NextSequence > 0 ? NextSequence - 1 : 0;
+	Frame.CaptureTime = Frame.SendTime = FPlatformTime::Seconds();
+	Frame.bReset = true;
+	Enqueue(Frame);
+}
+
+void FVoskLatencyTracer::OnOtherMessage()
+{
+	if (InFlight.Num() == 0)
+		return;
+
+	// acknowledged reset
+	if (InFlight[0].bReset)
+	{
+		InFlight.RemoveAt(0, 1, false);
+		TRACE_COUNTER_SET(VoskFramesInFlight, InFlight.Num());
+		return;
+	}
+
+	// took the place of the reply to a frame, or came on top of it. Which one is unknown
+	DropPairing(TEXT("server sent a message that is not a result while audio was in flight"));
+}
+
+int32 FVoskLatencyTracer::OnResult(double ArrivalTime, bool bIsFinal)
+{
+	if (!bPaired)
+	{
+		UnmatchedResults++;
+		return INDEX_NONE;
+	}
+
+	if (InFlight.Num() == 0)
+	{
+		// extra reply would pair every later result with the frame before its own
+		DropPairing(TEXT("server sent a result no frame was waiting for"));
+		UnmatchedResults++;
+		return INDEX_NONE;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const FInFlightFrame Frame = InFlight[0];
+	InFlight.RemoveAt(0, 1, false);
+
+	if (Frame.bReset)
+	{
+		TRACE_COUNTER_SET(VoskFramesInFlight, InFlight.Num());
+		return INDEX_NONE;
+	}
+
+	const float ServerMs = (float)((ArrivalTime - Frame.SendTime) * 1000.0);
+	const float DecodeMs = (float)((Now - ArrivalTime) * 1000.0);
+	const float TotalMs = (float)((Now - Frame.CaptureTime) * 1000.0);
+
+	SendToResult.Add(ServerMs, MaxSamples);
+	Decode.Add(DecodeMs, MaxSamples);
+	CaptureToResult.Add(TotalMs, MaxSamples);
+
+	TRACE_COUNTER_SET(VoskSendToResult, ServerMs);
+	TRACE_COUNTER_SET(VoskDecode, DecodeMs);
+	TRACE_COUNTER_SET(VoskCaptureToResult, TotalMs);
+	TRACE_COUNTER_SET(VoskFramesInFlight, InFlight.Num());
+
+	if (bIsFinal)
+	{
+		TRACE_BOOKMARK(TEXT("Vosk final result #%u (%.1f ms)"), Frame.Sequence, TotalMs);
+	}
+
+	return (int32)(Frame.Sequence & MAX_int32);
+}
+
+FVoskLatencyReport FVoskLatencyTracer::GetReport() const
+{
+	FVoskLatencyReport Report;
+	Report.CaptureToSend = CaptureToSend.Compute();
+	Report.SendToResult = SendToResult.Compute();
+	Report.Decode = Decode.Compute();
+	Report.CaptureToResult = CaptureToResult.Compute();
+	Report.UnmatchedResults = UnmatchedResults;
+	Report.bPairingDropped = !bPaired;
+	return Report;
+}
+
+void FVoskLatencyTracer::LogReport() const
+{
+	const FVoskLatencyReport Report = GetReport();
+	if (Report.CaptureToResult.Samples == 0)
+		return;
+
+	auto LogStage = [](const TCHAR* Name, const FVoskLatencyPercentiles& Stage) {
+		UE_LOG(LogTemp, Log, TEXT("  %-16s p50 %7.1f  p90 %7.1f  p99 %7.1f  max %7.1f ms (%d)"),
+			Name, Stage.P50, Stage.P90, Stage.P99, Stage.Max, Stage.Samples);
+	};
+
+	UE_LOG(LogTemp, Log, TEXT("Language server session latency:"));
+	LogStage(TEXT("capture->send"), Report.CaptureToSend);
+	LogStage(TEXT("send->result"), Report.SendToResult);
+	LogStage(TEXT("decode"), Report.Decode);
+	LogStage(TEXT("capture->result"), Report.CaptureToResult);
+
+	if (Report.UnmatchedResults > 0)
+		UE_LOG(LogTemp, Warning, TEXT("  %d results could not be matched to audio"), Report.UnmatchedResults);
+
+	if (Report.bPairingDropped)
+		UE_LOG(LogTemp, Warning, TEXT("  server broke reply order, results after that are not timed"));
+}
+
+void FVoskLatencyTracer::FStageSamples::Add(float Value, int32 InMaxSamples)
+{
+	if (Values.Num() < InMaxSamples)
+	{
+		Values.Add(Value);
+		return;
+	}
+
+	Values[Next] = Value;
+	Next = (Next + 1) % InMaxSamples;
+}
+
+void FVoskLatencyTracer::FStageSamples::Reset()
+{
+	Values.Reset();
+	Next = 0;
+}
+
+FVoskLatencyPercentiles FVoskLatencyTracer::FStageSamples::Compute() const
+{
+	FVoskLatencyPercentiles Result;
+	Result.Samples = Values.Num();
+	if (Values.Num() == 0)
+		return Result;
+
+	TArray<float> Sorted = Values;
+	Sorted.Sort();
+
+	// nearest rank
+	auto Percentile = [&Sorted](float P) {
+		const int32 Rank = FMath::CeilToInt(P * Sorted.Num());
+		return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+	};
+
+	Result.P50 = Percentile(0.5f);
+	Result.P90 = Percentile(0.9f);
+	Result.P99 = Percentile(0.99f);
+	Result.Max = Sorted.Last();
+	return Result;
+}
@@ -0,0 +1,96 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoskLatencyStats.h"
+
+
+/**
+* Correlates results of the language server with the audio frames that produced them.
+*
+* Audio goes out as raw pcm, so sequence numbers are kept on the client only. The server
+* answers every audio frame, final result request and reset with exactly one message, in
+* order, which lets replies be matched against a FIFO of frames in flight.
+*
+* Nothing in the replies ties them to a frame, so pairing is dropped for the rest of the
+* session as soon as the server is seen breaking that order: a message that is not a result
+* arriving while audio is in flight, a result with nothing in flight, or frames piling up
+* unanswered. Results after that count as unmatched instead of skewing every later sample.
+*
+* Per stage timings are published as Unreal Insights counters and kept in a bounded
+* window for percentile reports.
+*/
+class FVoskLatencyTracer
+{
+public:
+	explicit FVoskLatencyTracer(int32 InMaxSamples = 4096);
+
+	/** Drops frames in flight and collected timings */
+	void BeginSession();
+
+	/**
+	* Stamps outgoing audio frame.
+	* CaptureTime is FPlatformTime::Seconds() when samples were captured, 0 if unknown
+	*/
+	uint32 OnAudioSent(double CaptureTime);
+
+	/** Final result request is answered like an audio frame, on behalf of the last one sent */
+	void OnFinalResultRequested();
+
+	/** Reset is answered with one message too, it is not timed */
+	void OnResetRequested();
+
+	/** Any message that is not a recognition result, such as an acknowledgement or an error */
+	void OnOtherMessage();
+
+	/**
+	* Matches decoded reply with the oldest frame in flight.
+	* ArrivalTime is when the message came off the socket, before decoding.
+	* Returns sequence number of the matched frame, INDEX_NONE if there was none
+	*/
+	int32 OnResult(double ArrivalTime, bool bIsFinal);
+
+	FVoskLatencyReport GetReport() const;
+	void LogReport() const;
+
+private:
+	struct FInFlightFrame
+	{
+		uint32 Sequence;
+		double CaptureTime;
+		double SendTime;
+
+		/** Reset request, its reply is expected but carries no latency */
+		bool bReset;
+	};
+
+	/** Adds a frame, false once pairing was dropped */
+	bool Enqueue(const FInFlightFrame& Frame);
+
+	void DropPairing(const TCHAR* Reason);
+
+	/** Fixed size window of latest timings of one stage, milliseconds */
+	struct FStageSamples
+	{
+		TArray<float> Values;
+		int32 Next = 0;
+
+		void Add(float Value, int32 MaxSamples);
+		void Reset();
+		FVoskLatencyPercentiles Compute() const;
+	};
+
+	TArray<FInFlightFrame> InFlight;
+
+	FStageSamples CaptureToSend;
+	FStageSamples SendToResult;
+	FStageSamples Decode;
+	FStageSamples CaptureToResult;
+
+	double LastCaptureTime = 0.0;
+	uint32 NextSequence = 0;
+	int32 UnmatchedResults = 0;
+	bool bPaired = true;
+
+	const int32 MaxSamples;
+};
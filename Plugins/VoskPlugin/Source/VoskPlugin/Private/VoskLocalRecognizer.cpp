@@ -0,0 +1,173 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskLocalRecognizer.h"
+#include "Async/Async.h"
+#include <string>
+
+
+FVoskLocalRecognizer::~FVoskLocalRecognizer()
+{
+	Unload();
+}
+
+bool FVoskLocalRecognizer::Load(const FString& PathToLanguageModel, float SampleRate)
+{
+	Unload();
+
+	std::string ModelPath = std::string(TCHAR_TO_UTF8(*PathToLanguageModel));
+	VoskModel* NewModel = vosk_model_new(ModelPath.c_str());
+	if (NewModel == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to load vosk model from %s"), *PathToLanguageModel);
+		return false;
+	}
+
+	VoskRecognizer* NewRecognizer = vosk_recognizer_new(NewModel, SampleRate);
+	vosk_recognizer_set_max_alternatives(NewRecognizer, 0);
+	vosk_recognizer_set_words(NewRecognizer, false);
+
+	FScopeLock Lock(&Guard);
+	Model = NewModel;
+	Recognizer = NewRecognizer;
+	AcceptedSampleRate = SampleRate > 0.f ? SampleRate : 16000.f;
+	SamplesAccepted = 0;
+	return true;
+}
+
+void FVoskLocalRecognizer::Unload()
+{
+	FScopeLock Lock(&Guard);
+
+	if (Recognizer != nullptr) {
+		vosk_recognizer_free(Recognizer);
+		Recognizer = nullptr;
+	}
+
+	if (Model != nullptr) {
+		vosk_model_free(Model);
+		Model = nullptr;
+	}
+}
+
+void FVoskLocalRecognizer::AcceptWaveform(const uint8* Data, int32 Size)
+{
+	FString RawResult;
+	float AudioTime = 0.f;
+	{
+		FScopeLock Lock(&Guard);
+		if (Recognizer == nullptr || Size <= 0)
+			return;
+
+		SamplesAccepted += Size / sizeof(int16);
+		AudioTime = (float)(SamplesAccepted / AcceptedSampleRate);
+
+		if (vosk_recognizer_accept_waveform(Recognizer, reinterpret_cast<const char*>(Data), Size))
+			RawResult = UTF8_TO_TCHAR(vosk_recognizer_result(Recognizer));
+		else
+			RawResult = UTF8_TO_TCHAR(vosk_recognizer_partial_result(Recognizer));
+	}
+
+	Decode(RawResult, AudioTime);
+}
+
+void FVoskLocalRecognizer::FinalResult()
+{
+	FString RawResult;
+	float AudioTime = 0.f;
+	{
+		FScopeLock Lock(&Guard);
+		if (Recognizer == nullptr)
+			return;
+
+		RawResult = UTF8_TO_TCHAR(vosk_recognizer_final_result(Recognizer));
+		AudioTime = (float)(SamplesAccepted / AcceptedSampleRate);
+	}
+
+	Decode(RawResult, AudioTime);
+}
+
+void FVoskLocalRecognizer::Reset()
+{
+	FScopeLock Lock(&Guard);
+	if (Recognizer != nullptr)
+		vosk_recognizer_reset(Recognizer);
+	SamplesAccepted = 0;
+}
+
+void FVoskLocalRecognizer::QueueWaveform(const uint8* Data, int32 Size)
+{
+	if (Size <= 0)
+		return;
+
+	FCommand Command;
+	Command.Audio.Append(Data, Size);
+	Queue(MoveTemp(Command));
+}
+
+void FVoskLocalRecognizer::QueueWaveform(TArray<uint8>&& Audio)
+{
+	if (Audio.Num() == 0)
+		return;
+
+	FCommand Command;
+	Command.Audio = MoveTemp(Audio);
+	Queue(MoveTemp(Command));
+}
+
+void FVoskLocalRecognizer::QueueFinalResult()
+{
+	FCommand Command;
+	Command.Type = ECommand::FinalResult;
+	Queue(MoveTemp(Command));
+}
+
+void FVoskLocalRecognizer::QueueReset()
+{
+	FCommand Command;
+	Command.Type = ECommand::Reset;
+	Queue(MoveTemp(Command));
+}
+
+void FVoskLocalRecognizer::Queue(FCommand&& Command)
+{
+	Commands.Enqueue(MoveTemp(Command));
+
+	if (!bRunningCommands.AtomicSet(true))
+	{
+		TSharedRef<FVoskLocalRecognizer> Self = AsShared();
+		Async(EAsyncExecution::ThreadPool, [Self]() { Self->RunCommands(); });
+	}
+}
+
+void FVoskLocalRecognizer::RunCommands()
+{
+	FCommand Command;
+	for (;;)
+	{
+		while (Commands.Dequeue(Command))
+		{
+			switch (Command.Type)
+			{
+			case ECommand::Waveform: AcceptWaveform(Command.Audio.GetData(), Command.Audio.Num()); break;
+			case ECommand::FinalResult: FinalResult(); break;
+			case ECommand::Reset: Reset(); break;
+			}
+		}
+
+		bRunningCommands = false;
+
+		// a command queued between the last dequeue and the flag reset would be left behind
+		if (Commands.IsEmpty() || bRunningCommands.AtomicSet(true))
+			return;
+	}
+}
+
+void FVoskLocalRecognizer::Decode(const FString& Raw, float AudioTime)
+{
+	FVoskRecognitionResult Result;
+	if (FVoskRecognitionResult::FromJson(Raw, Result))
+	{
+		Result.AudioTime = AudioTime;
+		OnResult.Broadcast(Result);
+	}
+}
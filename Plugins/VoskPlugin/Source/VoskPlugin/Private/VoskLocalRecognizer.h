@@ -0,0 +1,75 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
+#include "VoskRecognitionResult.h"
+#include "vosk_api.h"
+
+
+/**
+* In-process libvosk model and recognizer.
+*/
+class FVoskLocalRecognizer : public TSharedFromThis<FVoskLocalRecognizer>
+{
+public:
+	~FVoskLocalRecognizer();
+
+	/**
+	* Loads model from disk. This is blocking call, run it off the game thread
+	*/
+	bool Load(const FString& PathToLanguageModel, float SampleRate = 16000.f);
+	void Unload();
+
+	bool IsLoaded() const { return Recognizer != nullptr; }
+
+	/**
+	* Feeds audio and broadcasts partial or final result
+	*/
+	void AcceptWaveform(const uint8* Data, int32 Size);
+	void FinalResult();
+	void Reset();
+
+	/**
+	* Same as above, run in order on a pool thread so decoding never holds up the caller.
+	* Results are broadcast from that thread
+	*/
+	void QueueWaveform(const uint8* Data, int32 Size);
+	void QueueWaveform(TArray<uint8>&& Audio);
+	void QueueFinalResult();
+	void QueueReset();
+
+	FOnVoskRecognitionResult OnResult;
+
+private:
+	void Decode(const FString& Raw, float AudioTime);
+
+	enum class ECommand : uint8
+	{
+		Waveform,
+		FinalResult,
+		Reset
+	};
+
+	struct FCommand
+	{
+		ECommand Type = ECommand::Waveform;
+		TArray<uint8> Audio;
+	};
+
+	void Queue(FCommand&& Command);
+	void RunCommands();
+
+	/** Filled by the game thread, drained by one pool task at a time */
+	TQueue<FCommand, EQueueMode::Spsc> Commands;
+	FThreadSafeBool bRunningCommands = false;
+
+	VoskModel* Model = nullptr;
+	VoskRecognizer* Recognizer = nullptr;
+
+	/** Samples fed since load or last Reset(), timestamps results */
+	int64 SamplesAccepted = 0;
+	float AcceptedSampleRate = 16000.f;
+	FCriticalSection Guard;
+};
@@ -0,0 +1,79 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskPCMCache.h"
+#include "Sound/SoundWave.h"
+
+
+FVoskPCMCache& FVoskPCMCache::Get()
+{
+	static FVoskPCMCache Instance;
+	return Instance;
+}
+
+TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> FVoskPCMCache::Find(const USoundWave* Sound, int32 SampleRate)
+{
+	FScopeLock Lock(&Guard);
+
+	FEntry* Entry = Entries.Find(FKey(FObjectKey(Sound), SampleRate));
+	if (Entry == nullptr)
+		return nullptr;
+
+	Entry->LastUsed = ++UseCounter;
+	return Entry->Samples;
+}
+
+void FVoskPCMCache::Add(const USoundWave* Sound, int32 SampleRate, const FVoskSharedPCM& Samples)
+{
+	// would evict everything else and itself right away
+	if (Samples->Num() > BudgetBytes)
+		return;
+
+	FScopeLock Lock(&Guard);
+
+	const FKey Key(FObjectKey(Sound), SampleRate);
+	if (FEntry* Existing = Entries.Find(Key))
+		TotalBytes -= Existing->Samples->Num();
+
+	Entries.Add(Key, FEntry{ Samples, ++UseCounter });
+	TotalBytes += Samples->Num();
+
+	Trim();
+}
+
+void FVoskPCMCache::SetBudget(int64 InBudgetBytes)
+{
+	FScopeLock Lock(&Guard);
+
+	BudgetBytes = FMath::Max<int64>(0, InBudgetBytes);
+	Trim();
+}
+
+void FVoskPCMCache::Clear()
+{
+	FScopeLock Lock(&Guard);
+
+	Entries.Empty();
+	TotalBytes = 0;
+}
+
+void FVoskPCMCache::Trim()
+{
+	// entries are whole assets, there are few of them, linear scan is fine
+	while (TotalBytes > BudgetBytes && Entries.Num() > 0)
+	{
+		const FKey* Oldest = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FKey, FEntry>& It : Entries)
+		{
+			if (It.Value.LastUsed < OldestUse)
+			{
+				Oldest = &It.Key;
+				OldestUse = It.Value.LastUsed;
+			}
+		}
+
+		const FKey Key = *Oldest;
+		TotalBytes -= Entries[Key].Samples->Num();
+		Entries.Remove(Key);
+	}
+}
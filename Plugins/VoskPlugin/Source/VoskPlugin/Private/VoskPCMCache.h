@@ -0,0 +1,42 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "VoskSoundUtils.h"
+
+
+/**
+* Decoded mono PCM of sound assets, least recently used entries are evicted
+* once total size goes over budget. Thread safe.
+*/
+class FVoskPCMCache
+{
+public:
+	static FVoskPCMCache& Get();
+
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Find(const class USoundWave* Sound, int32 SampleRate);
+
+	void Add(const class USoundWave* Sound, int32 SampleRate, const FVoskSharedPCM& Samples);
+
+	void SetBudget(int64 InBudgetBytes);
+	void Clear();
+
+private:
+	typedef TPair<FObjectKey, int32> FKey;
+
+	struct FEntry
+	{
+		FVoskSharedPCM Samples;
+		uint64 LastUsed;
+	};
+
+	void Trim();
+
+	TMap<FKey, FEntry> Entries;
+	FCriticalSection Guard;
+
+	int64 BudgetBytes = 64 * 1024 * 1024;
+	int64 TotalBytes = 0;
+	uint64 UseCounter = 0;
+};
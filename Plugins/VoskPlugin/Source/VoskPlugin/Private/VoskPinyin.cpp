@@ -0,0 +1,253 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskPinyin.h"
+#include "VoskStringDistance.h"
+
+
+namespace
+{
+#include "VoskPinyinData.inl"
+
+	struct FToneMark
+	{
+		TCHAR Marked;
+		TCHAR Base;
+		int32 Tone;
+	};
+
+	const FToneMark ToneMarks[] = {
+		{ TEXT('ā'), TEXT('a'), 1 }, { TEXT('á'), TEXT('a'), 2 }, { TEXT('ǎ'), TEXT('a'), 3 }, { TEXT('à'), TEXT('a'), 4 },
+		{ TEXT('ē'), TEXT('e'), 1 }, { TEXT('é'), TEXT('e'), 2 }, { TEXT('ě'), TEXT('e'), 3 }, { TEXT('è'), TEXT('e'), 4 },
+		{ TEXT('ī'), TEXT('i'), 1 }, { TEXT('í'), TEXT('i'), 2 }, { TEXT('ǐ'), TEXT('i'), 3 }, { TEXT('ì'), TEXT('i'), 4 },
+		{ TEXT('ō'), TEXT('o'), 1 }, { TEXT('ó'), TEXT('o'), 2 }, { TEXT('ǒ'), TEXT('o'), 3 }, { TEXT('ò'), TEXT('o'), 4 },
+		{ TEXT('ū'), TEXT('u'), 1 }, { TEXT('ú'), TEXT('u'), 2 }, { TEXT('ǔ'), TEXT('u'), 3 }, { TEXT('ù'), TEXT('u'), 4 },
+		{ TEXT('ǖ'), TEXT('v'), 1 }, { TEXT('ǘ'), TEXT('v'), 2 }, { TEXT('ǚ'), TEXT('v'), 3 }, { TEXT('ǜ'), TEXT('v'), 4 },
+		{ TEXT('ü'), TEXT('v'), 5 },
+		{ TEXT('ń'), TEXT('n'), 2 }, { TEXT('ň'), TEXT('n'), 3 }, { TEXT('ǹ'), TEXT('n'), 4 },
+		{ TEXT('ḿ'), TEXT('m'), 2 },
+	};
+
+	void AppendCodepoint(FString& Out, UTF32CHAR C)
+	{
+		if (sizeof(TCHAR) == 2 && C >= 0x10000)
+		{
+			C -= 0x10000;
+			Out.AppendChar((TCHAR)(0xD800 + (C >> 10)));
+			Out.AppendChar((TCHAR)(0xDC00 + (C & 0x3FF)));
+			return;
+		}
+		Out.AppendChar((TCHAR)C);
+	}
+}
+
+
+const FVoskPinyinTable& FVoskPinyinTable::Get()
+{
+	static const FVoskPinyinTable Instance;
+	return Instance;
+}
+
+FVoskPinyinTable::FVoskPinyinTable()
+{
+	static_assert(UE_ARRAY_COUNT(PinyinTable) == TableLast - TableFirst + 1, "Generated table has to cover TableFirst to TableLast");
+
+	Syllables.Reserve(UE_ARRAY_COUNT(PinyinSyllables));
+	for (const ANSICHAR* Syllable : PinyinSyllables)
+	{
+		SyllableToIndex.Add(Syllable, Syllables.Num());
+		Syllables.Add(Syllable);
+	}
+
+	Table.Append(PinyinTable, UE_ARRAY_COUNT(PinyinTable));
+
+	if (IsEmpty())
+		UE_LOG(LogTemp, Error, TEXT("Built-in pinyin table is empty, pinyin matching compares text as written"));
+}
+
+FVoskPinyinTable::FVoskPinyinTable(const FString& Data)
+{
+	Parse(Data);
+}
+
+bool FVoskPinyinTable::Parse(const FString& Data)
+{
+	Table.SetNumZeroed(TableLast - TableFirst + 1);
+
+	int32 NumEntries = 0;
+	const TCHAR* Cursor = *Data;
+
+	while (*Cursor)
+	{
+		const TCHAR* LineStart = Cursor;
+		while (*Cursor && *Cursor != TEXT('\n'))
+			Cursor++;
+		const FString Line(UE_PTRDIFF_TO_INT32(Cursor - LineStart), LineStart);
+		if (*Cursor)
+			Cursor++;
+
+		// U+4E2D: zhōng,zhòng  # 中
+		if (!Line.StartsWith(TEXT("U+")))
+			continue;
+
+		int32 Colon;
+		if (!Line.FindChar(TEXT(':'), Colon))
+			continue;
+
+		const UTF32CHAR Codepoint = (UTF32CHAR)FParse::HexNumber(*Line.Mid(2, Colon - 2));
+
+		FString Readings = Line.Mid(Colon + 1);
+		int32 Comment;
+		if (Readings.FindChar(TEXT('#'), Comment))
+			Readings.LeftInline(Comment);
+
+		FString Reading;
+		if (!Readings.TrimStartAndEnd().Split(TEXT(","), &Reading, nullptr))
+			Reading = Readings.TrimStartAndEnd();
+
+		int32 Tone;
+		const int32 Syllable = AddReading(Reading, Tone);
+		if (Syllable == INDEX_NONE)
+			continue;
+
+		const uint16 Packed = (uint16)(((Syllable + 1) << 3) | Tone);
+		if (Codepoint >= TableFirst && Codepoint <= TableLast)
+			Table[Codepoint - TableFirst] = Packed;
+		else
+			Supplementary.Add(Codepoint, Packed);
+
+		NumEntries++;
+	}
+
+	Syllables.Shrink();
+	UE_LOG(LogTemp, Log, TEXT("Pinyin table loaded, %d characters, %d syllables"), NumEntries, Syllables.Num());
+
+	return NumEntries > 0;
+}
+
+int32 FVoskPinyinTable::AddReading(const FString& Reading, int32& OutTone)
+{
+	OutTone = 5;
+
+	FString Syllable;
+	Syllable.Reserve(Reading.Len());
+
+	for (TCHAR C : Reading)
+	{
+		// combining marks of rare readings like m̀
+		if (C >= 0x0300 && C <= 0x036F)
+			continue;
+
+		const FToneMark* Mark = nullptr;
+		for (const FToneMark& Candidate : ToneMarks)
+		{
+			if (Candidate.Marked == C)
+			{
+				Mark = &Candidate;
+				break;
+			}
+		}
+
+		if (Mark)
+		{
+			Syllable.AppendChar(Mark->Base);
+			if (Mark->Tone != 5)
+				OutTone = Mark->Tone;
+		}
+		else if (FChar::IsAlpha(C) && C < 128)
+		{
+			Syllable.AppendChar(FChar::ToLower(C));
+		}
+	}
+
+	if (Syllable.IsEmpty())
+		return INDEX_NONE;
+
+	if (const int32* Existing = SyllableToIndex.Find(Syllable))
+		return *Existing;
+
+	const int32 Index = Syllables.Add(Syllable);
+	SyllableToIndex.Add(Syllable, Index);
+	return Index;
+}
+
+int32 FVoskPinyinTable::Lookup(UTF32CHAR Codepoint, int32& OutTone) const
+{
+	uint16 Packed = 0;
+	if (Codepoint >= TableFirst && Codepoint <= TableLast)
+	{
+		if (Table.Num() > 0)
+			Packed = Table[Codepoint - TableFirst];
+	}
+	else if (const uint16* Found = Supplementary.Find(Codepoint))
+	{
+		Packed = *Found;
+	}
+
+	if (Packed == 0)
+		return INDEX_NONE;
+
+	OutTone = Packed & 7;
+	return (Packed >> 3) - 1;
+}
+
+void FVoskPinyinTable::MakeKey(const FString& Text, bool bToneSensitive, TArray<UTF32CHAR>& OutKey) const
+{
+	VoskStringDistance::FCodepoints Codepoints;
+	VoskStringDistance::ToCodepoints(Text, Codepoints);
+
+	OutKey.Reset(Codepoints.Num());
+
+	for (const UTF32CHAR C : Codepoints)
+	{
+		if (C < 0x10000 && FChar::IsWhitespace((TCHAR)C))
+			continue;
+
+		int32 Tone;
+		const int32 Syllable = Lookup(C, Tone);
+		if (Syllable == INDEX_NONE)
+			OutKey.Add(C);
+		else
+			OutKey.Add(TokenBase + (bToneSensitive ? Syllable * 8 + Tone : Syllable));
+	}
+}
+
+FString FVoskPinyinTable::ToPinyin(const FString& Text, bool bWithTones) const
+{
+	VoskStringDistance::FCodepoints Codepoints;
+	VoskStringDistance::ToCodepoints(Text, Codepoints);
+
+	FString Out;
+	Out.Reserve(Codepoints.Num() * 4);
+
+	bool bSeparate = false;
+
+	for (const UTF32CHAR C : Codepoints)
+	{
+		if (C < 0x10000 && FChar::IsWhitespace((TCHAR)C))
+		{
+			bSeparate = true;
+			continue;
+		}
+
+		int32 Tone;
+		const int32 Syllable = Lookup(C, Tone);
+
+		if (!Out.IsEmpty() && (bSeparate || Syllable != INDEX_NONE))
+			Out.AppendChar(TEXT(' '));
+
+		if (Syllable == INDEX_NONE)
+		{
+			// non hanzi runs are kept together, e.g. latin words
+			AppendCodepoint(Out, C);
+			bSeparate = false;
+			continue;
+		}
+
+		Out += Syllables[Syllable];
+		if (bWithTones)
+			Out.AppendInt(Tone);
+		bSeparate = true;
+	}
+
+	return Out;
+}
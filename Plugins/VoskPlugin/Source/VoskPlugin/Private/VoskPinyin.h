@@ -0,0 +1,62 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+* Hanzi to pinyin lookup.
+*
+* The shared table is compiled in (VoskPinyinData.inl, generated from ICU Han-Latin) and
+* covers CJK Unified Ideographs and Extension A with one reading per character.
+* Other tables are parsed from pinyin-data format text ("U+4E2D: zhōng,zhòng  # 中"),
+* only the first (most common) reading is kept.
+* CJK Unified Ideographs and Extension A are stored as a flat uint16 array indexed by
+* codepoint, each entry packing syllable index and tone.
+*/
+class FVoskPinyinTable
+{
+public:
+	/** Lazily built shared table of the compiled in readings */
+	static const FVoskPinyinTable& Get();
+
+	/** Table of pinyin-data formatted text */
+	explicit FVoskPinyinTable(const FString& Data);
+
+	bool IsEmpty() const { return Syllables.Num() == 0; }
+
+	/**
+	* Syllable of a single hanzi, INDEX_NONE if unknown.
+	* Tone is 1-4, 5 for neutral tone.
+	*/
+	int32 Lookup(UTF32CHAR Codepoint, int32& OutTone) const;
+
+	/** Toneless ascii spelling, u with umlaut written as v */
+	const FString& GetSyllable(int32 Index) const { return Syllables[Index]; }
+
+	/**
+	* Matching key of text: every known hanzi becomes one syllable token, other
+	* characters are kept as codepoints and whitespace is dropped.
+	* Syllable tokens live above the unicode range, so they never collide with codepoints.
+	*/
+	void MakeKey(const FString& Text, bool bToneSensitive, TArray<UTF32CHAR>& OutKey) const;
+
+	/** Space separated syllables, e.g. "da3 kai1 deng1" */
+	FString ToPinyin(const FString& Text, bool bWithTones) const;
+
+private:
+	FVoskPinyinTable();
+	bool Parse(const FString& Data);
+	int32 AddReading(const FString& Reading, int32& OutTone);
+
+	static const UTF32CHAR TableFirst = 0x3400;
+	static const UTF32CHAR TableLast = 0x9FFF;
+	static const UTF32CHAR TokenBase = 0x110000;
+
+	/** (syllable index + 1) << 3 | tone, 0 if unknown */
+	TArray<uint16> Table;
+	TMap<UTF32CHAR, uint16> Supplementary;
+
+	TArray<FString> Syllables;
+	TMap<FString, int32> SyllableToIndex;
+};
@@ -0,0 +1,1771 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+// Generated from the Han-Latin transliteration of ICU 72 (Unicode license), do not edit.
+// One reading per character of CJK Unified Ideographs and Extension A, included by VoskPinyin.cpp.
+
+/** Toneless syllables, u with umlaut written as v */
+static const ANSICHAR* const PinyinSyllables[] = {
+	"a", "ai", "an", "ang", "ao", "ba", "bai", "ban", "bang", "bao", "bei", "ben", "beng", "bi",
+	"bian", "biao", "bie", "bin", "bing", "bo", "bu", "ca", "cai", "can", "cang", "cao", "ce", "cen",
+	"ceng", "cha", "chai", "chan", "chang", "chao", "che", "chen", "cheng", "chi", "chong", "chou",
+	"chu", "chua", "chuai", "chuan", "chuang", "chui", "chun", "chuo", "ci", "cong", "cou", "cu",
+	"cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang", "dao", "de", "den", "deng", "di", "dian",
+	"diao", "die", "ding", "diu", "dong", "dou", "du", "duan", "dui", "dun", "duo", "e", "ei", "en",
+	"eng", "er", "fa", "fan", "fang", "fei", "fen", "feng", "fiao", "fo", "fou", "fu", "ga", "gai",
+	"gan", "gang", "gao", "ge", "gei", "gen", "geng", "gong", "gou", "gu", "gua", "guai", "guan",
+	"guang", "gui", "gun", "guo", "ha", "hai", "han", "hang", "hao", "he", "hei", "hen", "heng", "hm",
+	"hong", "hou", "hu", "hua", "huai", "huan", "huang", "hui", "hun", "huo", "ji", "jia", "jian",
+	"jiang", "jiao", "jie", "jin", "jing", "jiong", "jiu", "ju", "juan", "jue", "jun", "ka", "kai",
+	"kan", "kang", "kao", "ke", "kei", "ken", "keng", "kong", "kou", "ku", "kua", "kuai", "kuan",
+	"kuang", "kui", "kun", "kuo", "la", "lai", "lan", "lang", "lao", "le", "lei", "leng", "li", "lia",
+	"lian", "liang", "liao", "lie", "lin", "ling", "liu", "lo", "long", "lou", "lu", "luan", "lun",
+	"luo", "lv", "lve", "m", "ma", "mai", "man", "mang", "mao", "me", "mei", "men", "meng", "mi",
+	"mian", "miao", "mie", "min", "ming", "miu", "mo", "mou", "mu", "n", "na", "nai", "nan", "nang",
+	"nao", "ne", "nei", "nen", "neng", "ni", "nian", "niang", "niao", "nie", "nin", "ning", "niu",
+	"nong", "nou", "nu", "nuan", "nun", "nuo", "nv", "nve", "o", "ou", "pa", "pai", "pan", "pang",
+	"pao", "pei", "pen", "peng", "pi", "pian", "piao", "pie", "pin", "ping", "po", "pou", "pu", "qi",
+	"qia", "qian", "qiang", "qiao", "qie", "qin", "qing", "qiong", "qiu", "qu", "quan", "que", "qun",
+	"ran", "rang", "rao", "re", "ren", "reng", "ri", "rong", "rou", "ru", "rua", "ruan", "rui", "run",
+	"ruo", "sa", "sai", "san", "sang", "sao", "se", "sen", "seng", "sha", "shai", "shan", "shang",
+	"shao", "she", "shei", "shen", "sheng", "shi", "shou", "shu", "shua", "shuai", "shuan", "shuang",
+	"shui", "shun", "shuo", "si", "song", "sou", "su", "suan", "sui", "sun", "suo", "ta", "tai",
+	"tan", "tang", "tao", "te", "teng", "ti", "tian", "tiao", "tie", "ting", "tong", "tou", "tu",
+	"tuan", "tui", "tun", "tuo", "wa", "wai", "wan", "wang", "wei", "wen", "weng", "wo", "wu", "xi",
+	"xia", "xian", "xiang", "xiao", "xie", "xin", "xing", "xiong", "xiu", "xu", "xuan", "xue", "xun",
+	"ya", "yan", "yang", "yao", "ye", "yi", "yin", "ying", "yo", "yong", "you", "yu", "yuan", "yue",
+	"yun", "za", "zai", "zan", "zang", "zao", "ze", "zei", "zen", "zeng", "zha", "zhai", "zhan",
+	"zhang", "zhao", "zhe", "zhen", "zheng", "zhi", "zhong", "zhou", "zhu", "zhua", "zhuai", "zhuan",
+	"zhuang", "zhui", "zhun", "zhuo", "zi", "zong", "zou", "zu", "zuan", "zui", "zun", "zuo",
+};
+
+/** (syllable index + 1) << 3 | tone, 0 if unknown, indexed by codepoint - 0x3400 */
+static const uint16 PinyinTable[] = {
+	2121, 2628, 0, 0, 1268, 2779, 2947, 0, 0, 0, 0, 0, 2938, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2826, 0, 0, 0, 0, 0, 322, 0, 0, 0,
+	0, 1876, 0, 0, 473, 0, 0, 0, 2868, 2842, 0, 2849, 1450, 1435, 2809, 2969,
+	2836, 3139, 468, 2780, 1929, 2234, 0, 1539, 2068, 2940, 2946, 1748, 300, 705, 0, 0,
+	0, 3233, 683, 43, 2779, 3300, 0, 3172, 572, 2524, 2940, 2114, 1289, 1372, 1731, 3180,
+	2433, 0, 0, 0, 2867, 0, 0, 2401, 1100, 546, 1874, 2524, 2940, 1468, 2956, 107,
+	0, 0, 0, 1338, 1626, 2940, 1388, 1060, 2987, 1506, 250, 0, 0, 0, 1042, 2867,
+	1036, 2179, 0, 3172, 0, 916, 2788, 2572, 2922, 1036, 1164, 1540, 1524, 2586, 2922, 3124,
+	3097, 2987, 3234, 660, 2163, 2051, 308, 2779, 916, 2587, 2324, 2497, 2114, 1370, 2284, 0,
+	0, 1299, 2042, 2564, 2434, 2913, 1907, 2570, 0, 1618, 2948, 540, 2987, 1636, 1164, 1795,
+	2828, 2978, 0, 0, 284, 705, 1371, 1388, 0, 1507, 0, 1060, 0, 0, 0, 0,
+	2138, 0, 186, 1411, 835, 1572, 0, 843, 2540, 0, 0, 1572, 1554, 2137, 2420, 1386,
+	0, 2739, 1252, 588, 3140, 2649, 0, 0, 156, 1052, 572, 820, 297, 0, 2097, 1123,
+	1484, 2844, 0, 1714, 2828, 0, 116, 1098, 2524, 0, 817, 0, 2980, 2842, 2060, 1978,
+	532, 739, 1508, 2060, 2060, 2585, 57, 761, 394, 2873, 1347, 0, 0, 2386, 537, 1386,
+	1004, 2666, 1985, 521, 2251, 628, 2092, 2940, 3233, 2260, 1073, 0, 308, 314, 2785, 0,
+	1524, 513, 1434, 1154, 2524, 2820, 3036, 0, 0, 3179, 3107, 1073, 3260, 337, 2828, 1388,
+	0, 308, 2786, 1075, 0, 1058, 0, 692, 332, 105, 1098, 0, 50, 1411, 1276, 0,
+	2793, 137, 1154, 1370, 2836, 60, 2915, 1516, 92, 628, 1483, 0, 0, 284, 1874, 2874,
+	962, 2987, 0, 875, 2940, 2875, 820, 1476, 2617, 1364, 2420, 0, 2547, 2924, 2801, 3260,
+	0, 2148, 2946, 2785, 3155, 1066, 996, 1321, 2939, 1212, 737, 2098, 20, 0, 1212, 330,
+	2827, 330, 2745, 0, 0, 1020, 2524, 2980, 0, 1164, 3123, 2868, 2419, 0, 2441, 1300,
+	2465, 938, 756, 2907, 2122, 2401, 1004, 2785, 676, 1940, 475, 683, 817, 41, 739, 1740,
+	2884, 2978, 1002, 0, 290, 890, 1691, 1004, 1388, 666, 2817, 2035, 0, 2500, 0, 0,
+	1364, 1436, 2940, 987, 0, 2868, 2130, 658, 0, 0, 2890, 0, 0, 0, 0, 1804,
+	2747, 2828, 2618, 978, 2699, 1804, 1804, 2946, 3137, 0, 0, 0, 0, 0, 2721, 2428,
+	1876, 2932, 2050, 2668, 914, 1164, 571, 1041, 1484, 1137, 1052, 1442, 0, 2627, 1498, 0,
+	0, 0, 0, 0, 0, 786, 2905, 2418, 2882, 1961, 379, 1826, 619, 3058, 628, 2826,
+	2977, 628, 2411, 2755, 1257, 994, 786, 2794, 1556, 1524, 1058, 986, 3156, 0, 0, 2721,
+	0, 61, 20, 3217, 2065, 828, 476, 89, 162, 329, 1388, 2820, 2860, 0, 0, 0,
+	0, 0, 978, 2620, 420, 1316, 1354, 3156, 2825, 2785, 0, 2092, 3089, 2785, 0, 0,
+	402, 1058, 1052, 2563, 2906, 2868, 2025, 2291, 0, 0, 0, 889, 2932, 2811, 2881, 938,
+	3300, 2940, 394, 0, 1377, 2802, 2571, 2218, 2940, 3156, 2785, 2802, 1140, 1058, 915, 0,
+	1948, 1388, 0, 1338, 2291, 915, 2906, 2129, 0, 2906, 915, 1185, 307, 1804, 1052, 0,
+	116, 2794, 2763, 2874, 2729, 2978, 2098, 2868, 1804, 116, 932, 1115, 44, 44, 0, 0,
+	3137, 2577, 1138, 0, 3300, 172, 1098, 20, 3044, 394, 666, 0, 0, 0, 0, 1804,
+	1452, 1586, 604, 73, 116, 83, 0, 332, 2796, 2627, 266, 0, 0, 617, 2745, 740,
+	619, 2987, 2931, 1298, 2747, 1276, 0, 2745, 2921, 1467, 2841, 171, 306, 2826, 1804, 1347,
+	2937, 3249, 1554, 3116, 2796, 884, 2826, 0, 1060, 1418, 2940, 1058, 2946, 0, 457, 2940,
+	2828, 932, 2971, 1187, 260, 2570, 2586, 3154, 84, 1602, 1298, 258, 1371, 0, 2788, 0,
+	2785, 2084, 1724, 3009, 0, 1466, 740, 3249, 0, 835, 1177, 537, 1004, 1299, 0, 779,
+	2596, 0, 2363, 1331, 1804, 738, 779, 2090, 68, 1065, 1241, 2788, 2988, 3217, 2403, 388,
+	2817, 1059, 1850, 2818, 2940, 2986, 2938, 2907, 2403, 2163, 932, 2284, 1161, 2978, 0, 2834,
+	1953, 2121, 257, 0, 172, 569, 2500, 659, 0, 1571, 3012, 1057, 0, 2083, 2849, 1946,
+	330, 1969, 1875, 1098, 2937, 660, 620, 0, 0, 0, 619, 0, 0, 2092, 1515, 2122,
+	2515, 196, 580, 2785, 705, 2940, 2553, 2089, 2028, 2833, 2659, 2836, 2978, 92, 1468, 0,
+	0, 0, 0, 3010, 1386, 2564, 1339, 1555, 2075, 3170, 2908, 2785, 1484, 2785, 2315, 676,
+	0, 2747, 668, 2940, 1731, 297, 2580, 1057, 2436, 1986, 25, 1265, 241, 0, 2802, 3156,
+	0, 0, 705, 1404, 2890, 2868, 1612, 1036, 1684, 2969, 3107, 2940, 1843, 2586, 2785, 3010,
+	2436, 738, 2940, 458, 0, 1402, 210, 193, 1140, 1484, 2524, 1756, 44, 27, 2068, 0,
+	433, 401, 0, 2162, 1779, 1546, 2834, 3004, 1706, 44, 2401, 1540, 0, 0, 1340, 2785,
+	3004, 3156, 2763, 1010, 1604, 1795, 2731, 1610, 1804, 2130, 3036, 1404, 3154, 3243, 906, 2868,
+	932, 2873, 3156, 1619, 378, 828, 0, 378, 1490, 3180, 2427, 1419, 1132, 2827, 556, 1100,
+	2218, 1562, 0, 1212, 2923, 1818, 2938, 1346, 2970, 2946, 2906, 2524, 0, 1434, 2897, 1570,
+	1650, 3284, 2987, 2940, 828, 1611, 1164, 2755, 0, 1193, 532, 1466, 0, 2843, 436, 2082,
+	1618, 1604, 2099, 0, 2730, 498, 20, 0, 124, 1842, 1402, 1107, 2985, 370, 3299, 163,
+	1033, 2924, 2691, 1060, 25, 1508, 1059, 2747, 161, 3017, 2868, 1779, 3012, 0, 51, 3130,
+	1137, 2747, 2828, 2052, 2938, 2828, 394, 2122, 585, 1796, 2052, 1059, 2689, 0, 2506, 532,
+	1354, 3107, 0, 0, 2946, 226, 1059, 1036, 3243, 1338, 1730, 1140, 2100, 468, 0, 1098,
+	2867, 401, 2972, 579, 306, 0, 1643, 1026, 2540, 1211, 3266, 932, 298, 2884, 1770, 308,
+	1402, 28, 1683, 2497, 2810, 2914, 1002, 452, 2122, 1354, 738, 604, 1562, 1346, 2707, 914,
+	1563, 162, 2153, 2050, 914, 0, 1468, 145, 2634, 3058, 2050, 3036, 1610, 1954, 3108, 2812,
+	771, 0, 2050, 0, 1484, 225, 3012, 628, 593, 1642, 2745, 2138, 2515, 1642, 2673, 0,
+	1651, 2923, 1154, 1388, 1276, 771, 2994, 461, 0, 1354, 1474, 2068, 42, 131, 2969, 1563,
+	491, 0, 42, 0, 2786, 738, 473, 1132, 2268, 2658, 2129, 628, 2049, 1058, 1058, 1002,
+	1092, 3284, 131, 1602, 60, 2747, 2939, 44, 2987, 930, 604, 2772, 1772, 426, 0, 1386,
+	1482, 1795, 1010, 1388, 0, 1516, 705, 1611, 2988, 0, 1140, 0, 0, 3107, 1969, 2939,
+	0, 1060, 115, 0, 2196, 1025, 674, 786, 1260, 1100, 2345, 0, 2497, 2658, 2993, 3241,
+	116, 1267, 1388, 1025, 2890, 1875, 0, 3130, 2756, 2802, 2060, 2930, 1572, 0, 2361, 2436,
+	0, 2081, 3225, 1305, 2780, 2953, 362, 2618, 1402, 113, 825, 1562, 2828, 708, 1474, 3049,
+	3148, 330, 1556, 1466, 0, 2948, 2009, 3148, 1073, 1490, 1802, 2940, 0, 1060, 1058, 3098,
+	2987, 1131, 1018, 3155, 1321, 1442, 3155, 99, 3092, 1137, 476, 1420, 2940, 3124, 2804, 308,
+	396, 307, 2907, 1346, 580, 1468, 258, 0, 2690, 242, 19, 307, 0, 2955, 3130, 2666,
+	0, 2690, 242, 2923, 3251, 0, 1929, 2084, 1402, 2098, 1483, 2908, 1196, 2521, 2940, 257,
+	1123, 1083, 0, 1116, 0, 572, 0, 1148, 916, 524, 0, 0, 978, 0, 306, 537,
+	116, 0, 2892, 1482, 0, 2826, 116, 0, 116, 0, 2802, 2260, 140, 659, 1148, 0,
+	3140, 92, 628, 2987, 2130, 3036, 1610, 2940, 2500, 0, 0, 0, 2364, 2570, 1684, 1116,
+	124, 2218, 236, 196, 553, 0, 0, 0, 0, 522, 2659, 2564, 2842, 2505, 618, 2788,
+	2593, 0, 2618, 2364, 1076, 3156, 2745, 2948, 0, 0, 1019, 3163, 2052, 3249, 0, 2828,
+	2828, 3058, 2746, 0, 0, 2564, 3105, 1820, 0, 0, 2833, 2940, 2195, 2436, 244, 3234,
+	0, 1619, 1058, 682, 1956, 20, 676, 43, 2100, 2057, 2820, 697, 761, 2081, 785, 2658,
+	257, 2980, 777, 100, 740, 332, 3180, 0, 3172, 0, 922, 1810, 1154, 313, 244, 1243,
+	1428, 1388, 2988, 0, 2986, 908, 1388, 986, 819, 1212, 2996, 498, 1036, 1089, 868, 1123,
+	3300, 740, 2092, 91, 284, 394, 1562, 913, 2788, 2122, 1027, 0, 0, 322, 2300, 2905,
+	3154, 498, 2604, 1596, 1442, 2428, 2692, 194, 546, 284, 1970, 2937, 1138, 1060, 1330, 2627,
+	2996, 0, 187, 2049, 2988, 1402, 401, 0, 0, 0, 2986, 1058, 2748, 1611, 2540, 2826,
+	2865, 308, 2122, 1036, 0, 2986, 2092, 2484, 2476, 619, 1474, 0, 1938, 2572, 3172, 2947,
+	2313, 691, 289, 2994, 2938, 1044, 2324, 2932, 1643, 699, 938, 0, 2948, 220, 1772, 44,
+	706, 1402, 266, 259, 1538, 545, 993, 1484, 20, 2940, 1002, 3089, 993, 628, 1052, 2547,
+	1772, 2804, 1386, 2804, 2908, 1466, 1596, 1105, 1057, 0, 123, 2987, 1052, 1627, 322, 1546,
+	0, 1364, 1098, 2748, 2940, 2873, 2788, 195, 1338, 2947, 2828, 3017, 1507, 1442, 2066, 1052,
+	1073, 2771, 0, 0, 786, 3177, 546, 2971, 1059, 2914, 2236, 2786, 2468, 2988, 2938, 2067,
+	1058, 2132, 2626, 2425, 2067, 1684, 1105, 1571, 2947, 756, 2025, 2875, 1572, 683, 2898, 769,
+	2507, 1033, 2988, 841, 852, 1451, 628, 3243, 3244, 116, 2715, 1339, 1428, 0, 0, 1275,
+	0, 908, 2945, 3177, 316, 2803, 2876, 0, 2122, 1956, 875, 658, 819, 2114, 993, 1355,
+	1388, 292, 2299, 3236, 2771, 2034, 1233, 2700, 1969, 2604, 2564, 3234, 132, 836, 993, 0,
+	155, 3156, 571, 603, 3169, 1748, 1435, 2026, 1059, 1642, 2747, 283, 828, 73, 2234, 2577,
+	171, 3249, 1297, 1354, 916, 2954, 3156, 1098, 2843, 2826, 2890, 2363, 2066, 2825, 2524, 905,
+	1612, 1042, 1977, 0, 1036, 1700, 2507, 100, 321, 1098, 1028, 1339, 0, 996, 577, 1052,
+	883, 2922, 220, 875, 1076, 1075, 491, 1108, 1540, 1036, 1619, 194, 1524, 1980, 2916, 1140,
+	1140, 2148, 0, 2065, 2353, 0, 1132, 1052, 3011, 458, 2873, 2817, 692, 220, 2932, 0,
+	508, 0, 2098, 1035, 2698, 0, 2074, 2786, 1771, 2289, 1602, 2682, 1339, 930, 396, 3100,
+	41, 1507, 1636, 0, 737, 0, 2826, 162, 1036, 2107, 2826, 0, 0, 162, 2066, 2026,
+	1091, 1154, 1307, 2507, 1138, 628, 1804, 2065, 546, 546, 0, 2049, 3153, 2050, 3220, 1257,
+	2986, 2098, 1257, 938, 738, 812, 523, 2804, 876, 938, 2154, 916, 2659, 162, 2363, 115,
+	1484, 2932, 1770, 346, 2300, 540, 1484, 2667, 1403, 1211, 2300, 3139, 347, 1404, 1572, 0,
+	2065, 1180, 2379, 2817, 116, 3089, 2948, 2785, 2364, 2524, 2284, 2260, 385, 1482, 1442, 242,
+	0, 1020, 0, 0, 1066, 68, 994, 579, 0, 1475, 1137, 1148, 1211, 2555, 1508, 3130,
+	555, 596, 3180, 2907, 1938, 242, 0, 0, 0, 0, 2939, 0, 0, 2978, 1033, 2923,
+	2923, 3155, 819, 2051, 804, 0, 0, 988, 1612, 738, 993, 868, 2579, 521, 0, 2906,
+	0, 0, 2132, 0, 267, 1651, 2593, 84, 25, 0, 0, 2803, 0, 0, 0, 1572,
+	1348, 1715, 92, 290, 0, 689, 3171, 1057, 1097, 2436, 0, 1308, 546, 1484, 0, 0,
+	0, 0, 2986, 2570, 260, 1556, 1643, 1020, 2753, 1859, 1020, 986, 1116, 162, 2803, 1388,
+	1108, 0, 1563, 1996, 930, 2914, 0, 2804, 2524, 2747, 284, 2785, 1108, 234, 940, 697,
+	2356, 1442, 0, 604, 2049, 2044, 3004, 162, 0, 1036, 546, 2908, 1140, 1092, 1716, 1428,
+	2986, 2620, 2625, 2779, 979, 2818, 932, 0, 2633, 3145, 0, 1025, 740, 0, 0, 2697,
+	0, 2202, 1091, 0, 2836, 0, 0, 2996, 1154, 1002, 0, 76, 1674, 0, 769, 2747,
+	0, 1588, 2500, 124, 1482, 2129, 0, 0, 786, 3130, 1515, 1924, 2218, 2122, 1428, 819,
+	2803, 2788, 2833, 0, 1795, 0, 0, 0, 2826, 1428, 737, 450, 3234, 49, 3300, 3130,
+	3281, 938, 1058, 0, 1073, 0, 0, 0, 2674, 2802, 2907, 2586, 2564, 523, 1154, 34,
+	914, 2818, 1138, 2745, 75, 3217, 1804, 2628, 1708, 0, 0, 2979, 1618, 0, 0, 1708,
+	2411, 241, 2905, 804, 316, 2251, 1066, 2098, 1570, 628, 1388, 306, 3041, 938, 1098, 1779,
+	0, 860, 986, 756, 0, 100, 2555, 2777, 1060, 2785, 2114, 938, 2761, 2802, 1098, 1042,
+	1978, 2401, 321, 3140, 0, 3105, 2492, 1057, 2508, 3155, 99, 0, 0, 0, 1347, 116,
+	2876, 1954, 468, 2049, 3153, 1978, 259, 116, 2524, 1052, 954, 1123, 354, 1083, 1756, 835,
+	683, 0, 0, 2564, 436, 2785, 498, 2802, 1283, 3130, 2561, 994, 436, 1484, 1148, 1484,
+	2068, 1948, 3140, 0, 1388, 210, 2050, 0, 0, 2620, 1442, 2130, 1403, 1483, 2434, 820,
+	3130, 1945, 1108, 2106, 0, 0, 3249, 2042, 1107, 131, 1076, 883, 0, 145, 3049, 1428,
+	1386, 1507, 2403, 1618, 1076, 522, 92, 0, 1403, 0, 2802, 2010, 2148, 1466, 3284, 0,
+	1154, 2361, 2882, 0, 2828, 0, 1339, 2050, 2938, 1874, 1386, 3004, 0, 2939, 305, 1060,
+	921, 2828, 1233, 3241, 937, 2788, 2132, 905, 2793, 905, 873, 257, 2890, 2865, 2404, 1252,
+	2793, 2348, 2985, 2900, 2035, 3266, 2979, 3244, 1403, 2801, 2796, 2939, 2348, 2908, 1092, 2785,
+	307, 2420, 1193, 2947, 945, 2940, 2785, 2324, 1108, 2932, 2977, 2148, 2930, 1490, 1305, 3148,
+	0, 0, 0, 0, 2825, 0, 436, 2857, 28, 2859, 194, 355, 3090, 0, 2940, 1977,
+	1257, 2409, 1346, 2691, 2785, 1442, 2049, 2772, 1404, 586, 1596, 1340, 2747, 596, 1276, 18,
+	3027, 1036, 2940, 1668, 3244, 700, 1970, 0, 116, 1388, 1482, 1508, 905, 3139, 753, 2148,
+	3137, 1241, 298, 1132, 1154, 1060, 1442, 0, 2378, 2148, 2260, 388, 1764, 3153, 1474, 1945,
+	0, 0, 84, 2218, 2801, 1372, 2817, 737, 2130, 0, 2345, 3155, 2578, 2219, 2521, 2955,
+	1570, 1708, 124, 0, 2449, 2586, 916, 2316, 2218, 0, 513, 2042, 1089, 2579, 0, 2162,
+	1818, 1428, 546, 546, 3164, 0, 1516, 476, 2785, 875, 1058, 1772, 2940, 1780, 2987, 2739,
+	892, 3060, 2906, 436, 2802, 1091, 2667, 740, 1956, 0, 2977, 2121, 2897, 172, 124, 2420,
+	3090, 2940, 124, 0, 604, 1338, 2937, 252, 313, 2876, 2868, 2986, 2857, 0, 0, 0,
+	2564, 889, 0, 0, 0, 1468, 2828, 284, 1075, 2577, 1980, 3035, 2874, 2802, 1796, 0,
+	0, 0, 0, 0, 1612, 1060, 1843, 993, 1001, 2739, 2978, 3058, 116, 1611, 2073, 2828,
+	676, 2940, 2577, 1372, 2971, 0, 1108, 2388, 2948, 1059, 0, 2524, 0, 0, 1708, 2739,
+	1620, 2524, 2940, 2353, 2785, 1058, 1508, 2977, 1572, 3091, 2540, 3156, 124, 1386, 0, 0,
+	0, 0, 0, 0, 0, 2084, 860, 2785, 3140, 2969, 1804, 1164, 2828, 2923, 2828, 3153,
+	1762, 0, 2497, 1467, 290, 1612, 2148, 473, 2363, 0, 0, 0, 2524, 2828, 162, 555,
+	3266, 0, 2436, 2386, 916, 2577, 779, 0, 0, 0, 1700, 1612, 2890, 1596, 1076, 435,
+	1154, 940, 692, 2418, 283, 2404, 1884, 2018, 1556, 0, 0, 0, 0, 2940, 322, 0,
+	1257, 82, 1370, 1211, 2348, 116, 2538, 786, 1980, 2940, 2802, 1772, 2954, 3179, 378, 706,
+	2868, 1995, 2779, 1418, 202, 3260, 3297, 124, 2924, 1018, 1924, 2857, 0, 1371, 2108, 2820,
+	1089, 890, 0, 0, 2906, 2882, 3177, 962, 2954, 2785, 0, 0, 1402, 2803, 1018, 2945,
+	0, 1404, 2363, 202, 92, 1075, 2436, 676, 532, 0, 52, 2986, 0, 0, 1723, 1371,
+	2940, 468, 0, 258, 275, 761, 1108, 1756, 0, 0, 0, 1419, 1668, 2979, 0, 1452,
+	914, 0, 2972, 1108, 307, 2196, 1834, 0, 0, 980, 2628, 0, 17, 841, 129, 162,
+	2114, 0, 2436, 371, 1035, 275, 740, 1033, 628, 2748, 698, 2578, 0, 1498, 940, 2971,
+	1035, 0, 2986, 3251, 2908, 2122, 3124, 1123, 2570, 0, 0, 0, 0, 0, 0, 2692,
+	1434, 1123, 3091, 2841, 996, 0, 2868, 0, 0, 0, 436, 2107, 1668, 0, 3049, 108,
+	305, 0, 0, 2908, 786, 1668, 92, 1147, 546, 3124, 0, 2778, 2908, 0, 1154, 2801,
+	2570, 915, 0, 531, 1060, 1098, 1204, 3275, 0, 2828, 1332, 674, 1052, 2788, 1804, 1610,
+	2162, 428, 2946, 1612, 0, 1154, 2129, 2658, 2732, 3129, 1387, 2378, 1244, 2801, 3130, 3153,
+	2635, 2433, 92, 2932, 1988, 260, 996, 1228, 1129, 25, 378, 2066, 92, 49, 698, 1209,
+	2706, 2706, 3298, 1442, 0, 875, 2905, 2420, 987, 1428, 2345, 2500, 0, 92, 2196, 586,
+	162, 1410, 2067, 692, 1060, 3251, 1033, 938, 1386, 2994, 3004, 2857, 259, 522, 1370, 1107,
+	314, 2500, 2043, 2923, 1081, 1017, 1020, 2593, 2236, 2763, 2954, 2178, 2946, 2420, 2946, 1154,
+	2698, 2874, 1065, 3161, 2092, 3180, 537, 0, 2980, 0, 0, 2938, 2419, 2940, 1668, 0,
+	0, 2148, 2817, 2778, 809, 2955, 2650, 2419, 1770, 809, 2564, 2769, 1138, 259, 1995, 3234,
+	993, 1731, 2906, 827, 2987, 986, 0, 2497, 305, 996, 2916, 2761, 2804, 2010, 2218, 1474,
+	1355, 2361, 2817, 3058, 908, 674, 915, 257, 3108, 0, 2563, 3180, 1834, 916, 2986, 3234,
+	2980, 1388, 1052, 2785, 2801, 258, 1402, 0, 2497, 1132, 2042, 2122, 819, 3243, 2986, 0,
+	0, 2202, 1827, 1586, 49, 1130, 0, 2868, 2018, 124, 1572, 0, 0, 0, 0, 2938,
+	2986, 0, 2018, 2129, 83, 1036, 0, 0, 0, 172, 1562, 1324, 2674, 2778, 1388, 1442,
+	0, 1060, 1164, 3257, 619, 1154, 468, 92, 0, 0, 0, 0, 0, 1324, 145, 2538,
+	2674, 2881, 0, 0, 0, 0, 0, 620, 0, 0, 2540, 116, 2673, 2324, 196, 2674,
+	1619, 1105, 1515, 0, 0, 3108, 115, 1058, 3073, 2873, 1388, 0, 0, 2540, 2969, 2435,
+	0, 0, 626, 0, 0, 0, 0, 2114, 1506, 3140, 2698, 833, 2987, 1371, 162, 1747,
+	1986, 1404, 2587, 1402, 2753, 481, 1388, 2650, 2715, 3172, 769, 2842, 36, 676, 1972, 162,
+	2706, 2433, 2938, 162, 2092, 2667, 819, 2658, 914, 298, 1098, 1020, 2844, 532, 249, 572,
+	1978, 2251, 1428, 2411, 1907, 524, 2986, 354, 2218, 1193, 2586, 402, 1994, 363, 1484, 2658,
+	3148, 1388, 2284, 1929, 2497, 0, 481, 994, 2940, 2804, 2828, 1506, 1452, 0, 2578, 764,
+	0, 2578, 0, 0, 0, 2978, 1714, 0, 771, 1164, 308, 825, 2731, 1388, 1450, 1428,
+	2794, 89, 27, 2988, 1138, 2226, 2890, 3241, 450, 196, 3083, 2969, 740, 2251, 0, 2786,
+	2436, 1091, 1091, 2865, 3116, 0, 0, 2476, 290, 675, 1058, 3153, 0, 836, 2780, 0,
+	2092, 2436, 905, 2706, 586, 3243, 2162, 1684, 740, 1442, 1058, 2857, 2875, 1706, 2897, 1100,
+	1388, 458, 2234, 2993, 1515, 2403, 1387, 1412, 811, 2836, 2825, 2099, 2092, 284, 2978, 172,
+	1290, 2148, 20, 2097, 2073, 332, 1956, 1316, 2937, 849, 2411, 1985, 0, 3172, 1026, 1033,
+	994, 92, 0, 0, 3089, 1060, 835, 2785, 779, 250, 1540, 3180, 2691, 3220, 2801, 1346,
+	0, 0, 0, 3156, 20, 2803, 889, 2786, 0, 2691, 195, 2316, 2801, 1100, 700, 2154,
+	0, 2924, 491, 1066, 1371, 2906, 1482, 2690, 2954, 1980, 1508, 1388, 139, 0, 1572, 58,
+	1028, 0, 2924, 937, 379, 938, 1820, 322, 1388, 2587, 1018, 116, 49, 284, 2916, 458,
+	42, 2882, 0, 3241, 457, 2163, 73, 450, 2731, 2564, 82, 761, 2906, 2785, 3180, 2899,
+	676, 2980, 25, 2690, 1602, 2388, 1108, 835, 1060, 2082, 1091, 2906, 2788, 1188, 1619, 2876,
+	2361, 2772, 2065, 1020, 2196, 3140, 2625, 1154, 2826, 2052, 34, 1588, 835, 0, 2593, 674,
+	1140, 260, 2484, 116, 1572, 2492, 835, 979, 1004, 1508, 922, 1066, 2138, 753, 1025, 171,
+	835, 705, 1684, 20, 2955, 2484, 1412, 1098, 308, 1098, 321, 2020, 289, 2906, 587, 524,
+	0, 1412, 2804, 129, 2844, 1603, 2932, 1612, 2052, 2052, 2772, 2828, 2988, 2060, 298, 2923,
+	2953, 2914, 1058, 3249, 2873, 1642, 1473, 1179, 2923, 2907, 2547, 876, 1028, 2954, 2411, 242,
+	1402, 0, 2874, 354, 284, 1772, 2132, 1626, 1052, 2986, 3107, 994, 234, 129, 2066, 2785,
+	1083, 1249, 1546, 1563, 3107, 123, 1057, 1154, 1722, 116, 2420, 2492, 1668, 1428, 1636, 1668,
+	2785, 258, 2130, 1092, 1052, 2801, 2868, 1827, 2658, 986, 2988, 0, 313, 162, 3275, 537,
+	3233, 1057, 2060, 0, 2844, 1036, 2418, 1257, 0, 601, 2922, 2986, 76, 1098, 3132, 1065,
+	2419, 523, 571, 394, 740, 1642, 3137, 3139, 0, 2908, 2083, 921, 819, 2081, 1524, 852,
+	1324, 2260, 667, 451, 2906, 817, 1098, 849, 890, 2555, 2771, 3148, 1804, 540, 1331, 2564,
+	436, 2897, 883, 0, 0, 521, 0, 1618, 1097, 1642, 1139, 2986, 3137, 3124, 3092, 2841,
+	0, 65, 938, 828, 978, 1354, 2780, 161, 1233, 1484, 420, 1402, 2937, 2084, 2434, 0,
+	2876, 1105, 2097, 1035, 2524, 362, 609, 1466, 0, 1730, 2578, 475, 2747, 763, 458, 1388,
+	177, 2804, 1930, 1324, 3177, 1795, 1010, 2954, 2804, 1340, 1666, 52, 0, 875, 115, 737,
+	1052, 2940, 1452, 2913, 2945, 1148, 1050, 298, 580, 626, 0, 2907, 3220, 3092, 2051, 2986,
+	2140, 1050, 1804, 1026, 1139, 2388, 0, 0, 1970, 1650, 210, 1474, 1386, 361, 0, 433,
+	2364, 473, 2050, 0, 1332, 1442, 1419, 2202, 2986, 2940, 539, 2051, 2938, 1778, 737, 1075,
+	2898, 681, 2260, 2801, 0, 0, 116, 2418, 2028, 1778, 3156, 2594, 2627, 2627, 2236, 2940,
+	1428, 28, 938, 2114, 1388, 873, 3244, 2524, 2996, 2900, 242, 2731, 1145, 2651, 2979, 1036,
+	1075, 2258, 1562, 1139, 3241, 1137, 25, 2540, 1330, 1044, 2139, 265, 620, 1241, 1740, 195,
+	2618, 2867, 1132, 1026, 2052, 1098, 1570, 2905, 0, 3155, 2690, 0, 20, 1938, 204, 2586,
+	643, 1044, 2050, 330, 2555, 3234, 1844, 2674, 2401, 1475, 129, 1386, 1554, 2833, 226, 1026,
+	1587, 777, 1402, 492, 3107, 3241, 0, 0, 3156, 52, 436, 2121, 0, 1466, 2801, 692,
+	890, 298, 1132, 628, 313, 3004, 978, 2923, 2897, 2922, 2658, 3092, 2980, 2884, 2923, 1212,
+	1020, 1346, 3004, 290, 0, 0, 2404, 0, 1818, 1650, 977, 361, 3011, 2873, 1108, 3234,
+	2985, 2577, 1193, 2114, 0, 298, 1129, 2884, 3145, 313, 1929, 2084, 0, 2130, 1338, 2940,
+	2218, 2497, 2065, 2500, 0, 666, 0, 1602, 1004, 0, 0, 908, 2084, 332, 2148, 604,
+	1388, 52, 1100, 2865, 1508, 0, 3011, 3161, 996, 2947, 2028, 3155, 2067, 0, 761, 1076,
+	3180, 3180, 1259, 1804, 2260, 3058, 35, 3156, 820, 2940, 305, 1057, 3177, 1355, 2196, 2218,
+	3145, 1700, 220, 0, 0, 2938, 1154, 138, 298, 1164, 580, 2747, 2940, 3130, 2906, 0,
+	2297, 1498, 2018, 3123, 914, 2988, 468, 3124, 690, 2348, 1442, 2564, 2129, 1562, 2932, 82,
+	876, 843, 1715, 786, 0, 2418, 1209, 2555, 394, 3172, 2570, 1276, 2100, 2865, 587, 220,
+	1019, 401, 2291, 3148, 2066, 1105, 3249, 2747, 0, 0, 2788, 1700, 2042, 2513, 1140, 3137,
+	2377, 2593, 65, 2564, 2068, 2761, 2218, 1508, 994, 2515, 3161, 2042, 1636, 1105, 2377, 1612,
+	2436, 1442, 1371, 1083, 1378, 3156, 539, 0, 2299, 833, 676, 1588, 2540, 1075, 2586, 2828,
+	1257, 2778, 674, 1508, 193, 234, 1442, 2937, 402, 3010, 1602, 2988, 3156, 2939, 475, 1052,
+	2746, 2578, 2324, 2828, 2515, 2507, 2065, 1450, 2940, 0, 1372, 1386, 692, 1428, 1436, 2804,
+	2820, 1905, 1610, 2801, 2170, 3204, 2465, 2906, 124, 1442, 978, 2050, 1420, 67, 116, 994,
+	994, 0, 220, 1956, 2114, 1650, 1132, 172, 1586, 2299, 2748, 0, 0, 1386, 2139, 0,
+	1042, 2811, 0, 2420, 2954, 0, 1715, 1026, 1132, 2905, 0, 2284, 2682, 2828, 3130, 1594,
+	2788, 1554, 0, 1026, 2578, 2820, 2932, 116, 1506, 674, 1388, 435, 337, 492, 522, 1292,
+	330, 2801, 260, 1610, 2068, 2122, 3140, 0, 0, 0, 996, 761, 307, 852, 1684, 162,
+	1004, 811, 2922, 1572, 2739, 0, 0, 0, 2234, 2882, 3145, 1642, 1083, 0, 3108, 3298,
+	3004, 1428, 0, 3172, 116, 2196, 2988, 0, 388, 659, 2940, 1611, 2108, 0, 2739, 1060,
+	171, 0, 137, 674, 3004, 1386, 674, 2130, 739, 658, 625, 3145, 2625, 2988, 1108, 2051,
+	1138, 1330, 283, 91, 1828, 2940, 2867, 1674, 2890, 738, 0, 1810, 2649, 107, 3091, 2745,
+	1209, 2921, 1908, 2817, 811, 2586, 876, 1036, 2561, 0, 2922, 457, 2052, 1107, 1524, 1612,
+	1612, 1073, 1484, 674, 1905, 1610, 1098, 739, 140, 1028, 2521, 2922, 1804, 1105, 1403, 162,
+	1073, 2619, 1442, 3275, 2417, 2947, 492, 322, 177, 1636, 2907, 1339, 314, 1089, 2465, 2137,
+	1804, 1508, 0, 2417, 1508, 3178, 0, 321, 1148, 1123, 659, 2940, 2260, 187, 2194, 738,
+	1338, 2540, 2986, 2978, 531, 1442, 3180, 2564, 2018, 3099, 1089, 370, 172, 1252, 444, 0,
+	915, 915, 1675, 996, 817, 521, 738, 2876, 1610, 1586, 1348, 836, 3124, 2564, 2988, 3252,
+	1386, 1484, 2778, 1370, 1059, 1388, 1386, 0, 2025, 2915, 2716, 2706, 1969, 0, 3124, 875,
+	0, 2866, 1706, 2148, 2747, 3145, 569, 2747, 162, 0, 1020, 2876, 3033, 1388, 2907, 1026,
+	2884, 994, 83, 2163, 2817, 2028, 1420, 3169, 2940, 2868, 1508, 1204, 332, 0, 1700, 914,
+	275, 1484, 3107, 2564, 737, 977, 3081, 2082, 2524, 2009, 860, 0, 1041, 330, 0, 658,
+	658, 2251, 2051, 2500, 1138, 0, 2907, 76, 2932, 3241, 1740, 364, 52, 209, 2620, 916,
+	3298, 52, 3130, 2716, 809, 116, 660, 3180, 2780, 2754, 3156, 3172, 1484, 2754, 883, 2122,
+	1324, 3027, 2515, 1618, 523, 2052, 210, 1996, 1402, 2417, 1466, 2524, 2052, 2996, 706, 2865,
+	1154, 524, 1988, 859, 1827, 2196, 3140, 756, 1980, 2579, 275, 379, 937, 3201, 1668, 138,
+	2052, 2420, 115, 1154, 2500, 0, 841, 1700, 1035, 2785, 660, 2857, 1674, 0, 2786, 3156,
+	2268, 1138, 546, 3132, 2380, 1603, 116, 916, 2986, 2804, 1937, 1762, 194, 172, 0, 2051,
+	1060, 3234, 1484, 1164, 2804, 2785, 187, 2755, 3154, 3244, 1305, 401, 2627, 332, 521, 379,
+	2121, 3130, 3089, 2226, 147, 1058, 2785, 3177, 1154, 786, 1057, 457, 289, 2556, 2276, 2811,
+	1027, 2050, 3180, 2547, 249, 2763, 1209, 1204, 835, 753, 676, 401, 210, 3156, 259, 1370,
+	2857, 3100, 3130, 2986, 876, 817, 3033, 473, 1052, 2513, 2580, 833, 2788, 1554, 618, 44,
+	1980, 2780, 19, 1602, 1980, 1602, 2915, 3156, 162, 2954, 2746, 2171, 1338, 2905, 259, 2138,
+	3139, 2042, 0, 2570, 692, 2435, 0, 484, 450, 2577, 2626, 307, 2564, 1067, 2484, 1026,
+	1419, 0, 0, 289, 1108, 628, 825, 738, 620, 0, 628, 105, 2593, 524, 0, 524,
+	172, 2731, 3124, 1498, 2050, 1684, 2068, 0, 3249, 2513, 0, 2978, 3169, 2564, 0, 2524,
+	172, 2786, 1083, 212, 740, 2610, 284, 740, 692, 2779, 2785, 2915, 1652, 1939, 1563, 2337,
+	1602, 211, 2634, 1179, 60, 2819, 2836, 2052, 0, 0, 2379, 1020, 1826, 2818, 290, 473,
+	705, 2947, 34, 2163, 2212, 1554, 676, 2129, 2419, 938, 124, 468, 1668, 515, 0, 0,
+	1289, 0, 244, 619, 2979, 932, 0, 841, 2884, 1372, 1107, 2051, 2129, 2739, 2937, 1418,
+	0, 0, 2906, 2940, 2946, 2050, 3130, 2788, 2940, 2930, 2778, 3153, 3156, 915, 388, 737,
+	378, 2018, 1275, 322, 0, 2707, 2114, 401, 777, 1265, 2129, 2129, 3153, 1604, 1388, 3169,
+	2564, 3153, 836, 1411, 993, 1324, 531, 396, 2953, 0, 0, 2050, 3234, 244, 1572, 586,
+	2945, 250, 2260, 955, 2251, 737, 1332, 2844, 1073, 2940, 1587, 0, 1562, 1060, 2553, 916,
+	0, 1388, 3243, 3267, 2922, 785, 1386, 2051, 820, 1388, 153, 2553, 0, 0, 2524, 324,
+	1073, 2826, 92, 2867, 1116, 2042, 1442, 2810, 3300, 540, 378, 2107, 1714, 3097, 1516, 2938,
+	2379, 2986, 1002, 1386, 1913, 0, 0, 1386, 0, 0, 2467, 0, 2940, 1820, 2497, 1260,
+	740, 2937, 513, 2162, 220, 0, 2618, 2098, 131, 2540, 2746, 609, 2324, 20, 2052, 3291,
+	1283, 691, 0, 2948, 0, 2315, 580, 1036, 2828, 3058, 2578, 2586, 3156, 2940, 738, 626,
+	0, 1164, 1065, 242, 2802, 1556, 0, 116, 1442, 1098, 1300, 1066, 0, 297, 1348, 2841,
+	692, 1514, 3091, 938, 1057, 1771, 2954, 2820, 2610, 1355, 3058, 1298, 0, 2066, 1138, 1994,
+	674, 2666, 1435, 1610, 3234, 2826, 996, 1610, 1097, 3018, 402, 1388, 2162, 3178, 2946, 916,
+	0, 2940, 1490, 3004, 2162, 1442, 1788, 2988, 1892, 0, 2940, 1892, 2940, 2066, 2794, 331,
+	2946, 1612, 2785, 1700, 1187, 3267, 2794, 2906, 2674, 2617, 2777, 2555, 2946, 314, 3171, 1563,
+	2994, 1884, 1626, 3051, 2731, 1386, 2129, 1700, 2418, 116, 3241, 76, 0, 1148, 2811, 1298,
+	1924, 1289, 2890, 3092, 2922, 1305, 1033, 2785, 626, 2914, 2634, 2978, 1154, 1386, 0, 1386,
+	297, 1060, 995, 3108, 739, 266, 859, 1138, 1602, 265, 2580, 1674, 2841, 1387, 2905, 2513,
+	2417, 2940, 156, 401, 986, 2731, 524, 1057, 786, 914, 162, 2857, 1450, 194, 194, 2940,
+	2874, 2906, 3051, 916, 2970, 3249, 0, 1193, 2986, 2049, 3132, 1538, 0, 0, 2467, 1108,
+	860, 2042, 1436, 0, 2650, 1081, 1324, 2940, 2969, 396, 2907, 1098, 2889, 2748, 2803, 1818,
+	740, 786, 0, 1668, 3180, 1706, 2803, 2754, 1388, 194, 1636, 1073, 1772, 252, 2729, 2868,
+	1884, 1548, 3281, 1188, 1169, 922, 0, 0, 2988, 2748, 3178, 0, 0, 2940, 0, 537,
+	738, 115, 3179, 3243, 2436, 2794, 1770, 0, 1091, 2890, 313, 1844, 2218, 3156, 2305, 0,
+	2361, 2988, 0, 1105, 0, 1484, 913, 137, 2940, 3284, 3108, 2988, 2731, 1770, 859, 1154,
+	107, 194, 0, 620, 2052, 2921, 1300, 2250, 986, 2890, 2828, 0, 1300, 0, 2826, 162,
+	1212, 433, 2868, 59, 1905, 3251, 0, 2620, 331, 306, 1795, 860, 706, 2828, 513, 2746,
+	1154, 1300, 3084, 2284, 619, 1442, 1602, 0, 891, 1602, 1466, 0, 2956, 0, 860, 420,
+	1386, 586, 0, 129, 2065, 2785, 0, 498, 498, 2804, 1402, 0, 2380, 2826, 2417, 2748,
+	0, 0, 940, 2978, 1484, 1332, 2955, 2411, 1148, 2052, 1075, 3012, 0, 2052, 0, 1436,
+	1058, 1546, 362, 1779, 145, 1388, 1442, 769, 298, 2873, 2803, 994, 113, 3266, 467, 467,
+	1044, 2289, 284, 2618, 0, 1876, 3156, 1450, 692, 1091, 857, 2786, 1434, 2873, 2202, 2595,
+	1979, 2836, 2364, 3156, 2716, 2667, 2625, 2937, 2828, 1979, 2922, 2922, 1884, 932, 1810, 2948,
+	675, 1714, 2921, 2732, 2995, 2794, 3172, 2995, 2420, 1620, 2785, 1060, 2594, 692, 2884, 1770,
+	394, 1612, 124, 1076, 1698, 2988, 628, 3155, 2194, 2868, 1524, 1036, 2892, 1730, 916, 1066,
+	580, 1004, 2673, 2017, 420, 2785, 2508, 1610, 2836, 2780, 2114, 3113, 2594, 2844, 1132, 1140,
+	1044, 2618, 1554, 2908, 1057, 2428, 1371, 2731, 284, 196, 1100, 2980, 1035, 3091, 2524, 786,
+	1731, 2788, 0, 601, 306, 2746, 3130, 883, 273, 305, 3049, 1036, 1490, 1418, 1354, 2705,
+	1033, 2780, 44, 2388, 2538, 1548, 2580, 2836, 1115, 26, 2564, 258, 2748, 2683, 1060, 290,
+	284, 2988, 2803, 2833, 0, 0, 0, 1731, 0, 2908, 2122, 1081, 2507, 1164, 1418, 1138,
+	0, 1555, 1428, 0, 332, 307, 2810, 2097, 1587, 2436, 251, 307, 834, 2986, 2945, 0,
+	1450, 1354, 2436, 3130, 2465, 1033, 0, 0, 628, 0, 2348, 3252, 1154, 1164, 2681, 1474,
+	2746, 313, 3180, 1428, 0, 3130, 3123, 0, 2940, 329, 1770, 161, 2529, 2939, 932, 2900,
+	1018, 1556, 1556, 2130, 1355, 930, 3161, 1642, 2802, 3140, 2435, 3298, 3180, 828, 2876, 2940,
+	3156, 2826, 1108, 194, 0, 172, 1410, 3153, 1060, 2731, 860, 1137, 1116, 20, 740, 876,
+	988, 2908, 2251, 3156, 132, 2938, 2555, 546, 876, 2412, 2892, 292, 2386, 2106, 0, 0,
+	379, 978, 572, 297, 2747, 2234, 2435, 185, 1058, 3018, 2050, 2905, 740, 2988, 738, 2028,
+	3153, 2579, 3298, 283, 2130, 2980, 938, 988, 875, 628, 1084, 3011, 2668, 441, 2673, 740,
+	3298, 994, 0, 162, 3121, 1155, 2585, 1154, 740, 1026, 377, 2971, 371, 2555, 306, 2065,
+	185, 2818, 1554, 193, 2052, 1076, 116, 1057, 3154, 3178, 2130, 3107, 1058, 121, 0, 1388,
+	1388, 3004, 2138, 297, 740, 244, 2588, 2420, 924, 2092, 2050, 162, 1700, 2668, 330, 420,
+	3004, 3153, 290, 332, 116, 1602, 50, 2626, 1642, 1427, 707, 297, 2124, 2634, 738, 1316,
+	1075, 0, 0, 0, 3140, 2122, 3300, 308, 1298, 1428, 92, 588, 2779, 0, 3234, 1484,
+	2585, 0, 330, 1411, 2627, 1307, 266, 1154, 2674, 1020, 692, 116, 0, 2793, 2772, 1060,
+	2132, 1299, 994, 2121, 2540, 185, 0, 2124, 1980, 1938, 2716, 2922, 2218, 2889, 420, 546,
+	308, 450, 1604, 2875, 619, 138, 3132, 330, 260, 876, 596, 3260, 516, 1330, 2610, 3004,
+	2138, 3178, 1442, 289, 3139, 740, 2388, 2635, 1265, 18, 0, 2114, 2436, 906, 2363, 2724,
+	3107, 1467, 1129, 1388, 0, 377, 2218, 3004, 1154, 1195, 675, 2050, 978, 738, 1482, 978,
+	2706, 1642, 2626, 1148, 2051, 3147, 2108, 819, 2626, 1346, 1572, 2948, 1484, 2993, 1138, 1980,
+	0, 2826, 124, 1041, 3177, 2218, 2307, 2777, 244, 1233, 2364, 1970, 1556, 2857, 0, 401,
+	1233, 3203, 258, 2497, 313, 2540, 92, 1180, 0, 3156, 2748, 1642, 1442, 3273, 1804, 1442,
+	2052, 3004, 0, 2940, 2787, 290, 0, 2219, 290, 1834, 2978, 1060, 162, 683, 0, 0,
+	418, 523, 1089, 2986, 938, 2868, 2988, 2129, 0, 60, 809, 1123, 0, 2900, 2436, 2978,
+	2508, 2932, 204, 2922, 2436, 2906, 2452, 1420, 401, 2988, 162, 2538, 0, 2908, 1372, 1434,
+	2617, 586, 3004, 1059, 0, 3010, 0, 0, 1137, 1139, 329, 290, 817, 2812, 2803, 25,
+	875, 2987, 1371, 0, 2674, 290, 2842, 2122, 924, 0, 483, 187, 523, 2907, 3241, 0,
+	2953, 258, 0, 1386, 2555, 1539, 1539, 0, 2586, 1954, 1474, 2049, 450, 2674, 628, 194,
+	1098, 2938, 1058, 483, 1154, 115, 1372, 2940, 378, 378, 2028, 1386, 3027, 2572, 2028, 418,
+	1140, 2868, 676, 0, 2868, 660, 1050, 3177, 2163, 666, 1145, 913, 1410, 3153, 1612, 2985,
+	0, 226, 1586, 2945, 1619, 2674, 1298, 0, 0, 1612, 2218, 2988, 2073, 1610, 1138, 1979,
+	1107, 2740, 1060, 1602, 1076, 2884, 84, 763, 259, 1388, 1387, 2122, 612, 2956, 3011, 290,
+	3155, 2163, 0, 1524, 1177, 875, 3004, 1036, 1980, 242, 619, 258, 2345, 2420, 2388, 2842,
+	2954, 2420, 308, 2932, 914, 692, 2932, 2907, 3276, 2513, 1105, 620, 2804, 857, 2593, 2092,
+	259, 914, 1604, 3004, 420, 2068, 1107, 2364, 1683, 2993, 0, 1969, 3148, 3156, 378, 2987,
+	1674, 2732, 1084, 2049, 2524, 2003, 2626, 1283, 420, 2540, 0, 1097, 1076, 42, 1091, 2932,
+	0, 2932, 1466, 3050, 82, 1402, 0, 1018, 1516, 2746, 2803, 2643, 162, 3148, 3178, 89,
+	1602, 2827, 1905, 2977, 0, 2819, 1388, 3090, 1610, 0, 2930, 0, 0, 2025, 2827, 0,
+	0, 0, 2364, 3233, 0, 2364, 1154, 1060, 1097, 0, 1795, 42, 332, 2780, 859, 2828,
+	2651, 2884, 484, 3105, 2579, 1969, 2826, 2868, 2804, 2500, 1268, 3148, 2778, 1049, 2268, 2755,
+	585, 1018, 1316, 740, 348, 2802, 2098, 2090, 1338, 0, 2900, 2953, 2148, 921, 379, 3156,
+	0, 2747, 2906, 2812, 2940, 1771, 3148, 348, 0, 2418, 553, 3243, 1154, 2868, 2994, 0,
+	0, 2867, 492, 2626, 788, 2938, 978, 2937, 0, 1387, 1257, 2803, 2537, 2788, 2876, 0,
+	0, 521, 1330, 3169, 1780, 298, 1076, 116, 3204, 1442, 932, 76, 2586, 305, 1540, 2804,
+	2460, 2969, 2129, 0, 2042, 1036, 2746, 2939, 2932, 0, 284, 930, 145, 0, 2804, 258,
+	1044, 0, 916, 394, 3153, 2050, 1298, 2226, 0, 2953, 2850, 0, 994, 435, 0, 2148,
+	522, 2780, 2121, 0, 2908, 1418, 114, 0, 145, 0, 2993, 1892, 82, 2955, 978, 394,
+	2060, 2618, 2988, 1370, 82, 0, 1060, 738, 2804, 226, 993, 2324, 105, 2105, 2987, 2713,
+	19, 914, 476, 786, 522, 1052, 1937, 0, 3217, 1442, 1546, 1548, 1402, 2817, 2883, 3140,
+	2028, 740, 1842, 2788, 604, 476, 3011, 2804, 2947, 2433, 604, 108, 996, 691, 692, 3018,
+	92, 689, 2801, 2420, 1619, 3107, 3107, 3105, 1036, 739, 2731, 1667, 2082, 1419, 0, 1636,
+	993, 978, 2986, 2050, 620, 34, 0, 52, 524, 2876, 524, 116, 3172, 1946, 2642, 2938,
+	0, 1066, 3156, 2674, 2826, 476, 2634, 2828, 268, 2995, 859, 1411, 107, 0, 1484, 1058,
+	2876, 2436, 585, 2513, 994, 3012, 259, 73, 2218, 626, 2761, 52, 706, 2985, 3132, 698,
+	859, 171, 786, 609, 1026, 586, 2619, 162, 2068, 1428, 1466, 2748, 3108, 1338, 2537, 1700,
+	116, 2706, 3180, 545, 171, 1138, 2028, 2794, 2747, 2028, 457, 673, 257, 996, 3018, 0,
+	0, 0, 0, 0, 674, 2828, 978, 306, 82, 2946, 0, 1113, 162, 2251, 323, 2953,
+	2937, 755, 1305, 3011, 3139, 2899, 1137, 988, 1642, 57, 786, 124, 3233, 932, 3139, 2411,
+	803, 116, 619, 378, 340, 2300, 298, 2162, 291, 1572, 1954, 2745, 1979, 739, 3233, 2049,
+	1434, 2937, 1594, 2778, 2052, 546, 291, 2794, 938, 2307, 841, 986, 41, 739, 2081, 1044,
+	1977, 2906, 2497, 2786, 1650, 1299, 786, 0, 44, 2299, 2467, 1474, 3139, 1036, 258, 0,
+	1436, 1698, 916, 586, 1108, 1618, 674, 628, 273, 978, 978, 2988, 2884, 1945, 113, 273,
+	2979, 2938, 2884, 2284, 2868, 1388, 1388, 2996, 604, 1052, 2348, 1378, 2033, 993, 890, 172,
+	2258, 2748, 2513, 28, 2986, 2809, 962, 2914, 2817, 2922, 0, 116, 0, 962, 2594, 1450,
+	0, 3180, 0, 2788, 3036, 2940, 580, 2994, 1132, 0, 162, 2618, 2955, 0, 2938, 1778,
+	2380, 100, 825, 67, 1668, 753, 644, 2387, 0, 3156, 2916, 1076, 2996, 2476, 2618, 2747,
+	2892, 3156, 2940, 2195, 2420, 994, 1740, 2929, 1076, 2539, 2955, 83, 994, 994, 2932, 0,
+	2916, 1402, 2785, 644, 601, 3035, 3180, 2955, 2955, 1107, 362, 476, 0, 1276, 2940, 2932,
+	1075, 644, 1818, 394, 2067, 2884, 161, 1611, 2476, 1666, 1410, 2051, 2051, 2427, 738, 162,
+	108, 138, 2939, 2748, 1018, 674, 2050, 1570, 740, 34, 35, 740, 2050, 2154, 2706, 2940,
+	162, 1986, 50, 0, 2874, 0, 0, 2988, 306, 1482, 2938, 1388, 0, 1795, 2788, 2778,
+	0, 1372, 2041, 3233, 3281, 3234, 265, 28, 658, 2988, 1380, 740, 3090, 1042, 379, 2513,
+	113, 116, 3090, 0, 938, 1388, 0, 916, 3027, 834, 298, 1474, 1668, 1612, 1548, 44,
+	3130, 3178, 1026, 674, 516, 2658, 0, 586, 2772, 2748, 1060, 308, 1434, 129, 1466, 1075,
+	1804, 1506, 2401, 0, 841, 1804, 2940, 1257, 2730, 2713, 2060, 162, 1201, 1442, 764, 841,
+	906, 1289, 962, 1297, 3058, 2649, 1346, 116, 1020, 2028, 2923, 2732, 2620, 2539, 1265, 604,
+	43, 1076, 1666, 1300, 1276, 28, 1540, 2107, 2081, 0, 1203, 932, 619, 2801, 1706, 2553,
+	1100, 1977, 1913, 2505, 266, 1804, 1554, 2505, 396, 2801, 1316, 0, 522, 2034, 2634, 3266,
+	2771, 692, 188, 1970, 2289, 0, 2226, 2050, 450, 1930, 162, 1554, 3251, 396, 1300, 1060,
+	1338, 0, 1602, 1618, 1930, 1482, 3275, 1129, 1450, 2939, 2754, 1388, 1388, 3084, 3179, 1042,
+	2402, 308, 2844, 2739, 569, 1052, 1979, 993, 1588, 283, 1588, 273, 1138, 1844, 0, 2940,
+	2234, 1442, 2900, 0, 2052, 3241, 0, 76, 817, 3058, 1100, 2986, 2098, 92, 49, 2706,
+	2913, 2082, 2979, 3156, 1100, 1668, 2410, 2364, 2050, 2364, 1611, 819, 2938, 812, 812, 2667,
+	737, 2882, 2932, 2650, 2634, 1674, 1450, 193, 1386, 2433, 1484, 1052, 452, 1922, 1450, 1140,
+	3108, 1138, 3145, 3266, 2804, 3156, 0, 0, 1324, 0, 0, 1324, 2865, 812, 626, 1682,
+	3164, 2618, 2994, 3105, 812, 2761, 1346, 2986, 2513, 3091, 906, 1002, 3107, 265, 1474, 260,
+	3156, 2748, 2874, 3051, 1642, 873, 2521, 0, 0, 2497, 620, 226, 1283, 2610, 1747, 1354,
+	1483, 2938, 2828, 2907, 2106, 2041, 322, 2802, 859, 1098, 1332, 1602, 2932, 265, 1388, 2948,
+	377, 2121, 2610, 2986, 0, 0, 468, 588, 978, 0, 2788, 0, 2050, 0, 2994, 1058,
+	3012, 683, 817, 922, 3140, 2148, 0, 0, 1100, 1978, 764, 2874, 2409, 2418, 2083, 394,
+	546, 162, 537, 2731, 394, 3155, 58, 2779, 83, 476, 50, 2658, 0, 817, 1132, 876,
+	396, 2979, 2994, 1355, 1138, 738, 1804, 626, 626, 2843, 1188, 2908, 2674, 2035, 107, 1650,
+	2476, 2908, 2050, 2994, 137, 0, 2873, 986, 1026, 2921, 1148, 1298, 628, 1058, 1668, 314,
+	83, 2780, 3140, 2868, 2564, 308, 2785, 402, 1538, 1252, 2908, 194, 0, 940, 513, 2162,
+	2658, 2988, 2812, 1730, 2484, 698, 2042, 1442, 43, 1018, 2938, 1018, 1602, 2953, 1371, 2908,
+	83, 546, 1442, 2417, 1089, 1428, 1113, 1138, 2617, 1980, 771, 2817, 2721, 348, 522, 1018,
+	2923, 1388, 1610, 993, 2409, 1065, 2946, 2745, 0, 1994, 1484, 1442, 2940, 186, 2364, 993,
+	2434, 2705, 1668, 1002, 2644, 155, 1970, 1042, 737, 891, 172, 1386, 260, 1978, 450, 1602,
+	2555, 2076, 3154, 1292, 114, 42, 1602, 2804, 1260, 2666, 2681, 2747, 2801, 0, 2681, 1355,
+	259, 1772, 1772, 1386, 571, 1140, 2068, 162, 2356, 3089, 2595, 2068, 1835, 2940, 1116, 763,
+	522, 1075, 1588, 458, 1075, 2988, 2828, 3028, 1562, 1386, 884, 2889, 2564, 3132, 2916, 2683,
+	2369, 2788, 2081, 2748, 2956, 337, 2130, 2713, 0, 3153, 2651, 835, 2369, 180, 738, 2644,
+	2564, 2564, 3234, 914, 2018, 938, 3217, 3172, 162, 1450, 1884, 2785, 1948, 524, 937, 2620,
+	2724, 2620, 2050, 1060, 306, 52, 1108, 1212, 1388, 1140, 2131, 1324, 835, 2060, 2050, 2804,
+	1075, 2418, 1073, 18, 1002, 3089, 3058, 2923, 3105, 1060, 244, 2908, 1073, 0, 2907, 0,
+	1089, 2658, 1714, 3004, 0, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2937, 553, 1203, 2049, 2372, 2796, 915, 2732, 3116, 2297, 2372, 2796, 1057, 172, 2987, 1619,
+	756, 323, 323, 3201, 2091, 1977, 2420, 2420, 2121, 155, 2932, 402, 569, 2497, 298, 561,
+	2121, 1411, 561, 2979, 1411, 2906, 156, 2308, 883, 1129, 788, 2897, 2074, 3161, 1059, 1100,
+	705, 860, 356, 259, 1434, 3234, 3179, 49, 2730, 473, 2748, 3179, 1115, 1388, 1139, 2003,
+	738, 2938, 2940, 1707, 2779, 1131, 1131, 2705, 1581, 2940, 2937, 3153, 2777, 3092, 993, 666,
+	1364, 2946, 2017, 1937, 2082, 995, 849, 298, 298, 2939, 2947, 2901, 1633, 1131, 2051, 2931,
+	2786, 2809, 756, 1131, 2796, 996, 2433, 579, 2419, 1057, 1722, 1065, 1140, 2418, 1571, 993,
+	1547, 1492, 3241, 2235, 2882, 2907, 739, 2345, 1699, 761, 2555, 2986, 437, 3131, 2066, 3156,
+	873, 761, 1492, 1435, 2940, 1154, 1365, 1541, 2987, 3145, 2420, 2420, 660, 332, 2986, 1297,
+	2986, 3010, 996, 2050, 2779, 1115, 2500, 2540, 804, 804, 2900, 2825, 2900, 2050, 2900, 1058,
+	2666, 2738, 1196, 460, 1089, 908, 2940, 259, 961, 1683, 2933, 2811, 1113, 2650, 1412, 2811,
+	1113, 2932, 2097, 162, 2980, 2828, 475, 1402, 619, 1594, 2194, 2194, 1058, 1058, 2738, 2940,
+	2402, 2194, 1364, 553, 3060, 1107, 2041, 322, 49, 3115, 1105, 1100, 153, 2202, 402, 722,
+	2299, 1498, 153, 201, 3243, 2420, 2561, 3116, 740, 2801, 2801, 2705, 978, 2658, 2196, 2065,
+	763, 785, 162, 468, 1444, 2939, 276, 266, 2281, 266, 2938, 1684, 1597, 2196, 675, 276,
+	2915, 2066, 3164, 1979, 2772, 2779, 1076, 1068, 2923, 705, 201, 2196, 2738, 700, 521, 683,
+	3161, 2051, 1956, 2986, 540, 612, 2780, 2940, 2835, 1196, 2937, 1058, 20, 2779, 1060, 738,
+	666, 2857, 1108, 1977, 475, 737, 2587, 3164, 2977, 1051, 1036, 2987, 436, 3010, 2299, 2747,
+	354, 281, 2898, 2804, 2369, 265, 1498, 201, 2892, 2836, 2747, 3180, 3061, 2802, 1851, 162,
+	833, 1771, 1772, 2828, 68, 2868, 1442, 3172, 2401, 2129, 396, 105, 2420, 1065, 1977, 2940,
+	2500, 2939, 3145, 532, 913, 1548, 476, 3180, 172, 2129, 115, 3121, 395, 2748, 521, 3180,
+	3299, 2980, 2915, 2619, 3108, 938, 116, 2706, 2386, 2986, 2940, 738, 3300, 825, 1820, 2658,
+	1771, 2801, 2130, 2969, 2715, 2065, 2421, 1171, 81, 1956, 1034, 940, 1355, 2810, 786, 2914,
+	59, 667, 1651, 1065, 660, 156, 1058, 955, 1050, 875, 2138, 2633, 1091, 396, 2940, 2419,
+	2842, 2401, 2705, 1187, 3154, 753, 1330, 2938, 307, 1267, 865, 1388, 2945, 2420, 1611, 3177,
+	2868, 2980, 25, 1484, 1674, 658, 1498, 572, 244, 305, 2892, 817, 3169, 2937, 2234, 442,
+	2794, 2500, 468, 1515, 2565, 1091, 3137, 220, 2082, 1276, 250, 1820, 1834, 1107, 2779, 986,
+	1123, 299, 3140, 3300, 323, 2097, 1515, 1138, 2436, 2651, 2404, 2692, 162, 1714, 2817, 124,
+	2691, 2987, 2788, 420, 626, 2122, 2866, 868, 1260, 2779, 1164, 2940, 739, 1410, 3267, 2084,
+	1388, 2971, 1044, 1116, 2068, 2300, 1955, 2522, 738, 2785, 1387, 739, 2017, 83, 2986, 2050,
+	2794, 2836, 2857, 2987, 524, 281, 322, 3156, 2907, 1395, 1388, 1330, 2497, 1075, 2857, 739,
+	1052, 1140, 2820, 1922, 1076, 132, 332, 692, 708, 2900, 27, 92, 2988, 2833, 115, 995,
+	265, 3153, 156, 1132, 2922, 436, 1395, 2731, 1330, 201, 3252, 788, 857, 92, 2627, 2433,
+	2433, 1597, 492, 2578, 1154, 370, 2844, 1970, 2587, 988, 2939, 2049, 2620, 764, 1116, 1100,
+	2537, 268, 1098, 683, 3154, 1241, 1148, 3249, 1140, 2068, 1770, 1498, 3233, 2769, 1507, 2505,
+	1380, 1044, 569, 3244, 100, 2779, 1140, 1707, 187, 1075, 3100, 2929, 3154, 2348, 2105, 1820,
+	2953, 297, 2066, 2907, 2251, 3164, 379, 1067, 1060, 2747, 2987, 156, 2276, 2618, 2745, 1985,
+	2908, 705, 2587, 2772, 628, 2826, 283, 2411, 1187, 524, 3300, 241, 2650, 92, 2828, 1026,
+	2923, 3108, 323, 2905, 2978, 1076, 2867, 3089, 393, 740, 113, 3156, 3251, 1619, 1058, 2939,
+	2828, 2890, 185, 593, 220, 3137, 1907, 2665, 2665, 92, 3018, 1474, 1098, 2747, 700, 266,
+	873, 2515, 3156, 2524, 2793, 740, 2996, 2219, 1388, 1852, 3012, 1083, 1540, 76, 529, 2586,
+	932, 1098, 2785, 2364, 2068, 1154, 201, 332, 2299, 92, 2820, 2971, 2922, 2580, 2553, 2915,
+	666, 156, 1065, 467, 3028, 2587, 835, 145, 331, 1874, 193, 1371, 433, 2969, 3049, 3251,
+	105, 2507, 44, 354, 2987, 3100, 3266, 2369, 363, 1116, 308, 2347, 916, 3113, 2105, 2908,
+	524, 2828, 1474, 92, 1996, 1107, 1404, 1484, 1554, 2065, 2801, 2580, 2954, 572, 3204, 2812,
+	2364, 2082, 1123, 2691, 3291, 2042, 2785, 1354, 267, 865, 1418, 2049, 297, 258, 2747, 1057,
+	161, 1036, 355, 2643, 476, 1091, 1132, 2337, 700, 2804, 1138, 628, 1089, 1076, 2658, 1436,
+	162, 836, 2801, 2524, 2804, 1081, 1643, 2932, 1108, 1068, 2084, 1980, 705, 3172, 20, 2292,
+	2938, 1164, 1834, 258, 2940, 484, 1115, 2873, 1276, 1075, 332, 473, 1091, 2347, 3028, 196,
+	145, 26, 2234, 2570, 322, 250, 1338, 1771, 1107, 2068, 1602, 2779, 1818, 2114, 1771, 266,
+	1428, 1371, 1515, 1291, 84, 2988, 129, 3035, 3156, 2500, 2977, 930, 2108, 292, 1388, 2610,
+	2747, 1467, 331, 258, 2170, 2433, 1036, 1388, 1506, 3035, 1874, 2587, 2907, 1370, 1724, 658,
+	2780, 3011, 3033, 2994, 2849, 313, 3124, 2849, 2801, 865, 604, 1212, 604, 1619, 2676, 266,
+	658, 604, 658, 1105, 2676, 2500, 2907, 2907, 2419, 0, 483, 2065, 577, 697, 1570, 2401,
+	577, 0, 1113, 1387, 1027, 2236, 2738, 1748, 2138, 1411, 2986, 49, 817, 1452, 2785, 917,
+	1338, 820, 2625, 857, 2844, 153, 2050, 1140, 531, 3241, 697, 2915, 1073, 2428, 1060, 2940,
+	1060, 259, 1121, 1572, 2163, 1748, 2994, 1571, 769, 2163, 220, 1121, 220, 3028, 843, 1123,
+	1572, 3172, 1572, 828, 2867, 1619, 1612, 2219, 2946, 2827, 1187, 1161, 1834, 2938, 1610, 2420,
+	857, 1602, 3163, 1140, 2993, 1650, 1252, 1434, 740, 2827, 1612, 153, 569, 2572, 769, 706,
+	153, 996, 313, 1154, 996, 1292, 2931, 1379, 1932, 738, 1643, 572, 2803, 1428, 2060, 1073,
+	1116, 2513, 1587, 2674, 2049, 836, 3227, 2505, 1116, 1410, 2108, 537, 1442, 572, 764, 1075,
+	2945, 412, 18, 1388, 364, 1651, 3227, 433, 2497, 618, 1108, 1435, 1435, 1818, 2785, 586,
+	1059, 674, 674, 674, 708, 1137, 331, 3145, 705, 1684, 3155, 738, 705, 2018, 705, 1179,
+	1026, 1179, 761, 516, 2018, 2067, 2849, 1276, 2673, 41, 329, 1057, 484, 914, 914, 3050,
+	489, 537, 489, 2196, 2196, 361, 697, 2092, 2940, 1057, 1185, 2068, 443, 330, 2755, 1057,
+	475, 2842, 1004, 2730, 1154, 1386, 3004, 1428, 1450, 3058, 769, 364, 738, 329, 2132, 537,
+	2361, 1643, 1442, 3161, 1932, 138, 1098, 1098, 1946, 1388, 2361, 138, 259, 1115, 841, 809,
+	492, 364, 1297, 1257, 620, 660, 3156, 2441, 2140, 2345, 396, 1212, 1098, 876, 396, 876,
+	1179, 620, 1060, 2620, 1115, 1474, 1507, 3058, 2993, 452, 2881, 1217, 1322, 2066, 2345, 364,
+	843, 1076, 452, 1386, 2617, 692, 2033, 259, 2050, 364, 3244, 769, 2729, 161, 1057, 617,
+	2106, 2364, 585, 1076, 1060, 161, 2905, 1140, 1049, 2412, 1075, 618, 593, 2777, 843, 740,
+	2412, 1076, 785, 458, 1179, 364, 353, 259, 2682, 1484, 1386, 1971, 2361, 1993, 1249, 1091,
+	841, 2081, 1154, 1004, 3089, 3234, 1402, 1140, 1977, 1450, 876, 1091, 876, 1076, 1076, 2585,
+	1049, 1060, 1076, 2940, 1076, 3156, 258, 1075, 1666, 1386, 3179, 1388, 2900, 2140, 68, 817,
+	1065, 2780, 1548, 1428, 1108, 1233, 2826, 3155, 572, 3180, 1851, 1098, 2130, 2380, 2940, 3177,
+	1668, 1388, 1108, 1354, 1354, 1148, 1251, 2914, 2713, 2820, 1674, 1289, 1098, 1428, 938, 2420,
+	1212, 1108, 780, 162, 1643, 308, 1346, 2971, 2971, 1619, 1212, 2889, 1148, 2106, 1484, 172,
+	1603, 308, 1369, 1180, 1619, 572, 2868, 2868, 1185, 2780, 2940, 2889, 2763, 2412, 1354, 1684,
+	1484, 1996, 2420, 1057, 2098, 1084, 273, 2140, 2812, 2940, 1154, 673, 1145, 2658, 1140, 473,
+	2826, 1548, 2889, 2889, 1516, 1388, 284, 2170, 2140, 81, 2378, 3010, 1129, 84, 825, 2780,
+	3010, 2754, 2849, 756, 756, 81, 401, 2940, 2849, 1969, 1137, 2594, 786, 2042, 628, 1946,
+	738, 817, 458, 1132, 817, 115, 1004, 91, 1731, 2421, 681, 1132, 2938, 3017, 1084, 1196,
+	1084, 1289, 993, 2794, 2129, 674, 875, 2092, 3041, 1289, 691, 993, 2987, 875, 1300, 1036,
+	473, 876, 1402, 1402, 2531, 586, 1132, 1154, 2788, 1979, 2129, 2937, 1209, 2907, 123, 1772,
+	2129, 2418, 2892, 2065, 1780, 2284, 3266, 2409, 2779, 1036, 68, 2420, 2788, 2732, 1002, 2826,
+	2732, 89, 3266, 3233, 2826, 473, 1548, 1714, 473, 1058, 162, 2452, 165, 1292, 124, 171,
+	3108, 1171, 1482, 2979, 1483, 2785, 844, 2772, 2828, 1098, 1098, 2748, 34, 2114, 3153, 1571,
+	2948, 2745, 2380, 1058, 2148, 1491, 307, 1147, 2828, 2868, 1107, 2148, 2780, 1058, 628, 2105,
+	2785, 2297, 267, 2747, 628, 2649, 1388, 3130, 915, 1388, 2899, 2897, 2908, 2388, 523, 3091,
+	1938, 2898, 2092, 2898, 3156, 220, 1938, 2618, 1386, 2388, 988, 2649, 3281, 452, 692, 2994,
+	220, 2994, 2809, 2907, 1388, 1154, 2348, 529, 330, 1132, 1107, 42, 875, 2908, 2497, 1388,
+	267, 1338, 1388, 2906, 2907, 2994, 2497, 817, 1434, 2226, 2132, 2132, 659, 1371, 585, 2804,
+	3201, 2297, 193, 193, 193, 193, 20, 468, 2980, 241, 1058, 2979, 2465, 675, 2425, 852,
+	50, 665, 2276, 2420, 2433, 3234, 2131, 2428, 124, 2868, 2794, 1932, 2515, 1058, 2748, 2515,
+	546, 2260, 402, 1251, 835, 1140, 1444, 843, 489, 1252, 3155, 1092, 3124, 49, 553, 1211,
+	2570, 308, 2419, 2980, 2122, 2027, 2932, 932, 2497, 2580, 307, 1364, 537, 1057, 1419, 977,
+	1633, 2865, 1562, 305, 788, 2873, 2921, 3243, 938, 1058, 540, 444, 2658, 1650, 988, 1388,
+	2675, 2812, 3089, 2796, 2931, 1515, 2897, 1541, 1907, 1049, 2937, 1161, 323, 1436, 2697, 2946,
+	692, 115, 2100, 2100, 1100, 172, 731, 53, 609, 697, 626, 914, 2649, 1233, 2483, 2051,
+	978, 3153, 2947, 2778, 2778, 275, 1700, 2884, 2785, 369, 577, 2755, 987, 977, 2778, 780,
+	2901, 1164, 1515, 628, 786, 1586, 465, 2051, 298, 2778, 780, 737, 1092, 977, 307, 2409,
+	1700, 2697, 739, 2940, 465, 1907, 1388, 93, 2994, 889, 2757, 2073, 2777, 628, 2417, 1147,
+	1963, 2755, 1741, 1530, 1444, 2162, 2977, 523, 3169, 2420, 3172, 2644, 2788, 2940, 2052, 2018,
+	3243, 833, 393, 2748, 2867, 937, 1730, 745, 1953, 2940, 2817, 2401, 993, 1652, 458, 2132,
+	1139, 914, 3017, 2705, 617, 2035, 1946, 138, 738, 2913, 938, 3019, 938, 905, 1132, 2971,
+	740, 457, 3172, 2715, 1169, 833, 1169, 3301, 172, 1466, 569, 1818, 2565, 2497, 2804, 1052,
+	2052, 660, 628, 865, 3092, 2788, 2938, 1427, 3241, 1633, 1609, 3155, 2923, 1057, 3172, 785,
+	2436, 3034, 2820, 905, 1033, 1267, 1012, 2594, 2802, 628, 2875, 2857, 889, 2908, 1355, 2937,
+	17, 2011, 2403, 2658, 977, 2849, 617, 2717, 897, 3025, 2980, 548, 1924, 2811, 17, 802,
+	1289, 2899, 458, 2817, 116, 1036, 1778, 1001, 2845, 1276, 619, 697, 1060, 1834, 1673, 2961,
+	932, 2994, 1468, 2035, 1562, 785, 1898, 305, 2380, 1385, 1699, 3266, 938, 1257, 2817, 2804,
+	1354, 161, 3130, 3089, 1412, 49, 1633, 1428, 2537, 738, 171, 913, 961, 811, 2489, 787,
+	2980, 2908, 833, 835, 93, 914, 2553, 378, 2940, 17, 1066, 2673, 2802, 2731, 1388, 2785,
+	2586, 3300, 2122, 281, 2778, 3052, 2899, 577, 2051, 522, 2100, 1540, 1668, 820, 579, 2132,
+	1354, 1411, 2555, 3052, 1020, 1349, 2345, 1057, 3267, 2769, 707, 1108, 995, 2052, 2428, 2746,
+	2441, 268, 658, 1388, 2076, 27, 3058, 2961, 1780, 2985, 2627, 1332, 2348, 2785, 2708, 993,
+	18, 3121, 1843, 1227, 3234, 3234, 2369, 524, 961, 1434, 13, 187, 2809, 2697, 2779, 2756,
+	436, 2348, 835, 2051, 2051, 2594, 476, 476, 2932, 3243, 115, 436, 348, 938, 2899, 2051,
+	3130, 689, 1411, 2802, 1978, 2348, 1325, 3058, 2953, 844, 1913, 3131, 2324, 3204, 1804, 889,
+	1505, 2906, 521, 2138, 259, 161, 556, 1345, 2820, 1138, 2586, 308, 2618, 26, 1129, 476,
+	1169, 2970, 2748, 1714, 2364, 2988, 3130, 1323, 1097, 986, 915, 546, 3169, 250, 2721, 1876,
+	2988, 2945, 3018, 2921, 1897, 1619, 994, 3011, 355, 1036, 1020, 1020, 2787, 937, 1057, 1300,
+	3163, 2746, 2348, 2868, 1026, 618, 1804, 2873, 1412, 2988, 2308, 305, 2082, 2908, 473, 1964,
+	193, 1386, 2961, 3089, 2745, 1625, 2954, 1961, 171, 1298, 2786, 2988, 1097, 1474, 1260, 3052,
+	996, 2618, 2922, 940, 10, 2860, 2073, 2324, 2969, 2524, 979, 2826, 20, 2553, 1541, 241,
+	908, 1209, 457, 2307, 289, 2236, 2513, 2713, 1057, 1939, 2777, 2067, 2420, 786, 3241, 1097,
+	1356, 2761, 2716, 2500, 305, 930, 2557, 0, 905, 2555, 2098, 1804, 937, 3154, 2292, 1690,
+	787, 1698, 545, 17, 2073, 2657, 116, 42, 42, 1402, 3281, 3129, 1668, 2516, 2515, 2579,
+	522, 2049, 1092, 313, 1089, 1179, 2580, 2361, 210, 1065, 18, 2820, 1996, 1474, 745, 835,
+	2817, 993, 1036, 889, 1907, 2801, 3058, 266, 2865, 2026, 497, 1541, 1540, 994, 1373, 585,
+	745, 2585, 2931, 105, 2953, 2289, 1092, 1612, 2820, 1001, 1547, 2162, 348, 1969, 1354, 2820,
+	1057, 3179, 274, 1300, 3283, 2817, 2497, 930, 739, 1418, 2082, 2785, 332, 259, 476, 945,
+	2892, 627, 3291, 673, 305, 1033, 3035, 362, 420, 476, 2988, 2697, 233, 1092, 2929, 2785,
+	2052, 930, 1402, 2865, 513, 1033, 2946, 2041, 1153, 2098, 2890, 1804, 1481, 2497, 2907, 2956,
+	457, 3105, 1897, 3172, 1108, 1834, 1036, 2828, 2052, 628, 3052, 2937, 2420, 1092, 2996, 17,
+	2969, 1154, 1276, 2987, 1961, 492, 746, 973, 609, 481, 2833, 2289, 1977, 1979, 2945, 3283,
+	1818, 522, 1340, 2561, 1049, 2234, 929, 2796, 2932, 617, 1980, 322, 1060, 1108, 930, 2620,
+	266, 2889, 1577, 177, 2620, 1483, 1036, 162, 2977, 1804, 2946, 996, 1581, 977, 3130, 1386,
+	1450, 909, 1722, 2817, 1666, 2908, 1388, 1482, 1466, 1666, 476, 292, 2010, 1979, 2812, 1052,
+	1666, 2788, 619, 1260, 2906, 258, 2953, 2171, 531, 1322, 2564, 2817, 1154, 388, 1017, 1052,
+	3204, 1804, 2817, 180, 1386, 259, 252, 1388, 2940, 1505, 1722, 3018, 2521, 2787, 3077, 1073,
+	3018, 3179, 1338, 1804, 1721, 1339, 1461, 2746, 1034, 2945, 2122, 2500, 1810, 1075, 1034, 2836,
+	2945, 1713, 2682, 2682, 612, 1196, 2993, 1123, 1985, 3010, 401, 994, 1034, 2994, 626, 890,
+	1308, 401, 2657, 2674, 2746, 1498, 890, 2153, 2212, 1442, 836, 890, 2569, 890, 2674, 2980,
+	890, 2946, 1044, 2043, 2987, 914, 2994, 1498, 2137, 2987, 2105, 890, 354, 2746, 2994, 2137,
+	1257, 2043, 2994, 2994, 2900, 2674, 2674, 2674, 2682, 1524, 1036, 2940, 1018, 1490, 1490, 2675,
+	2900, 2675, 2651, 2412, 2042, 1484, 1276, 2897, 3028, 2746, 785, 2988, 2777, 873, 1979, 2938,
+	501, 2065, 2065, 3140, 3234, 484, 2060, 2796, 2361, 1292, 267, 2050, 1804, 1668, 1057, 1066,
+	3155, 3155, 67, 2889, 2940, 2099, 1586, 1161, 2219, 2698, 681, 100, 100, 2577, 1187, 1012,
+	3300, 1233, 116, 1115, 524, 1113, 1060, 1276, 523, 1113, 1073, 2578, 1388, 52, 2780, 698,
+	3220, 2025, 68, 2586, 1305, 2129, 2579, 3153, 2706, 761, 2018, 532, 844, 1770, 2570, 1977,
+	1121, 2915, 722, 44, 1484, 2121, 1683, 1211, 828, 2884, 50, 306, 284, 1442, 3180, 740,
+	993, 3156, 370, 1321, 1467, 1467, 1482, 44, 468, 1946, 1645, 2842, 572, 1060, 940, 1516,
+	394, 307, 1371, 753, 2945, 988, 601, 3124, 738, 865, 2922, 619, 619, 875, 242, 2914,
+	2946, 666, 828, 2994, 546, 2826, 1227, 2371, 2427, 628, 156, 532, 978, 2897, 1267, 461,
+	1171, 484, 1179, 922, 1731, 27, 2841, 2804, 2996, 73, 737, 52, 2940, 2948, 916, 2868,
+	370, 2098, 811, 17, 107, 682, 2148, 2971, 1164, 1065, 524, 1546, 1348, 1147, 298, 2361,
+	1105, 3130, 1428, 1428, 172, 298, 1001, 172, 2418, 2889, 889, 1121, 2931, 1780, 521, 2988,
+	172, 2897, 2138, 2540, 1978, 2105, 2731, 1140, 1499, 3145, 1241, 315, 569, 468, 2580, 27,
+	188, 332, 107, 1187, 3154, 619, 2940, 3154, 2940, 1954, 1057, 3227, 2050, 2316, 1140, 1770,
+	1257, 1212, 2586, 1305, 1772, 1073, 601, 1107, 769, 2988, 628, 1970, 836, 2676, 1380, 685,
+	2898, 2068, 1305, 28, 2401, 620, 1731, 2673, 298, 2945, 1042, 116, 1404, 889, 546, 3204,
+	988, 83, 83, 2986, 521, 1570, 1097, 2250, 2932, 812, 1185, 3249, 2986, 1026, 628, 2922,
+	2908, 84, 394, 1586, 267, 587, 2706, 2948, 706, 3164, 1100, 1105, 964, 769, 377, 1075,
+	2018, 1371, 2812, 1025, 1378, 596, 2729, 2873, 1060, 1058, 1276, 2954, 2561, 298, 2971, 1179,
+	2524, 2524, 2418, 1612, 2563, 2763, 298, 2674, 2586, 2148, 3163, 1388, 3163, 76, 2289, 3044,
+	601, 2626, 2780, 3148, 2889, 786, 3140, 20, 817, 2906, 1187, 2626, 2994, 2753, 2828, 1452,
+	907, 1347, 266, 1970, 108, 290, 1484, 1483, 1905, 2068, 1586, 1668, 3201, 2467, 2434, 1475,
+	306, 1556, 129, 1116, 220, 2436, 3156, 3116, 1188, 2969, 532, 291, 3154, 2788, 889, 2075,
+	1108, 524, 2369, 1684, 433, 2908, 2563, 3081, 2066, 2074, 1410, 2748, 3220, 2081, 3081, 2865,
+	2364, 2364, 50, 2042, 1276, 571, 674, 2148, 1668, 609, 609, 3289, 524, 2412, 620, 620,
+	2578, 516, 1682, 698, 1026, 2578, 461, 2932, 3180, 1076, 44, 2074, 1057, 2081, 1227, 2940,
+	1978, 116, 532, 1081, 2931, 2969, 2882, 2578, 1339, 1140, 1012, 484, 2171, 2068, 2889, 2804,
+	2787, 940, 20, 2897, 491, 930, 2250, 1108, 1371, 1292, 1482, 2906, 2578, 2747, 1012, 1467,
+	1467, 2260, 1388, 1434, 2171, 258, 2889, 2906, 1370, 52, 2729, 2420, 2194, 2301, 3212, 3212,
+	2409, 2937, 1548, 1210, 3180, 3212, 994, 994, 1307, 2937, 994, 2868, 1307, 2428, 1563, 3289,
+	2428, 2937, 3155, 835, 332, 1084, 706, 92, 3097, 124, 2537, 2153, 1442, 740, 452, 2796,
+	2852, 2828, 1730, 2796, 1298, 2785, 2724, 2996, 1571, 2524, 617, 617, 2932, 2106, 2724, 828,
+	828, 2052, 1604, 1604, 2946, 1051, 291, 460, 3060, 2625, 2572, 737, 852, 2921, 2913, 921,
+	779, 2417, 2593, 2572, 2666, 2907, 115, 2938, 1265, 1065, 618, 1004, 1291, 3011, 1065, 49,
+	641, 1402, 1020, 521, 2907, 1948, 1148, 2050, 1708, 708, 2826, 700, 531, 2137, 1298, 3260,
+	1020, 2052, 1177, 3089, 97, 2940, 1083, 2596, 3044, 99, 2785, 1027, 691, 537, 2892, 105,
+	532, 44, 2385, 2763, 899, 44, 2780, 44, 1083, 1402, 618, 3009, 1083, 2420, 700, 1052,
+	116, 1490, 619, 1883, 1850, 555, 1707, 2065, 1073, 2561, 1131, 1858, 244, 931, 2801, 676,
+	1059, 2492, 2234, 689, 2740, 978, 3209, 740, 1537, 473, 2196, 737, 1116, 2906, 908, 2756,
+	3161, 1913, 588, 1060, 1233, 3164, 2921, 1108, 3010, 1628, 731, 305, 3004, 3209, 1825, 2908,
+	1700, 2833, 698, 115, 2986, 2707, 705, 2732, 682, 2779, 2988, 873, 588, 50, 1769, 3170,
+	3234, 3121, 458, 1707, 2996, 2667, 2802, 3154, 625, 1588, 1668, 2049, 116, 2401, 2092, 625,
+	938, 2867, 666, 3145, 1642, 68, 1683, 737, 1442, 3243, 3243, 2419, 2163, 2361, 2913, 1554,
+	1099, 833, 2500, 2844, 2747, 3241, 1140, 2361, 2009, 2196, 2922, 572, 1081, 2433, 1058, 753,
+	2812, 1002, 1145, 1089, 828, 1355, 1073, 1073, 2938, 1780, 3154, 1057, 1057, 2804, 962, 865,
+	1161, 1265, 2908, 1651, 1428, 1956, 628, 2980, 2906, 244, 2401, 2945, 2418, 875, 2138, 3241,
+	2505, 2745, 978, 2714, 1474, 2900, 2178, 1089, 1490, 2017, 2804, 2380, 1387, 298, 2828, 1562,
+	737, 2553, 1586, 2747, 1212, 388, 388, 2651, 1786, 2842, 1714, 2986, 1700, 2033, 1747, 1145,
+	2401, 3156, 914, 524, 3209, 626, 2010, 2692, 2804, 1619, 2778, 2906, 2779, 17, 2906, 2986,
+	2500, 2986, 2713, 1388, 2802, 1137, 2131, 3220, 2049, 2802, 3234, 569, 265, 1484, 19, 625,
+	625, 1474, 1618, 402, 2035, 1138, 2026, 187, 1442, 2731, 131, 2817, 2434, 2051, 1033, 676,
+	2771, 2258, 2578, 689, 689, 1098, 2625, 1770, 2138, 1116, 1041, 1113, 2065, 532, 2844, 996,
+	2729, 1330, 116, 2945, 321, 1732, 740, 1116, 1498, 28, 1338, 1305, 2946, 2900, 1137, 1388,
+	531, 2802, 1001, 1004, 2953, 258, 2403, 2650, 484, 2923, 2780, 1716, 388, 1067, 2665, 2868,
+	2988, 2746, 524, 2226, 1587, 473, 2251, 2097, 1033, 2772, 2066, 377, 1626, 740, 1099, 593,
+	2938, 3164, 1586, 1026, 1618, 25, 2953, 2873, 1097, 2745, 1588, 2996, 3145, 2121, 2420, 2828,
+	2707, 1404, 1572, 2163, 2497, 1985, 2748, 2713, 420, 994, 43, 1098, 83, 2865, 2665, 873,
+	330, 2922, 1980, 2786, 2994, 2956, 2218, 2236, 305, 1450, 1587, 1930, 43, 1537, 828, 1300,
+	2098, 1068, 2315, 3137, 2994, 1097, 2218, 1650, 2953, 1058, 2524, 1795, 2802, 2593, 1938, 1346,
+	1731, 82, 20, 1980, 2010, 2940, 1994, 2988, 1370, 2874, 1553, 2937, 3113, 1193, 2969, 1772,
+	1386, 522, 873, 2905, 1107, 3201, 266, 3058, 913, 1756, 1356, 1666, 3129, 996, 996, 44,
+	1756, 2074, 1541, 2004, 833, 2779, 2082, 2707, 3107, 1626, 2802, 2802, 1668, 1418, 1402, 1004,
+	873, 513, 3154, 2865, 2937, 1004, 2785, 1300, 2178, 2785, 2908, 258, 1089, 1587, 676, 673,
+	2801, 2940, 1036, 1092, 740, 2420, 116, 2364, 2540, 2074, 1403, 1018, 2833, 1795, 571, 2940,
+	193, 20, 1786, 1818, 1537, 2635, 322, 1108, 394, 2986, 2010, 2218, 2234, 1707, 2905, 2570,
+	2953, 2068, 1795, 3004, 2954, 1618, 114, 1537, 2403, 2844, 1772, 586, 1451, 2993, 1339, 2908,
+	2465, 1442, 1091, 1786, 1339, 2065, 2953, 2465, 1036, 2138, 1611, 1386, 1490, 2906, 3178, 1339,
+	3245, 1098, 1154, 1154, 1243, 3012, 1537, 3244, 442, 2545, 738, 92, 3241, 2820, 2836, 1604,
+	2500, 2569, 81, 1060, 833, 1850, 2882, 2980, 3203, 906, 1490, 2545, 1729, 1633, 402, 2065,
+	2434, 196, 2897, 3241, 1771, 737, 3241, 1386, 2882, 164, 2234, 1706, 1804, 1804, 2953, 1490,
+	1618, 1818, 2219, 2561, 875, 3098, 2114, 2987, 2427, 25, 2673, 2508, 2730, 2228, 2923, 978,
+	2938, 1115, 3225, 1612, 3179, 484, 978, 3249, 857, 3172, 556, 2731, 2938, 83, 2418, 2418,
+	315, 2403, 1212, 2873, 2420, 2980, 1020, 2938, 2635, 2419, 2804, 817, 298, 2154, 817, 2817,
+	3027, 3092, 83, 908, 2908, 2817, 1065, 2403, 290, 2218, 1027, 1612, 1252, 1281, 145, 2524,
+	187, 3035, 1060, 2993, 1060, 2946, 1612, 1252, 2105, 940, 3137, 1076, 740, 1818, 156, 1018,
+	1588, 2099, 914, 2988, 2418, 1818, 1108, 1818, 3156, 2987, 83, 1281, 1818, 2099, 1668, 242,
+	1140, 843, 2099, 993, 2780, 1418, 2418, 1818, 3100, 2403, 2747, 2827, 1281, 1036, 1418, 1164,
+	1018, 2940, 2938, 83, 2097, 315, 83, 705, 444, 604, 2500, 2890, 491, 1516, 604, 2428,
+	2027, 705, 3201, 737, 2388, 1212, 1081, 1081, 3201, 2748, 3289, 2890, 2436, 604, 491, 2819,
+	1098, 2379, 659, 659, 659, 747, 1073, 2433, 290, 2372, 2372, 1666, 746, 266, 1420, 2803,
+	2803, 1309, 2978, 2737, 2978, 1420, 1420, 2922, 1562, 2737, 2737, 2737, 748, 2922, 620, 1300,
+	3163, 1132, 761, 835, 761, 2690, 761, 761, 2417, 2947, 307, 1201, 1770, 1107, 2747, 1796,
+	1138, 1980, 234, 2788, 113, 1137, 1100, 2626, 2129, 2620, 1100, 2777, 539, 2417, 2419, 2018,
+	1057, 2828, 3139, 2828, 1770, 3107, 2785, 2747, 1555, 625, 1476, 2018, 2620, 692, 2435, 2828,
+	2674, 1515, 1515, 2787, 234, 1515, 1140, 2828, 1140, 1153, 1418, 1154, 2435, 2788, 284, 2698,
+	1772, 2361, 2713, 2801, 1388, 628, 1036, 1036, 1466, 2940, 2051, 2196, 2780, 916, 2401, 2987,
+	329, 2540, 2051, 2196, 3004, 67, 2923, 34, 2898, 2780, 1098, 628, 1058, 2065, 698, 2730,
+	2050, 226, 2066, 2050, 244, 1100, 2129, 771, 2804, 44, 1338, 491, 49, 3300, 3300, 2915,
+	1140, 769, 1211, 827, 2882, 2025, 1388, 2634, 2129, 2906, 738, 2860, 1067, 1443, 2706, 1978,
+	44, 468, 1292, 3004, 2129, 996, 2028, 1642, 28, 2634, 1442, 306, 2018, 569, 916, 1297,
+	2860, 1571, 2658, 2882, 2940, 124, 938, 49, 1508, 628, 740, 2890, 546, 1484, 643, 658,
+	753, 2137, 572, 2938, 1683, 2418, 25, 2746, 1018, 3156, 1612, 1387, 1060, 2658, 2746, 2980,
+	2059, 2794, 1387, 2922, 1092, 3145, 1490, 1089, 626, 626, 2988, 2826, 169, 2084, 2153, 705,
+	705, 1730, 1387, 2978, 2804, 2218, 491, 2401, 298, 2674, 811, 1164, 780, 2794, 2946, 2987,
+	1348, 1188, 1354, 1330, 2803, 2148, 1241, 314, 314, 2564, 1434, 1004, 1137, 1330, 2050, 1642,
+	1305, 1305, 3266, 836, 433, 2898, 2898, 771, 1498, 1498, 1378, 1154, 617, 3145, 889, 2946,
+	569, 914, 3145, 2747, 2818, 1978, 2905, 2505, 1098, 105, 3266, 1257, 569, 3107, 836, 2946,
+	3241, 3060, 1026, 2986, 2723, 2914, 705, 2122, 2914, 2618, 2939, 3156, 2420, 3027, 2923, 628,
+	3180, 1185, 1516, 2907, 1587, 914, 1057, 1057, 1020, 2650, 2412, 1586, 2068, 2780, 2986, 3249,
+	1338, 1211, 2906, 2906, 2747, 3249, 242, 2540, 2218, 1209, 2097, 2986, 2050, 1475, 2674, 601,
+	2785, 2763, 201, 484, 2218, 1098, 1179, 1450, 2780, 2505, 2081, 3241, 2746, 105, 529, 450,
+	2067, 2971, 1804, 450, 1059, 2418, 2276, 2507, 3249, 1084, 1418, 1193, 259, 546, 225, 555,
+	2673, 1475, 3116, 3107, 3107, 42, 210, 2129, 2073, 433, 3283, 491, 491, 2786, 2988, 1956,
+	1466, 2812, 234, 161, 2097, 1089, 2905, 1354, 3108, 1434, 1418, 1418, 1105, 516, 620, 3289,
+	1092, 876, 2922, 1089, 2922, 1154, 3105, 2940, 2882, 1730, 2932, 2932, 2938, 1804, 2803, 1058,
+	2828, 1211, 2785, 524, 44, 3283, 2745, 2938, 2218, 491, 1443, 1098, 2987, 3004, 2947, 2237,
+	1098, 1388, 873, 1466, 1466, 529, 2218, 2785, 1138, 258, 2955, 1297, 2906, 2745, 1730, 2138,
+	275, 426, 1490, 529, 529, 1804, 2906, 2906, 2907, 1298, 2907, 353, 1276, 353, 3169, 1025,
+	1113, 2890, 274, 274, 1428, 817, 3299, 2083, 1140, 819, 1140, 2777, 2045, 2045, 244, 2122,
+	2122, 1059, 2939, 2500, 49, 3153, 3121, 2812, 2938, 1107, 2892, 1148, 49, 2892, 1105, 738,
+	3017, 116, 2420, 172, 553, 2452, 673, 1804, 2417, 697, 1916, 3155, 2785, 996, 476, 2746,
+	3116, 2587, 468, 1668, 1956, 1916, 2641, 161, 1402, 3156, 3171, 162, 3156, 524, 1668, 2940,
+	2940, 2018, 2060, 1147, 2234, 2452, 468, 3148, 2476, 2084, 3137, 2417, 2154, 2786, 73, 468,
+	873, 322, 2018, 3116, 2300, 2729, 468, 2746, 266, 2348, 2050, 3058, 890, 1572, 587, 986,
+	3148, 2865, 1612, 2746, 2772, 738, 2940, 73, 2018, 546, 817, 1930, 1027, 2593, 1612, 1068,
+	2610, 1033, 3161, 2361, 1556, 1684, 129, 890, 3058, 1684, 73, 3116, 1115, 259, 738, 3156,
+	993, 673, 362, 116, 116, 3115, 1612, 2081, 257, 698, 1602, 73, 322, 1636, 330, 1098,
+	2803, 1338, 764, 2018, 1778, 1073, 156, 156, 2844, 764, 2921, 1020, 2980, 2977, 1059, 867,
+	1979, 2649, 3060, 867, 3209, 1666, 2108, 116, 2098, 612, 362, 875, 2899, 60, 1100, 2868,
+	1482, 2779, 3209, 1260, 2953, 523, 1946, 532, 2897, 1628, 809, 396, 739, 2658, 1938, 692,
+	2810, 2939, 3156, 2633, 3156, 2857, 588, 3300, 2817, 2674, 875, 1260, 1562, 2650, 2979, 169,
+	156, 299, 1330, 116, 1058, 25, 2436, 1193, 2969, 2707, 2505, 2436, 2107, 2988, 2987, 1628,
+	2513, 220, 2809, 692, 1132, 628, 873, 1452, 2348, 1402, 1346, 2513, 3156, 172, 2107, 1132,
+	1132, 1107, 42, 1316, 1474, 2948, 1420, 468, 1484, 2940, 330, 258, 2674, 2497, 2833, 1628,
+	267, 2779, 692, 867, 1260, 1276, 116, 2074, 2828, 1435, 1435, 1418, 1482, 1060, 2955, 2801,
+	2649, 2969, 1386, 2649, 2947, 2890, 2906, 2650, 522, 1923, 1076, 1034, 1707, 1034, 819, 1780,
+	1177, 124, 2940, 2052, 1836, 700, 1139, 2907, 2940, 3044, 116, 2940, 2937, 660, 2297, 2420,
+	660, 2420, 2420, 817, 540, 2947, 996, 738, 978, 2777, 2690, 306, 1084, 52, 2403, 524,
+	3113, 1154, 2593, 739, 523, 1610, 2802, 994, 273, 1851, 1116, 3139, 2938, 1611, 2137, 2729,
+	2377, 2276, 2873, 1116, 537, 3113, 1084, 2074, 1970, 476, 2074, 116, 116, 2388, 476, 1075,
+	828, 785, 665, 116, 1249, 1075, 140, 2817, 476, 889, 1084, 978, 1610, 889, 2729, 1154,
+	1060, 1060, 873, 481, 1484, 1484, 2684, 1036, 3156, 1036, 1036, 2938, 2938, 2938, 2938, 3001,
+	3001, 2361, 2842, 2754, 2658, 2908, 2908, 2988, 305, 187, 129, 537, 145, 1970, 2971, 1993,
+	3113, 2955, 305, 308, 3234, 2707, 1058, 683, 3161, 2940, 2738, 284, 115, 521, 1442, 738,
+	2739, 3145, 418, 2739, 1116, 468, 2785, 2892, 955, 2914, 1010, 1516, 988, 2739, 299, 3156,
+	2866, 1116, 2674, 402, 3157, 1330, 402, 498, 1922, 2787, 569, 1060, 266, 3156, 402, 3169,
+	1330, 2988, 2828, 1100, 1076, 2420, 1067, 124, 1026, 740, 2890, 2747, 1938, 2922, 2745, 2785,
+	3145, 1996, 2618, 498, 3145, 3155, 138, 498, 313, 284, 1091, 1036, 1091, 1033, 1586, 1468,
+	2809, 84, 2130, 2833, 2837, 116, 2940, 1364, 2194, 489, 556, 755, 1060, 2195, 2194, 260,
+	2579, 2604, 2604, 761, 2052, 2420, 443, 3156, 2740, 1562, 2785, 673, 2953, 2627, 1642, 2755,
+	3161, 313, 2780, 1058, 2779, 2788, 1066, 2977, 2732, 401, 2505, 1276, 2988, 124, 3156, 2050,
+	436, 290, 2572, 2698, 2066, 1780, 1042, 2849, 1827, 1290, 2801, 2833, 1193, 993, 1180, 700,
+	1010, 2572, 2507, 2779, 1908, 268, 364, 1140, 2940, 83, 273, 1642, 1953, 3300, 3075, 2916,
+	1140, 68, 1852, 1730, 3145, 1916, 172, 2641, 996, 996, 1140, 458, 1402, 2497, 322, 524,
+	468, 2938, 2673, 2978, 737, 1058, 1969, 2844, 2996, 1770, 852, 738, 2788, 116, 2977, 2092,
+	2876, 401, 155, 1027, 2868, 332, 116, 2436, 2785, 2577, 2971, 3251, 604, 1669, 3155, 2940,
+	2420, 1756, 2890, 2420, 2788, 1355, 962, 1289, 1674, 3155, 2826, 1404, 2633, 1027, 546, 932,
+	1243, 875, 962, 2785, 1091, 2436, 2497, 993, 2121, 2916, 1036, 1034, 308, 1066, 2938, 2849,
+	852, 1436, 1033, 3244, 2868, 307, 2372, 1884, 956, 641, 1212, 572, 2626, 817, 2137, 2785,
+	2060, 3004, 1969, 1227, 498, 1036, 628, 2821, 2660, 2905, 1179, 220, 1731, 3012, 1562, 2971,
+	2971, 2993, 1977, 1307, 2081, 3004, 2988, 2674, 1100, 2785, 3130, 1436, 2620, 916, 932, 2092,
+	2620, 172, 2940, 2068, 1035, 2785, 92, 1554, 2937, 961, 2507, 2137, 299, 1297, 2780, 2780,
+	2977, 1386, 1412, 1020, 401, 2940, 3004, 1388, 1810, 1731, 628, 2148, 2874, 2065, 2780, 1643,
+	402, 691, 89, 498, 436, 268, 1596, 1388, 1060, 860, 860, 2844, 492, 2049, 1241, 2627,
+	1498, 2785, 1187, 883, 1772, 2106, 322, 609, 891, 3105, 1113, 2731, 2993, 1105, 1060, 1338,
+	2988, 1052, 938, 2138, 2578, 2620, 2620, 1804, 2739, 388, 993, 1041, 2785, 267, 2833, 2746,
+	1036, 628, 2555, 3251, 1073, 2971, 532, 1140, 195, 298, 498, 92, 2092, 194, 476, 860,
+	620, 1731, 3012, 2811, 3220, 546, 1026, 379, 2114, 2187, 2841, 220, 123, 1643, 3249, 2618,
+	2083, 322, 92, 2873, 2745, 786, 2065, 2747, 2988, 2986, 116, 2873, 1020, 1643, 116, 2940,
+	1619, 2971, 1180, 484, 2945, 628, 290, 1572, 2060, 1212, 2986, 20, 2092, 2907, 1876, 763,
+	3012, 3251, 2289, 1380, 700, 2953, 1300, 1300, 2148, 817, 3010, 2524, 2524, 2050, 2922, 2507,
+	1028, 1058, 835, 1140, 364, 1772, 2826, 1179, 3147, 2971, 211, 2892, 2404, 162, 1180, 2996,
+	2788, 1044, 2971, 2915, 1388, 2313, 2593, 2945, 394, 2868, 2068, 2572, 1025, 3012, 2404, 1651,
+	821, 2388, 402, 1993, 1684, 1684, 890, 308, 195, 194, 194, 433, 1643, 2604, 3113, 2660,
+	44, 2467, 1556, 860, 2148, 3052, 1132, 1036, 1179, 1402, 1908, 2507, 2098, 2948, 1516, 2369,
+	2748, 2682, 1554, 2065, 2388, 2969, 2108, 1193, 524, 3154, 1474, 1148, 2049, 2049, 2988, 2018,
+	1418, 404, 2977, 313, 3156, 2660, 297, 2052, 2129, 1970, 92, 137, 2114, 1089, 3081, 308,
+	1402, 2018, 1300, 1036, 2082, 298, 2948, 2948, 2787, 2785, 476, 2578, 620, 604, 604, 2524,
+	1154, 220, 2817, 673, 700, 1354, 1356, 313, 913, 2052, 2802, 1643, 1115, 1419, 2779, 195,
+	1154, 420, 2804, 2579, 2410, 1977, 2940, 332, 2801, 1730, 476, 2579, 1115, 2505, 916, 1091,
+	2748, 2873, 571, 2098, 2098, 1140, 211, 1227, 2828, 2953, 44, 1572, 2940, 1435, 2324, 1164,
+	1010, 1596, 1339, 20, 1435, 2905, 1316, 2796, 308, 2987, 2948, 465, 1603, 20, 1602, 604,
+	2050, 1667, 1338, 1596, 322, 3156, 1876, 1876, 2905, 2915, 162, 3156, 1292, 1291, 2979, 737,
+	1450, 1636, 298, 1037, 260, 1603, 1339, 1010, 2874, 2172, 260, 1060, 1140, 1017, 2388, 2940,
+	1404, 1715, 1610, 2587, 1154, 772, 772, 3212, 785, 3004, 2780, 1073, 2865, 2436, 2218, 2788,
+	298, 2771, 1100, 785, 1073, 2073, 1052, 2073, 3108, 572, 2049, 1066, 546, 3066, 1066, 1059,
+	3153, 1185, 1058, 1298, 756, 515, 3108, 2073, 785, 1075, 1098, 2988, 1075, 2907, 1484, 993,
+	3108, 2788, 2788, 385, 468, 2130, 996, 996, 996, 628, 2420, 2620, 1571, 996, 1388, 682,
+	2555, 123, 532, 1121, 2371, 2938, 2939, 2364, 996, 689, 2907, 2427, 2429, 186, 3089, 2122,
+	1364, 2041, 49, 459, 2201, 675, 2236, 3028, 2705, 3116, 539, 1194, 2985, 1257, 763, 2401,
+	241, 2705, 835, 1252, 2780, 508, 2065, 3154, 2196, 1316, 1594, 2315, 2914, 1827, 68, 283,
+	2179, 2785, 2066, 65, 1066, 2986, 738, 44, 2785, 1977, 3155, 3156, 628, 508, 3123, 298,
+	1060, 2907, 1290, 124, 273, 1137, 2755, 994, 3004, 1154, 51, 2100, 475, 3147, 3011, 2730,
+	1740, 2940, 2433, 3185, 2034, 2666, 579, 1196, 3130, 2034, 739, 1945, 50, 43, 3058, 2682,
+	1249, 1497, 2075, 3013, 996, 84, 155, 3155, 1969, 1714, 172, 1977, 2570, 2923, 3139, 3089,
+	2913, 84, 937, 1771, 2932, 523, 308, 1977, 1065, 1667, 1588, 289, 2897, 321, 2129, 1643,
+	332, 1065, 738, 3091, 3179, 473, 249, 1683, 1777, 1321, 739, 1945, 68, 1921, 1433, 1698,
+	851, 2066, 1140, 2564, 50, 2705, 2705, 43, 1137, 3233, 1932, 3121, 60, 60, 523, 1771,
+	1140, 1316, 1467, 1075, 2058, 2969, 1338, 1818, 161, 3058, 2065, 954, 1316, 2420, 1098, 3147,
+	1811, 819, 819, 2138, 2457, 442, 3017, 1203, 2938, 2826, 220, 1033, 2009, 3193, 2418, 1698,
+	57, 306, 844, 3156, 1316, 619, 619, 3155, 2092, 28, 1836, 3140, 786, 1092, 1268, 572,
+	1698, 2633, 1428, 3089, 1515, 546, 2713, 1154, 1427, 1139, 3156, 1490, 2900, 2769, 2564, 2826,
+	1730, 483, 1091, 3145, 1059, 1033, 2802, 2987, 17, 2705, 1874, 452, 162, 811, 2619, 3140,
+	298, 2281, 2281, 1233, 1587, 1836, 1137, 1970, 1075, 2940, 2651, 2361, 2242, 2731, 2826, 241,
+	706, 1091, 2779, 1164, 1132, 2659, 1307, 1052, 2674, 3233, 2034, 1515, 49, 916, 2377, 1801,
+	1145, 3060, 2436, 2930, 1154, 171, 2730, 172, 3292, 2932, 3097, 1515, 2513, 2705, 1353, 2547,
+	73, 1075, 1020, 491, 2747, 2732, 2098, 1971, 2387, 1428, 1642, 1594, 739, 59, 1140, 490,
+	2771, 18, 1147, 3004, 3251, 289, 370, 1098, 2673, 100, 1700, 1779, 2274, 3298, 2772, 2049,
+	2801, 298, 529, 2315, 1497, 2108, 769, 617, 2428, 540, 2034, 523, 3115, 1044, 1059, 2593,
+	2057, 2050, 1922, 2433, 2065, 1442, 2929, 2900, 1154, 3145, 1411, 844, 2940, 1052, 2364, 3147,
+	1524, 187, 2580, 284, 153, 1097, 2620, 1244, 2689, 2907, 452, 3169, 1137, 2628, 2066, 1228,
+	57, 1914, 1097, 1483, 849, 1653, 1098, 3156, 475, 1605, 196, 2313, 860, 1972, 2996, 1876,
+	1075, 3145, 1129, 1075, 2986, 2906, 1298, 1715, 977, 2226, 1980, 2745, 2289, 3260, 2873, 1626,
+	2618, 1801, 241, 2420, 3251, 3140, 2937, 2890, 2970, 121, 2914, 1020, 2907, 3035, 27, 2865,
+	2900, 2772, 1210, 345, 1058, 2620, 1322, 1324, 290, 1177, 1129, 1129, 2674, 1097, 1033, 804,
+	316, 2817, 546, 2825, 2994, 2066, 2930, 241, 3089, 89, 2922, 2745, 109, 1339, 2756, 2100,
+	257, 785, 1475, 3251, 804, 1091, 828, 2100, 2218, 2148, 321, 345, 3107, 2547, 2545, 162,
+	332, 2218, 76, 449, 2313, 1209, 2922, 491, 3153, 1852, 1321, 1073, 2513, 2123, 779, 2803,
+	2492, 2307, 1108, 1636, 628, 370, 1876, 2361, 2564, 3091, 2586, 1930, 65, 457, 1388, 2593,
+	994, 3156, 2713, 1002, 2065, 2756, 2075, 2626, 3137, 628, 2826, 1876, 2138, 242, 3092, 786,
+	2779, 644, 2388, 1194, 2388, 2433, 59, 2922, 148, 2513, 2577, 2284, 259, 2553, 1129, 313,
+	361, 849, 155, 706, 2449, 524, 2052, 2513, 3097, 1403, 297, 305, 860, 1484, 1508, 1475,
+	3251, 756, 996, 3089, 363, 2588, 1004, 433, 1706, 1666, 1081, 873, 2955, 3154, 42, 3156,
+	1804, 1556, 260, 1249, 329, 2388, 2682, 1091, 1665, 1666, 3130, 196, 1233, 129, 1084, 2922,
+	828, 2065, 1420, 1057, 2953, 1153, 2001, 2001, 1353, 609, 2804, 2250, 876, 3035, 2940, 2802,
+	297, 297, 2281, 1730, 980, 2497, 916, 868, 457, 3291, 1779, 1435, 3147, 1033, 3212, 1091,
+	1059, 209, 475, 475, 284, 161, 283, 1153, 739, 1417, 100, 739, 2084, 161, 449, 3234,
+	3204, 2747, 2041, 2100, 609, 1779, 1002, 2826, 1481, 1091, 425, 2564, 916, 2084, 2769, 1075,
+	763, 2969, 1370, 1723, 1483, 2364, 3234, 3058, 2041, 388, 1057, 483, 2324, 209, 2106, 2106,
+	1020, 1097, 2098, 1275, 473, 2826, 1169, 1979, 57, 44, 1140, 2932, 628, 1601, 2515, 1610,
+	1059, 2570, 3234, 491, 2843, 1339, 177, 1139, 2930, 2235, 2932, 2932, 1771, 2772, 1098, 148,
+	1818, 785, 3156, 3156, 1316, 1666, 1076, 2826, 1428, 2577, 59, 2515, 1483, 1524, 2179, 2617,
+	1929, 2915, 1372, 177, 2433, 3035, 1779, 2803, 1164, 1049, 1388, 1324, 1019, 2954, 1482, 1467,
+	2065, 2065, 3035, 2065, 1338, 2801, 2953, 1586, 2171, 257, 2763, 425, 2826, 2388, 1506, 1164,
+	1610, 305, 3035, 1490, 2577, 3276, 1388, 529, 2713, 483, 1091, 1154, 1339, 1388, 1723, 3153,
+	876, 875, 2049, 2890, 2041, 2041, 2425, 1203, 2977, 755, 2939, 817, 761, 65, 684, 3148,
+	2028, 529, 1252, 1643, 2780, 836, 938, 220, 2820, 1611, 332, 786, 522, 2868, 1092, 1643,
+	290, 1132, 2401, 618, 2987, 308, 42, 60, 2868, 1092, 618, 1403, 1804, 116, 267, 531,
+	617, 2940, 763, 2300, 1211, 2908, 609, 1057, 2667, 2820, 617, 1091, 1116, 2914, 2794, 1643,
+	2436, 18, 2081, 18, 3147, 522, 3140, 737, 2436, 1418, 2129, 2852, 2939, 1091, 2364, 1091,
+	3234, 2940, 1403, 116, 1386, 2820, 2820, 2754, 2882, 2050, 2050, 3097, 145, 1154, 3097, 1346,
+	691, 65, 65, 1338, 2987, 1338, 2747, 580, 2409, 1420, 1067, 994, 2826, 1067, 2987, 3137,
+	1092, 2772, 2635, 580, 1105, 308, 2946, 739, 2073, 3107, 2130, 3234, 3107, 596, 452, 2497,
+	2833, 3234, 3234, 2098, 1434, 3234, 332, 596, 3179, 681, 259, 922, 2986, 2417, 1956, 2978,
+	1588, 1938, 2050, 3105, 1570, 1515, 1956, 1977, 1450, 737, 683, 2874, 1113, 1113, 1771, 3266,
+	3124, 2939, 1450, 2377, 1076, 2986, 2939, 2050, 3156, 673, 1993, 673, 3105, 1276, 2540, 2986,
+	2778, 1060, 1060, 1060, 1052, 2212, 476, 1132, 3155, 3051, 2826, 2633, 2890, 2868, 745, 1322,
+	764, 916, 2570, 524, 2865, 259, 2418, 1292, 2914, 2418, 2740, 1642, 1642, 2697, 377, 2779,
+	3010, 92, 34, 3060, 67, 1098, 1305, 2409, 996, 683, 932, 876, 265, 2873, 1650, 1041,
+	697, 2099, 993, 2940, 2785, 2833, 2906, 3060, 683, 2578, 2404, 1140, 2914, 3035, 155, 2841,
+	2956, 2876, 2028, 3139, 1442, 377, 932, 1588, 3298, 1668, 124, 2868, 1041, 3121, 3252, 2420,
+	2420, 2988, 692, 546, 1571, 1772, 267, 2753, 569, 19, 155, 34, 3172, 1466, 2803, 1292,
+	2635, 274, 2418, 1027, 1027, 2875, 1298, 2865, 1091, 1108, 3156, 1108, 2371, 2658, 979, 2908,
+	753, 2811, 2356, 2819, 2932, 3009, 1033, 914, 916, 1164, 2731, 2804, 1305, 3172, 2785, 298,
+	2412, 169, 3130, 3130, 2780, 2731, 1036, 932, 290, 2731, 2627, 3234, 3284, 3171, 2043, 1115,
+	2785, 2363, 1771, 2785, 2106, 2051, 1113, 875, 3147, 2940, 3156, 28, 2731, 1434, 1412, 265,
+	2739, 2819, 3036, 689, 2873, 812, 2938, 2794, 3009, 1033, 2867, 1643, 1298, 2929, 2956, 2435,
+	2747, 2435, 2106, 1572, 1714, 1075, 1859, 28, 2914, 377, 2922, 2555, 2043, 1650, 1091, 1179,
+	779, 2763, 268, 2052, 932, 2908, 1388, 20, 1060, 1060, 1596, 3036, 2828, 932, 1684, 1668,
+	401, 1772, 3113, 1036, 84, 916, 2874, 354, 1418, 2801, 2579, 1115, 2001, 1434, 2697, 2787,
+	2940, 1060, 1028, 468, 2932, 2932, 1388, 2578, 2658, 2819, 692, 2403, 3124, 932, 2940, 2811,
+	2841, 2401, 1091, 84, 1116, 2908, 20, 2932, 2234, 2435, 1602, 2889, 2924, 2044, 1388, 290,
+	1292, 546, 1419, 2908, 1052, 1482, 2785, 2218, 1466, 1723, 1507, 1490, 2356, 2587, 2907, 3178,
+	3001, 3001, 2129, 2932, 812, 2932, 993, 938, 2433, 210, 210, 2409, 1556, 233, 234, 2620,
+	3284, 195, 2868, 1036, 2947, 2092, 697, 1978, 3004, 2979, 2251, 1970, 698, 738, 1442, 691,
+	2130, 2620, 1884, 2635, 2492, 3140, 1347, 1347, 3281, 1650, 1025, 2740, 2697, 274, 1057, 2049,
+	2953, 3249, 2740, 2658, 1347, 1354, 1602, 1466, 1684, 515, 2748, 1668, 99, 3090, 2436, 2436,
+	1684, 3177, 2194, 49, 2043, 619, 619, 489, 1388, 875, 1057, 1129, 115, 2859, 298, 396,
+	2345, 2236, 3018, 2138, 2065, 2986, 761, 2777, 241, 2361, 2890, 674, 2780, 3243, 1387, 2844,
+	186, 441, 2196, 129, 2705, 524, 3116, 1562, 308, 2940, 756, 817, 588, 1386, 2051, 2436,
+	769, 2634, 1085, 1618, 2732, 1330, 1131, 1562, 2914, 1540, 1627, 2500, 2994, 922, 692, 89,
+	1098, 569, 779, 2923, 2801, 331, 377, 1914, 2433, 1004, 2833, 323, 3180, 323, 2505, 67,
+	2505, 1058, 2772, 1108, 828, 1057, 1570, 1978, 116, 2739, 36, 681, 698, 2940, 738, 1714,
+	2785, 996, 2897, 579, 2834, 3139, 2921, 1434, 2260, 627, 1586, 3124, 891, 3153, 401, 3012,
+	3285, 2409, 2433, 3051, 524, 1388, 1482, 1075, 298, 2505, 2073, 705, 3105, 2817, 2801, 1257,
+	2018, 2570, 2787, 3155, 851, 2817, 1068, 1065, 827, 81, 1668, 2940, 2932, 2932, 2420, 1804,
+	115, 620, 2938, 1442, 155, 1771, 1321, 938, 68, 674, 3161, 468, 394, 2915, 737, 59,
+	1675, 761, 2049, 2163, 2226, 1572, 2378, 2505, 3132, 2794, 2980, 2401, 876, 2708, 3092, 1714,
+	1818, 2971, 523, 3156, 3089, 242, 476, 833, 172, 1132, 41, 738, 1075, 49, 620, 1209,
+	1708, 3180, 116, 1451, 250, 2361, 2500, 332, 1953, 2420, 851, 3089, 2923, 297, 1132, 2420,
+	3153, 1451, 1586, 1388, 2218, 3092, 3051, 129, 3108, 3156, 1466, 572, 1482, 2409, 1388, 1338,
+	2971, 2436, 2890, 2457, 2052, 3137, 2049, 1388, 2938, 2810, 3140, 1388, 2324, 841, 1185, 97,
+	2195, 2820, 59, 2195, 156, 3241, 322, 2940, 396, 2867, 3177, 1076, 3284, 658, 659, 2979,
+	666, 819, 1203, 1355, 3105, 1428, 2945, 2916, 938, 801, 2940, 2420, 786, 3025, 1490, 738,
+	1098, 962, 876, 2594, 865, 2746, 1289, 2234, 28, 25, 1148, 2938, 3233, 1257, 3156, 2114,
+	2658, 2305, 2305, 1018, 1138, 1132, 2884, 620, 3220, 2986, 3035, 0, 2953, 1098, 1451, 3108,
+	2897, 2178, 3137, 484, 2049, 2082, 1004, 876, 1083, 3209, 2890, 2553, 2345, 3137, 89, 2649,
+	1316, 1116, 2029, 100, 738, 2258, 2659, 1154, 2785, 1346, 1451, 705, 2049, 2755, 1161, 763,
+	2524, 1410, 2122, 2651, 2979, 1586, 73, 1468, 1969, 3209, 524, 2873, 2674, 3052, 41, 836,
+	116, 522, 914, 3243, 3153, 2196, 92, 811, 1075, 1020, 2731, 1874, 1065, 2634, 1060, 2817,
+	1515, 1042, 2377, 226, 698, 2505, 1604, 2778, 1386, 1386, 580, 2099, 2955, 2553, 1137, 2617,
+	2828, 1307, 3234, 2433, 257, 676, 2747, 1116, 1386, 145, 2796, 722, 2594, 3156, 1330, 1402,
+	1075, 3233, 1442, 1386, 2052, 155, 1498, 401, 2068, 1618, 2050, 2050, 188, 884, 258, 498,
+	691, 1922, 76, 76, 1041, 3249, 298, 3051, 1058, 1388, 1970, 2988, 2988, 836, 1164, 572,
+	2586, 769, 2739, 524, 452, 674, 297, 3108, 2051, 2993, 2907, 2988, 2137, 2940, 2329, 2195,
+	370, 1378, 2049, 3233, 738, 1209, 1330, 3257, 3257, 3124, 857, 697, 698, 2401, 2106, 1770,
+	2731, 891, 1484, 930, 1097, 2939, 322, 1139, 1138, 298, 3298, 1410, 2073, 3154, 370, 2897,
+	1137, 89, 1089, 3234, 3241, 145, 1970, 556, 331, 265, 1593, 1001, 1075, 873, 2788, 586,
+	2068, 492, 876, 531, 1506, 3153, 2141, 1652, 739, 809, 1972, 2364, 2938, 2707, 2329, 619,
+	2929, 740, 2747, 2745, 596, 1067, 3249, 1073, 2938, 2404, 2786, 2908, 2907, 354, 1073, 377,
+	2987, 938, 3089, 2772, 1986, 113, 2921, 1052, 2865, 2276, 2914, 1324, 2906, 99, 1033, 1298,
+	1100, 1298, 2497, 705, 2825, 2707, 3156, 1076, 1684, 1572, 331, 996, 994, 1404, 1378, 2650,
+	1714, 2986, 2978, 1586, 2507, 2876, 2876, 2915, 3137, 1986, 2932, 1058, 1098, 2932, 331, 612,
+	2986, 3260, 2745, 1586, 2620, 1058, 1098, 1179, 2121, 2954, 2227, 1026, 1474, 1364, 2138, 2809,
+	2011, 2419, 756, 2578, 1339, 2753, 2986, 292, 1514, 1139, 2402, 333, 113, 2828, 1067, 2940,
+	3107, 738, 1876, 1612, 1346, 2218, 835, 1076, 1139, 2561, 2923, 3137, 75, 2345, 2994, 3243,
+	1650, 2524, 1068, 2922, 1098, 1028, 764, 691, 3092, 2066, 1540, 2547, 2994, 2828, 2218, 2418,
+	3153, 433, 2753, 2650, 1450, 2218, 2586, 2148, 3097, 2497, 2412, 2564, 1209, 2785, 835, 2049,
+	779, 779, 2545, 1930, 2593, 786, 377, 529, 1844, 1058, 2492, 828, 370, 2073, 242, 2067,
+	1010, 1586, 2868, 772, 777, 3233, 2706, 2082, 2916, 529, 1067, 1187, 3284, 491, 1466, 145,
+	3177, 2305, 2786, 1057, 1402, 1036, 2969, 2068, 891, 756, 756, 2682, 1004, 2049, 2329, 433,
+	1970, 2979, 994, 1083, 996, 1020, 876, 1804, 2940, 777, 1193, 873, 873, 210, 1556, 1107,
+	522, 3209, 1364, 1347, 290, 401, 1386, 2857, 2106, 2467, 674, 2657, 860, 3058, 2524, 1371,
+	1483, 1410, 1612, 1474, 274, 2524, 1209, 329, 2586, 129, 1484, 1129, 3132, 3089, 2433, 3113,
+	1554, 1666, 1795, 2916, 2634, 1970, 3180, 2345, 2785, 2138, 962, 1073, 401, 1057, 2905, 2074,
+	2883, 2953, 660, 2890, 3154, 2082, 3281, 402, 2043, 2436, 1004, 1300, 3137, 3289, 3004, 2364,
+	2785, 377, 532, 666, 763, 1666, 2779, 2081, 2178, 1436, 1450, 2082, 2804, 2268, 674, 3107,
+	2706, 1355, 3010, 2484, 609, 297, 2586, 1602, 1138, 298, 2524, 1154, 1154, 532, 1036, 1057,
+	1875, 2812, 2707, 1819, 2259, 3177, 2658, 3081, 698, 2114, 2163, 962, 2066, 833, 1451, 1356,
+	777, 330, 2787, 2412, 3243, 2301, 1058, 577, 1113, 1483, 1077, 333, 2994, 2564, 2433, 1081,
+	2578, 1435, 1834, 2947, 2786, 1036, 2361, 3284, 2874, 297, 764, 1138, 3284, 2940, 2098, 2043,
+	2906, 1370, 705, 1035, 484, 1060, 2540, 164, 2018, 298, 331, 3185, 876, 1058, 1099, 1067,
+	2106, 3098, 1075, 2074, 492, 2939, 131, 2505, 2385, 1435, 1388, 242, 1602, 2946, 2594, 2570,
+	1618, 2050, 2682, 145, 1052, 1060, 2065, 1771, 1818, 2937, 779, 1187, 2948, 1844, 2107, 2907,
+	2050, 1612, 3124, 876, 377, 1057, 1298, 2026, 516, 330, 786, 1618, 2977, 3156, 1027, 2065,
+	1371, 1370, 2284, 1483, 1388, 426, 1516, 1636, 1036, 1905, 1514, 3156, 777, 586, 2994, 1388,
+	692, 3234, 2515, 1402, 1084, 330, 2108, 3177, 1482, 2906, 1388, 3177, 292, 1098, 628, 2521,
+	1010, 1804, 2988, 1466, 1332, 1093, 2803, 873, 1139, 2817, 1442, 2953, 1073, 2947, 2978, 2954,
+	2809, 1834, 162, 258, 1338, 1139, 2465, 2388, 2746, 402, 2138, 2130, 202, 1132, 2988, 1506,
+	1388, 426, 1490, 483, 1154, 2906, 1339, 1338, 3178, 1370, 1387, 52, 1722, 2988, 1442, 869,
+	2068, 396, 1017, 2833, 2986, 2940, 2065, 1905, 2865, 273, 332, 2052, 1180, 2940, 1154, 2788,
+	2868, 937, 2988, 1300, 1346, 1283, 2492, 2785, 17, 2937, 2049, 337, 307, 2097, 1283, 1187,
+	1283, 1187, 355, 2348, 841, 2945, 2833, 2825, 2986, 2068, 2817, 2932, 785, 2777, 2580, 1108,
+	1905, 993, 2620, 1017, 2865, 1961, 2787, 2820, 337, 2388, 2364, 913, 332, 2940, 628, 2986,
+	388, 1017, 3155, 3148, 395, 172, 2779, 2050, 172, 172, 2721, 1140, 2066, 306, 2324, 307,
+	2324, 3163, 2540, 2540, 1388, 3058, 2986, 1388, 873, 467, 628, 2499, 1073, 3130, 1668, 1668,
+	2921, 1668, 418, 2913, 2627, 2409, 468, 2369, 2868, 2892, 2433, 194, 1154, 1995, 2060, 2122,
+	2524, 2106, 3011, 1404, 2940, 731, 3154, 2932, 194, 1041, 473, 1058, 546, 3137, 3011, 2753,
+	324, 148, 2620, 1108, 2369, 2946, 537, 1132, 1036, 428, 2940, 473, 588, 1081, 1404, 148,
+	586, 1073, 1073, 2433, 1905, 596, 3180, 2945, 2108, 2940, 2345, 2084, 1210, 2818, 2892, 532,
+	1035, 1035, 835, 2081, 1057, 2940, 1905, 1035, 596, 2937, 2817, 2778, 860, 1683, 1587, 1587,
+	19, 1099, 586, 2988, 115, 116, 116, 1978, 1978, 116, 258, 1570, 930, 187, 1978, 1427,
+	1065, 3105, 2289, 1684, 2708, 2890, 659, 2218, 2803, 1138, 1682, 930, 2122, 580, 2345, 2579,
+	1954, 1138, 617, 436, 113, 2297, 2297, 1572, 2289, 2433, 2433, 2708, 938, 1076, 2564, 2297,
+	1514, 1682, 1570, 2658, 2219, 267, 2043, 1485, 3105, 2316, 3105, 1602, 1483, 2130, 546, 2420,
+	521, 1642, 1154, 1562, 2052, 2001, 1707, 2052, 489, 2801, 353, 697, 2914, 1748, 149, 738,
+	2401, 569, 2105, 2052, 2945, 2785, 908, 2915, 25, 2900, 1212, 2105, 2900, 569, 476, 1516,
+	2106, 2915, 3009, 3009, 2475, 2477, 3147, 153, 2971, 484, 2475, 1364, 1772, 2699, 674, 875,
+	2649, 3153, 2122, 145, 3060, 1619, 425, 1036, 537, 916, 244, 3234, 356, 2730, 676, 460,
+	2785, 2705, 1562, 2122, 2052, 2364, 2012, 916, 2065, 2777, 2777, 2892, 2500, 2235, 819, 1081,
+	306, 2777, 2677, 1131, 2585, 3153, 3155, 2065, 1612, 835, 2737, 1115, 1115, 2260, 1161, 978,
+	2572, 2139, 1058, 124, 124, 764, 2756, 3161, 681, 2849, 1154, 995, 1826, 2052, 698, 2868,
+	2868, 2100, 2938, 2772, 3010, 2994, 924, 2907, 2403, 290, 476, 2978, 612, 996, 1052, 2049,
+	1684, 1884, 1586, 458, 1619, 1612, 313, 1937, 115, 2345, 3155, 1956, 1932, 3219, 3017, 825,
+	1450, 1586, 3058, 705, 1905, 1388, 1498, 201, 705, 2746, 996, 1668, 1588, 2436, 1139, 3018,
+	2705, 2706, 2706, 938, 1388, 1611, 2938, 665, 692, 2978, 2626, 3156, 3123, 833, 3105, 2906,
+	2497, 1292, 1123, 1137, 2828, 2122, 2940, 1065, 3161, 2138, 2025, 1036, 1612, 97, 3058, 3178,
+	1364, 2977, 833, 978, 761, 667, 1571, 2500, 993, 2018, 395, 676, 3153, 2524, 1820, 297,
+	1442, 1948, 161, 2052, 2500, 1770, 1138, 2284, 3180, 2409, 1372, 2876, 1154, 738, 1932, 1643,
+	2572, 2913, 1059, 2971, 860, 108, 2882, 1466, 1482, 476, 1508, 2828, 2025, 3058, 1113, 2946,
+	1930, 1098, 2932, 1033, 1034, 3028, 298, 2945, 2746, 988, 1076, 2914, 1428, 2500, 1060, 658,
+	2842, 738, 2283, 2324, 3155, 2948, 2778, 2787, 1203, 3177, 1084, 1508, 1508, 28, 572, 2620,
+	1674, 1372, 2937, 1611, 2138, 1105, 2028, 2747, 2818, 2828, 978, 2868, 2524, 1289, 2594, 2092,
+	1140, 659, 3169, 2236, 2018, 2890, 2849, 3156, 865, 1018, 1650, 1050, 2713, 2060, 1924, 2777,
+	2129, 1450, 2940, 1065, 1116, 2067, 1081, 1089, 3137, 2417, 3234, 220, 666, 1036, 1060, 1450,
+	259, 1042, 995, 1834, 2890, 1108, 1428, 2122, 2747, 3132, 1164, 914, 73, 1562, 3234, 2978,
+	2785, 162, 580, 1020, 978, 2940, 2043, 2955, 1339, 932, 1348, 915, 1387, 809, 738, 2778,
+	1404, 378, 706, 2940, 2988, 2658, 1354, 907, 1108, 1065, 313, 1123, 1587, 2537, 297, 1956,
+	2804, 2404, 2674, 1308, 2017, 1804, 916, 1113, 2817, 2388, 1779, 2673, 2971, 2820, 2802, 2651,
+	626, 2524, 2697, 1145, 226, 2620, 1388, 2476, 2500, 1372, 2476, 2593, 586, 1356, 1330, 1402,
+	2746, 2769, 3010, 1020, 522, 961, 2268, 1076, 3115, 2324, 738, 860, 2844, 2428, 2460, 2898,
+	388, 3116, 2932, 1241, 2772, 914, 2705, 569, 938, 2769, 1137, 2388, 1410, 1041, 2564, 3233,
+	532, 2092, 498, 1148, 3241, 2785, 2818, 2050, 835, 891, 2905, 1434, 2587, 3169, 1971, 932,
+	265, 2433, 2049, 681, 3154, 1484, 1732, 1138, 2594, 402, 1372, 3132, 2018, 690, 2505, 2627,
+	1980, 476, 2988, 1770, 2985, 1484, 764, 1612, 1116, 1442, 1498, 2946, 436, 2130, 1010, 2988,
+	1779, 2401, 129, 378, 993, 2993, 1330, 1044, 2105, 2905, 2067, 2625, 1627, 3155, 2947, 162,
+	100, 2993, 2756, 2276, 689, 2105, 2993, 1211, 1060, 2388, 2993, 2324, 1484, 3244, 586, 2937,
+	1076, 1619, 1924, 2785, 2986, 2993, 2403, 2404, 2226, 1020, 3179, 1075, 1859, 2986, 2122, 2650,
+	2130, 588, 674, 3089, 162, 2772, 2769, 524, 2745, 2753, 2234, 2828, 220, 2748, 938, 771,
+	2907, 978, 2876, 1611, 1211, 1570, 2953, 2907, 2978, 977, 1627, 2411, 1587, 3025, 1042, 1708,
+	875, 308, 628, 1924, 1586, 1404, 2052, 2052, 1586, 2626, 412, 2746, 193, 2681, 1619, 1036,
+	1668, 2865, 1058, 1962, 1073, 1075, 994, 708, 2809, 2940, 2948, 3108, 2418, 1097, 297, 1026,
+	2580, 2986, 116, 1643, 2417, 2673, 2409, 2971, 1138, 572, 2684, 1091, 1091, 2122, 2905, 2585,
+	1466, 1052, 2994, 1715, 68, 2979, 2138, 3209, 1412, 258, 2802, 378, 1804, 3241, 2729, 2417,
+	1555, 2954, 1324, 1300, 706, 1076, 2868, 1474, 2746, 756, 161, 2954, 2025, 1108, 2908, 2586,
+	2994, 2555, 2994, 1402, 2923, 1602, 3227, 298, 1212, 2572, 2563, 2713, 1449, 825, 2313, 1650,
+	3092, 2418, 2940, 1500, 1539, 2043, 2745, 1388, 3025, 2780, 2785, 2753, 2073, 3058, 2417, 2524,
+	18, 2098, 2513, 3010, 2860, 2945, 2218, 1044, 2524, 2556, 1772, 2561, 2417, 2236, 17, 1932,
+	332, 330, 1937, 2761, 201, 1636, 786, 529, 932, 1028, 2788, 3241, 522, 3156, 2842, 739,
+	1098, 1002, 785, 3243, 2593, 2610, 2537, 116, 1092, 1036, 883, 2946, 777, 1466, 3156, 2908,
+	2388, 1555, 2954, 378, 1516, 1340, 1490, 2922, 145, 2577, 2988, 2859, 996, 116, 129, 3156,
+	1084, 1252, 2404, 2369, 521, 1612, 42, 1483, 995, 993, 2977, 259, 676, 2969, 883, 1555,
+	2107, 2986, 1996, 1060, 2898, 274, 2049, 2787, 1060, 1484, 1474, 1466, 1107, 890, 402, 1476,
+	3154, 756, 2074, 1386, 2907, 210, 1092, 401, 378, 2682, 1905, 2610, 2931, 2786, 1612, 2586,
+	1668, 2369, 916, 1402, 1339, 2713, 306, 761, 706, 2874, 2937, 1556, 3244, 1563, 1193, 1508,
+	1969, 2436, 3115, 3113, 3212, 2868, 1020, 1051, 1076, 2905, 2467, 1418, 435, 2618, 2916, 1081,
+	402, 2955, 978, 2859, 2436, 860, 2954, 2817, 3253, 1305, 2868, 1404, 3156, 2746, 1980, 2988,
+	1092, 2025, 484, 1036, 1098, 2779, 1914, 1058, 1929, 2746, 2524, 2066, 2066, 2785, 1484, 2788,
+	2892, 612, 1026, 1643, 2268, 2524, 1355, 3137, 402, 2940, 3132, 2729, 2364, 2578, 274, 2890,
+	1300, 2929, 2380, 2674, 3177, 2283, 945, 116, 2361, 258, 258, 2435, 2658, 2041, 1434, 2746,
+	2324, 2324, 298, 1123, 298, 1004, 1089, 1356, 284, 763, 441, 980, 2497, 2436, 1969, 914,
+	3010, 1452, 980, 738, 932, 938, 2802, 1076, 2361, 2788, 2989, 1483, 1338, 1820, 2986, 1435,
+	1619, 3051, 481, 1020, 3058, 2828, 2988, 1387, 2420, 2882, 1442, 2732, 3241, 2969, 1036, 196,
+	1404, 532, 2932, 44, 1018, 3137, 258, 1556, 475, 476, 2940, 2540, 1980, 1140, 2564, 2098,
+	1057, 3234, 1402, 1834, 889, 1108, 698, 2324, 1058, 2537, 1036, 331, 2564, 2505, 555, 2324,
+	3179, 1332, 145, 1402, 1611, 2417, 2436, 1612, 1820, 2954, 2954, 1602, 1108, 2050, 116, 1060,
+	930, 2234, 436, 2772, 2593, 2947, 2947, 604, 394, 1052, 2108, 1340, 1164, 19, 2042, 3234,
+	2746, 145, 835, 2066, 2954, 145, 1316, 692, 201, 1581, 1076, 2747, 1508, 3036, 1516, 1388,
+	2977, 2916, 1483, 2500, 3156, 2954, 586, 2739, 1033, 2828, 1930, 2403, 129, 258, 1668, 1450,
+	1073, 2044, 2324, 298, 835, 145, 1052, 2804, 1482, 2100, 916, 2954, 2218, 1388, 1116, 2817,
+	2954, 2539, 2747, 2828, 1010, 2884, 3177, 1466, 1332, 604, 674, 994, 1332, 2433, 1445, 2954,
+	1610, 1060, 1404, 1076, 2954, 700, 1434, 2940, 1073, 3004, 258, 468, 2170, 1075, 1338, 674,
+	2468, 2993, 3234, 705, 2388, 1371, 1338, 402, 2130, 2969, 2066, 667, 860, 1154, 2908, 932,
+	2954, 2283, 3036, 1490, 2908, 1386, 1611, 2364, 2577, 483, 1091, 259, 2954, 932, 52, 3178,
+	1339, 1338, 1723, 2729, 1490, 2890, 2803, 2908, 764, 2908, 2988, 1051, 129, 1636, 865, 513,
+	1033, 2817, 2817, 1033, 977, 1442, 3052, 3204, 1131, 3092, 2828, 308, 3234, 3025, 3025, 196,
+	2914, 2052, 3161, 698, 1827, 1123, 2754, 2041, 2940, 1482, 369, 1977, 1180, 1932, 2906, 1180,
+	1940, 1684, 275, 1420, 876, 1196, 612, 865, 2833, 3156, 865, 865, 2747, 2076, 125, 458,
+	2794, 3145, 3178, 1211, 3124, 738, 50, 2828, 2828, 1444, 3233, 2876, 1140, 2580, 1948, 1123,
+	1946, 2570, 2570, 155, 2915, 2657, 2363, 3180, 3092, 531, 2748, 2418, 1404, 308, 1027, 3169,
+	993, 2492, 1340, 2649, 1091, 2868, 962, 2139, 1428, 1020, 2914, 2857, 2857, 2803, 2946, 2777,
+	3169, 2922, 2420, 2745, 2658, 1636, 3025, 1180, 977, 1356, 2794, 3178, 2875, 3145, 2028, 2905,
+	1034, 865, 284, 1033, 1203, 1140, 674, 2377, 2932, 1036, 0, 2588, 1108, 2188, 1428, 2785,
+	738, 1123, 2828, 2043, 2649, 3234, 2651, 2730, 907, 1969, 1347, 2908, 2868, 705, 308, 2218,
+	994, 2785, 2433, 940, 2889, 1260, 1145, 2817, 2785, 2905, 916, 3212, 1164, 524, 2828, 1058,
+	2780, 2905, 1515, 914, 2908, 1020, 1596, 1138, 492, 92, 698, 1436, 1305, 1044, 2697, 2785,
+	436, 2778, 977, 275, 739, 2772, 1089, 401, 708, 2018, 2114, 2276, 2785, 2114, 2836, 273,
+	2908, 2908, 2940, 1154, 2988, 772, 2162, 1978, 2852, 772, 2409, 268, 2377, 2851, 1779, 809,
+	2749, 290, 940, 1299, 3163, 596, 2793, 1033, 708, 1404, 2873, 2841, 1026, 1091, 1073, 116,
+	2953, 3179, 2747, 2681, 2363, 2785, 1859, 1859, 258, 2905, 1123, 1123, 2988, 1588, 2345, 2748,
+	3090, 1108, 2114, 2226, 1586, 1020, 2868, 3124, 2745, 674, 2122, 2540, 2914, 1428, 3179, 1097,
+	3052, 841, 81, 994, 3009, 1715, 2420, 1413, 121, 828, 2692, 2586, 275, 2361, 641, 162,
+	1027, 2826, 2788, 2780, 2785, 3012, 938, 940, 2785, 3010, 2850, 1706, 2363, 2114, 2924, 2889,
+	1612, 1402, 2954, 2779, 2218, 817, 2908, 2076, 1449, 2785, 116, 129, 401, 1484, 1073, 2434,
+	2940, 1474, 1970, 2537, 2940, 2609, 1154, 3249, 3012, 996, 2938, 3156, 42, 2748, 1451, 916,
+	1905, 2188, 1123, 1556, 1305, 2369, 428, 3081, 1073, 2785, 2785, 2785, 2940, 2820, 308, 1026,
+	259, 2932, 2578, 2162, 2908, 2890, 2081, 1164, 513, 612, 2401, 1089, 698, 2497, 1418, 2988,
+	1434, 2658, 2377, 698, 674, 2908, 2890, 1340, 1587, 2588, 2940, 1123, 1596, 1117, 1091, 2954,
+	2988, 2940, 2882, 1338, 2572, 3052, 196, 2540, 2785, 2148, 3251, 1402, 1035, 3178, 2828, 1442,
+	2745, 2940, 2826, 3124, 1036, 458, 1834, 1338, 2234, 2803, 940, 2889, 1108, 322, 492, 2924,
+	940, 1340, 129, 2218, 1388, 1668, 84, 2276, 1516, 1324, 41, 2889, 1292, 2492, 1418, 1388,
+	1482, 1154, 1419, 2908, 2785, 2828, 1466, 2932, 193, 2171, 3004, 1340, 402, 1154, 314, 860,
+	1141, 284, 1610, 2587, 1340, 3178, 1339, 1442, 428, 2988, 3123, 3123, 1914, 3145, 1946, 297,
+	2994, 20, 2748, 917, 1154, 1154, 740, 2930, 52, 545, 2930, 2922, 3267, 2467, 659, 1930,
+	362, 1209, 3041, 546, 2073, 2969, 2074, 1988, 67, 1932, 274, 1073, 1922, 586, 361, 2986,
+	3090, 121, 546, 75, 162, 361, 2979, 2979, 586, 2898, 297, 1826, 1826, 2012, 1129, 1674,
+	2561, 1683, 1354, 2196, 1561, 681, 1570, 1684, 769, 2780, 2908, 785, 92, 2500, 1076, 835,
+	2980, 785, 2409, 1683, 523, 2065, 2140, 2138, 3244, 2604, 2785, 1562, 1233, 2065, 2779, 836,
+	2785, 1386, 1386, 2035, 1057, 769, 3154, 97, 2138, 378, 586, 1140, 1065, 1073, 705, 1985,
+	1209, 1138, 1204, 330, 2788, 92, 1508, 1100, 1538, 2297, 2748, 1570, 609, 2658, 2082, 1084,
+	2785, 1388, 586, 1428, 1922, 1993, 162, 2785, 321, 2746, 1298, 321, 2139, 2139, 50, 676,
+	2122, 1059, 250, 3234, 28, 785, 3212, 867, 1540, 2978, 1196, 162, 987, 2900, 2946, 1017,
+	3212, 3011, 1290, 1827, 522, 1290, 3164, 1684, 92, 1977, 1138, 2938, 2409, 1946, 2794, 2706,
+	994, 1442, 692, 1978, 1771, 2923, 2980, 827, 2884, 1137, 476, 162, 1259, 2803, 1818, 1018,
+	955, 1091, 938, 3124, 1058, 2892, 2361, 2564, 2218, 2428, 2658, 1355, 586, 2794, 2417, 1276,
+	3145, 2988, 2545, 2986, 116, 1562, 2785, 1148, 1386, 2794, 2946, 2529, 1346, 92, 3156, 2906,
+	2345, 1388, 916, 2803, 1113, 1922, 689, 2817, 60, 2050, 1770, 129, 2948, 1330, 1428, 1073,
+	2073, 1305, 2908, 891, 3252, 1610, 265, 2937, 3156, 3145, 2898, 1603, 185, 420, 2385, 1428,
+	531, 1506, 994, 3249, 876, 2747, 705, 2769, 2994, 2841, 3177, 1569, 2748, 353, 2804, 2681,
+	2900, 1730, 2825, 1065, 986, 121, 2978, 2978, 1586, 242, 2922, 2545, 162, 1650, 1002, 2994,
+	2513, 1540, 2994, 465, 2988, 2417, 930, 2073, 2940, 3137, 201, 930, 1556, 1116, 1083, 1668,
+	3113, 258, 42, 42, 930, 433, 100, 1154, 116, 116, 1026, 2042, 1434, 2868, 2658, 2924,
+	1418, 2492, 2817, 2428, 609, 1092, 786, 1148, 586, 1036, 1276, 2803, 2828, 2563, 2803, 2889,
+	1818, 121, 1052, 1844, 1603, 1428, 1731, 867, 2428, 1482, 2563, 2804, 1610, 2170, 1017, 1731,
+	1506, 2803, 2050, 1154, 2874, 1628, 3241, 1516, 1482, 2988, 2524, 2738, 2122, 747, 553, 1364,
+	49, 1057, 978, 524, 356, 761, 1131, 2986, 2051, 2986, 268, 1539, 978, 2779, 737, 2754,
+	1100, 2898, 145, 124, 76, 3004, 1154, 1594, 1154, 2730, 1073, 1586, 475, 2010, 2747, 1018,
+	2804, 2073, 1442, 468, 2940, 26, 2018, 532, 738, 2874, 2787, 161, 395, 827, 1067, 2378,
+	2028, 394, 1209, 2163, 2409, 2401, 2938, 3267, 1065, 1642, 2361, 1451, 116, 3137, 3137, 1154,
+	668, 1466, 1105, 1092, 1076, 1388, 865, 2801, 3169, 819, 2905, 2860, 2914, 2867, 1508, 2524,
+	3177, 2098, 2946, 2890, 83, 659, 2812, 2922, 2794, 922, 873, 313, 2868, 65, 1956, 1355,
+	481, 2953, 1033, 2754, 626, 298, 524, 2779, 2778, 298, 1164, 1586, 92, 2651, 2804, 332,
+	914, 2874, 2906, 2122, 2876, 1346, 1387, 2860, 738, 1450, 2898, 2785, 1442, 1386, 1108, 1403,
+	2555, 2555, 705, 2730, 532, 2010, 3107, 2324, 1642, 2988, 1137, 289, 1330, 1642, 2412, 2746,
+	2627, 332, 3298, 107, 297, 995, 2050, 628, 1305, 265, 2050, 107, 2731, 1484, 402, 859,
+	2907, 537, 92, 1434, 2098, 1978, 1914, 2148, 3234, 2098, 668, 1105, 2114, 587, 1100, 1042,
+	2987, 1572, 1586, 377, 2873, 2618, 2841, 468, 2226, 1642, 1073, 2747, 2251, 1020, 2826, 353,
+	1075, 3204, 268, 1404, 2138, 2794, 596, 2996, 2898, 1731, 994, 2953, 2986, 1026, 2260, 2324,
+	1450, 2417, 2218, 2555, 2922, 2753, 2779, 3137, 1108, 2954, 1539, 2593, 1450, 2586, 1388, 1346,
+	873, 3140, 2073, 449, 1154, 3123, 2922, 20, 145, 2433, 266, 1305, 3201, 401, 1107, 2937,
+	435, 401, 2050, 1386, 1115, 2555, 2122, 2874, 42, 1403, 1594, 3113, 2946, 2932, 2953, 2748,
+	1484, 2778, 513, 2860, 3081, 2890, 2130, 484, 1434, 1418, 2114, 2524, 1026, 873, 2042, 1115,
+	674, 1108, 1450, 1057, 1036, 1115, 20, 116, 196, 2130, 3051, 481, 1091, 884, 2579, 1036,
+	1018, 2324, 2540, 2626, 331, 2986, 1108, 1482, 145, 2434, 2756, 3283, 1338, 2787, 3241, 2874,
+	2251, 2772, 756, 1370, 586, 1388, 3156, 2226, 1386, 3036, 2114, 2620, 873, 2538, 1324, 1466,
+	1482, 1388, 3036, 1340, 2953, 1610, 2809, 2114, 860, 492, 3036, 1018, 841, 162, 546, 162,
+	996, 3154, 1994, 68, 2170, 1388, 2715, 0, 2810, 2065, 67, 1962, 683, 475, 2764, 1905,
+	0, 0, 2717, 994, 1442, 2938, 2018, 394, 59, 1145, 266, 305, 0, 484, 1603, 172,
+	3220, 2018, 121, 3172, 3137, 0, 394, 2953, 2052, 2802, 1475, 524, 1905, 1602, 3201, 108,
+	1436, 3084, 2779, 1980, 473, 2764, 2953, 2907, 761, 468, 2402, 2626, 2626, 914, 266, 2409,
+	2106, 2401, 259, 259, 2258, 2409, 2521, 2401, 2972, 2451, 1484, 739, 2971, 106, 708, 1818,
+	2626, 2978, 1067, 2401, 3090, 532, 738, 1714, 529, 2017, 2649, 1004, 2651, 3140, 3025, 1602,
+	116, 116, 1452, 2890, 1450, 268, 1683, 3010, 676, 738, 809, 2626, 1100, 1100, 2139, 2748,
+	738, 2626, 1683, 617, 1932, 1081, 2713, 458, 1714, 1450, 99, 3139, 332, 1683, 1683, 220,
+	2626, 753, 116, 458, 3156, 1524, 2050, 1524, 1929, 2937, 673, 1004, 2385, 2986, 1683, 1164,
+	2940, 1450, 2385, 546, 322, 1004, 481, 3220, 1057, 2731, 1081, 298, 268, 2699, 1370, 1057,
+	241, 1450, 546, 2683, 1436, 1081, 1081, 322, 1980, 546, 546, 1979, 1098, 476, 2433, 2433,
+	3156, 2938, 1740, 1707, 553, 115, 1097, 1418, 769, 785, 1132, 3171, 2796, 2364, 2865, 1892,
+	1388, 2914, 292, 2978, 49, 1100, 1154, 2050, 2793, 436, 116, 2940, 1388, 3252, 361, 705,
+	3180, 1948, 1978, 761, 1209, 393, 2881, 3153, 475, 3139, 666, 3155, 2610, 1137, 1058, 692,
+	1137, 2361, 1065, 2874, 3092, 156, 1804, 3148, 2969, 1116, 2138, 2610, 2657, 2938, 1097, 2747,
+	1034, 2577, 2915, 308, 3156, 954, 2899, 1588, 580, 1116, 2817, 2660, 2673, 1562, 1979, 2817,
+	2529, 737, 1388, 3156, 450, 618, 2780, 2345, 1354, 2428, 1020, 2802, 2940, 105, 3116, 859,
+	2578, 692, 1538, 1434, 305, 1060, 2627, 25, 308, 116, 116, 1642, 836, 601, 625, 2747,
+	2985, 436, 2899, 3178, 420, 473, 2404, 3163, 308, 2988, 986, 705, 1324, 2914, 290, 2674,
+	2987, 889, 2754, 1020, 1260, 1067, 2945, 2940, 1476, 2316, 1154, 308, 2785, 857, 2940, 2753,
+	1058, 361, 65, 1036, 1450, 252, 2428, 1892, 529, 461, 139, 2577, 3116, 129, 2404, 420,
+	1507, 2940, 3252, 321, 3116, 3100, 2516, 2324, 2146, 540, 1476, 1476, 1668, 2098, 2947, 2955,
+	1026, 738, 1418, 1466, 2082, 1450, 1354, 2802, 692, 473, 2948, 940, 18, 65, 2802, 857,
+	876, 1836, 2988, 2746, 2940, 2969, 1979, 1371, 1388, 2435, 476, 1435, 532, 1435, 1332, 139,
+	1060, 305, 2915, 2875, 1097, 3145, 1581, 1388, 1052, 1332, 1057, 529, 2875, 2955, 2947, 2130,
+	2969, 2577, 529, 1507, 1490, 1490, 161, 161, 875, 50, 665, 513, 665, 58, 59, 2090,
+	1058, 3052, 3052, 1572, 501, 1913, 1097, 1026, 873, 395, 1442, 777, 1668, 1058, 1091, 1971,
+	777, 18, 626, 932, 916, 116, 2731, 322, 2068, 2785, 18, 2819, 932, 1028, 932, 3058,
+	435, 932, 2819, 2932, 2026, 932, 1091, 20, 2841, 1028, 1388, 1995, 938, 1092, 1978, 763,
+	1948, 3172, 1161, 2122, 441, 2148, 3089, 835, 1161, 1161, 3172, 3089, 835, 3121, 586, 1643,
+	2051, 2954, 2986, 89, 3121, 3161, 1962, 938, 2954, 938, 2940, 161, 2731, 938, 36, 3107,
+	2906, 1073, 938, 2985, 1297, 676, 756, 492, 1930, 739, 2122, 2412, 492, 1484, 3107, 1602,
+	1386, 1107, 2868, 1073, 1930, 860, 25, 1482, 2867, 3169, 484, 25, 835, 1388, 1684, 553,
+	764, 2865, 1562, 2740, 3154, 2052, 2995, 2626, 2809, 611, 2833, 2788, 1932, 705, 612, 1642,
+	1650, 2411, 2420, 3010, 1619, 1929, 683, 1627, 473, 1586, 1572, 1188, 2804, 1249, 2420, 2913,
+	3145, 2923, 2401, 1052, 460, 3139, 1292, 1137, 2404, 2938, 2411, 1588, 1668, 3180, 3137, 3137,
+	1618, 2420, 2993, 546, 1772, 3244, 3244, 275, 3091, 2876, 155, 1611, 1466, 2537, 2658, 1609,
+	548, 524, 1740, 1650, 2876, 305, 1292, 1148, 1674, 3140, 2636, 2914, 2907, 1668, 3164, 1668,
+	3133, 3145, 1586, 2553, 2380, 916, 1020, 524, 299, 450, 1148, 626, 1555, 2804, 2785, 1308,
+	1332, 1075, 2363, 2627, 884, 2731, 1380, 2420, 2114, 1428, 2898, 1113, 3145, 1386, 1332, 2540,
+	1148, 2476, 2537, 585, 116, 1980, 1684, 1041, 1772, 1484, 2940, 1098, 187, 3171, 2986, 1041,
+	1540, 2796, 2843, 1033, 884, 3025, 379, 1073, 1588, 587, 986, 2873, 2628, 1298, 777, 2260,
+	1572, 2868, 666, 2772, 1626, 323, 1300, 1609, 2763, 1252, 484, 289, 1209, 2515, 2793, 2114,
+	1668, 1650, 1554, 2476, 3058, 3116, 2940, 537, 1249, 1668, 2484, 401, 1473, 305, 1554, 1995,
+	297, 873, 1602, 2732, 2266, 2001, 2785, 2082, 2042, 3179, 516, 2403, 2484, 1420, 284, 2802,
+	1188, 2932, 2868, 2658, 1674, 1434, 876, 1076, 2932, 20, 1036, 3105, 1075, 835, 3124, 2130,
+	1586, 323, 2316, 1819, 2889, 2924, 1052, 1602, 1618, 2010, 1618, 1371, 1292, 1154, 2873, 1618,
+	1052, 1482, 1602, 1466, 860, 1555, 2787, 332, 2587, 1188, 3179, 1570, 1105, 1105, 2988, 2492,
+	3058, 1154, 2419, 2939, 2403, 3153, 986, 2403, 2955, 1139, 3169, 1091, 450, 595, 19, 1091,
+	3081, 3001, 52, 2418, 556, 2052, 1057, 3243, 761, 2780, 3130, 1257, 769, 2788, 674, 1292,
+	484, 1539, 2345, 473, 1154, 1388, 737, 1642, 627, 1052, 1193, 3155, 2052, 1187, 1100, 145,
+	628, 2900, 1977, 3130, 2906, 2540, 3201, 281, 612, 2715, 2908, 1105, 705, 666, 1668, 3091,
+	1137, 2988, 1209, 2706, 2706, 523, 3100, 3137, 628, 738, 1683, 3180, 1322, 121, 1851, 2017,
+	1969, 1442, 1948, 1364, 2028, 161, 2028, 2401, 3018, 20, 1388, 1466, 2658, 2972, 1388, 1292,
+	331, 1233, 2138, 3177, 1289, 873, 628, 1730, 2060, 1484, 2747, 20, 788, 2804, 2842, 2906,
+	572, 1969, 2785, 1355, 978, 2492, 2794, 2081, 2109, 2746, 2082, 2940, 1233, 2817, 2148, 260,
+	1346, 977, 2986, 2817, 2794, 1563, 1508, 2971, 281, 284, 2772, 1450, 2956, 1562, 2148, 2908,
+	2345, 1307, 2988, 308, 1001, 1483, 291, 1075, 1892, 2505, 3234, 1233, 1970, 2905, 3220, 1241,
+	298, 2050, 3252, 2108, 1434, 1161, 161, 556, 1642, 537, 1073, 940, 1484, 20, 2540, 2148,
+	1378, 89, 2946, 604, 2779, 2050, 1499, 2731, 531, 1730, 92, 2052, 291, 2251, 2906, 546,
+	556, 586, 2706, 1098, 2953, 123, 1212, 116, 2748, 2492, 3137, 596, 2794, 484, 2618, 1731,
+	1972, 1075, 524, 2580, 242, 2626, 2052, 612, 705, 2876, 2148, 2148, 1539, 817, 1779, 2524,
+	626, 394, 1450, 2497, 2586, 76, 1002, 1977, 2747, 2307, 1371, 449, 2626, 2794, 2785, 1402,
+	1930, 2746, 3011, 601, 3130, 1209, 1322, 3201, 2922, 883, 3201, 258, 2052, 42, 1969, 1452,
+	1483, 1188, 363, 291, 2947, 1371, 129, 2052, 1666, 2052, 433, 3249, 2108, 388, 1498, 1057,
+	2364, 1354, 2130, 3081, 516, 1076, 2788, 1434, 556, 2578, 1026, 1930, 3018, 2081, 521, 1388,
+	1076, 1089, 2785, 3115, 2082, 609, 1075, 2988, 3220, 938, 1212, 3058, 1370, 1098, 331, 2932,
+	2148, 484, 2939, 1081, 1977, 1977, 2988, 2009, 628, 20, 1209, 1073, 2988, 2251, 1602, 1948,
+	394, 162, 2915, 1540, 179, 2802, 1292, 1370, 1371, 3156, 1388, 1388, 674, 2148, 1948, 2953,
+	1388, 1466, 1466, 1668, 162, 2465, 860, 1338, 179, 2906, 2420, 2420, 1387, 2202, 2388, 3004,
+	2500, 2050, 2561, 1540, 2828, 2921, 2801, 2050, 2050, 3155, 105, 604, 3164, 2196, 2937, 2418,
+	2980, 3156, 2634, 738, 740, 1612, 3267, 3153, 2532, 1588, 3300, 2129, 996, 3180, 2402, 2540,
+	394, 250, 1610, 1515, 2987, 2810, 2778, 2633, 1996, 3180, 875, 2794, 3153, 1060, 780, 3137,
+	780, 2476, 1108, 2404, 753, 1307, 524, 491, 1052, 2594, 2050, 836, 860, 3284, 1442, 1484,
+	155, 1108, 491, 3154, 1484, 258, 116, 3131, 1033, 2979, 2788, 2945, 3241, 1052, 3137, 738,
+	2996, 2778, 2803, 2914, 3153, 2937, 1586, 2497, 524, 92, 3234, 3137, 2971, 1060, 780, 2586,
+	2497, 1540, 2564, 740, 2873, 2050, 2988, 2787, 1057, 2500, 258, 476, 876, 2540, 1387, 1834,
+	1610, 491, 1388, 2170, 3004, 2618, 3036, 1372, 2226, 2987, 2986, 1386, 2828, 2098, 938, 2673,
+	2860, 2497, 2194, 2673, 3243, 242, 763, 2940, 2801, 155, 1778, 2121, 2121, 3163, 700, 932,
+	3010, 1209, 1627, 3153, 1113, 115, 3153, 2988, 1612, 1260, 68, 1977, 1770, 1388, 2978, 3265,
+	1977, 162, 1442, 1668, 300, 1778, 2098, 2913, 3298, 3156, 3153, 2434, 1140, 3243, 1050, 1057,
+	297, 2658, 3156, 1050, 938, 2945, 3241, 3156, 1097, 2195, 588, 2938, 3177, 1036, 1834, 740,
+	2785, 779, 1346, 737, 2892, 2476, 1515, 1307, 763, 1113, 2618, 298, 2674, 2377, 2476, 2900,
+	1499, 1484, 836, 3298, 2195, 3228, 76, 60, 1057, 3153, 3156, 1307, 1378, 1970, 1209, 155,
+	322, 3284, 2988, 2521, 1524, 2809, 2937, 2788, 123, 1060, 738, 1980, 1876, 1097, 3163, 3249,
+	2867, 297, 492, 2755, 2802, 3241, 2988, 1060, 2868, 3139, 3156, 492, 1068, 1057, 779, 779,
+	835, 2218, 2540, 2221, 1060, 1193, 1684, 195, 1586, 3156, 1060, 1484, 2521, 1057, 2955, 2755,
+	2121, 2324, 940, 2940, 1026, 2092, 1059, 2540, 2817, 2042, 1089, 3233, 3163, 3285, 1515, 2540,
+	1834, 2324, 1036, 2170, 1876, 2988, 2009, 1060, 2690, 2755, 297, 1052, 1292, 1515, 129, 2324,
+	2170, 3233, 1386, 426, 2882, 2713, 1129, 2114, 2785, 2114, 1241, 2985, 2401, 1115, 2924, 353,
+	3225, 2673, 1354, 2092, 3099, 2923, 123, 82, 2923, 155, 2713, 3178, 1092, 2084, 540, 2777,
+	873, 2922, 3156, 361, 2924, 2635, 1092, 361, 1123, 2817, 298, 1252, 428, 2769, 476, 1257,
+	1209, 3234, 2865, 2521, 857, 1297, 580, 3237, 2889, 2769, 2713, 2900, 2986, 1140, 2114, 2922,
+	2922, 2635, 274, 2987, 2626, 540, 1140, 1420, 2785, 2780, 1297, 361, 3121, 1283, 1283, 1466,
+	297, 436, 1418, 3052, 428, 2084, 2114, 580, 3052, 1467, 2092, 1388, 332, 2418, 740, 2065,
+	332, 978, 2050, 930, 2409, 697, 2436, 1628, 2131, 3108, 3180, 1442, 1466, 156, 1116, 1116,
+	3113, 59, 2500, 1164, 978, 2658, 2507, 1116, 540, 2940, 2436, 1116, 2131, 1098, 2017, 593,
+	1386, 3203, 234, 513, 441, 2721, 1116, 1187, 1116, 3178, 3178, 1364, 1970, 2986, 306, 761,
+	1562, 3178, 2730, 587, 1057, 1091, 49, 2532, 1058, 2099, 3124, 2547, 2898, 3220, 2994, 996,
+	922, 2820, 226, 116, 115, 1075, 2939, 569, 2361, 2409, 457, 522, 3178, 1700, 305, 833,
+	1388, 2092, 1643, 81, 2634, 2500, 738, 220, 100, 666, 458, 3243, 524, 1442, 3058, 1850,
+	738, 827, 674, 1065, 763, 676, 2419, 1571, 2027, 2621, 1073, 2114, 1466, 1643, 121, 1508,
+	876, 2129, 306, 2945, 2924, 2803, 115, 2114, 1316, 515, 2818, 1105, 2138, 2547, 2234, 666,
+	1289, 3180, 2659, 1057, 458, 922, 220, 3164, 1252, 1330, 116, 2353, 481, 3145, 220, 737,
+	3010, 2674, 1914, 1386, 1346, 1139, 859, 1075, 914, 2658, 2794, 3156, 298, 2532, 2420, 3180,
+	3298, 2819, 2377, 2650, 220, 2906, 780, 1276, 761, 322, 1289, 772, 3010, 1905, 2065, 2819,
+	1075, 2034, 1330, 3257, 115, 116, 116, 788, 2570, 851, 2985, 1073, 492, 833, 306, 3145,
+	2108, 2348, 3171, 1484, 162, 1057, 1434, 2532, 1164, 738, 3090, 833, 1241, 2066, 2065, 1164,
+	370, 859, 2993, 220, 3266, 163, 3058, 2092, 2708, 1506, 473, 2817, 2276, 1076, 2873, 121,
+	2547, 2809, 2803, 2018, 3137, 2841, 994, 2938, 3180, 3001, 377, 1516, 2777, 571, 2492, 1058,
+	1098, 1026, 2841, 1588, 676, 354, 3204, 1985, 705, 3178, 1026, 2092, 986, 2121, 1627, 2068,
+	833, 1300, 2421, 1475, 3010, 938, 2586, 3004, 321, 777, 691, 2276, 3145, 825, 1804, 2068,
+	2819, 428, 1467, 1970, 587, 1388, 116, 3234, 330, 2353, 306, 3180, 2073, 1466, 1338, 1073,
+	172, 1386, 1036, 116, 522, 401, 2905, 1970, 195, 3204, 1978, 1995, 577, 2988, 1636, 2682,
+	3058, 2353, 876, 2938, 996, 259, 1252, 420, 2018, 3052, 1057, 875, 2524, 1475, 220, 1484,
+	1779, 2553, 428, 537, 2553, 1364, 596, 1413, 2817, 162, 1612, 2353, 484, 1418, 473, 532,
+	739, 1075, 1643, 1300, 468, 1089, 513, 1026, 2547, 1354, 3033, 2817, 1484, 2420, 3033, 2053,
+	1922, 2050, 1922, 763, 1140, 1484, 1484, 2906, 163, 481, 2292, 3185, 825, 2065, 1402, 172,
+	3172, 1332, 2421, 1338, 1300, 2986, 3004, 930, 3137, 2570, 2620, 1804, 322, 1058, 2938, 2050,
+	2610, 3204, 3172, 673, 2515, 3172, 2069, 3234, 2610, 1484, 1482, 1075, 2708, 2954, 2988, 1332,
+	1466, 2092, 1402, 1338, 2065, 3004, 3161, 2130, 1402, 121, 596, 3275, 1386, 2497, 1506, 2954,
+	3004, 3234, 2988, 1611, 522, 674, 2401, 3130, 2401, 1883, 938, 1372, 2801, 3243, 1770, 444,
+	3116, 2065, 3097, 115, 67, 2780, 2345, 1193, 2226, 699, 116, 436, 2949, 3130, 1611, 2573,
+	996, 49, 1388, 761, 1140, 2028, 1668, 417, 3105, 3172, 305, 2524, 2636, 1388, 2785, 2524,
+	978, 2658, 3241, 220, 3004, 3169, 1434, 3209, 59, 1353, 700, 658, 2129, 938, 1410, 2804,
+	738, 1410, 196, 1113, 1387, 3004, 1484, 1138, 2050, 436, 60, 3113, 1434, 3252, 1113, 891,
+	1001, 2299, 2299, 2586, 123, 2226, 1620, 986, 2867, 3252, 994, 1076, 3033, 394, 1386, 2828,
+	737, 1876, 92, 835, 2859, 777, 2586, 2123, 1065, 209, 3209, 2586, 1610, 2299, 700, 3049,
+	1193, 1084, 1666, 2299, 2299, 1876, 2785, 1410, 1084, 1276, 164, 1018, 2435, 3252, 2804, 1876,
+	2682, 1804, 1388, 3300, 522, 1804, 2636, 1340, 1612, 2497, 1129, 2788, 817, 3147, 1129, 2980,
+	1060, 244, 3172, 2890, 3001, 978, 2985, 938, 2730, 2196, 2755, 2754, 2122, 1700, 3241, 2667,
+	1827, 730, 1060, 2433, 378, 1977, 3140, 2345, 978, 3155, 1058, 697, 3010, 2196, 475, 1105,
+	2524, 683, 2555, 436, 1131, 3017, 53, 1107, 737, 3156, 2049, 3243, 322, 978, 3017, 1372,
+	2788, 738, 2828, 2401, 161, 3180, 2129, 1442, 3180, 2380, 764, 2915, 738, 2706, 3139, 468,
+	332, 2417, 3161, 2802, 3267, 1121, 68, 2130, 1668, 2436, 3284, 1292, 1113, 2196, 922, 2828,
+	1098, 3177, 322, 844, 59, 1154, 1292, 994, 396, 1018, 809, 2593, 1098, 1260, 1091, 2138,
+	755, 1508, 2876, 105, 2804, 738, 795, 572, 2218, 2636, 2945, 1371, 2828, 1148, 2868, 753,
+	546, 2659, 2497, 1084, 2810, 1036, 1154, 3154, 1075, 1148, 305, 1619, 3140, 1515, 298, 2122,
+	2433, 75, 2659, 2817, 1018, 2097, 811, 2859, 2618, 2668, 2826, 978, 2788, 738, 2649, 2537,
+	604, 1307, 737, 1113, 996, 3153, 2906, 1123, 706, 1060, 2868, 2195, 3249, 289, 619, 1388,
+	1516, 1410, 322, 2139, 2380, 2050, 2050, 3227, 2050, 2731, 2068, 2804, 2428, 2746, 2051, 2594,
+	2731, 769, 2739, 105, 3220, 187, 891, 436, 1498, 1451, 2051, 3108, 116, 388, 1442, 1618,
+	2049, 2092, 2626, 3249, 883, 3257, 2785, 3241, 2844, 1411, 1107, 689, 2258, 1642, 2988, 3251,
+	674, 1516, 2868, 2953, 2372, 2053, 2868, 2809, 1073, 1212, 2804, 2251, 1618, 1057, 596, 314,
+	524, 1642, 1626, 2994, 2828, 83, 2497, 2121, 121, 1019, 809, 401, 1619, 2748, 740, 2747,
+	2666, 825, 1627, 2826, 1404, 3249, 124, 3012, 2945, 2618, 841, 3156, 3012, 297, 258, 468,
+	2794, 2994, 3251, 2865, 2410, 2745, 809, 2873, 2954, 1108, 2940, 3220, 1772, 73, 835, 1930,
+	3172, 1073, 393, 2138, 2467, 3012, 2794, 433, 2785, 2218, 2593, 740, 3010, 289, 779, 2236,
+	994, 3028, 2610, 2804, 2524, 3139, 3252, 2593, 1027, 188, 116, 708, 420, 1386, 2553, 2907,
+	2787, 3252, 1370, 1148, 2068, 1556, 3154, 1515, 1684, 1995, 1402, 1610, 2876, 3251, 1057, 2361,
+	2540, 674, 1516, 107, 2937, 2313, 1674, 2922, 2075, 1042, 2801, 1060, 2349, 2860, 2162, 2876,
+	2540, 2081, 3081, 3299, 3153, 2364, 2299, 1434, 2988, 673, 1418, 388, 3289, 1076, 2180, 259,
+	2259, 2860, 1036, 1004, 3275, 2785, 2075, 3013, 461, 2410, 1036, 2788, 2324, 1075, 1081, 1018,
+	3051, 401, 2828, 1091, 116, 476, 2940, 1835, 2540, 2940, 2355, 2865, 1060, 145, 2067, 1338,
+	2042, 2889, 3275, 2050, 1970, 2924, 1668, 1372, 2826, 3275, 1292, 2977, 2868, 1370, 2801, 258,
+	1091, 1482, 258, 2953, 186, 2171, 2801, 3281, 3275, 1508, 1386, 492, 1339, 1370, 1404, 2497,
+	1129, 2985, 978, 3172, 2801, 785, 3001, 1058, 2730, 1292, 1060, 2196, 2747, 3010, 978, 378,
+	1977, 2345, 769, 1700, 2196, 3252, 1498, 697, 3155, 2754, 683, 3180, 3140, 1827, 2433, 2804,
+	764, 2828, 738, 1404, 3267, 2401, 2788, 3153, 3161, 3172, 68, 738, 332, 2380, 2940, 1113,
+	468, 75, 2218, 1098, 1260, 2180, 546, 922, 1036, 795, 2876, 1084, 1508, 1154, 1091, 2659,
+	811, 2817, 1148, 2860, 2788, 2538, 2593, 1060, 2618, 1057, 2868, 1442, 2953, 2868, 2051, 689,
+	388, 2372, 883, 2410, 2746, 1618, 2428, 105, 322, 2594, 1451, 2139, 3249, 3108, 2731, 1516,
+	3220, 3241, 1212, 2809, 1073, 1619, 1339, 2618, 1627, 1057, 3009, 1036, 2497, 619, 596, 124,
+	2804, 825, 3220, 1019, 524, 1515, 121, 1642, 2994, 1108, 740, 2236, 3139, 708, 433, 779,
+	258, 1386, 2940, 1073, 145, 1993, 1556, 1370, 2953, 2553, 1674, 2313, 2826, 1418, 2364, 3081,
+	1081, 2067, 2081, 1018, 1091, 3275, 731, 2828, 769, 731, 2145, 731, 2053, 161, 2018, 2812,
+	3125, 769, 2953, 2953, 2108, 2796, 860, 3289, 2578, 297, 2052, 2764, 2953, 1370, 2578, 1482,
+	860, 2739, 2739, 769, 2739, 915, 1506, 1505, 738, 2401, 666, 833, 3179, 1137, 1570, 835,
+	1642, 769, 52, 844, 2618, 1148, 738, 2404, 2907, 3124, 3284, 844, 3234, 2988, 3156, 27,
+	666, 1339, 2435, 2497, 1978, 1540, 1451, 52, 666, 1386, 274, 2748, 116, 1060, 3081, 313,
+	1451, 1057, 1148, 1612, 3124, 1506, 1978, 1057, 1057, 1490, 2914, 1611, 2073, 458, 1587, 2914,
+	2979, 2979, 698, 49, 777, 2916, 835, 2073, 3041, 777, 1442, 2940, 3180, 521, 2857, 2075,
+	2938, 2804, 2218, 2154, 2154, 2075, 1018, 2553, 2804, 2940, 2917, 2073, 2066, 2986, 809, 1098,
+	2585, 2994, 2785, 674, 2361, 698, 2361, 1403, 1370, 809, 1842, 2076, 260, 2987, 820, 2940,
+	313, 2761, 697, 978, 308, 308, 436, 738, 2794, 99, 2940, 1321, 2940, 1977, 1442, 1452,
+	3156, 2130, 2786, 2826, 2810, 2785, 2785, 1210, 2084, 1036, 1033, 2817, 2348, 978, 1081, 522,
+	436, 691, 492, 2348, 308, 3180, 1075, 2873, 308, 1985, 3249, 2730, 1033, 986, 938, 940,
+	916, 42, 1993, 2940, 1402, 986, 42, 1434, 1963, 2084, 42, 673, 2940, 1036, 2873, 492,
+	2924, 1355, 1355, 1203, 1572, 3131, 2050, 827, 827, 827, 546, 546, 658, 2443, 2251, 1708,
+	1708, 593, 1371, 2649, 3243, 809, 276, 932, 3010, 52, 1977, 2938, 2500, 2132, 1065, 1140,
+	1049, 330, 1356, 1499, 1058, 2585, 1907, 1474, 1844, 1083, 1939, 3090, 1474, 1057, 1356, 1052,
+	2977, 1668, 1010, 659, 2940, 553, 2930, 457, 2507, 2098, 3010, 307, 473, 473, 978, 811,
+	3154, 1932, 1804, 473, 3139, 284, 1442, 3145, 2979, 2716, 1418, 1466, 3154, 1818, 2633, 658,
+	2900, 2641, 841, 2868, 1402, 932, 2412, 1428, 2012, 1113, 1140, 115, 523, 890, 2754, 2868,
+	2017, 401, 556, 1770, 2650, 1139, 401, 1297, 1402, 1300, 401, 1402, 2763, 1300, 1402, 1402,
+	401, 42, 2409, 2507, 2649, 1300, 1804, 3154, 473, 1818, 2090, 1771, 2649, 2649, 1466, 2988,
+	2988, 3124, 2500, 2524, 2940, 2524, 2500, 3124, 3124, 2228, 2940, 1361, 1057, 2122, 1227, 212,
+	785, 162, 1020, 1025, 307, 2196, 2820, 2235, 3171, 2996, 588, 769, 2218, 761, 241, 2772,
+	266, 835, 3153, 914, 737, 690, 698, 1953, 1940, 1073, 682, 3225, 2978, 1700, 33, 1227,
+	2162, 817, 2988, 2755, 2922, 2050, 1978, 2067, 2785, 2785, 692, 1227, 1115, 2572, 2404, 3163,
+	3116, 2826, 2404, 2748, 3172, 546, 475, 692, 50, 162, 2130, 2626, 92, 841, 2569, 3243,
+	691, 3153, 1772, 2018, 3244, 739, 1940, 3137, 2802, 3300, 1953, 1067, 2412, 3153, 81, 1683,
+	2129, 994, 1209, 307, 2948, 2865, 2913, 1466, 572, 1171, 1482, 1116, 1851, 2905, 1937, 1268,
+	2938, 865, 907, 785, 572, 305, 1089, 2849, 2849, 658, 28, 962, 1986, 1762, 3244, 873,
+	298, 2635, 3153, 436, 1586, 2826, 436, 2826, 1548, 1548, 1058, 2826, 1813, 1276, 2284, 3044,
+	2050, 1731, 1611, 1834, 1490, 2732, 162, 2755, 2731, 2857, 1091, 1116, 2979, 961, 451, 1428,
+	2361, 2651, 1586, 378, 2404, 2067, 501, 1145, 420, 2857, 2836, 2705, 1945, 298, 1747, 2042,
+	580, 2705, 1796, 1731, 1979, 835, 1506, 1388, 1403, 3116, 436, 1097, 1411, 2474, 1978, 129,
+	1498, 1986, 1371, 1300, 370, 476, 2627, 1747, 1113, 1706, 1324, 2932, 2905, 2196, 2404, 388,
+	739, 739, 1137, 690, 2073, 2732, 572, 1978, 890, 3249, 556, 2772, 1586, 1770, 3204, 308,
+	412, 1506, 1907, 524, 25, 2841, 1731, 2436, 2460, 1715, 3012, 3163, 2226, 628, 2289, 2674,
+	2921, 1076, 2747, 1091, 2986, 1065, 596, 116, 266, 740, 2804, 1772, 1619, 2716, 2610, 2691,
+	75, 2067, 1515, 2716, 2428, 2586, 2524, 3220, 786, 2940, 162, 1418, 1058, 1978, 2826, 777,
+	1515, 148, 1905, 266, 1484, 890, 1937, 346, 129, 1083, 737, 2586, 1666, 2785, 3201, 1516,
+	1089, 2956, 1514, 3156, 2883, 441, 1436, 2658, 1970, 1772, 348, 1418, 436, 873, 2817, 2609,
+	674, 3154, 1089, 2364, 993, 436, 2268, 2809, 2539, 700, 2953, 2361, 3185, 475, 1276, 1834,
+	2698, 1402, 116, 2969, 1154, 332, 2940, 1147, 1324, 1403, 2313, 2698, 835, 2050, 436, 148,
+	2889, 1732, 2772, 3044, 2804, 129, 2844, 1281, 1324, 2905, 1482, 1052, 3017, 1507, 2130, 3044,
+	1490, 1770, 3017, 290, 2065, 2772, 868, 3041, 1434, 867, 3244, 1091, 1804, 324, 1060, 777,
+	324, 1618, 1804, 3156, 3156, 786, 1076, 546, 3153, 2857, 2570, 3137, 1132, 2804, 2986, 241,
+	2923, 2986, 313, 2788, 2788, 1132, 2986, 2987, 2844, 1139, 1132, 2836, 2386, 2387, 2388, 1131,
+	2420, 2577, 2433, 2420, 2627, 2580, 2044, 2044, 859, 1004, 2628, 355, 2484, 2794, 2779, 3169,
+	489, 354, 2361, 2939, 674, 1913, 2572, 674, 67, 354, 922, 683, 65, 115, 1482, 3161,
+	1076, 201, 1442, 3178, 3058, 620, 162, 2802, 787, 354, 2794, 1482, 2114, 1938, 2785, 1265,
+	738, 3052, 706, 1386, 2377, 2986, 1346, 2651, 2988, 2747, 162, 1603, 1780, 1137, 1026, 2427,
+	1212, 124, 1684, 546, 492, 76, 241, 2940, 2513, 201, 210, 1474, 468, 2883, 2924, 313,
+	513, 481, 2074, 1483, 2939, 1058, 1076, 1052, 1602, 2050, 1483, 1482, 258, 2465, 803, 1410,
+	1073, 1073, 2324, 2908, 738, 2017, 2908, 2908, 211, 213, 2940, 1364, 2649, 1089, 20, 1707,
+	2634, 1089, 1098, 1970, 2730, 2940, 249, 1618, 1611, 761, 2065, 2988, 2988, 2378, 2113, 588,
+	996, 2051, 1562, 3244, 1036, 2537, 3156, 2809, 1978, 738, 2698, 2747, 2778, 3153, 2052, 2361,
+	2754, 2068, 2194, 738, 1249, 1100, 1482, 2868, 1057, 2098, 2050, 2906, 697, 49, 2260, 2833,
+	1060, 1001, 1001, 681, 2780, 1154, 827, 3155, 3010, 2098, 43, 330, 1572, 2898, 692, 2204,
+	922, 401, 2946, 2979, 124, 2940, 2089, 2747, 1388, 1979, 628, 2804, 266, 201, 3180, 2521,
+	2618, 2996, 2163, 1442, 2570, 2378, 522, 1626, 2107, 1388, 2972, 1209, 1684, 92, 81, 827,
+	1642, 2939, 2939, 1140, 2003, 2276, 1259, 1818, 1771, 162, 155, 2361, 2858, 2923, 2801, 99,
+	978, 2953, 3091, 569, 1137, 546, 1802, 761, 993, 2018, 1586, 738, 2409, 833, 116, 2748,
+	738, 3234, 1572, 676, 1065, 1570, 1570, 50, 394, 1668, 3241, 3155, 306, 1060, 1113, 1466,
+	401, 1795, 2994, 2882, 2954, 2114, 786, 1650, 1388, 2218, 2948, 804, 2068, 251, 290, 2988,
+	929, 3244, 1428, 2778, 1060, 873, 396, 1075, 394, 828, 865, 1562, 242, 1089, 1089, 738,
+	2986, 3177, 3241, 1081, 1034, 2945, 242, 666, 2217, 2234, 313, 1563, 2658, 3164, 2065, 3178,
+	2890, 1018, 737, 2138, 753, 457, 1113, 2844, 355, 211, 1113, 658, 28, 2082, 306, 2195,
+	1076, 2618, 1025, 2018, 1388, 1105, 1355, 2436, 3209, 458, 1066, 2178, 116, 220, 2082, 1036,
+	1060, 484, 3244, 2218, 1041, 2842, 1508, 2954, 2890, 1108, 2545, 2945, 1547, 978, 3172, 2924,
+	588, 2747, 1386, 580, 737, 2195, 2946, 938, 114, 172, 3011, 522, 2674, 2537, 2537, 298,
+	290, 2778, 138, 2785, 811, 1388, 2042, 3180, 1668, 1388, 3209, 3298, 2705, 2122, 2345, 2553,
+	290, 1970, 1139, 1586, 1602, 2844, 1113, 281, 2401, 1161, 2906, 2650, 2978, 452, 859, 916,
+	2979, 452, 1066, 2738, 2524, 1827, 2377, 2804, 1348, 738, 626, 1668, 2756, 1098, 1714, 1684,
+	1187, 1330, 1402, 2418, 2769, 2676, 2801, 1052, 2978, 2954, 2953, 820, 378, 1563, 1563, 396,
+	2731, 1113, 524, 2130, 569, 1073, 3257, 833, 1321, 1484, 1138, 2748, 1161, 1804, 1305, 938,
+	2042, 3025, 779, 891, 738, 1498, 265, 322, 2505, 370, 3108, 1594, 188, 50, 1386, 2674,
+	161, 916, 84, 2100, 1147, 2785, 2098, 523, 1097, 2042, 484, 1107, 2082, 2570, 809, 1002,
+	833, 1442, 689, 2098, 25, 2739, 107, 3171, 2905, 1137, 1073, 1435, 2579, 2433, 2626, 492,
+	995, 2050, 938, 436, 2594, 377, 116, 266, 1018, 692, 1330, 2049, 1602, 2018, 2745, 476,
+	2348, 1018, 2907, 2938, 2634, 2050, 2731, 220, 1708, 3139, 2708, 1129, 2641, 1506, 116, 2940,
+	1929, 165, 1945, 556, 2954, 2954, 2954, 2817, 2284, 2121, 1209, 2812, 2732, 2987, 2986, 740,
+	1404, 2873, 2873, 1715, 220, 2769, 379, 2817, 2986, 123, 1572, 25, 628, 1508, 2954, 1316,
+	1316, 1081, 1619, 3300, 3300, 3265, 83, 2226, 2787, 2932, 25, 2130, 1073, 738, 1516, 1113,
+	1962, 705, 978, 978, 986, 2908, 2673, 3133, 3241, 2809, 2196, 786, 2057, 2106, 1611, 1026,
+	2401, 2042, 756, 571, 3172, 1076, 2747, 162, 2745, 1913, 1060, 994, 3044, 1065, 596, 2924,
+	2537, 401, 2138, 2745, 3137, 1298, 2650, 1041, 2787, 2417, 2052, 1338, 3249, 2921, 2993, 1586,
+	3009, 2436, 524, 3204, 857, 2163, 2881, 259, 1179, 1300, 1001, 1083, 1474, 2747, 1924, 2981,
+	2513, 2945, 2417, 378, 2418, 3009, 3137, 1348, 2234, 1602, 1388, 2145, 2532, 2994, 1388, 1139,
+	2785, 76, 330, 2866, 2674, 1450, 1052, 531, 2068, 3265, 2028, 450, 2993, 330, 2988, 1275,
+	1930, 2042, 2042, 1700, 2492, 2786, 698, 3010, 3145, 1073, 1058, 2276, 201, 641, 1610, 929,
+	2545, 3137, 1650, 2513, 2868, 1450, 2786, 835, 1346, 2218, 2763, 756, 452, 2417, 2586, 1507,
+	2236, 2553, 2873, 92, 2923, 876, 116, 3251, 883, 3300, 2634, 220, 1956, 1338, 476, 1060,
+	1386, 2401, 1347, 2988, 1442, 2954, 1668, 540, 2634, 1571, 2657, 332, 1970, 25, 1402, 401,
+	2787, 2018, 2121, 1107, 378, 1098, 2746, 2689, 210, 2988, 2940, 3242, 1419, 116, 1483, 2869,
+	172, 3113, 1370, 2074, 1556, 2906, 1442, 1060, 129, 883, 915, 522, 2524, 1484, 2388, 2369,
+	522, 1636, 2889, 1556, 162, 524, 450, 3132, 2401, 2876, 2748, 994, 42, 1611, 1474, 420,
+	3161, 188, 2026, 1083, 1612, 401, 1795, 1036, 1148, 2946, 1076, 1777, 2433, 2945, 890, 290,
+	996, 2345, 1252, 2068, 1538, 3041, 3058, 2074, 577, 1403, 1436, 1252, 19, 116, 1386, 2747,
+	1058, 2066, 2412, 673, 1602, 1907, 259, 531, 2892, 1089, 2259, 2259, 1371, 2986, 2082, 330,
+	1002, 1073, 1547, 3010, 81, 2978, 2130, 1484, 2178, 1036, 628, 2618, 691, 1154, 3284, 668,
+	2234, 698, 1300, 2484, 2258, 2899, 2865, 740, 1154, 484, 2778, 571, 2497, 2817, 2788, 1466,
+	2753, 2377, 2050, 1073, 3012, 2545, 1442, 2988, 2794, 2764, 1058, 978, 2500, 1834, 1371, 2873,
+	3012, 2988, 2786, 932, 82, 929, 20, 2745, 1036, 1036, 1060, 394, 2809, 2732, 1636, 2940,
+	1378, 1081, 196, 2401, 2074, 1402, 1209, 2994, 458, 2620, 2585, 2881, 116, 3105, 2545, 2801,
+	674, 555, 2828, 835, 2828, 2435, 1076, 929, 977, 2284, 2833, 2889, 2924, 60, 2515, 2435,
+	2889, 604, 2010, 2747, 1818, 322, 1546, 2234, 1994, 2570, 1060, 3051, 290, 3137, 659, 1771,
+	2954, 779, 402, 2817, 2050, 666, 1075, 2868, 1298, 1058, 123, 540, 1612, 1338, 1108, 202,
+	1627, 2114, 2092, 2803, 1418, 1907, 2802, 2524, 1514, 2940, 2868, 2827, 1386, 2940, 1323, 1371,
+	1092, 522, 3155, 89, 2610, 2924, 1668, 1020, 129, 673, 2515, 2578, 2689, 2114, 2082, 2748,
+	1450, 1036, 1905, 779, 3012, 83, 1388, 2435, 330, 19, 1436, 3051, 2873, 2100, 1332, 1052,
+	2708, 2780, 2259, 2259, 2050, 962, 1482, 2521, 2690, 1602, 3012, 2018, 2987, 2889, 1060, 1121,
+	2873, 1666, 2121, 2521, 1121, 1970, 1804, 164, 2170, 2940, 2803, 2986, 1138, 1403, 1403, 2947,
+	2074, 2953, 1466, 2667, 1001, 3004, 1442, 2130, 2922, 674, 1586, 916, 1297, 1338, 1060, 484,
+	1556, 1372, 1370, 1033, 705, 3153, 2748, 1298, 3108, 1010, 1386, 1060, 1610, 1371, 1012, 1506,
+	1057, 1298, 1484, 1073, 2284, 2610, 1370, 2139, 2817, 2940, 1490, 1594, 137, 993, 995, 1483,
+	1892, 1516, 2497, 2817, 2066, 332, 993, 2865, 450, 738, 2865, 2865, 1483, 995, 2986, 932,
+	1089, 1140, 890, 84, 2906, 3108, 3108, 1297, 145, 2788, 2436, 314, 2122, 537, 1059, 2122,
+	553, 2417, 2793, 1154, 3130, 2386, 2985, 914, 3243, 978, 1033, 1602, 788, 2537, 2793, 252,
+	2418, 2939, 1539, 2811, 681, 628, 49, 307, 2065, 2754, 2754, 2260, 76, 1978, 3004, 3004,
+	1161, 2050, 2658, 2947, 2050, 194, 2994, 1154, 1034, 2098, 2050, 3164, 2898, 930, 1684, 2738,
+	698, 698, 922, 817, 3051, 740, 2162, 1100, 738, 305, 579, 84, 2803, 1770, 468, 2121,
+	2978, 3092, 2018, 306, 2980, 938, 913, 1140, 1388, 740, 2162, 3090, 827, 1978, 1978, 2802,
+	3180, 537, 138, 155, 833, 3105, 2129, 2386, 2643, 1442, 835, 476, 835, 2954, 1388, 297,
+	2129, 1674, 786, 396, 1034, 1034, 1562, 740, 2914, 2713, 1428, 3177, 2937, 2802, 1316, 1089,
+	1388, 2940, 2018, 2049, 898, 2386, 2938, 2739, 1668, 2114, 2092, 875, 2114, 3156, 1554, 1355,
+	3130, 1066, 1730, 2497, 2050, 2841, 1100, 2122, 2377, 2971, 1066, 2692, 281, 92, 626, 916,
+	2435, 2874, 705, 2404, 2404, 739, 2804, 3129, 2778, 738, 1386, 1346, 116, 330, 2993, 2979,
+	1098, 476, 2906, 2650, 532, 2692, 1034, 2769, 3153, 2505, 689, 1137, 1612, 2050, 2050, 2988,
+	1164, 1324, 1603, 2073, 2497, 2785, 1498, 1388, 546, 2634, 2594, 1305, 914, 916, 2988, 76,
+	690, 1978, 2745, 609, 2940, 2993, 2556, 2138, 2067, 2260, 1770, 2105, 2748, 1411, 891, 2729,
+	569, 628, 67, 524, 2739, 194, 2915, 2954, 889, 258, 556, 1324, 1209, 1098, 2825, 2650,
+	1572, 2865, 1618, 2986, 1097, 2418, 2873, 1026, 2907, 121, 2226, 2745, 740, 2994, 1588, 2748,
+	738, 2234, 2826, 2978, 2122, 1570, 2793, 2953, 2417, 314, 2585, 3177, 3249, 2618, 740, 2994,
+	1298, 1602, 1324, 586, 994, 2121, 546, 1388, 2769, 3009, 2131, 1715, 1474, 377, 2218, 2954,
+	1081, 69, 1346, 1938, 2497, 2785, 396, 2785, 2994, 2761, 1402, 2513, 65, 2218, 2218, 1058,
+	2777, 2860, 916, 2098, 2938, 113, 1002, 2586, 2939, 588, 1708, 938, 994, 873, 1539, 1650,
+	2940, 2754, 2954, 2604, 3161, 201, 2313, 2050, 1555, 2637, 2369, 2420, 210, 305, 524, 42,
+	1484, 2748, 3156, 2586, 290, 1993, 2130, 1978, 2986, 1076, 1506, 1474, 2099, 3161, 2947, 1081,
+	2452, 2754, 2817, 2732, 3130, 3132, 1538, 1538, 889, 1450, 1570, 2785, 401, 1386, 1555, 2817,
+	269, 3113, 1563, 2812, 1668, 3281, 2497, 2121, 2604, 3154, 1970, 1970, 1091, 2130, 137, 1418,
+	1930, 875, 2787, 1059, 3201, 1026, 690, 1354, 1154, 1154, 1036, 2946, 258, 1089, 2364, 1730,
+	2817, 2778, 314, 2890, 2497, 330, 297, 481, 1387, 2828, 2364, 2939, 1115, 458, 258, 2052,
+	393, 2811, 2388, 1507, 2098, 2954, 252, 1388, 3066, 2873, 1402, 3178, 3058, 2825, 1563, 2828,
+	2050, 2218, 1075, 1603, 930, 2234, 1052, 3234, 1098, 2010, 937, 1636, 674, 1371, 1098, 1324,
+	1643, 1386, 379, 1388, 2121, 1804, 1482, 588, 2817, 3177, 1466, 1386, 1466, 705, 2929, 1978,
+	1722, 835, 1145, 2953, 2435, 2785, 194, 2130, 2138, 588, 194, 1554, 2130, 1098, 3178, 3233,
+	2884, 1025, 1884, 1953, 1884, 2836, 3164, 1548, 660, 1169, 1636, 2788, 2842, 2907, 1188, 2996,
+	2130, 1442, 2876, 2436, 2802, 2660, 2812, 1097, 2802, 2898, 994, 2748, 492, 313, 2748, 492,
+	3225, 962, 2130, 2937, 2937, 171, 763, 2986, 131, 243, 2938, 2361, 292, 737, 883, 697,
+	2449, 1098, 1700, 3161, 475, 2940, 3164, 3161, 1100, 3155, 2826, 2162, 3153, 2196, 2097, 1105,
+	1161, 2994, 1588, 252, 43, 1795, 1033, 2162, 1065, 2706, 1443, 468, 84, 1946, 2924, 3300,
+	116, 2380, 2579, 1140, 940, 2882, 2860, 3139, 2938, 1916, 161, 521, 2716, 740, 883, 3156,
+	3156, 2162, 1932, 2940, 1572, 2705, 1700, 825, 2876, 3130, 2129, 92, 2988, 2786, 1610, 162,
+	161, 738, 307, 307, 1260, 2196, 1084, 2057, 1076, 162, 1098, 658, 785, 2234, 3177, 873,
+	2945, 186, 1428, 1171, 2845, 3209, 481, 2865, 1305, 1228, 1795, 2436, 1066, 1307, 298, 1387,
+	1145, 2401, 2034, 786, 2940, 2988, 3139, 1450, 2122, 2154, 1060, 2940, 171, 3209, 2476, 2345,
+	2154, 1387, 1402, 1403, 1260, 1075, 730, 257, 116, 1305, 2594, 2996, 1442, 307, 265, 322,
+	617, 131, 1411, 2373, 1954, 1954, 689, 2993, 1507, 891, 2907, 586, 2620, 3156, 1137, 2939,
+	2050, 891, 844, 1228, 2049, 2620, 2618, 740, 314, 2828, 123, 546, 1305, 593, 2860, 2860,
+	940, 2996, 81, 83, 740, 2986, 2684, 2907, 1033, 92, 331, 1515, 1946, 473, 3011, 2561,
+	825, 457, 1010, 2218, 2996, 2236, 1708, 1123, 2555, 65, 2692, 307, 2307, 1795, 2953, 1100,
+	2065, 1010, 1260, 1402, 1338, 1386, 3131, 2417, 1515, 2940, 545, 2828, 2801, 2748, 131, 210,
+	1057, 2075, 2329, 81, 2809, 116, 738, 1075, 3204, 1075, 436, 1058, 473, 3018, 674, 162,
+	2812, 2834, 138, 2178, 1555, 1338, 43, 3058, 876, 212, 2540, 1834, 257, 1403, 116, 1105,
+	481, 2435, 2579, 116, 1338, 738, 2234, 3155, 604, 2435, 2716, 2420, 59, 2826, 162, 292,
+	1332, 1466, 2786, 2801, 1338, 3131, 468, 1139, 3036, 2417, 1075, 1932, 2940, 1338, 2900, 2785,
+	2785, 2924, 707, 2578, 740, 716, 740, 52, 938, 1057, 1057, 1076, 857, 124, 2908, 873,
+	1154, 1987, 1572, 1612, 1612, 1636, 2420, 2500, 257, 1506, 1154, 1612, 2636, 1402, 2924, 3156,
+	1161, 2786, 2363, 2745, 2788, 2627, 2986, 1339, 628, 587, 2097, 1939, 1060, 1650, 2954, 828,
+	2129, 3108, 1108, 857, 513, 1076, 1506, 2132, 1073, 2746, 1154, 2129, 1506, 1339, 2403, 522,
+	857, 1076, 857, 2908, 873, 1612, 2420, 257, 1339, 1154, 1060, 2786, 522, 2627, 2986, 828,
+	1108, 2132, 1091, 2122, 1105, 417, 1154, 3156, 276, 1058, 833, 476, 3241, 523, 2369, 1004,
+	2138, 786, 2420, 1099, 875, 817, 332, 1099, 1044, 2122, 2841, 2524, 1770, 1057, 1484, 3156,
+	3089, 116, 2841, 994, 2369, 817, 3156, 2882, 332, 2785, 2938, 1388, 1154, 2785, 2908, 2785,
+	2906, 2906, 556, 740, 2122, 2122, 1092, 977, 1060, 676, 2892, 540, 980, 252, 2595, 2865,
+	1098, 2938, 2196, 2892, 2946, 2364, 2052, 2705, 1060, 2892, 2946, 626, 697, 2900, 2921, 2508,
+	2403, 2946, 2833, 1154, 2818, 1740, 290, 2978, 3155, 2849, 683, 2836, 273, 2388, 2906, 2283,
+	3228, 2867, 2940, 2940, 2524, 305, 937, 2401, 938, 2868, 3139, 3180, 3148, 828, 3241, 3243,
+	3105, 835, 740, 1075, 546, 1442, 523, 2916, 1388, 1730, 1932, 3172, 764, 2940, 1140, 2924,
+	3092, 2938, 2938, 2131, 3124, 2018, 116, 2852, 2129, 50, 458, 3267, 2593, 3179, 394, 3130,
+	2971, 2867, 2890, 2940, 1027, 938, 2420, 242, 2820, 2417, 955, 244, 828, 875, 2138, 1036,
+	1098, 1004, 753, 2810, 2745, 2401, 3172, 2658, 1610, 3105, 1652, 628, 1033, 2906, 2849, 844,
+	660, 156, 2635, 2938, 1371, 3177, 1289, 1265, 2777, 2988, 2610, 1060, 3156, 2196, 420, 1347,
+	626, 1290, 634, 2420, 2651, 476, 92, 258, 2980, 1233, 2084, 2097, 2444, 25, 2987, 2820,
+	298, 1100, 2804, 2777, 2780, 780, 2508, 169, 1036, 1116, 2489, 3140, 2489, 586, 1001, 268,
+	2474, 1098, 1212, 2129, 402, 2818, 2540, 2739, 2802, 691, 305, 2564, 2940, 1772, 2946, 540,
+	1979, 3234, 259, 289, 3225, 1060, 2049, 2578, 3220, 2747, 1137, 2107, 571, 3148, 3058, 3257,
+	2065, 3234, 1412, 1076, 332, 930, 1500, 2403, 131, 1004, 1986, 2986, 546, 2865, 1987, 2420,
+	2873, 2420, 1044, 1004, 628, 3164, 524, 2826, 738, 2043, 2650, 1076, 2051, 2988, 3241, 3201,
+	2787, 1036, 2945, 25, 2802, 1714, 290, 707, 3177, 2914, 2908, 1026, 2873, 786, 1876, 2049,
+	1674, 2932, 2748, 2841, 2610, 3169, 2364, 1075, 2026, 1300, 1027, 1052, 785, 2954, 1610, 2819,
+	1612, 2787, 2073, 289, 2884, 2618, 2524, 76, 306, 2065, 2420, 1083, 2994, 2828, 940, 2593,
+	2922, 2922, 1481, 2986, 129, 404, 2108, 1386, 1666, 1666, 2369, 3130, 1660, 1075, 3058, 1097,
+	1402, 1474, 196, 1905, 884, 2786, 3234, 42, 42, 1107, 3130, 2938, 993, 1084, 1554, 274,
+	916, 1002, 259, 2865, 3081, 2324, 2785, 3089, 604, 3148, 1730, 1338, 626, 2953, 1154, 1057,
+	3291, 1091, 164, 1036, 3204, 2778, 3076, 3090, 2418, 2084, 2578, 3076, 2043, 2410, 2873, 3052,
+	2578, 483, 2540, 2803, 1057, 1092, 1115, 3108, 1722, 2937, 19, 3105, 1980, 1035, 1004, 2940,
+	2940, 2364, 2172, 1844, 2067, 604, 2564, 996, 3169, 930, 20, 2953, 1076, 2988, 1075, 1036,
+	586, 3130, 2876, 3036, 1371, 2403, 2748, 259, 1388, 2938, 124, 3130, 2908, 628, 322, 2748,
+	322, 2924, 258, 2172, 2947, 1338, 292, 2826, 1804, 1017, 3036, 2940, 483, 3105, 2908, 586,
+	2906, 1060, 556, 740, 2196, 1057, 1098, 980, 2595, 2172, 2364, 2052, 2705, 2892, 2940, 2892,
+	1060, 2196, 1083, 1036, 1905, 1140, 2900, 1740, 2867, 626, 1500, 2849, 2508, 707, 2388, 683,
+	1154, 3148, 835, 937, 2018, 3267, 2418, 2852, 3092, 2524, 3139, 523, 3169, 394, 2129, 3124,
+	116, 2940, 2938, 1289, 1371, 2420, 844, 2417, 1058, 1033, 298, 3177, 2401, 1004, 476, 828,
+	2138, 875, 2890, 2940, 3145, 753, 2810, 244, 1044, 2867, 3169, 1100, 2777, 2987, 2084, 2780,
+	780, 2980, 1036, 1290, 2489, 2508, 634, 2107, 3177, 3257, 1876, 586, 3234, 691, 1212, 2747,
+	2986, 2394, 2403, 540, 259, 1412, 3225, 2540, 2578, 2403, 2940, 1674, 290, 546, 1027, 1076,
+	2826, 2884, 2932, 2748, 628, 2988, 2873, 258, 3241, 25, 2908, 524, 1610, 1986, 2865, 1666,
+	483, 2524, 2828, 2922, 76, 2420, 2065, 1612, 1107, 1554, 3130, 1075, 1660, 2578, 3076, 2082,
+	1338, 2043, 1154, 2908, 2067, 3105, 292, 835, 2065, 978, 2793, 1058, 978, 913, 977, 2785,
+	2785, 1049, 1418, 915, 586, 1466, 580, 1081, 2051, 2420, 1387, 513, 2729, 113, 2436, 2804,
+	705, 3156, 3156, 2908, 2908, 2419, 332, 1033, 2698, 2940, 2698, 2940, 1073, 49, 988, 628,
+	330, 2812, 1020, 1073, 1227, 753, 1140, 737, 2785, 145, 930, 2988, 3177, 1065, 698, 2785,
+	162, 2753, 1018, 145, 522, 3249, 698, 2940, 3156, 84, 250, 28, 1978, 1700, 1977, 827,
+	1700, 2980, 537, 1668, 2500, 2857, 1018, 1305, 938, 930, 1668, 28, 1572, 1386, 1770, 115,
+	2987, 1065, 2681, 1569, 1978, 2785, 2940, 1140, 1668, 329, 2578, 1017, 1154, 92, 3137, 2994,
+	740, 186, 820, 2604, 2938, 922, 2730, 2010, 1052, 676, 2577, 860, 3058, 3156, 660, 3180,
+	2420, 116, 3241, 660, 876, 1987, 123, 1547, 468, 2412, 1292, 692, 2641, 2938, 306, 1572,
+	940, 116, 1484, 1436, 1036, 753, 1986, 3241, 1067, 2868, 3066, 1091, 753, 3041, 1076, 2953,
+	2892, 3140, 2385, 145, 145, 2122, 2385, 356, 3041, 3169, 1332, 3036, 396, 289, 2371, 2627,
+	1954, 809, 2802, 1548, 1076, 2540, 740, 2580, 402, 402, 3156, 1057, 3116, 587, 1108, 2849,
+	379, 3011, 83, 3025, 1332, 708, 204, 1057, 2412, 2940, 3204, 740, 828, 2292, 3058, 1418,
+	2940, 60, 291, 2732, 3156, 3220, 129, 3009, 3084, 476, 3036, 2908, 2042, 2364, 2732, 2954,
+	1108, 764, 2802, 3041, 116, 586, 2434, 2908, 2371, 2876, 1468, 764, 3041, 92, 3137, 740,
+	2994, 820, 186, 3058, 2802, 60, 3116, 1052, 3156, 676, 2577, 2010, 123, 828, 3180, 860,
+	660, 1076, 97, 2420, 2641, 876, 1292, 468, 1572, 692, 940, 2938, 3066, 3156, 1067, 1036,
+	3241, 1436, 1484, 3041, 3241, 753, 1108, 2122, 3140, 1332, 2385, 740, 587, 1057, 2434, 2371,
+	396, 116, 3169, 809, 1954, 475, 1332, 708, 3220, 740, 3204, 2292, 3058, 2908, 3036, 3009,
+	3084, 2364, 2954, 764, 308, 2785, 2388, 1715, 2658, 2788, 297, 940, 297, 3131, 2794, 2586,
+	3259, 3259, 1388, 1129, 740, 3124, 763, 2051, 2364, 2114, 2947, 2803, 3241, 1154, 2099, 306,
+	393, 292, 292, 546, 1137, 273, 521, 2788, 3105, 1154, 3004, 2129, 1058, 306, 330, 841,
+	2884, 3241, 2634, 619, 1428, 763, 2553, 420, 2786, 3124, 2524, 2947, 1138, 1076, 2148, 2588,
+	388, 435, 1484, 2132, 484, 2121, 3241, 2618, 2129, 308, 1026, 2082, 2081, 1092, 3052, 2620,
+	659, 3035, 3035, 3266, 1913, 84, 1260, 1209, 611, 1154, 737, 291, 1075, 684, 3155, 2561,
+	3004, 52, 2050, 3004, 2073, 2708, 2570, 2940, 1779, 1442, 1588, 50, 545, 1257, 2706, 1065,
+	393, 1947, 2059, 3180, 1137, 531, 3154, 737, 1930, 1140, 2361, 163, 1770, 1140, 1388, 801,
+	2938, 1057, 620, 2803, 1089, 620, 3177, 2138, 1268, 3195, 876, 2114, 1299, 2810, 308, 1484,
+	1986, 3156, 1066, 2636, 187, 1076, 458, 2081, 116, 2801, 620, 1057, 1138, 1060, 2433, 2674,
+	332, 1116, 1804, 2817, 172, 2882, 441, 1683, 2433, 1410, 2971, 1091, 322, 2081, 1674, 2564,
+	1076, 2050, 2769, 2747, 385, 1098, 1058, 1804, 1137, 1804, 1498, 1484, 1380, 1010, 1140, 306,
+	2731, 2138, 2617, 162, 3266, 2092, 2939, 420, 3249, 187, 3249, 1972, 3156, 3145, 531, 3154,
+	2986, 618, 612, 355, 2971, 3163, 524, 3091, 291, 348, 1076, 841, 2586, 1139, 738, 3266,
+	546, 1986, 2226, 1876, 2618, 243, 2691, 1075, 491, 449, 2049, 2564, 2073, 1779, 529, 2618,
+	1058, 1804, 1554, 1449, 3036, 116, 313, 1484, 1418, 420, 2585, 468, 2524, 2787, 1299, 1057,
+	3154, 2073, 522, 1930, 3249, 1402, 108, 3049, 1779, 138, 2690, 1138, 513, 236, 2801, 674,
+	330, 3161, 609, 161, 420, 420, 1154, 1154, 1436, 2562, 2081, 1153, 2043, 1417, 609, 425,
+	860, 3052, 458, 116, 116, 3178, 1140, 330, 2084, 611, 322, 1057, 2779, 3004, 1779, 1436,
+	1428, 3154, 1388, 3156, 258, 330, 596, 2748, 1466, 1436, 2801, 2748, 3273, 1338, 2828, 2170,
+	2283, 1804, 2564, 2130, 1058, 425, 450, 2787, 1298, 1154, 1436, 2401, 817, 473, 697, 2129,
+	2619, 619, 619, 817, 1346, 2195, 1507, 19, 1057, 1138, 2587, 1241, 1356, 2907, 1587, 1193,
+	2129, 1474, 1356, 619, 3154, 2908, 2619, 492, 2953, 2988, 281, 2900, 875, 1161, 2748, 3004,
+	2836, 468, 2873, 676, 2196, 2361, 1290, 2433, 2698, 290, 468, 628, 1700, 2050, 1570, 2251,
+	1290, 2066, 3203, 977, 993, 2130, 1292, 523, 1442, 468, 41, 3139, 676, 1289, 2915, 1969,
+	92, 833, 833, 1946, 3180, 2219, 628, 50, 3170, 3155, 2922, 1209, 2940, 3156, 2420, 2018,
+	658, 819, 1138, 1092, 865, 938, 1179, 2138, 3169, 3028, 3156, 2385, 1412, 2988, 2377, 2978,
+	2732, 2947, 3130, 2731, 739, 2105, 3169, 1770, 1378, 3130, 3108, 1412, 3241, 1033, 2739, 388,
+	891, 1187, 2939, 1970, 2068, 883, 1779, 2018, 859, 92, 1498, 1922, 1410, 2251, 2226, 1058,
+	2914, 2802, 354, 412, 377, 786, 2978, 977, 2433, 740, 3241, 738, 2753, 100, 3107, 2986,
+	2753, 2593, 835, 3137, 2794, 2994, 1484, 1089, 274, 3203, 2748, 1042, 2883, 3130, 1092, 3108,
+	170, 1355, 698, 673, 1434, 786, 2324, 1187, 1018, 2939, 1058, 3220, 658, 2988, 1076, 977,
+	1370, 1956, 1388, 1388, 1482, 1436, 281, 2900, 875, 2873, 468, 2196, 3203, 628, 1498, 2251,
+	977, 833, 1209, 1482, 3170, 3155, 2940, 993, 3139, 1388, 2922, 2105, 2420, 3028, 3156, 1092,
+	3169, 2138, 1484, 1092, 3130, 739, 1412, 1779, 92, 1033, 883, 2739, 1410, 388, 3241, 412,
+	738, 1058, 2753, 2433, 1956, 2994, 2794, 1779, 1484, 3130, 1434, 2833, 833, 394, 394, 1980,
+	3284, 124, 1324, 1324, 394, 2881, 68, 124, 124, 124, 2881, 124, 65, 394, 124, 124,
+	290, 2235, 1834, 1834, 259, 388, 388, 2937, 2202, 121, 121, 2418, 2985, 1418, 458, 257,
+	761, 2065, 2985, 2985, 2052, 2892, 2938, 892, 1548, 2049, 3017, 2740, 2676, 3225, 2954, 458,
+	3012, 1108, 922, 2900, 675, 2780, 458, 626, 906, 3132, 458, 1108, 2995, 2746, 1402, 306,
+	284, 1772, 2634, 3156, 2938, 1123, 1065, 290, 468, 659, 522, 2028, 3180, 546, 3058, 2594,
+	2436, 2706, 2133, 1116, 1034, 572, 2980, 1610, 108, 1057, 1707, 2938, 1098, 3217, 1428, 2892,
+	2692, 2508, 2420, 2594, 1938, 988, 1772, 612, 1123, 2875, 2892, 169, 2977, 2817, 2122, 2668,
+	3178, 2122, 524, 524, 2674, 1116, 2620, 580, 2939, 3132, 2657, 868, 2780, 2420, 299, 2524,
+	3052, 2153, 706, 1402, 2556, 1034, 1387, 835, 1330, 100, 452, 1154, 108, 1020, 467, 1484,
+	2978, 3169, 1108, 2988, 385, 1298, 2745, 2620, 2940, 458, 2995, 1506, 113, 1876, 2986, 484,
+	2538, 612, 2540, 2907, 354, 306, 2618, 2988, 2418, 3137, 2978, 3012, 628, 124, 892, 628,
+	2794, 1026, 2122, 492, 458, 2746, 1714, 2938, 828, 2922, 324, 1450, 2892, 2564, 524, 306,
+	2995, 2524, 2564, 2067, 1539, 2922, 860, 3113, 42, 2420, 180, 308, 2524, 3049, 3129, 612,
+	524, 1474, 306, 449, 1434, 3289, 2180, 2065, 2875, 2988, 2938, 628, 1418, 1140, 2420, 116,
+	2921, 1548, 2828, 2540, 906, 3105, 2610, 659, 1627, 121, 121, 1321, 1386, 2994, 2922, 1506,
+	1387, 2940, 2650, 516, 2051, 2969, 2361, 914, 2986, 1562, 2234, 2114, 2785, 1292, 737, 1196,
+	145, 681, 2842, 1700, 2833, 2403, 73, 2994, 441, 1051, 2826, 73, 2777, 1140, 2978, 914,
+	2570, 2121, 116, 1977, 155, 2380, 92, 2715, 523, 3257, 2932, 1434, 1289, 873, 3177, 2417,
+	1257, 2988, 753, 938, 2092, 3156, 1058, 1018, 988, 2842, 1089, 2786, 873, 1874, 1346, 1066,
+	1276, 3148, 1346, 3012, 2906, 298, 580, 2785, 1515, 739, 2778, 738, 780, 931, 1346, 1066,
+	811, 1164, 2955, 162, 2788, 92, 1388, 3010, 172, 2818, 2049, 1978, 2105, 889, 3169, 2578,
+	3257, 2018, 1330, 1770, 289, 2978, 172, 2809, 473, 1138, 2969, 2081, 2937, 577, 2907, 1586,
+	2276, 92, 628, 2433, 1148, 2987, 3012, 986, 1298, 2809, 2809, 2513, 2586, 1650, 2785, 2235,
+	332, 3241, 3257, 2932, 2777, 2809, 3010, 932, 2969, 115, 1572, 274, 737, 1419, 2946, 3201,
+	996, 2081, 2905, 3113, 1556, 2081, 2867, 516, 116, 2890, 116, 3081, 2746, 3148, 1572, 2364,
+	1434, 2026, 473, 1602, 2932, 212, 1276, 705, 1602, 3257, 1292, 1403, 3036, 258, 2977, 1057,
+	2908, 258, 450, 1442, 1017, 2785, 705, 3036, 1388, 2979, 553, 2122, 3234, 1956, 3172, 2939,
+	761, 2986, 1131, 2907, 3284, 1570, 3140, 2868, 580, 3137, 697, 2994, 741, 3012, 2572, 2625,
+	2059, 2706, 420, 913, 833, 2521, 2028, 322, 3028, 1651, 1356, 388, 322, 2980, 2658, 3155,
+	2801, 1084, 298, 2948, 2674, 1092, 1586, 1260, 2529, 1372, 2042, 3284, 907, 2908, 2353, 1788,
+	2746, 1484, 1339, 2905, 2594, 1953, 3107, 378, 2578, 3284, 3220, 420, 1305, 2618, 2802, 585,
+	994, 2867, 2843, 2579, 2122, 378, 3012, 2028, 1209, 2513, 1610, 2138, 323, 449, 3012, 2972,
+	36, 3092, 907, 2586, 1084, 1995, 291, 2988, 1386, 3049, 1354, 2937, 1084, 170, 1092, 2785,
+	2578, 665, 1834, 2940, 1387, 1140, 2908, 2940, 1788, 2234, 2889, 322, 2908, 1442, 1610, 1610,
+	1788, 2836, 1092, 2353, 1610, 2908, 124, 187, 2420, 2980, 2420, 2420, 1387, 3164, 2931, 1412,
+	2785, 1105, 1105, 2122, 2939, 1419, 489, 3121, 553, 2028, 2122, 49, 739, 3137, 3154, 49,
+	1492, 739, 1707, 540, 2364, 2083, 1252, 356, 3243, 675, 1002, 1002, 916, 769, 2050, 1562,
+	2212, 524, 2500, 2788, 2940, 249, 2417, 2675, 2785, 1883, 2065, 2122, 1076, 1980, 2930, 1105,
+	51, 681, 290, 2842, 579, 3004, 2065, 737, 1977, 1700, 2833, 626, 1154, 612, 825, 2947,
+	2066, 67, 2284, 2194, 273, 1827, 697, 3011, 2939, 2098, 1977, 889, 978, 2946, 1161, 540,
+	2940, 3161, 2787, 756, 2212, 1051, 2572, 1196, 2994, 1482, 628, 2098, 618, 3241, 1771, 2674,
+	2420, 1642, 833, 1209, 1442, 155, 2500, 835, 162, 1977, 2988, 2500, 3298, 169, 2978, 2626,
+	1067, 3137, 2419, 2420, 3154, 1140, 257, 2417, 2417, 2876, 3121, 84, 938, 116, 2409, 330,
+	2418, 162, 3180, 308, 3017, 2025, 2658, 2066, 738, 3099, 1451, 2065, 738, 1388, 3004, 1977,
+	2913, 68, 161, 1098, 825, 2436, 3145, 1683, 2787, 2787, 524, 1065, 1684, 2579, 1018, 2939,
+	2497, 1292, 1171, 91, 1076, 2658, 2842, 978, 1091, 307, 660, 1508, 155, 2420, 1674, 1065,
+	2946, 1161, 3169, 316, 2811, 2658, 1668, 1372, 1057, 2988, 2868, 2194, 3292, 3156, 2114, 2364,
+	308, 2803, 2842, 2138, 1977, 2643, 3177, 2812, 1650, 1267, 2922, 2801, 2802, 2857, 1161, 241,
+	1355, 1058, 1979, 2234, 1611, 2937, 2945, 865, 27, 561, 2979, 2324, 1204, 2066, 1490, 2497,
+	17, 540, 916, 2260, 2420, 1233, 2122, 2817, 3130, 2860, 3044, 2618, 452, 841, 980, 3161,
+	2665, 1515, 1586, 1346, 2732, 2833, 3010, 92, 2780, 2524, 2988, 258, 556, 162, 916, 1066,
+	978, 425, 705, 257, 2731, 3156, 2497, 2873, 1002, 2987, 2634, 1292, 3234, 1524, 2842, 2099,
+	2404, 914, 1524, 2930, 330, 3084, 1137, 2804, 2643, 1562, 2044, 1386, 1932, 2260, 298, 780,
+	1387, 2604, 153, 3180, 3140, 2673, 1451, 3284, 1140, 267, 2995, 1076, 769, 540, 2594, 266,
+	1498, 891, 1442, 1977, 1484, 1386, 2073, 2034, 1147, 1642, 3284, 1970, 28, 1977, 2804, 2897,
+	3217, 1372, 1209, 1241, 2564, 1305, 586, 1748, 370, 3241, 3145, 97, 1804, 3252, 378, 2578,
+	556, 2050, 2066, 3220, 1057, 2988, 1107, 859, 1570, 265, 2627, 2785, 1404, 2594, 836, 452,
+	2436, 3137, 1484, 1603, 1484, 1001, 131, 746, 1330, 1227, 681, 2781, 1708, 2732, 3036, 995,
+	498, 2801, 1985, 1049, 1412, 667, 1594, 1179, 2953, 521, 1404, 889, 2803, 588, 2674, 2746,
+	3249, 740, 2226, 1058, 628, 1161, 291, 2618, 3090, 996, 2914, 596, 2794, 2986, 1233, 2409,
+	1026, 2747, 740, 3121, 241, 2092, 2417, 977, 1298, 2627, 1674, 2081, 2081, 986, 2665, 401,
+	1018, 2932, 1642, 1076, 593, 1076, 2505, 1298, 994, 2873, 619, 1098, 3137, 121, 3161, 3241,
+	2857, 2930, 1587, 1924, 17, 1100, 2069, 1586, 2555, 458, 76, 2794, 1402, 2555, 1180, 1450,
+	2922, 2932, 1844, 2761, 2218, 2586, 2555, 2073, 1388, 2492, 370, 162, 1930, 457, 113, 2307,
+	769, 3241, 2777, 2954, 1028, 2634, 1450, 1179, 2547, 2345, 2513, 2732, 932, 3140, 3140, 1346,
+	2940, 2994, 2587, 1804, 2786, 1065, 785, 1539, 1145, 2508, 3267, 2555, 2796, 705, 2753, 1698,
+	1483, 2555, 1905, 3266, 2682, 2857, 860, 2876, 1404, 2428, 44, 1555, 1668, 1506, 116, 2748,
+	1450, 522, 2299, 3251, 2938, 1484, 42, 1233, 2073, 433, 2049, 266, 2585, 1556, 2969, 259,
+	705, 1116, 129, 2436, 1476, 2860, 401, 1466, 3036, 1076, 210, 1386, 2796, 2785, 1193, 2467,
+	108, 3117, 2069, 297, 1484, 1002, 1058, 2042, 1036, 2075, 2025, 1434, 2324, 2860, 2299, 297,
+	1300, 2497, 1450, 1730, 1026, 2003, 2540, 674, 2082, 2137, 2914, 2585, 2812, 1154, 1089, 3289,
+	1418, 2092, 1354, 604, 2834, 3033, 1057, 1075, 3161, 516, 2897, 2955, 601, 1154, 1844, 3033,
+	2043, 2643, 674, 297, 555, 2364, 1177, 1073, 692, 2540, 1483, 1145, 1036, 2988, 1402, 3234,
+	2081, 1076, 3234, 1370, 116, 2643, 1018, 2932, 618, 891, 481, 1140, 698, 458, 92, 2940,
+	20, 3249, 2892, 540, 3180, 962, 3220, 1057, 1804, 938, 1052, 2105, 145, 2953, 1300, 1818,
+	2865, 1076, 1076, 2067, 243, 3156, 1636, 1386, 1370, 1057, 3276, 1292, 2371, 1970, 1324, 586,
+	2492, 388, 1516, 129, 84, 1483, 2805, 1281, 1466, 628, 1482, 2833, 1076, 1340, 162, 1073,
+	2924, 258, 2809, 1076, 2785, 860, 202, 1804, 1371, 425, 2130, 1932, 1506, 3273, 1490, 3050,
+	1804, 1154, 2587, 3178, 1338, 1105, 746, 2939, 3137, 553, 3121, 2025, 1419, 2675, 2065, 356,
+	2361, 2284, 674, 540, 1594, 1883, 2914, 249, 2842, 756, 172, 2572, 1140, 612, 273, 3161,
+	1700, 92, 769, 67, 2066, 2924, 2097, 1161, 2777, 825, 1196, 681, 1051, 2667, 1827, 51,
+	2988, 2066, 3145, 2066, 835, 161, 1209, 2027, 169, 162, 3004, 3273, 1684, 2579, 1067, 532,
+	2978, 2643, 162, 1442, 2492, 2065, 1571, 84, 2420, 2876, 2561, 116, 1770, 1977, 618, 2842,
+	1204, 1355, 659, 1562, 2897, 2979, 298, 1066, 2930, 1730, 3156, 481, 2658, 1515, 540, 2945,
+	1179, 3090, 3177, 2787, 556, 561, 2801, 1002, 2138, 2345, 897, 540, 788, 1650, 3145, 2324,
+	1091, 2937, 259, 316, 2585, 27, 2946, 2234, 3180, 1354, 2044, 2778, 1330, 2604, 1404, 1233,
+	2817, 2555, 1387, 3084, 330, 889, 780, 626, 2860, 452, 1524, 705, 2833, 1451, 1177, 1075,
+	2260, 2617, 1346, 2099, 1137, 9, 2073, 3131, 1876, 452, 1570, 97, 2050, 498, 1212, 1305,
+	265, 2785, 836, 1506, 370, 3217, 1107, 3156, 2801, 1147, 1049, 1954, 2578, 556, 1076, 1140,
+	1603, 3241, 2092, 2953, 1179, 2073, 2497, 628, 241, 2081, 3161, 596, 2513, 1026, 1018, 17,
+	588, 1587, 1476, 3241, 692, 1586, 1668, 3140, 162, 786, 1804, 2587, 1145, 1804, 1698, 1450,
+	779, 76, 2940, 1065, 145, 2218, 129, 2585, 1556, 1506, 108, 2969, 1116, 521, 3266, 2876,
+	1450, 258, 1154, 1420, 2042, 1483, 604, 1338, 2043, 425, 2073, 516, 1052, 1370, 1018, 3234,
+	1402, 2940, 243, 129, 1324, 258, 2809, 3115, 266, 1131, 43, 546, 2129, 1419, 1610, 3115,
+	1594, 1540, 2457, 2363, 1052, 1594, 2906, 116, 916, 116, 2361, 1177, 1196, 105, 978, 2268,
+	2300, 2802, 2802, 1073, 1643, 2793, 2477, 580, 3090, 1732, 3105, 1969, 2795, 1442, 124, 116,
+	2268, 20, 857, 786, 786, 666, 332, 980, 873, 1643, 2321, 1307, 1348, 1514, 2650, 2348,
+	1138, 3004, 3004, 259, 2132, 1436, 265, 2356, 1307, 2905, 2754, 2906, 628, 1041, 2988, 2754,
+	980, 81, 980, 2132, 2923, 2754, 67, 28, 2746, 2945, 1316, 2148, 1338, 585, 2138, 705,
+	2626, 1804, 2564, 1179, 938, 2148, 363, 857, 580, 2051, 1297, 2586, 857, 1994, 1188, 2788,
+	1036, 259, 1980, 484, 1018, 2564, 2754, 2561, 1594, 2457, 2363, 2906, 916, 116, 2756, 363,
+	2268, 2746, 2802, 978, 1073, 1643, 1193, 1596, 3090, 1732, 873, 2754, 2564, 1643, 1514, 1179,
+	666, 786, 938, 1307, 1129, 3004, 1346, 585, 2988, 2905, 265, 2788, 2754, 1041, 2906, 628,
+	259, 1338, 2132, 1036, 1316, 2148, 938, 2626, 458, 2145, 915, 1018, 740, 740, 1364, 604,
+	2836, 2065, 2780, 756, 3156, 2945, 2914, 579, 628, 2409, 67, 1954, 1233, 3011, 2251, 3155,
+	1978, 1115, 682, 2914, 2945, 3140, 1097, 297, 628, 2129, 523, 3267, 3300, 532, 1443, 9,
+	2706, 2706, 89, 155, 740, 1060, 1484, 1467, 290, 2842, 620, 1476, 1668, 1084, 2433, 620,
+	2804, 658, 875, 2985, 753, 2363, 1164, 2084, 2842, 378, 740, 116, 2794, 2363, 2409, 3156,
+	2041, 579, 2996, 3140, 330, 2804, 491, 1804, 3011, 2803, 1954, 692, 3257, 2940, 604, 1498,
+	2945, 1137, 370, 290, 1978, 1442, 2594, 2804, 1484, 2409, 2803, 2945, 3179, 2914, 2202, 2794,
+	314, 2908, 2945, 2436, 521, 2986, 1466, 2745, 2745, 1804, 604, 2538, 27, 1026, 1097, 2538,
+	2947, 756, 2907, 1033, 786, 3011, 2780, 1298, 20, 2788, 2586, 1060, 3116, 491, 42, 2788,
+	2947, 2284, 2179, 1434, 2690, 516, 1091, 2540, 2538, 44, 2803, 698, 1771, 658, 1057, 491,
+	2786, 2947, 3156, 1033, 1467, 2785, 1388, 1388, 1388, 3217, 994, 3153, 2547, 1148, 1714, 2940,
+	2148, 2908, 2098, 2065, 2850, 2899, 1058, 836, 1018, 3156, 828, 1148, 394, 2969, 1137, 330,
+	993, 3018, 1508, 2986, 322, 537, 2537, 916, 2772, 2465, 860, 330, 3018, 2969, 1057, 2785,
+	322, 1452, 1386, 1714, 2882, 3018, 1058, 1058, 2987, 2986, 2883, 1699, 731, 2324, 1684, 2754,
+	697, 1937, 3010, 1388, 308, 2913, 1442, 1370, 26, 82, 2780, 532, 484, 996, 2780, 540,
+	2865, 1060, 1684, 290, 2817, 3092, 2650, 3140, 1956, 1586, 1442, 2049, 3169, 1052, 2348, 689,
+	978, 3105, 2945, 1770, 3180, 2698, 1434, 1442, 572, 2953, 2780, 1442, 2465, 1442, 2794, 978,
+	2945, 1548, 1548, 3011, 1452, 1604, 145, 2780, 2748, 1316, 2946, 2786, 2940, 19, 476, 2612,
+	2804, 2988, 1484, 1466, 468, 1058, 1937, 2914, 52, 1977, 2746, 705, 2788, 1060, 1546, 1602,
+	1602, 1370, 1388, 1052, 19, 692, 468, 1466, 1442, 20, 705, 1388, 83, 940, 940, 940,
+	156, 2105, 2105, 1116, 2625, 3137, 1116, 297, 2108, 1116, 1116, 532, 1116, 2625, 689, 689,
+	1204, 1610, 1620, 1620, 84, 2932, 2627, 1036, 2932, 786, 553, 242, 2066, 2196, 522, 588,
+	2780, 2196, 2098, 1108, 2881, 1827, 51, 2947, 2283, 1700, 1668, 3267, 458, 68, 2940, 2924,
+	2594, 92, 1097, 978, 1946, 2913, 155, 2945, 786, 2594, 1098, 2826, 25, 25, 954, 819,
+	2059, 458, 2082, 2649, 1554, 2956, 2537, 2634, 2084, 2876, 1244, 107, 2564, 2372, 155, 1316,
+	1137, 1325, 2828, 2226, 73, 649, 2121, 2121, 938, 2084, 1684, 1137, 1073, 121, 521, 1073,
+	2753, 2593, 825, 2564, 92, 2826, 1930, 786, 116, 1316, 2585, 1474, 876, 2082, 2881, 1057,
+	1073, 1081, 260, 458, 996, 2803, 2065, 586, 2716, 1073, 1338, 2746, 2196, 738, 1588, 2140,
+	786, 2747, 2084, 914, 268, 1316, 2227, 3012, 2388, 2747, 786, 60, 2593, 825, 3012, 777,
+	116, 2747, 2540, 586, 2716, 586, 2746, 2196, 738, 914, 2747, 3012, 2593, 1131, 1131, 2801,
+	2828, 2801, 1057, 2945, 3018, 3012, 2378, 1364, 1970, 1026, 2953, 3012, 1970, 25, 2945, 2811,
+	996, 2932, 555, 2107, 1298, 2812, 2484, 913, 2865, 2938, 2865, 627, 2508, 1299, 2050, 922,
+	2988, 2730, 65, 612, 522, 473, 1932, 2025, 1443, 284, 1115, 1372, 938, 2081, 628, 626,
+	2747, 2826, 1316, 2403, 2938, 2938, 906, 603, 2987, 2017, 1372, 739, 1066, 2666, 1036, 1298,
+	1066, 1505, 2651, 297, 2955, 3009, 994, 916, 1115, 2690, 2690, 2010, 1332, 2690, 3241, 3241,
+	370, 556, 1332, 2578, 916, 2065, 1209, 436, 2875, 2097, 2938, 2289, 2618, 626, 628, 2906,
+	2756, 1187, 2970, 3201, 2906, 2803, 2836, 2939, 2996, 2307, 529, 529, 1083, 1297, 1372, 1354,
+	1995, 2724, 1554, 420, 2922, 932, 2082, 836, 2892, 2907, 1036, 260, 2234, 1602, 145, 2803,
+	2010, 1482, 1339, 1804, 2138, 2932, 555, 2107, 913, 2812, 2484, 2865, 2865, 2730, 836, 612,
+	2050, 65, 2508, 922, 2988, 1482, 1443, 2027, 1115, 1098, 1066, 2651, 938, 2955, 1123, 1209,
+	2938, 2010, 1036, 2690, 916, 2955, 2955, 1209, 2618, 2970, 628, 3201, 2906, 626, 1804, 1553,
+	529, 2307, 932, 1372, 260, 2234, 2010, 2138, 705, 129, 841, 738, 2793, 3107, 129, 2284,
+	50, 2570, 1428, 841, 2876, 2377, 1140, 129, 2497, 2747, 2914, 2922, 2513, 1179, 2513, 673,
+	1450, 2786, 1452, 1993, 1993, 1450, 129, 129, 129, 1418, 129, 2324, 705, 2857, 705, 2914,
+	3107, 129, 2284, 1140, 2497, 2513, 2922, 1450, 1993, 129, 129, 689, 673, 689, 689, 2418,
+	2418, 193, 1057, 556, 2500, 2705, 3105, 2545, 2811, 2698, 2196, 2988, 1148, 308, 2947, 676,
+	676, 2545, 2947, 2667, 2938, 3300, 116, 1099, 2593, 83, 394, 2644, 2500, 83, 2420, 620,
+	908, 2196, 2627, 1091, 1066, 155, 2922, 2658, 394, 2811, 2915, 1148, 659, 2908, 1365, 2785,
+	193, 161, 1747, 628, 172, 1164, 580, 2524, 2986, 2420, 2922, 1042, 891, 2420, 1076, 3220,
+	155, 2804, 172, 2932, 2578, 689, 3113, 2748, 859, 628, 1859, 3012, 994, 1026, 2644, 1036,
+	1073, 986, 20, 2586, 697, 2748, 835, 241, 2508, 2586, 162, 777, 2788, 1300, 1452, 2513,
+	2594, 2932, 2753, 1666, 2586, 1554, 116, 2988, 2857, 1107, 2299, 1300, 3204, 2364, 308, 476,
+	2940, 1057, 2178, 297, 2969, 2593, 2748, 2811, 3105, 697, 908, 1602, 2908, 1666, 258, 2811,
+	1506, 3036, 1722, 2418, 556, 1057, 2705, 2586, 2698, 2788, 2196, 2988, 308, 676, 2947, 1076,
+	2420, 83, 2500, 620, 2938, 659, 2178, 2811, 938, 1365, 1091, 2785, 155, 161, 580, 628,
+	2986, 1747, 1164, 891, 1042, 2804, 859, 241, 1300, 835, 2513, 258, 2932, 1666, 162, 1450,
+	2857, 1107, 1554, 2299, 3204, 1722, 2427, 1298, 890, 2809, 698, 162, 1771, 116, 162, 2674,
+	913, 689, 1073, 25, 20, 740, 2801, 3009, 2833, 698, 2009, 2833, 1539, 2988, 706, 916,
+	522, 2706, 3130, 306, 2890, 3180, 3153, 1956, 2836, 2212, 2284, 3011, 2754, 3154, 476, 1514,
+	2978, 162, 83, 1154, 2706, 2940, 2129, 2754, 2129, 1121, 2027, 3121, 2993, 1954, 3172, 1140,
+	3180, 1850, 1137, 1977, 3043, 1068, 1442, 3139, 2570, 740, 2915, 2419, 116, 2706, 2706, 2500,
+	1450, 1540, 1986, 2594, 3156, 2218, 2610, 572, 2889, 2137, 2401, 1121, 659, 908, 162, 3177,
+	2945, 1508, 3169, 476, 908, 1450, 1138, 2507, 2097, 1562, 1346, 916, 2674, 2873, 2692, 1164,
+	627, 299, 2841, 18, 1484, 3217, 3169, 2388, 1986, 1305, 2594, 1330, 3249, 1212, 2050, 2050,
+	2908, 689, 2313, 2908, 786, 2923, 2780, 1988, 401, 1988, 2066, 689, 1026, 2066, 1049, 2986,
+	2618, 2138, 2794, 3249, 1298, 2226, 2497, 841, 2706, 873, 2513, 2065, 298, 3156, 1450, 1970,
+	2610, 2786, 211, 586, 2908, 2994, 3257, 2313, 2364, 2050, 3156, 2465, 1484, 2786, 1506, 3113,
+	1668, 44, 193, 129, 401, 2129, 116, 3156, 2988, 2865, 1002, 161, 2524, 2817, 1434, 3108,
+	609, 1450, 2706, 234, 532, 1089, 2643, 2908, 1506, 3105, 1113, 2940, 2932, 2705, 2009, 3172,
+	2908, 1466, 1514, 2610, 2809, 1060, 2465, 1138, 2786, 1017, 1386, 129, 1539, 2988, 2706, 2890,
+	306, 2129, 2212, 162, 1514, 3043, 2419, 2500, 740, 1137, 3257, 3180, 2706, 1850, 1068, 2940,
+	468, 2817, 1540, 2945, 1089, 1002, 1508, 908, 1986, 129, 1386, 299, 2908, 2841, 2097, 1164,
+	2050, 2050, 1212, 3217, 3249, 2524, 193, 1988, 3156, 1298, 2313, 2780, 44, 1450, 2065, 2364,
+	129, 1506, 401, 259, 3172, 1060, 2465, 2809, 835, 2747, 2747, 2747, 2986, 764, 2940, 33,
+	2666, 1100, 84, 92, 393, 2619, 523, 1257, 906, 2081, 986, 1268, 786, 2691, 811, 1986,
+	116, 1209, 2060, 2986, 2539, 1474, 162, 2817, 75, 162, 393, 1281, 148, 1666, 1418, 1474,
+	2817, 586, 3041, 2539, 2619, 148, 1281, 1482, 777, 777, 2084, 1201, 2083, 1354, 2316, 129,
+	1305, 1305, 522, 683, 2857, 2162, 1570, 476, 1305, 148, 668, 2634, 1977, 3241, 668, 2162,
+	2620, 84, 116, 1570, 738, 658, 2218, 2129, 817, 2857, 1316, 1060, 1970, 3185, 2377, 2553,
+	2620, 1388, 148, 3249, 522, 1970, 2505, 3145, 2138, 3249, 2484, 1075, 2707, 994, 1324, 1129,
+	2050, 1402, 3139, 148, 1970, 1540, 2297, 1554, 1554, 2337, 2865, 1428, 2065, 2065, 1722, 1018,
+	1316, 1818, 148, 1428, 2170, 580, 580, 1732, 980, 2788, 580, 915, 580, 580, 1129, 268,
+	2988, 2988, 786, 2908, 739, 2098, 873, 3249, 1452, 873, 2369, 2988, 875, 1588, 1060, 2050,
+	748, 1298, 1042, 50, 2028, 1588, 2865, 2907, 2817, 1411, 2988, 2690, 2049, 2739, 1411, 2748,
+	761, 305, 1993, 116, 1666, 1059, 2865, 323, 2907, 3105, 2986, 489, 2194, 1098, 49, 978,
+	2705, 540, 1059, 2868, 626, 628, 2345, 922, 2698, 1668, 1100, 2403, 67, 2994, 1978, 1483,
+	2754, 994, 1482, 3017, 682, 698, 1700, 2978, 1988, 1666, 938, 2794, 2129, 914, 1977, 1442,
+	2706, 161, 2122, 2018, 738, 116, 395, 2748, 1137, 537, 52, 2978, 883, 1977, 1778, 2841,
+	2570, 84, 740, 3091, 1140, 833, 2418, 569, 469, 2564, 1098, 2433, 988, 2811, 658, 28,
+	2746, 3124, 3177, 2948, 1428, 1508, 2658, 2619, 2940, 156, 2747, 1089, 1257, 873, 2801, 786,
+	1034, 1355, 738, 1204, 2857, 618, 1161, 2618, 1619, 2377, 3091, 2553, 2097, 2986, 1747, 3130,
+	883, 811, 2521, 2778, 2122, 2361, 2041, 1020, 2634, 1387, 2345, 2345, 1204, 1602, 298, 1386,
+	3259, 2785, 2971, 2401, 3241, 2050, 3145, 2811, 1747, 378, 1060, 537, 2092, 836, 3171, 569,
+	1330, 692, 1770, 2940, 1305, 1484, 1132, 265, 1113, 1498, 1442, 3257, 1386, 1603, 3249, 3156,
+	1778, 995, 2986, 523, 2417, 2401, 1020, 2618, 986, 2841, 3177, 1324, 3249, 3066, 121, 121,
+	1020, 2138, 3066, 2745, 2745, 2986, 377, 2226, 546, 1026, 1404, 2907, 2121, 2121, 1075, 113,
+	628, 2914, 740, 2289, 763, 2793, 2707, 994, 2420, 2276, 2873, 2753, 2068, 932, 2777, 682,
+	2313, 1450, 1539, 2418, 2417, 857, 3241, 2610, 2563, 2922, 626, 2970, 2066, 2050, 2753, 2276,
+	2402, 1402, 42, 1364, 1033, 1643, 1060, 2634, 2129, 1073, 2401, 1554, 2786, 2122, 132, 1060,
+	1060, 3178, 1081, 2857, 3201, 2969, 3113, 1193, 2883, 137, 2988, 2129, 2812, 161, 1091, 2890,
+	2524, 1026, 3289, 2364, 2364, 673, 876, 1434, 2890, 1626, 2787, 3081, 2809, 700, 857, 988,
+	1276, 3066, 2313, 3105, 763, 876, 2956, 1387, 266, 1370, 2435, 20, 2234, 1060, 2868, 996,
+	2435, 1388, 1428, 1388, 1636, 3137, 2811, 628, 1482, 860, 1386, 2801, 2986, 489, 1059, 2978,
+	2698, 1483, 682, 49, 938, 52, 2018, 1778, 1482, 2978, 3091, 740, 52, 84, 988, 1978,
+	2570, 873, 1098, 1204, 2747, 658, 2658, 3066, 988, 1276, 1060, 1089, 2801, 3091, 2811, 2890,
+	811, 1386, 1402, 1073, 1387, 2418, 2634, 883, 2345, 1020, 1161, 1060, 2971, 2105, 1442, 2050,
+	3257, 689, 1305, 265, 836, 1770, 1778, 537, 1113, 2401, 2417, 3241, 700, 546, 113, 266,
+	2618, 2753, 2745, 2289, 628, 2121, 740, 1026, 2138, 1081, 121, 2313, 42, 2050, 2563, 857,
+	2922, 1938, 1073, 1364, 132, 2883, 137, 1554, 1643, 2969, 2748, 2786, 876, 2364, 1434, 3289,
+	996, 763, 1387, 3105, 859, 1795, 2939, 738, 1388, 1129, 170, 2908, 739, 537, 1057, 708,
+	2236, 761, 2417, 708, 1650, 83, 2993, 3153, 996, 2098, 737, 65, 2754, 1073, 2417, 2988,
+	731, 2921, 1154, 1154, 1979, 1017, 3140, 83, 2908, 2897, 3148, 681, 708, 2754, 1905, 468,
+	785, 2234, 1442, 1636, 738, 2706, 1642, 1388, 123, 3156, 785, 2993, 394, 2130, 2817, 305,
+	476, 1137, 2923, 833, 3161, 2988, 2913, 2988, 2897, 2643, 2988, 2626, 2953, 601, 2777, 658,
+	841, 20, 3153, 2908, 962, 2817, 1066, 1428, 3177, 2914, 2618, 978, 1508, 2234, 1674, 785,
+	2194, 1089, 2857, 3169, 305, 1508, 962, 1778, 627, 1490, 1066, 1060, 2674, 1017, 2707, 171,
+	2778, 1145, 2988, 162, 1164, 1164, 113, 2785, 1164, 1138, 2673, 1113, 2618, 626, 626, 1290,
+	994, 2779, 2401, 1332, 1093, 1932, 1484, 1978, 2433, 738, 25, 3234, 1970, 2098, 2065, 89,
+	537, 1484, 2148, 1073, 1138, 2676, 2897, 2993, 2050, 1386, 2932, 3217, 1241, 620, 1305, 2409,
+	2050, 1113, 2940, 2940, 1113, 3241, 1330, 569, 2049, 378, 809, 1137, 1154, 2940, 3289, 1057,
+	2436, 2953, 308, 1626, 2226, 25, 2121, 2618, 994, 2618, 628, 1097, 1570, 738, 377, 2674,
+	2907, 938, 2994, 1985, 1305, 1586, 994, 2953, 356, 2780, 1138, 569, 201, 683, 940, 2953,
+	2994, 2801, 2761, 2417, 940, 330, 2586, 2794, 2276, 1450, 1058, 834, 1073, 2547, 916, 394,
+	394, 2940, 2924, 2908, 1057, 1388, 2626, 1252, 2617, 2617, 2940, 2674, 1539, 2817, 777, 2626,
+	290, 1058, 2682, 3132, 42, 2923, 2937, 1905, 308, 3156, 1452, 2969, 1514, 116, 2465, 3234,
+	2986, 2778, 1154, 2946, 2618, 2497, 1089, 2940, 1002, 116, 2953, 2524, 1026, 674, 1089, 1418,
+	2908, 777, 1132, 2802, 2802, 2674, 1547, 3289, 2988, 2953, 1484, 2682, 2802, 2882, 2940, 1980,
+	2435, 1506, 2785, 2938, 1057, 3058, 2986, 3105, 2932, 2914, 1980, 1818, 996, 1610, 2953, 1602,
+	522, 3004, 2988, 1371, 171, 1482, 940, 1466, 2465, 3004, 2953, 860, 2130, 1386, 1490, 1795,
+	1129, 1057, 2993, 1650, 2417, 1905, 2897, 201, 83, 3140, 833, 569, 1482, 2897, 2817, 2913,
+	1442, 305, 2130, 2993, 2882, 2706, 2497, 3156, 658, 841, 2857, 962, 3169, 785, 1490, 978,
+	2778, 162, 1386, 1145, 835, 626, 2988, 2802, 2618, 2779, 2148, 1626, 25, 1305, 89, 1970,
+	2065, 378, 809, 2993, 2524, 994, 938, 628, 835, 2121, 394, 1586, 2780, 2940, 2924, 2761,
+	1450, 1058, 2940, 1073, 940, 2937, 2953, 3132, 1452, 1418, 1089, 1132, 2988, 1484, 1018, 3105,
+	2953, 996, 1602, 860, 2465, 1483, 1105, 1442, 1075, 2802, 450, 1075, 1075, 2906, 450, 1484,
+	2977, 417, 1059, 1946, 417, 1946, 3180, 1161, 3179, 1073, 1610, 1610, 2987, 1450, 290, 1161,
+	1434, 1770, 2050, 1484, 1132, 1161, 1113, 1388, 2809, 2802, 1065, 1610, 1388, 2388, 3113, 1434,
+	1113, 2050, 1442, 2906, 417, 1548, 1548, 938, 275, 737, 1620, 1620, 737, 1948, 2132, 2129,
+	1674, 737, 2804, 1330, 2129, 1620, 309, 705, 737, 2129, 1620, 1538, 1581, 1666, 1033, 1669,
+	3257, 1866, 698, 1026, 1026, 1105, 865, 2625, 2667, 978, 1004, 1292, 978, 2435, 1386, 1778,
+	305, 945, 945, 2940, 2066, 475, 2788, 2697, 1668, 1668, 2066, 468, 332, 2979, 531, 2937,
+	2794, 2907, 2129, 1587, 2907, 2106, 3004, 1386, 483, 586, 195, 2905, 2906, 2907, 475, 28,
+	3139, 468, 195, 2937, 1586, 3107, 2907, 586, 1482, 3155, 699, 738, 739, 1619, 1619, 2994,
+	420, 2132, 274, 2713, 3177, 3153, 1602, 42, 137, 2706, 116, 2994, 274, 2706, 555, 1612,
+	1708, 555, 3241, 835, 835, 569, 698, 2594, 2993, 1978, 265, 777, 2052, 2993, 2585, 2609,
+	2435, 2435, 698, 692, 2754, 50, 537, 2706, 3161, 2130, 2409, 2418, 2980, 2418, 2650, 2778,
+	1138, 1113, 1042, 1138, 2907, 2673, 2497, 2785, 2804, 2907, 1370, 114, 2924, 2122, 913, 2780,
+	2780, 985, 2828, 628, 3089, 2860, 2764, 3089, 1836, 1724, 2050, 3097, 1060, 3241, 1057, 1057,
+	2050, 1057, 307, 292, 292, 938, 2898, 2946, 2828, 81, 3058, 2828, 250, 305, 2907, 1139,
+	2634, 1442, 1442, 329, 2138, 2828, 1227, 1804, 1132, 2923, 388, 3011, 2987, 331, 2939, 1770,
+	3058, 3257, 2131, 3011, 2907, 1906, 628, 2772, 2940, 393, 3257, 529, 331, 1108, 2900, 307,
+	292, 938, 2946, 1139, 1442, 81, 2634, 3241, 1227, 2987, 388, 2131, 2772, 1466, 1938, 817,
+	1938, 2907, 1466, 1467, 817, 1185, 458, 1442, 458, 1466, 817, 1185, 873, 2121, 137, 873,
+	3004, 369, 938, 1154, 2826, 2988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 772, 2563, 1548,
+	0, 0, 0, 0, 785, 473, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 2626, 1771, 0, 0,
+	0, 0, 0, 0, 569, 3156, 1346, 28, 0, 0, 1548, 0, 0, 0, 0, 0,
+};
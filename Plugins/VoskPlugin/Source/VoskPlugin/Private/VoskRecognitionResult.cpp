@@ -0,0 +1,109 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskRecognitionResult.h"
+#include "Serialization/JsonSerializer.h"
+
+
+namespace
+{
+	const uint8 BINARY_RESULT_VERSION = 1;
+	const int32 BINARY_RESULT_HEADER_SIZE = 8;
+
+	FORCEINLINE float ReadFloat(const uint8* Data)
+	{
+		// word arrays follow variable length text, so they are not aligned
+		float Value;
+		FMemory::Memcpy(&Value, Data, sizeof(float));
+		return Value;
+	}
+}
+
+
+bool FVoskRecognitionResult::FromJson(const FString& Raw, FVoskRecognitionResult& OutResult)
+{
+	TSharedPtr<FJsonObject> Result;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Raw);
+
+	if (!FJsonSerializer::Deserialize(Reader, Result) || !Result.IsValid())
+	{
+		return false;
+	}
+
+	OutResult.Words.Reset();
+
+	if (Result->TryGetStringField(TEXT("partial"), OutResult.Text))
+	{
+		OutResult.Type = EVoskResultType::Partial;
+		return true;
+	}
+
+	if (Result->TryGetStringField(TEXT("text"), OutResult.Text))
+	{
+		OutResult.Type = EVoskResultType::Final;
+
+		// present when server runs with --show-words
+		const TArray<TSharedPtr<FJsonValue>>* Words = nullptr;
+		if (Result->TryGetArrayField(TEXT("result"), Words))
+		{
+			for (const TSharedPtr<FJsonValue>& Word : *Words)
+			{
+				const TSharedPtr<FJsonObject>* WordObject = nullptr;
+				if (!Word.IsValid() || !Word->TryGetObject(WordObject))
+					continue;
+
+				FVoskWordTiming& Timing = OutResult.Words.AddDefaulted_GetRef();
+				(*WordObject)->TryGetNumberField(TEXT("start"), Timing.Start);
+				(*WordObject)->TryGetNumberField(TEXT("end"), Timing.End);
+				(*WordObject)->TryGetNumberField(TEXT("conf"), Timing.Confidence);
+			}
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool FVoskRecognitionResult::FromBinary(const uint8* Data, int32 Size, FVoskRecognitionResult& OutResult)
+{
+	if (Data == nullptr || Size < BINARY_RESULT_HEADER_SIZE || Data[0] != BINARY_RESULT_VERSION)
+		return false;
+
+	EVoskResultType Type;
+	switch (Data[1])
+	{
+	case 1: Type = EVoskResultType::Partial; break;
+	case 2: Type = EVoskResultType::Final; break;
+	default: return false;
+	}
+
+	const int32 NumWords = Data[2] | (Data[3] << 8);
+	const uint32 TextLength = Data[4] | (Data[5] << 8) | (Data[6] << 16) | ((uint32)Data[7] << 24);
+
+	const int64 ExpectedSize = BINARY_RESULT_HEADER_SIZE + (int64)TextLength + (int64)NumWords * 3 * sizeof(float);
+	if (ExpectedSize > Size)
+		return false;
+
+	const uint8* Text = Data + BINARY_RESULT_HEADER_SIZE;
+	const uint8* Starts = Text + TextLength;
+	const uint8* Ends = Starts + NumWords * sizeof(float);
+	const uint8* Confs = Ends + NumWords * sizeof(float);
+
+	OutResult.Type = Type;
+
+	// conversion buffer lives on the stack for typical command lengths
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text), TextLength);
+	OutResult.Text.Reset(Converted.Length());
+	OutResult.Text.AppendChars(Converted.Get(), Converted.Length());
+
+	OutResult.Words.Reset(NumWords);
+	OutResult.Words.AddUninitialized(NumWords);
+	for (int32 i = 0; i < NumWords; i++)
+	{
+		FVoskWordTiming& Timing = OutResult.Words[i];
+		Timing.Start = ReadFloat(Starts + i * sizeof(float));
+		Timing.End = ReadFloat(Ends + i * sizeof(float));
+		Timing.Confidence = ReadFloat(Confs + i * sizeof(float));
+	}
+
+	return true;
+}
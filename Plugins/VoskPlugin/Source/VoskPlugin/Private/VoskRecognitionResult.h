@@ -0,0 +1,53 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoskWordTiming.h"
+
+
+enum class EVoskResultType : uint8
+{
+	None,
+	Partial,
+	Final
+};
+
+/**
+* Single recognition result as produced by either the language server or libvosk.
+*/
+struct FVoskRecognitionResult
+{
+	EVoskResultType Type = EVoskResultType::None;
+	FString Text;
+	TArray<FVoskWordTiming> Words;
+
+	/** Sequence number of the audio frame this result answers, INDEX_NONE if unknown */
+	int32 Sequence = INDEX_NONE;
+
+	/** Seconds of audio the recognizer had consumed when it produced the result, 0 if unknown */
+	float AudioTime = 0.f;
+
+	/**
+	* Decodes vosk json result ({"partial": ...} or {"text": ..., "result": [...]})
+	*/
+	static bool FromJson(const FString& Raw, FVoskRecognitionResult& OutResult);
+
+	/**
+	* Decodes compact binary result frame. All integers and floats are little endian:
+	*
+	*   uint8  Version        (1)
+	*   uint8  Type           (1 - partial, 2 - final)
+	*   uint16 NumWords
+	*   uint32 TextLength     (bytes)
+	*   uint8  Text[TextLength]   UTF-8
+	*   float  Start[NumWords]
+	*   float  End[NumWords]
+	*   float  Conf[NumWords]
+	*
+	* OutResult storage is reused, so decoding into the same result does not allocate
+	* once it has grown to the typical result size.
+	*/
+	static bool FromBinary(const uint8* Data, int32 Size, FVoskRecognitionResult& OutResult);
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVoskRecognitionResult, const FVoskRecognitionResult&);
@@ -0,0 +1,64 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskReplayBuffer.h"
+
+
+void FVoskReplayBuffer::SetCapacity(int32 InCapacity)
+{
+	const int32 Capacity = FMath::Max(0, InCapacity) & ~1;
+	if (Capacity == Storage.Num())
+		return;
+
+	Storage.SetNumUninitialized(Capacity);
+	Storage.Shrink();
+	Reset();
+}
+
+void FVoskReplayBuffer::Append(const uint8* Data, int32 Size)
+{
+	const int32 Capacity = Storage.Num();
+	if (Capacity == 0 || Size <= 0)
+		return;
+
+	int32 Excess = Count + Size - Capacity;
+	if (Excess > 0)
+	{
+		Excess += Excess & 1; // keep 16 bit sample alignment
+
+		if (Excess >= Count)
+		{
+			// everything held so far and the head of the new data fall out
+			Data += Excess - Count;
+			Size -= Excess - Count;
+			Reset();
+		}
+		else
+		{
+			Start = (Start + Excess) % Capacity;
+			Count -= Excess;
+		}
+	}
+
+	const int32 End = (Start + Count) % Capacity;
+	const int32 First = FMath::Min(Size, Capacity - End);
+	FMemory::Memcpy(Storage.GetData() + End, Data, First);
+	FMemory::Memcpy(Storage.GetData(), Data + First, Size - First);
+	Count += Size;
+}
+
+void FVoskReplayBuffer::Reset()
+{
+	Start = 0;
+	Count = 0;
+}
+
+void FVoskReplayBuffer::CopyTo(TArray<uint8>& Out) const
+{
+	Out.SetNumUninitialized(Count);
+	if (Count == 0)
+		return;
+
+	const int32 First = FMath::Min(Count, Storage.Num() - Start);
+	FMemory::Memcpy(Out.GetData(), Storage.GetData() + Start, First);
+	FMemory::Memcpy(Out.GetData() + First, Storage.GetData(), Count - First);
+}
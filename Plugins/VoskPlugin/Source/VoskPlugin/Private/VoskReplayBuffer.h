@@ -0,0 +1,30 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+* Latest Capacity bytes of 16 bit audio.
+* Appending overwrites the oldest samples in place, nothing is moved per packet.
+*/
+class FVoskReplayBuffer
+{
+public:
+	/** Rounded down to whole samples, contents are dropped when it changes */
+	void SetCapacity(int32 InCapacity);
+	int32 GetCapacity() const { return Storage.Num(); }
+
+	void Append(const uint8* Data, int32 Size);
+	void Reset();
+
+	int32 Num() const { return Count; }
+
+	/** Contents oldest first */
+	void CopyTo(TArray<uint8>& Out) const;
+
+private:
+	TArray<uint8> Storage;
+	int32 Start = 0;
+	int32 Count = 0;
+};
@@ -0,0 +1,122 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskResampler.h"
+
+
+FVoskResampler::FVoskResampler(int32 InSourceRate, int32 InTargetRate)
+	: SourceRate(FMath::Max(1, InSourceRate))
+	, TargetRate(FMath::Max(1, InTargetRate))
+	, Step((double)FMath::Max(1, InSourceRate) / FMath::Max(1, InTargetRate))
+{
+	if (SourceRate == TargetRate)
+		return;
+
+	// cutoff relative to source Nyquist, lowered a little so the transition band ends near target Nyquist
+	const double Cutoff = 0.9 * FMath::Min(1.0, (double)TargetRate / SourceRate);
+	HalfWidth = FMath::CeilToInt32(ZERO_CROSSINGS / Cutoff);
+
+	const int32 Taps = 2 * HalfWidth;
+	Kernel.SetNumUninitialized((NUM_PHASES + 1) * Taps);
+
+	for (int32 Phase = 0; Phase <= NUM_PHASES; Phase++)
+	{
+		float* Row = Kernel.GetData() + Phase * Taps;
+		const double Fraction = (double)Phase / NUM_PHASES;
+
+		double Sum = 0.0;
+		for (int32 Tap = 0; Tap < Taps; Tap++)
+		{
+			// distance of the tap from the read position, in source samples
+			const double X = Tap - HalfWidth + 1 - Fraction;
+			const double T = X / HalfWidth;
+
+			const double Sinc = X == 0.0 ? 1.0 : FMath::Sin(PI * Cutoff * X) / (PI * Cutoff * X);
+			const double Window = FMath::Abs(T) >= 1.0 ? 0.0 : 0.42 + 0.5 * FMath::Cos(PI * T) + 0.08 * FMath::Cos(2.0 * PI * T);
+
+			Row[Tap] = (float)(Sinc * Window);
+			Sum += Row[Tap];
+		}
+
+		// unity gain at DC for every phase
+		for (int32 Tap = 0; Tap < Taps; Tap++)
+			Row[Tap] = (float)(Row[Tap] / Sum);
+	}
+
+	Reset();
+}
+
+void FVoskResampler::Reset()
+{
+	if (SourceRate == TargetRate)
+		return;
+
+	// output starts right at the first input sample, its left neighbours are silence
+	History.Reset();
+	History.SetNumZeroed(HalfWidth);
+	Position = HalfWidth;
+}
+
+int32 FVoskResampler::GetMaxOutputSamples(int32 NumSamples) const
+{
+	return (int32)FMath::CeilToDouble((FMath::Max(NumSamples, HalfWidth) + 1) / Step) + 1;
+}
+
+void FVoskResampler::Process(const int16* In, int32 NumSamples, TArray<int16>& Out)
+{
+	if (NumSamples <= 0)
+		return;
+
+	if (SourceRate == TargetRate)
+	{
+		Out.Append(In, NumSamples);
+		return;
+	}
+
+	const int32 Start = History.Num();
+	History.SetNumUninitialized(Start + NumSamples, false);
+	for (int32 i = 0; i < NumSamples; i++)
+		History[Start + i] = In[i];
+
+	Out.Reserve(Out.Num() + GetMaxOutputSamples(NumSamples));
+
+	const int32 Taps = 2 * HalfWidth;
+	const float* Samples = History.GetData();
+
+	// every output needs HalfWidth samples on both sides of its position
+	while (FMath::FloorToInt32(Position) + HalfWidth < History.Num())
+	{
+		const int32 Index = FMath::FloorToInt32(Position);
+		const int32 Phase = FMath::RoundToInt32((Position - Index) * NUM_PHASES);
+
+		const float* Row = Kernel.GetData() + Phase * Taps;
+		const float* Window = Samples + Index - HalfWidth + 1;
+
+		float Acc = 0.f;
+		for (int32 Tap = 0; Tap < Taps; Tap++)
+			Acc += Window[Tap] * Row[Tap];
+
+		Out.Add((int16)FMath::Clamp(FMath::RoundToInt32(Acc), -32768, 32767));
+		Position += Step;
+	}
+
+	// drop what no future output reaches anymore
+	const int32 Consumed = FMath::Clamp(FMath::FloorToInt32(Position) - HalfWidth + 1, 0, History.Num());
+	if (Consumed > 0)
+	{
+		History.RemoveAt(0, Consumed, false);
+		Position -= Consumed;
+	}
+}
+
+void FVoskResampler::Flush(TArray<int16>& Out)
+{
+	if (SourceRate == TargetRate)
+		return;
+
+	// trailing silence lets the filter reach past the last real sample
+	TArray<int16> Silence;
+	Silence.SetNumZeroed(HalfWidth);
+	Process(Silence.GetData(), Silence.Num(), Out);
+
+	Reset();
+}
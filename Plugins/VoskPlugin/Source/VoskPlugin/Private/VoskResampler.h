@@ -0,0 +1,57 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+* Streaming mono 16 bit sample rate converter.
+*
+* Samples are interpolated with a Blackman windowed sinc whose cutoff sits below the
+* lower of both Nyquist frequencies, so content the target rate can't represent is
+* filtered out instead of folding back into the speech band when downsampling.
+* Filter history carries over between Process() calls, so audio can be fed in chunks
+* of any size without seams.
+*/
+class FVoskResampler
+{
+public:
+	FVoskResampler(int32 InSourceRate, int32 InTargetRate);
+
+	/** Appends converted samples to Out */
+	void Process(const int16* In, int32 NumSamples, TArray<int16>& Out);
+
+	/** Appends the samples still held back by the filter at end of stream and resets */
+	void Flush(TArray<int16>& Out);
+
+	void Reset();
+
+	/** Upper bound of samples Process() or Flush() produces for NumSamples of input */
+	int32 GetMaxOutputSamples(int32 NumSamples) const;
+
+	int32 GetSourceRate() const { return SourceRate; }
+	int32 GetTargetRate() const { return TargetRate; }
+
+	/** Filter zero crossings on each side at the cutoff frequency */
+	static constexpr int32 ZERO_CROSSINGS = 24;
+
+	/** Fractional positions the filter is tabulated for */
+	static constexpr int32 NUM_PHASES = 256;
+
+private:
+	const int32 SourceRate;
+	const int32 TargetRate;
+	const double Step;
+
+	/** Filter reach on each side of the read position, in source samples */
+	int32 HalfWidth = 0;
+
+	/** NUM_PHASES + 1 rows of 2 * HalfWidth taps */
+	TArray<float> Kernel;
+
+	/** Input not yet fully consumed, starts with HalfWidth samples of silence */
+	TArray<float> History;
+
+	/** Read position in History */
+	double Position = 0.0;
+};
@@ -0,0 +1,176 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskServerConnection.h"
+#include "WebSocketsModule.h"
+#include "IWebSocket.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+
+static const char* FINAL_RESULT_REQUEST_MESSAGE = "__final_result_request__";
+static const char* RESET_RECOGNIZER_MESSAGE = "__reset_recognizer__";
+static const char* BINARY_RESULTS_CONFIG_MESSAGE = "{\"config\" : {\"result_format\" : \"binary\"}}";
+
+
+FVoskServerConnection::~FVoskServerConnection()
+{
+	Close();
+}
+
+void FVoskServerConnection::Connect(FString Addr, int32 Port)
+{
+	Close();
+
+	if (Addr.ToLower().Equals(TEXT("localhost")))
+		Addr = TEXT("127.0.0.1");
+
+	const FString Protocol("ws");
+	const FString ServerURL = FString::Printf(TEXT("%s://%s:%d/"), *Protocol, *Addr, Port);  // Server URL. You can use ws, wss or wss+insecure.
+	Socket = FWebSocketsModule::Get().CreateWebSocket(ServerURL, Protocol);
+
+	Socket->OnConnected().AddLambda([this]() {
+		bIsConnecting = false;
+		if (bPreferBinaryResults)
+			Socket->Send(BINARY_RESULTS_CONFIG_MESSAGE);
+		OnConnected.Broadcast();
+	});
+
+	Socket->OnConnectionError().AddLambda([this](const FString& Error) {
+		bIsConnecting = false;
+		OnConnectionError.Broadcast(Error);
+	});
+
+	Socket->OnClosed().AddLambda([this](int32 StatusCode, const FString& Reason, bool bWasClean) {
+		// This code will run when the connection to the server has been terminated.
+		// Because of an error or a call to Socket->Close().
+		bIsConnecting = false;
+		OnClosed.Broadcast(StatusCode, Reason, bWasClean);
+	});
+
+	Socket->OnMessage().AddLambda([this](const FString& Message) {
+		HandleMessage(Message);
+	});
+
+	Socket->OnRawMessage().AddLambda([this](const void* Data, SIZE_T Size, SIZE_T BytesRemaining) {
+		HandleRawMessage(Data, Size, BytesRemaining);
+	});
+
+	Tracer.BeginSession();
+
+	bIsConnecting = true;
+	Socket->Connect();
+}
+
+void FVoskServerConnection::Close()
+{
+	if (!Socket.IsValid())
+		return;
+
+	// disconnect delegates first, they capture this
+	Socket->OnConnected().Clear();
+	Socket->OnConnectionError().Clear();
+	Socket->OnClosed().Clear();
+	Socket->OnMessage().Clear();
+	Socket->OnRawMessage().Clear();
+	Socket->OnMessageSent().Clear();
+
+	if (Socket->IsConnected())
+		Socket->Close(0, TEXT("End Play"));
+
+	Socket.Reset();
+	RawBuffer.Reset();
+	bIsConnecting = false;
+}
+
+bool FVoskServerConnection::IsConnected() const
+{
+	return Socket.IsValid() && Socket->IsConnected();
+}
+
+bool FVoskServerConnection::SendAudio(const uint8* Data, int32 Size, double CaptureTime)
+{
+	if (!IsConnected() || Size <= 0)
+		return false;
+
+	Tracer.OnAudioSent(CaptureTime);
+	Socket->Send(Data, Size, true);
+	return true;
+}
+
+void FVoskServerConnection::RequestFinalResult()
+{
+	if (IsConnected())
+	{
+		// tell server to send final result
+		Tracer.OnFinalResultRequested();
+		Socket->Send(FINAL_RESULT_REQUEST_MESSAGE);
+	}
+}
+
+void FVoskServerConnection::ResetRecognizer()
+{
+	if (IsConnected())
+	{
+		Tracer.OnResetRequested();
+		Socket->Send(RESET_RECOGNIZER_MESSAGE);
+	}
+}
+
+void FVoskServerConnection::HandleMessage(const FString& Message)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskServerConnection::HandleMessage);
+
+	const double ArrivalTime = FPlatformTime::Seconds();
+
+	FVoskRecognitionResult Result;
+	if (FVoskRecognitionResult::FromJson(Message, Result))
+	{
+		Result.Sequence = Tracer.OnResult(ArrivalTime, Result.Type == EVoskResultType::Final);
+		OnResult.Broadcast(Result);
+	}
+	else
+	{
+		Tracer.OnOtherMessage();
+	}
+}
+
+void FVoskServerConnection::HandleRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskServerConnection::HandleRawMessage);
+
+	if (RawBuffer.Num() == 0)
+		RawArrivalTime = FPlatformTime::Seconds();
+
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+
+	// whole frame in one piece, decode in place
+	if (RawBuffer.Num() == 0 && BytesRemaining == 0)
+	{
+		if (FVoskRecognitionResult::FromBinary(Bytes, (int32)Size, BinaryResult))
+			BroadcastBinaryResult();
+		else
+			Tracer.OnOtherMessage();
+		return;
+	}
+
+	if (RawBuffer.Num() == 0)
+		RawBuffer.Reserve((int32)(Size + BytesRemaining));
+
+	RawBuffer.Append(Bytes, (int32)Size);
+
+	if (BytesRemaining > 0)
+		return;
+
+	if (FVoskRecognitionResult::FromBinary(RawBuffer.GetData(), RawBuffer.Num(), BinaryResult))
+		BroadcastBinaryResult();
+	else
+		Tracer.OnOtherMessage();
+
+	// keep capacity for the next fragmented frame
+	RawBuffer.Reset();
+}
+
+void FVoskServerConnection::BroadcastBinaryResult()
+{
+	BinaryResult.Sequence = Tracer.OnResult(RawArrivalTime, BinaryResult.Type == EVoskResultType::Final);
+	OnResult.Broadcast(BinaryResult);
+}
@@ -0,0 +1,71 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoskRecognitionResult.h"
+#include "VoskLatencyTracer.h"
+
+
+DECLARE_MULTICAST_DELEGATE(FOnVoskServerConnected);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVoskServerConnectionError, const FString&);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVoskServerConnectionClosed, int32, const FString&, bool);
+
+
+/**
+* Websocket session with vosk language server.
+*/
+class FVoskServerConnection
+{
+public:
+	~FVoskServerConnection();
+
+	void Connect(FString Addr, int32 Port);
+	void Close();
+
+	bool IsConnected() const;
+	bool IsConnecting() const { return bIsConnecting; }
+
+	/**
+	* CaptureTime is FPlatformTime::Seconds() when the samples were captured,
+	* 0 to use the send time
+	*/
+	bool SendAudio(const uint8* Data, int32 Size, double CaptureTime = 0.0);
+	void RequestFinalResult();
+	void ResetRecognizer();
+
+	/** Latency percentiles since the last Connect() */
+	FVoskLatencyReport GetLatencyReport() const { return Tracer.GetReport(); }
+
+	/** Close() runs on every reconnect, so the report is only logged when asked for */
+	void LogLatencyReport() const { Tracer.LogReport(); }
+
+	/**
+	* Ask server for compact binary result frames instead of json text.
+	* Servers that do not support it ignore the request and keep sending json.
+	* Must be set before Connect()
+	*/
+	bool bPreferBinaryResults = false;
+
+	FOnVoskServerConnected OnConnected;
+	FOnVoskServerConnectionError OnConnectionError;
+	FOnVoskServerConnectionClosed OnClosed;
+	FOnVoskRecognitionResult OnResult;
+
+private:
+	void HandleMessage(const FString& Message);
+	void HandleRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+	void BroadcastBinaryResult();
+
+	TSharedPtr<class IWebSocket> Socket;
+
+	/** Reassembly buffer for fragmented binary frames */
+	TArray<uint8> RawBuffer;
+	double RawArrivalTime = 0.0;
+
+	/** Reused for every binary result to keep decoding allocation free */
+	FVoskRecognitionResult BinaryResult;
+
+	FVoskLatencyTracer Tracer;
+
+	bool bIsConnecting = false;
+};
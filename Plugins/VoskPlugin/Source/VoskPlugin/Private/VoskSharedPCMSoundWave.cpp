@@ -0,0 +1,41 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskSharedPCMSoundWave.h"
+
+
+void UVoskSharedPCMSoundWave::SetSamples(const FVoskSharedPCM& InSamples, uint32 InSampleRate, uint16 InNumChannels)
+{
+    Samples = InSamples;
+    ReadOffset = 0;
+
+    NumChannels = InNumChannels;
+    SetSampleRate(InSampleRate);
+    Duration = InSampleRate > 0 && InNumChannels > 0
+        ? (float)InSamples->Num() / (InSampleRate * InNumChannels * sizeof(int16))
+        : 0.f;
+    SoundGroup = ESoundGroup::SOUNDGROUP_Default;
+    bLooping = false;
+    bProcedural = true;
+}
+
+void UVoskSharedPCMSoundWave::OnBeginGenerate()
+{
+    Super::OnBeginGenerate();
+    ReadOffset = 0;
+}
+
+int32 UVoskSharedPCMSoundWave::OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples)
+{
+    if (!Samples.IsValid())
+        return 0;
+
+    const int32 BytesLeft = Samples->Num() - ReadOffset;
+    const int32 BytesToCopy = FMath::Min<int32>(NumSamples * sizeof(int16), BytesLeft);
+    if (BytesToCopy <= 0)
+        return 0;
+
+    OutAudio.Append(Samples->GetData() + ReadOffset, BytesToCopy);
+    ReadOffset += BytesToCopy;
+
+    return BytesToCopy;
+}
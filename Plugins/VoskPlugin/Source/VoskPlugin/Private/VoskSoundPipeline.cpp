@@ -0,0 +1,445 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskSoundPipeline.h"
+#include "VoskDownmix.h"
+#include "VoskResampler.h"
+#include "VoskPCMCache.h"
+#include "Async/Async.h"
+#include "Audio.h"
+#include "AudioDecompress.h"
+#include "AudioDevice.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Sound/SoundWave.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+
+FVoskSoundPipeline::FVoskSoundPipeline(int32 InTargetSampleRate, int32 InChunkSamples, int32 InMaxChunksInFlight)
+	: TargetSampleRate(InTargetSampleRate)
+	, ChunkSamples(FMath::Max(256, InChunkSamples))
+	, MaxChunksInFlight(FMath::Max(1, InMaxChunksInFlight))
+{
+	ReadyEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	SpaceEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FVoskSoundPipeline::~FVoskSoundPipeline()
+{
+	// stages hold a reference to the pipeline, nothing is running by now
+	FPlatformProcess::ReturnSynchEventToPool(ReadyEvent);
+	FPlatformProcess::ReturnSynchEventToPool(SpaceEvent);
+}
+
+bool FVoskSoundPipeline::Start(USoundWave* Sound, FChunkSink InSink, FFinishedCallback InOnFinished)
+{
+	check(IsInGameThread());
+
+	if (bRunning || Sound == nullptr)
+		return false;
+
+	CompressedInfo.Reset();
+	CompressedData = nullptr;
+	CompressedSize = 0;
+	DecodedData = nullptr;
+	DecodedSize = 0;
+	FilePath.Reset();
+	SourceSnapshot.Reset();
+
+	// cheapest first: already converted, already decompressed, decoded on the fly
+	CachedSamples = FVoskPCMCache::Get().Find(Sound, TargetSampleRate);
+	if (CachedSamples.IsValid())
+	{
+		DecodedData = CachedSamples->GetData();
+		DecodedSize = CachedSamples->Num();
+		SourceSampleRate = TargetSampleRate;
+		SourceChannels = 1;
+	}
+	else if (VoskComponentUtils::GetDecompressedPCM(Sound, DecodedData, DecodedSize, SourceSampleRate, SourceChannels))
+	{
+		// RawPCMData may be freed or replaced while the stages run
+		SourceSnapshot.Append(DecodedData, DecodedSize);
+		DecodedData = SourceSnapshot.GetData();
+	}
+	else
+	{
+		if (!Sound->IsStreaming() && Sound->InitAudioResource(Sound->GetRuntimeFormat()) && Sound->GetResourceData() != nullptr)
+		{
+			SourceSnapshot.Append(Sound->GetResourceData(), Sound->GetResourceSize());
+			CompressedData = SourceSnapshot.GetData();
+			CompressedSize = SourceSnapshot.Num();
+			CompressedInfo.Reset(FAudioDevice::CreateCompressedAudioInfo(Sound));
+		}
+
+		if (!CompressedInfo.IsValid() || CompressedData == nullptr || CompressedSize <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Can't stream %s, streaming sounds are not supported"), *Sound->GetName());
+			CompressedInfo.Reset();
+			return false;
+		}
+	}
+
+	return Launch(MoveTemp(InSink), MoveTemp(InOnFinished));
+}
+
+bool FVoskSoundPipeline::StartFile(const FString& Path, int32 RawSampleRate, int32 RawNumChannels, FChunkSink InSink, FFinishedCallback InOnFinished)
+{
+	if (bRunning)
+		return false;
+
+	TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Can't open %s"), *Path);
+		return false;
+	}
+
+	const int64 FileSize = File->Size();
+
+	// header is parsed from a private copy, ReadWaveInfo patches oversized data chunks in place
+	TArray<uint8> Header;
+	Header.SetNumUninitialized((int32)FMath::Min<int64>(FileSize, 64 * 1024));
+	if (!File->Read(Header.GetData(), Header.Num()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Can't read %s"), *Path);
+		return false;
+	}
+
+	CompressedInfo.Reset();
+	CachedSamples.Reset();
+	SourceSnapshot.Reset();
+	DecodedData = nullptr;
+	DecodedSize = 0;
+
+	const bool bIsWave = Header.Num() >= 12 && FMemory::Memcmp(Header.GetData(), "RIFF", 4) == 0;
+	if (bIsWave)
+	{
+		TArray<uint8> Parsed = Header;
+		FWaveModInfo WaveInfo;
+		if (!WaveInfo.ReadWaveInfo(Parsed.GetData(), Parsed.Num()) || *WaveInfo.pFormatTag != 1 || *WaveInfo.pBitsPerSample != 16)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s is not 16 bit PCM wave file"), *Path);
+			return false;
+		}
+
+		FileDataOffset = WaveInfo.SampleDataStart - Parsed.GetData();
+		SourceSampleRate = *WaveInfo.pSamplesPerSec;
+		SourceChannels = FMath::Max<int32>(1, *WaveInfo.pChannels);
+
+		// streamed recordings often leave the size unpatched or overflow 32 bits, trust the file then
+		const uint32 DeclaredSize = FileDataOffset >= 4 ? FPlatformMemory::ReadUnaligned<uint32>(Header.GetData() + FileDataOffset - 4) : 0;
+		const int64 Available = FileSize - FileDataOffset;
+		FileDataSize = (DeclaredSize == 0 || DeclaredSize == MAX_uint32 || DeclaredSize > Available) ? Available : (int64)DeclaredSize;
+	}
+	else
+	{
+		FileDataOffset = 0;
+		FileDataSize = FileSize;
+		SourceSampleRate = FMath::Max(1, RawSampleRate);
+		SourceChannels = FMath::Max(1, RawNumChannels);
+	}
+
+	FilePath = Path;
+
+	return Launch(MoveTemp(InSink), MoveTemp(InOnFinished));
+}
+
+bool FVoskSoundPipeline::Launch(FChunkSink InSink, FFinishedCallback InOnFinished)
+{
+	Sink = MoveTemp(InSink);
+	OnFinished = MoveTemp(InOnFinished);
+
+	TArray<int16> Discarded;
+	while (Ready.Dequeue(Discarded)) {}
+	ChunksInFlight.Reset();
+
+	bCancelled = false;
+	bDecoderDone = false;
+	bDecoderFailed = false;
+	bRunning = true;
+
+	TSharedRef<FVoskSoundPipeline, ESPMode::ThreadSafe> Self = AsShared();
+	RecognizerTask = Async(EAsyncExecution::ThreadPool, [Self]() { Self->RunRecognizer(); });
+	DecoderTask = Async(EAsyncExecution::ThreadPool, [Self]() { Self->RunDecoder(); });
+
+	return true;
+}
+
+void FVoskSoundPipeline::Cancel()
+{
+	if (!bRunning)
+		return;
+
+	bCancelled = true;
+	SpaceEvent->Trigger();
+	ReadyEvent->Trigger();
+
+	if (DecoderTask.IsValid())
+		DecoderTask.Wait();
+
+	if (RecognizerTask.IsValid())
+		RecognizerTask.Wait();
+}
+
+void FVoskSoundPipeline::RunDecoder()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::RunDecoder);
+
+	FSoundQualityInfo QualityInfo;
+	if (CompressedInfo.IsValid())
+	{
+		if (CompressedInfo->ReadCompressedInfo(CompressedData, CompressedSize, &QualityInfo))
+		{
+			SourceSampleRate = QualityInfo.SampleRate;
+			SourceChannels = FMath::Max<int32>(1, QualityInfo.NumChannels);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to read compressed audio header"));
+			bDecoderFailed = true;
+		}
+	}
+
+	Resampler = MakeUnique<FVoskResampler>(SourceSampleRate, TargetSampleRate > 0 ? TargetSampleRate : SourceSampleRate);
+
+	if (!FilePath.IsEmpty())
+	{
+		ReadFile();
+		PushResamplerTail();
+		bDecoderDone = true;
+		ReadyEvent->Trigger();
+		return;
+	}
+
+	const int32 FrameBytes = SourceChannels * (int32)sizeof(int16);
+
+	if (CompressedInfo.IsValid() && !bDecoderFailed)
+	{
+		TArray<uint8> Decoded;
+		Decoded.SetNumUninitialized(ChunkSamples * FrameBytes);
+
+		// decoders pad the last buffer with silence, don't feed it to the recognizer
+		int64 Remaining = QualityInfo.SampleDataSize > 0 ? (int64)QualityInfo.SampleDataSize : MAX_int64;
+		bool bFinished = false;
+
+		while (!bFinished && Remaining > 0 && !bCancelled)
+		{
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::Decode);
+				bFinished = CompressedInfo->ReadCompressedData(Decoded.GetData(), false, Decoded.Num());
+			}
+
+			const int32 Valid = (int32)FMath::Min<int64>(Decoded.Num(), Remaining);
+			Remaining -= Valid;
+
+			if (!PushDecoded(reinterpret_cast<const int16*>(Decoded.GetData()), Valid / FrameBytes))
+				break;
+		}
+	}
+	else if (!bDecoderFailed)
+	{
+		const int32 ChunkBytes = ChunkSamples * FrameBytes;
+		for (int32 Offset = 0; Offset + FrameBytes <= DecodedSize && !bCancelled; Offset += ChunkBytes)
+		{
+			const int32 Size = FMath::Min(ChunkBytes, DecodedSize - Offset);
+			if (!PushDecoded(reinterpret_cast<const int16*>(DecodedData + Offset), Size / FrameBytes))
+				break;
+		}
+	}
+
+	PushResamplerTail();
+
+	CompressedInfo.Reset();
+	bDecoderDone = true;
+	ReadyEvent->Trigger();
+}
+
+void FVoskSoundPipeline::ReadFile()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::ReadFile);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	const int32 FrameBytes = SourceChannels * (int32)sizeof(int16);
+	const int32 ChunkBytes = ChunkSamples * FrameBytes;
+	const int64 WindowBytes = (FILE_WINDOW_BYTES / ChunkBytes) * ChunkBytes;
+	const int64 DataEnd = FileDataOffset + FileDataSize;
+
+	auto PushWindow = [this, FrameBytes, ChunkBytes](const uint8* Data, int64 Size)
+	{
+		for (int64 Offset = 0; Offset + FrameBytes <= Size; Offset += ChunkBytes)
+		{
+			const int32 Bytes = (int32)FMath::Min<int64>(ChunkBytes, Size - Offset);
+			if (!PushDecoded(reinterpret_cast<const int16*>(Data + Offset), Bytes / FrameBytes))
+				return false;
+		}
+		return true;
+	};
+
+	TUniquePtr<IMappedFileHandle> Mapped(PlatformFile.OpenMapped(*FilePath));
+	if (Mapped.IsValid())
+	{
+		auto MapWindow = [&Mapped, WindowBytes, DataEnd](int64 Offset) -> IMappedFileRegion*
+		{
+			if (Offset >= DataEnd)
+				return nullptr;
+
+			// preload hint lets the OS page in the window while the previous one is converted
+			return Mapped->MapRegion(Offset, FMath::Min(WindowBytes, DataEnd - Offset), EMappedFileFlags::EPreloadHint);
+		};
+
+		int64 Offset = FileDataOffset;
+		TUniquePtr<IMappedFileRegion> Current(MapWindow(Offset));
+
+		while (Current.IsValid() && !bCancelled)
+		{
+			const int64 NextOffset = Offset + Current->GetMappedSize();
+			TUniquePtr<IMappedFileRegion> Next(MapWindow(NextOffset));
+
+			if (!PushWindow(Current->GetMappedPtr(), Current->GetMappedSize()))
+				break;
+
+			// pages of the finished window are released right away
+			Current = MoveTemp(Next);
+			Offset = NextOffset;
+		}
+
+		return;
+	}
+
+	// platforms without mapping support read the same windows into a single buffer
+	TUniquePtr<IFileHandle> File(PlatformFile.OpenRead(*FilePath));
+	if (!File.IsValid() || !File->Seek(FileDataOffset))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Can't read %s"), *FilePath);
+		bDecoderFailed = true;
+		return;
+	}
+
+	TArray<uint8> Window;
+	Window.SetNumUninitialized((int32)WindowBytes);
+
+	for (int64 Offset = FileDataOffset; Offset < DataEnd && !bCancelled; Offset += WindowBytes)
+	{
+		const int64 Size = FMath::Min(WindowBytes, DataEnd - Offset);
+		if (!File->Read(Window.GetData(), Size))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed reading %s"), *FilePath);
+			bDecoderFailed = true;
+			return;
+		}
+
+		if (!PushWindow(Window.GetData(), Size))
+			break;
+	}
+}
+
+bool FVoskSoundPipeline::WaitForSpace()
+{
+	while (ChunksInFlight.GetValue() >= MaxChunksInFlight)
+	{
+		if (bCancelled)
+			return false;
+
+		// timeout covers a trigger landing between the check and the wait
+		SpaceEvent->Wait(10);
+	}
+
+	return !bCancelled;
+}
+
+bool FVoskSoundPipeline::PushDecoded(const int16* Samples, int32 NumFrames)
+{
+	if (NumFrames <= 0)
+		return true;
+
+	if (!WaitForSpace())
+		return false;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::Convert);
+
+	const int16* Mono = Samples;
+	if (SourceChannels > 1)
+	{
+		MonoScratch.SetNumUninitialized(NumFrames, false);
+		VoskDownmix::Downmix(Samples, MonoScratch.GetData(), NumFrames, SourceChannels);
+		Mono = MonoScratch.GetData();
+	}
+
+	// buffers travel back from recognizer stage, steady state allocates nothing
+	TArray<int16> Chunk;
+	Free.Dequeue(Chunk);
+	Chunk.Reset();
+
+	Resampler->Process(Mono, NumFrames, Chunk);
+
+	ChunksInFlight.Increment();
+	Ready.Enqueue(MoveTemp(Chunk));
+	ReadyEvent->Trigger();
+
+	return true;
+}
+
+void FVoskSoundPipeline::PushResamplerTail()
+{
+	if (bDecoderFailed || !WaitForSpace())
+		return;
+
+	TArray<int16> Chunk;
+	Free.Dequeue(Chunk);
+	Chunk.Reset();
+
+	Resampler->Flush(Chunk);
+
+	ChunksInFlight.Increment();
+	Ready.Enqueue(MoveTemp(Chunk));
+	ReadyEvent->Trigger();
+}
+
+void FVoskSoundPipeline::RunRecognizer()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::RunRecognizer);
+
+	for (;;)
+	{
+		TArray<int16> Chunk;
+		if (Ready.Dequeue(Chunk))
+		{
+			if (!bCancelled && Chunk.Num() > 0)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FVoskSoundPipeline::Recognize);
+				Sink(reinterpret_cast<const uint8*>(Chunk.GetData()), Chunk.Num() * (int32)sizeof(int16));
+			}
+
+			Free.Enqueue(MoveTemp(Chunk));
+			ChunksInFlight.Decrement();
+			SpaceEvent->Trigger();
+			continue;
+		}
+
+		if (bDecoderDone)
+		{
+			// decoder may have queued its last chunk right after the dequeue above
+			if (Ready.IsEmpty())
+				break;
+			continue;
+		}
+
+		ReadyEvent->Wait(10);
+	}
+
+	const bool bSuccess = !bDecoderFailed && !bCancelled;
+
+	Resampler.Reset();
+	CachedSamples.Reset();
+	SourceSnapshot.Empty();
+	DecodedData = nullptr;
+	DecodedSize = 0;
+	FilePath.Reset();
+
+	FFinishedCallback Callback = MoveTemp(OnFinished);
+	Sink = nullptr;
+	bRunning = false;
+
+	if (Callback)
+		Callback(bSuccess);
+}
@@ -0,0 +1,112 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Async/Future.h"
+#include "VoskSoundUtils.h"
+
+
+/**
+* Streams sound asset or audio file into a recognizer chunk by chunk.
+*
+* Decoder stage decompresses a chunk, downmixes and resamples it to mono 16 bit PCM,
+* recognizer stage hands it to the sink while the next chunk is being decoded. Only
+* MaxChunksInFlight converted chunks exist at a time, so memory does not grow with
+* the length of the asset and first results arrive after the first chunk.
+*
+* Both stages run on the thread pool, sink and OnFinished are called from the
+* recognizer stage.
+*/
+class FVoskSoundPipeline : public TSharedFromThis<FVoskSoundPipeline, ESPMode::ThreadSafe>
+{
+public:
+	typedef TFunction<void(const uint8* Data, int32 Size)> FChunkSink;
+	typedef TFunction<void(bool bSuccess)> FFinishedCallback;
+
+	FVoskSoundPipeline(int32 InTargetSampleRate = 16000, int32 InChunkSamples = 4096, int32 InMaxChunksInFlight = 4);
+	~FVoskSoundPipeline();
+
+	/**
+	* Game thread only. Sound must be kept alive by caller until OnFinished
+	*/
+	bool Start(class USoundWave* Sound, FChunkSink InSink, FFinishedCallback InOnFinished);
+
+	/**
+	* Streams 16 bit PCM wave or headerless raw file. File is memory mapped and walked in
+	* windows of FILE_WINDOW_BYTES with the next window mapped ahead, so recordings of any
+	* length are processed in constant memory. RawSampleRate and RawNumChannels describe
+	* files without RIFF header
+	*/
+	bool StartFile(const FString& Path, int32 RawSampleRate, int32 RawNumChannels, FChunkSink InSink, FFinishedCallback InOnFinished);
+
+	/** Stops both stages and waits for them, OnFinished is still called */
+	void Cancel();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** Lets a sink waiting on another thread give up once Cancel was called */
+	bool IsCancelled() const { return bCancelled; }
+
+	static constexpr int64 FILE_WINDOW_BYTES = 4 * 1024 * 1024;
+
+private:
+	bool Launch(FChunkSink InSink, FFinishedCallback InOnFinished);
+
+	void RunDecoder();
+	void ReadFile();
+	void RunRecognizer();
+
+	/** Converts interleaved decoded samples and queues them for recognizer stage */
+	bool PushDecoded(const int16* Samples, int32 NumFrames);
+
+	/** Queues the samples the resampler holds back at end of stream */
+	void PushResamplerTail();
+
+	/** Blocks decoder until recognizer stage catches up, false when cancelled */
+	bool WaitForSpace();
+
+	/** Source is one of: compressed asset decoded on the fly, already decoded samples or a file */
+	TUniquePtr<class ICompressedAudioInfo> CompressedInfo;
+	const uint8* CompressedData = nullptr;
+	int32 CompressedSize = 0;
+
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> CachedSamples;
+
+	/** Asset bytes copied on the game thread, stages never read the sound itself */
+	TArray<uint8> SourceSnapshot;
+	const uint8* DecodedData = nullptr;
+	int32 DecodedSize = 0;
+
+	FString FilePath;
+	int64 FileDataOffset = 0;
+	int64 FileDataSize = 0;
+
+	int32 SourceSampleRate = 0;
+	int32 SourceChannels = 1;
+
+	const int32 TargetSampleRate;
+	const int32 ChunkSamples;
+	const int32 MaxChunksInFlight;
+
+	TUniquePtr<class FVoskResampler> Resampler;
+	TArray<int16> MonoScratch;
+
+	TQueue<TArray<int16>, EQueueMode::Spsc> Ready;
+	TQueue<TArray<int16>, EQueueMode::Spsc> Free;
+	FThreadSafeCounter ChunksInFlight;
+
+	FEvent* ReadyEvent = nullptr;
+	FEvent* SpaceEvent = nullptr;
+
+	FChunkSink Sink;
+	FFinishedCallback OnFinished;
+
+	TFuture<void> DecoderTask;
+	TFuture<void> RecognizerTask;
+
+	FThreadSafeBool bRunning = false;
+	FThreadSafeBool bDecoderDone = false;
+	FThreadSafeBool bDecoderFailed = false;
+	FThreadSafeBool bCancelled = false;
+};
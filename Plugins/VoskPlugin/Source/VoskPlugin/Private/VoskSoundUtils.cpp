@@ -20,12 +20,12 @@
 #endif
 
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "VoskSharedPCMSoundWave.h"
 
 
 USoundWave* VoskComponentUtils::CreateSoundFromWaveDataWithHeader(const TArray<uint8> &rawData)
 {
-    USoundWave* sWave = nullptr;
-
 	// reading wave information
 	FWaveModInfo waveInfo;
 
@@ -35,103 +35,106 @@ USoundWave* VoskComponentUtils::CreateSoundFromWaveDataWithHeader(const TArray<u
         const uint8* waveData = rawData.GetData();
     #endif
 
-	if (waveInfo.ReadWaveInfo(waveData, rawData.Num()))
-	{
-	    // Construct USoundWave and feed received bytes
-        sWave = NewObject<USoundWave>();
-
-	    // apply wave info
-	    int32 DurationDiv = *waveInfo.pChannels * *waveInfo.pBitsPerSample * *waveInfo.pSamplesPerSec;
-	    if (DurationDiv)
-		    sWave->Duration = *waveInfo.pWaveDataSize * 8.0f / DurationDiv;
-	    else
-		    sWave->Duration = 0.0f;
-        sWave->SoundGroup = ESoundGroup::SOUNDGROUP_Default;
-        sWave->NumChannels = *waveInfo.pChannels;
-        sWave->RawPCMDataSize = waveInfo.SampleDataSize;
-
-        #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 19
-            sWave->SampleRate = *waveInfo.pSamplesPerSec;
-        #else
-            sWave->SetSampleRate(*waveInfo.pSamplesPerSec);
-        #endif
-
-        sWave->bLooping = false;
-        sWave->RawPCMData = (uint8*)FMemory::Malloc(sWave->RawPCMDataSize);
-        const uint8 headerOffset = 44;
-        FMemory::Memcpy(sWave->RawPCMData, rawData.GetData() + headerOffset, rawData.Num() - headerOffset);
-	}
-
-	return sWave;
+	if (!waveInfo.ReadWaveInfo(waveData, rawData.Num()))
+        return nullptr;
+
+    const uint8* samples = waveInfo.SampleDataStart;
+    return CreateSoundWithPCM(waveInfo.SampleDataSize, *waveInfo.pSamplesPerSec, *waveInfo.pChannels, [samples](uint8* Dest, int32 Size) {
+        FMemory::Memcpy(Dest, samples, Size);
+    });
 }
 
 class USoundWave* VoskComponentUtils::CreateSoundFromWaveDataWithoutHeader(const TArray<uint8> &rawData, uint16 InSampleRate/*=48000*/, uint8 InNumChannels/*=2*/)
 {
-    USoundWave* sWave = nullptr;
-
-    // reading wave information
+    // header only inspection, already wrapped data goes the usual way
     FWaveModInfo waveInfo;
+    if (rawData.Num() > WAVE_HEADER_SIZE && waveInfo.ReadWaveInfo(rawData.GetData(), rawData.Num()))
+        return CreateSoundFromWaveDataWithHeader(rawData);
 
-    #if UE_VERSION_NEWER_THAN(4, 19, 0)
-        uint8* waveData = const_cast<uint8*>(rawData.GetData());
+    // RawPCMData holds bare samples, so no header has to be generated on the way
+    return CreateSoundWithPCM(rawData.Num(), InSampleRate, InNumChannels, [&rawData](uint8* Dest, int32 Size) {
+        FMemory::Memcpy(Dest, rawData.GetData(), Size);
+    });
+}
+
+USoundWave* VoskComponentUtils::CreateSoundWithPCM(int32 DataSize, uint32 InSampleRate, uint16 InNumChannels, TFunctionRef<void(uint8*, int32)> Fill)
+{
+    if (DataSize <= 0)
+        return nullptr;
+
+    uint8* data = (uint8*)FMemory::Malloc(DataSize);
+    Fill(data, DataSize);
+
+    return CreateSoundAdoptingPCM(data, DataSize, InSampleRate, InNumChannels);
+}
+
+USoundWave* VoskComponentUtils::CreateSoundAdoptingPCM(uint8* Data, int32 DataSize, uint32 InSampleRate, uint16 InNumChannels)
+{
+    if (Data == nullptr || DataSize <= 0)
+    {
+        FMemory::Free(Data);
+        return nullptr;
+    }
+
+    // Construct USoundWave and feed received bytes
+    USoundWave* sWave = NewObject<USoundWave>();
+
+    // apply wave info
+    const int32 DurationDiv = InNumChannels * 16 * InSampleRate;
+    if (DurationDiv)
+        sWave->Duration = DataSize * 8.0f / DurationDiv;
+    else
+        sWave->Duration = 0.0f;
+    sWave->SoundGroup = ESoundGroup::SOUNDGROUP_Default;
+    sWave->NumChannels = InNumChannels;
+
+    #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 19
+        sWave->SampleRate = InSampleRate;
     #else
-        const uint8* waveData = rawData.GetData();
+        sWave->SetSampleRate(InSampleRate);
     #endif
 
-    if (!waveInfo.ReadWaveInfo(waveData, rawData.Num()))
-    {
-        TArray<uint8> waveDataWithHeader = GenerateWaveHeader(rawData, InSampleRate, InNumChannels);
+    sWave->bLooping = false;
 
-        FString errorMsg;
-        if(waveInfo.ReadWaveInfo(waveDataWithHeader.GetData(), waveDataWithHeader.Num(), &errorMsg))
-        {
-            // Construct USoundWave and feed received bytes
-            sWave = NewObject<USoundWave>();
-
-            // apply wave info
-            int32 DurationDiv = *waveInfo.pChannels * *waveInfo.pBitsPerSample * *waveInfo.pSamplesPerSec;
-            if (DurationDiv)
-                sWave->Duration = *waveInfo.pWaveDataSize * 8.0f / DurationDiv;
-            else
-                sWave->Duration = 0.0f;
-            sWave->SoundGroup = ESoundGroup::SOUNDGROUP_Default;
-            sWave->NumChannels = *waveInfo.pChannels;
-            sWave->RawPCMDataSize = waveInfo.SampleDataSize;
-
-            #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 19
-                sWave->SampleRate = *waveInfo.pSamplesPerSec;
-            #else
-                sWave->SetSampleRate(*waveInfo.pSamplesPerSec);
-            #endif
-
-            sWave->bLooping = false;
-            sWave->RawPCMData = (uint8*)FMemory::Malloc(sWave->RawPCMDataSize);
-            const uint8 headerOffset = 44;
-            FMemory::Memcpy(sWave->RawPCMData, waveDataWithHeader.GetData() + headerOffset, waveDataWithHeader.Num() - headerOffset);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("Error generating wave info\n%s"), *errorMsg);
-        }
-    }
+    // sound wave frees RawPCMData with FMemory::Free
+    sWave->RawPCMData = Data;
+    sWave->RawPCMDataSize = DataSize;
 
     return sWave;
 }
 
+USoundWave* VoskComponentUtils::CreateSoundFromSharedPCM(const FVoskSharedPCM& Samples, uint32 InSampleRate, uint16 InNumChannels)
+{
+    if (Samples->Num() == 0)
+        return nullptr;
+
+    UVoskSharedPCMSoundWave* sWave = NewObject<UVoskSharedPCMSoundWave>();
+    sWave->SetSamples(Samples, InSampleRate, InNumChannels);
+    return sWave;
+}
+
 const TArray<uint8> VoskComponentUtils::GenerateWaveHeader(const TArray<uint8> &rawData, uint16 InSampleRate, uint8 InNumChannels)
 {
-    int  chunkSize = 36 + rawData.Num();
-    int subchunk1Size = 16;
-    short audioFormat = 1;
-    short numChannels = InNumChannels;
-    int sampleRate = InSampleRate;
-    int byteRate = sampleRate * numChannels * rawData.GetTypeSize();
-    short blockAlign = numChannels * rawData.GetTypeSize();
-    short bitsPerSample = 16;
-    int buffSize = rawData.Num();
-
-    uint8 header[44];
-    uint8* end = header;
+    TArray<uint8> wav;
+    wav.SetNumUninitialized(WAVE_HEADER_SIZE + rawData.Num());
+    WriteWaveHeader(wav.GetData(), rawData.Num(), InSampleRate, InNumChannels);
+    FMemory::Memcpy(wav.GetData() + WAVE_HEADER_SIZE, rawData.GetData(), rawData.Num());
+    return wav;
+}
+
+void VoskComponentUtils::WriteWaveHeader(uint8* OutHeader, uint32 DataSize, uint32 InSampleRate, uint16 InNumChannels)
+{
+    uint32 chunkSize = 36 + DataSize;
+    uint32 subchunk1Size = 16;
+    uint16 audioFormat = 1;
+    uint16 numChannels = InNumChannels;
+    uint32 sampleRate = InSampleRate;
+    uint16 bitsPerSample = 16;
+    uint32 byteRate = sampleRate * numChannels * (bitsPerSample / 8);
+    uint16 blockAlign = numChannels * (bitsPerSample / 8);
+    uint32 buffSize = DataSize;
+
+    uint8* end = OutHeader;
     FMemory::Memcpy(end, "RIFF", 4);            end += 4;
     FMemory::Memcpy(end, &chunkSize, 4);        end += 4;
     FMemory::Memcpy(end, "WAVE", 4);            end += 4;
@@ -140,15 +143,11 @@ const TArray<uint8> VoskComponentUtils::GenerateWaveHeader(const TArray<uint8> &
     FMemory::Memcpy(end, &audioFormat, 2);      end += 2;
     FMemory::Memcpy(end, &numChannels, 2);      end += 2;
     FMemory::Memcpy(end, &sampleRate, 4);       end += 4;
-    FMemory::Memcpy(end, &byteRate, 4);	        end += 4;
+    FMemory::Memcpy(end, &byteRate, 4);         end += 4;
     FMemory::Memcpy(end, &blockAlign, 2);       end += 2;
     FMemory::Memcpy(end, &bitsPerSample, 2);    end += 2;
     FMemory::Memcpy(end, "data", 4);            end += 4;
     FMemory::Memcpy(end, &buffSize, 4);         end += 4;
-
-    TArray<uint8> wav = TArray<uint8>(header, 44);
-    wav.Append(rawData);
-    return wav;
 }
 
 
@@ -157,15 +156,20 @@ bool VoskComponentUtils::WriteRawAudioToWavFile(const TArray<uint8> &CaptureData
     FText err;
     if (FFileHelper::IsFilenameValidForSaving(Path, err))
     {
+        TUniquePtr<FArchive> writer(IFileManager::Get().CreateFileWriter(*Path));
+        if (!writer)
+            return false;
+
+        // header and samples go out back to back, no combined copy
         if (generateHeader)
         {
-            const TArray<uint8> wav = GenerateWaveHeader(CaptureData, InSampleRate, InNumChannels);
-            return FFileHelper::SaveArrayToFile(wav, *Path);
-        }
-        else
-        {
-            return FFileHelper::SaveArrayToFile(CaptureData, *Path);
+            uint8 header[WAVE_HEADER_SIZE];
+            WriteWaveHeader(header, CaptureData.Num(), InSampleRate, InNumChannels);
+            writer->Serialize(header, WAVE_HEADER_SIZE);
         }
+
+        writer->Serialize(const_cast<uint8*>(CaptureData.GetData()), CaptureData.Num());
+        return writer->Close();
     }
 
     UE_LOG(LogTemp, Error, TEXT("Error saving capture data: %s"), *err.ToString());
@@ -190,45 +194,30 @@ FString VoskComponentUtils::GetEnvironmentVariable(FString key)
     return result;
 }
 
-void VoskComponentUtils::EnsureSoundWaveDecompressed(USoundWave* Sound, bool StopDeviceSounds)
+bool VoskComponentUtils::GetDecompressedPCM(USoundWave* Sound, const uint8*& OutData, int32& OutSize, int32& OutSampleRate, int32& OutNumChannels)
 {
-    if (Sound == nullptr)
-        return;
-
-    if (Sound->RawPCMData) {
-        UE_LOG(LogTemp, Display, TEXT("PCM data already exists, no need to decompress"));
-        return;
-    }
-
-    auto AudioDevice = GEngine->GetMainAudioDevice();
-    if (!AudioDevice) {
-        return;
-    }
-
-    AudioDevice->StopAllSounds(StopDeviceSounds);
-    auto OriginalDecompressionType = Sound->DecompressionType;
-
-    Sound->DecompressionType = DTYPE_Native;
-    
-#if UE_VERSION_OLDER_THAN(5, 1, 1)
-    FName runtimeFormat = AudioDevice->GetRuntimeFormat(Sound);
-#else
-    FName runtimeFormat = Sound->GetRuntimeFormat();
-#endif
+    if (Sound == nullptr || Sound->RawPCMData == nullptr || Sound->RawPCMDataSize <= 0)
+        return false;
 
-    if (Sound->InitAudioResource(runtimeFormat))
+    FWaveModInfo WaveInfo;
+    if (WaveInfo.ReadWaveInfo(Sound->RawPCMData, Sound->RawPCMDataSize))
     {
-#if UE_VERSION_OLDER_THAN(4, 22, 0)
-        USoundWave::FAsyncAudioDecompress Decompress(SoundWave);
-#else
-        USoundWave::FAsyncAudioDecompress Decompress(Sound, MONO_PCM_BUFFER_SAMPLES);
-#endif
-        UE_LOG(LogTemp, Display, TEXT("start audio decompression"));
-        Decompress.StartSynchronousTask();
+        if (*WaveInfo.pBitsPerSample != 16)
+            return false;
+
+        OutData = WaveInfo.SampleDataStart;
+        OutSize = WaveInfo.SampleDataSize;
+        OutSampleRate = *WaveInfo.pSamplesPerSec;
+        OutNumChannels = *WaveInfo.pChannels;
+        return true;
     }
-    
-    Sound->DecompressionType = OriginalDecompressionType;
 
+    // decoders expand straight to bare samples
+    OutData = Sound->RawPCMData;
+    OutSize = Sound->RawPCMDataSize;
+    OutSampleRate = (int32)Sound->GetSampleRateForCurrentPlatform();
+    OutNumChannels = FMath::Max(1, Sound->NumChannels);
+    return true;
 }
 
 int32 VoskComponentUtils::GetSoundSampleRate(USoundWave* Sound)
@@ -0,0 +1,208 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskStringDistance.h"
+
+
+namespace
+{
+	/**
+	* Pattern match vectors of Myers algorithm: bit i is set where pattern[i] == codepoint.
+	* Pattern has at most 64 distinct codepoints, open addressing at load <= 0.5 on the stack.
+	*/
+	struct FPeqTable
+	{
+		static const int32 Size = 128;
+		static const UTF32CHAR Empty = 0xFFFFFFFF;
+
+		UTF32CHAR Keys[Size];
+		uint64 Masks[Size];
+
+		FPeqTable()
+		{
+			FMemory::Memset(Keys, 0xFF, sizeof(Keys));
+		}
+
+		static FORCEINLINE uint32 Slot(UTF32CHAR C)
+		{
+			// fibonacci hashing, top 7 bits
+			return (uint32)(C * 2654435769u) >> 25;
+		}
+
+		FORCEINLINE void Add(UTF32CHAR C, uint64 Bit)
+		{
+			uint32 i = Slot(C);
+			while (Keys[i] != Empty && Keys[i] != C)
+				i = (i + 1) & (Size - 1);
+
+			if (Keys[i] == Empty)
+			{
+				Keys[i] = C;
+				Masks[i] = 0;
+			}
+			Masks[i] |= Bit;
+		}
+
+		FORCEINLINE uint64 Get(UTF32CHAR C) const
+		{
+			uint32 i = Slot(C);
+			while (Keys[i] != Empty)
+			{
+				if (Keys[i] == C)
+					return Masks[i];
+				i = (i + 1) & (Size - 1);
+			}
+			return 0;
+		}
+	};
+
+	/** Pattern length must be in [1, 64] */
+	int32 MyersDistance(const UTF32CHAR* Pattern, int32 M, const UTF32CHAR* Text, int32 N)
+	{
+		FPeqTable Peq;
+		for (int32 i = 0; i < M; i++)
+			Peq.Add(Pattern[i], 1ull << i);
+
+		const uint64 Last = 1ull << (M - 1);
+		uint64 Pv = ~0ull;
+		uint64 Mv = 0;
+		int32 Score = M;
+
+		for (int32 j = 0; j < N; j++)
+		{
+			const uint64 Eq = Peq.Get(Text[j]);
+			const uint64 Xv = Eq | Mv;
+			const uint64 Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+
+			uint64 Ph = Mv | ~(Xh | Pv);
+			uint64 Mh = Pv & Xh;
+
+			if (Ph & Last) Score++;
+			else if (Mh & Last) Score--;
+
+			// top row of the dp matrix grows by one per text codepoint
+			Ph = (Ph << 1) | 1;
+			Mh = Mh << 1;
+
+			Pv = Mh | ~(Xv | Ph);
+			Mv = Ph & Xv;
+		}
+
+		return Score;
+	}
+
+	/**
+	* Ukkonen cut-off: cells further than Band from the diagonal are treated as infinite.
+	* Exact whenever the returned distance is <= Band.
+	*/
+	int32 BandedDistance(const UTF32CHAR* A, int32 N, const UTF32CHAR* B, int32 M, int32 Band)
+	{
+		const int32 Inf = MAX_int32 / 2;
+
+		TArray<int32, TInlineAllocator<256>> Row;
+		Row.AddUninitialized(M + 1);
+		for (int32 j = 0; j <= M; j++)
+			Row[j] = j <= Band ? j : Inf;
+
+		for (int32 i = 1; i <= N; i++)
+		{
+			const int32 Lo = FMath::Max(1, i - Band);
+			const int32 Hi = FMath::Min(M, i + Band);
+
+			int32 Diag = Row[Lo - 1];
+			Row[Lo - 1] = (Lo == 1 && i <= Band) ? i : Inf;
+
+			const UTF32CHAR Ca = A[i - 1];
+			for (int32 j = Lo; j <= Hi; j++)
+			{
+				const int32 Up = Row[j];
+				const int32 Value = FMath::Min3(Diag + (Ca == B[j - 1] ? 0 : 1), Up + 1, Row[j - 1] + 1);
+				Diag = Up;
+				Row[j] = Value;
+			}
+		}
+
+		return Row[M];
+	}
+}
+
+
+void VoskStringDistance::ToCodepoints(const FString& In, FCodepoints& Out)
+{
+	Out.Reset(In.Len());
+
+	const TCHAR* Chars = *In;
+	const int32 Len = In.Len();
+
+	for (int32 i = 0; i < Len; i++)
+	{
+		UTF32CHAR C = (UTF32CHAR)Chars[i];
+
+		if (StringConv::IsHighSurrogate(C) && i + 1 < Len && StringConv::IsLowSurrogate((UTF32CHAR)Chars[i + 1]))
+		{
+			C = StringConv::EncodeSurrogate((uint16)C, (uint16)Chars[i + 1]);
+			i++;
+		}
+
+		Out.Add(C);
+	}
+}
+
+int32 VoskStringDistance::Levenshtein(const UTF32CHAR* A, int32 LenA, const UTF32CHAR* B, int32 LenB)
+{
+	// common prefix and suffix never change the distance
+	while (LenA > 0 && LenB > 0 && *A == *B)
+	{
+		A++; B++;
+		LenA--; LenB--;
+	}
+	while (LenA > 0 && LenB > 0 && A[LenA - 1] == B[LenB - 1])
+	{
+		LenA--; LenB--;
+	}
+
+	if (LenA == 0) return LenB;
+	if (LenB == 0) return LenA;
+
+	if (LenA > LenB)
+	{
+		Swap(A, B);
+		Swap(LenA, LenB);
+	}
+
+	if (LenA <= 64)
+		return MyersDistance(A, LenA, B, LenB);
+
+	// distance is at least the length difference, widen band until result fits inside it
+	int32 Band = FMath::Max(LenB - LenA, 32);
+	for (;;)
+	{
+		const int32 Distance = BandedDistance(A, LenA, B, LenB, Band);
+		if (Distance <= Band || Band >= LenB)
+			return Distance;
+		Band *= 2;
+	}
+}
+
+int32 VoskStringDistance::Levenshtein(const FString& A, const FString& B)
+{
+	FCodepoints CodepointsA;
+	FCodepoints CodepointsB;
+	ToCodepoints(A, CodepointsA);
+	ToCodepoints(B, CodepointsB);
+
+	return Levenshtein(CodepointsA.GetData(), CodepointsA.Num(), CodepointsB.GetData(), CodepointsB.Num());
+}
+
+float VoskStringDistance::Similarity(const FString& A, const FString& B)
+{
+	if (A.IsEmpty() || B.IsEmpty()) return 0.f;
+	if (A == B) return 1.f;
+
+	FCodepoints CodepointsA;
+	FCodepoints CodepointsB;
+	ToCodepoints(A, CodepointsA);
+	ToCodepoints(B, CodepointsB);
+
+	const int32 Distance = Levenshtein(CodepointsA.GetData(), CodepointsA.Num(), CodepointsB.GetData(), CodepointsB.Num());
+	return 1.f - (float)Distance / (float)FMath::Max(CodepointsA.Num(), CodepointsB.Num());
+}
@@ -0,0 +1,31 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+* Levenshtein distance over unicode codepoints.
+*
+* Shorter side up to 64 codepoints runs Myers/Hyyro bit-parallel algorithm in O(n) words,
+* longer pairs run banded dynamic programming with a single O(n) row. Buffers for typical
+* command lengths live on the stack.
+*/
+namespace VoskStringDistance
+{
+	/** Codepoints of typical command fit inline, longer strings spill to heap */
+	typedef TArray<UTF32CHAR, TInlineAllocator<128>> FCodepoints;
+
+	/** Decodes UTF-16 surrogate pairs, so every element is a whole codepoint */
+	void ToCodepoints(const FString& In, FCodepoints& Out);
+
+	int32 Levenshtein(const UTF32CHAR* A, int32 LenA, const UTF32CHAR* B, int32 LenB);
+
+	int32 Levenshtein(const FString& A, const FString& B);
+
+	/**
+	* 1 - distance / longest length, in codepoints.
+	* 0 if either string is empty.
+	*/
+	float Similarity(const FString& A, const FString& B);
+}
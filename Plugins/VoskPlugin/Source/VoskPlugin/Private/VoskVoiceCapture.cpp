@@ -0,0 +1,141 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskVoiceCapture.h"
+#include "VoskAudioConditioner.h"
+#include "Voice.h"
+
+
+FVoskVoiceCapture::FVoskVoiceCapture(int32 InSampleRate)
+	: SampleRate(InSampleRate)
+{
+}
+
+FVoskVoiceCapture::~FVoskVoiceCapture()
+{
+	Stop();
+}
+
+bool FVoskVoiceCapture::Start()
+{
+	if (bIsActive) return false;
+
+	if (!FVoiceModule::Get().DoesPlatformSupportVoiceCapture())
+	{
+		UE_LOG(LogTemp, Log, TEXT("%s"), TEXT("VoiceCapture is not supported on this platform!"));
+	}
+
+	if (!VoiceCapture.IsValid())
+	{
+		VoiceCapture = FVoiceModule::Get().CreateVoiceCapture("");
+		if (VoiceCapture.IsValid())
+		{
+			FString DeviceName;
+			if (!VoiceCapture->Init(DeviceName, SampleRate, 1))
+				return false;
+			UE_LOG(LogTemp, Log, TEXT("IVoiceCapture initialized"));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to obtain IVoiceCapture, no voice available!"));
+			return false;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Capture started"));
+	RecordedSamples.Empty();
+	Tail.Reset();
+	if (Conditioner.IsValid())
+		Conditioner->Reset();
+	VoiceCapture->Start();
+	bIsActive = true;
+
+	return true;
+}
+
+void FVoskVoiceCapture::Stop()
+{
+	if (bIsActive && Conditioner.IsValid())
+	{
+		// conditioner still holds the last hop or two of speech
+		TArray<int16> Held;
+		Conditioner->Flush(Held);
+
+		Tail.Reset();
+		Tail.Append(reinterpret_cast<const uint8*>(Held.GetData()), Held.Num() * sizeof(int16));
+		if (bKeepRecordedSamples)
+			RecordedSamples.Append(Tail);
+
+		// held samples are the newest the device handed out
+		LastCaptureTime = LastReadTime - (double)Held.Num() / SampleRate;
+	}
+
+	bIsActive = false;
+
+	if (VoiceCapture.IsValid())
+		VoiceCapture->Stop();
+}
+
+int32 FVoskVoiceCapture::Poll(TArray<uint8>& OutChunk)
+{
+	OutChunk.Reset();
+
+	if (!bIsActive)
+	{
+		OutChunk = MoveTemp(Tail);
+		Tail.Reset();
+		return OutChunk.Num();
+	}
+
+	if (!VoiceCapture.IsValid())
+		return 0;
+
+	uint32 BytesAvailable = 0;
+	const EVoiceCaptureState::Type CaptureState = VoiceCapture->GetCaptureState(BytesAvailable);
+	if (CaptureState != EVoiceCaptureState::Ok || BytesAvailable == 0)
+		return 0;
+
+	OutChunk.AddUninitialized(BytesAvailable);
+
+	uint32 BytesRead = 0;
+	const EVoiceCaptureState::Type MicrophoneState = VoiceCapture->GetVoiceData(OutChunk.GetData(), BytesAvailable, BytesRead);
+	const double ReadTime = FPlatformTime::Seconds();
+	if (MicrophoneState != EVoiceCaptureState::Ok || BytesRead == 0)
+	{
+		OutChunk.Reset();
+		return 0;
+	}
+
+	// device may hand out less than it reported
+	OutChunk.SetNum(BytesRead, false);
+	if (Conditioner.IsValid())
+		Conditioner->Process(reinterpret_cast<int16*>(OutChunk.GetData()), BytesRead / sizeof(int16));
+	if (bKeepRecordedSamples)
+		RecordedSamples.Append(OutChunk);
+
+	// device buffer is drained in order, its newest sample has just come in and the first one is a chunk length older.
+	// Conditioned output lags the device by the conditioner latency on top of that
+	const int32 Latency = Conditioner.IsValid() ? Conditioner->GetLatency() : 0;
+	LastReadTime = ReadTime;
+	LastCaptureTime = ReadTime - (double)(BytesRead / sizeof(int16) + Latency) / SampleRate;
+
+	return BytesRead;
+}
+
+void FVoskVoiceCapture::SetConditioning(bool bEnable, const FVoskAudioConditioningSettings& Settings)
+{
+	if (!bEnable)
+	{
+		Conditioner.Reset();
+		return;
+	}
+
+	if (Conditioner.IsValid())
+		Conditioner->SetSettings(Settings);
+	else
+		Conditioner = MakeUnique<FVoskAudioConditioner>(SampleRate, Settings);
+}
+
+FVoskAudioConditioningStats FVoskVoiceCapture::GetConditioningStats() const
+{
+	return Conditioner.IsValid() ? Conditioner->GetStats() : FVoskAudioConditioningStats();
+}
@@ -0,0 +1,63 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoskAudioConditioning.h"
+
+
+/**
+* Microphone capture shared by all recognizer components.
+* Owns IVoiceCapture and keeps everything recorded since Start().
+*/
+class FVoskVoiceCapture
+{
+public:
+	explicit FVoskVoiceCapture(int32 InSampleRate = 16000);
+	~FVoskVoiceCapture();
+
+	bool Start();
+
+	/** Conditioned audio still held back is kept for one more Poll() */
+	void Stop();
+
+	bool IsActive() const { return bIsActive; }
+	int32 GetSampleRate() const { return SampleRate; }
+
+	/**
+	* Reads whatever the device has buffered since the last call, or the conditioner tail once after Stop().
+	* Returns number of bytes written to OutChunk
+	*/
+	int32 Poll(TArray<uint8>& OutChunk);
+
+	/**
+	* FPlatformTime::Seconds() when the first sample of the last chunk Poll() returned was captured.
+	* Estimated from the chunk length, the device doesn't stamp its buffers
+	*/
+	double GetLastCaptureTime() const { return LastCaptureTime; }
+
+	const TArray<uint8>& GetRecordedSamples() const { return RecordedSamples; }
+
+	/**
+	* Conditions everything Poll() returns, recorded samples included.
+	* Takes effect immediately, stage state is kept when only settings change
+	*/
+	void SetConditioning(bool bEnable, const FVoskAudioConditioningSettings& Settings);
+
+	/** Zeroed when conditioning is off */
+	FVoskAudioConditioningStats GetConditioningStats() const;
+
+	/** Turn off for long sessions that are archived to disk instead */
+	bool bKeepRecordedSamples = true;
+
+private:
+	TSharedPtr<class IVoiceCapture> VoiceCapture;
+	TArray<uint8> RecordedSamples;
+	TArray<uint8> Tail;
+	TUniquePtr<class FVoskAudioConditioner> Conditioner;
+
+	double LastCaptureTime = 0.0;
+	double LastReadTime = 0.0;
+
+	const int32 SampleRate;
+	bool bIsActive = false;
+};
@@ -0,0 +1,122 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#include "VoskWavWriter.h"
+#include "VoskSoundUtils.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+
+
+FVoskWavWriter::~FVoskWavWriter()
+{
+	Close();
+}
+
+bool FVoskWavWriter::Open(const FString& Path, int32 InSampleRate, int32 InNumChannels)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+	File.Reset(PlatformFile.OpenWrite(*Path));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't open %s for writing"), *Path);
+		return false;
+	}
+
+	FilePath = Path;
+	SampleRate = InSampleRate;
+	NumChannels = InNumChannels;
+	DataSize = 0;
+	bStopping = false;
+	bWriteFailed = false;
+
+	// sizes are unknown until Close()
+	uint8 Header[VoskComponentUtils::WAVE_HEADER_SIZE];
+	VoskComponentUtils::WriteWaveHeader(Header, 0, SampleRate, NumChannels);
+	if (!File->Write(Header, sizeof(Header)))
+	{
+		File.Reset();
+		return false;
+	}
+
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("VoskWavWriter"), 0, TPri_BelowNormal);
+
+	return Thread != nullptr;
+}
+
+void FVoskWavWriter::Append(const uint8* Data, int32 Size)
+{
+	if (!IsOpen() || Size <= 0)
+		return;
+
+	TArray<uint8> Buffer;
+	Free.Dequeue(Buffer);
+
+	Buffer.Reset();
+	Buffer.Append(Data, Size);
+
+	Pending.Enqueue(MoveTemp(Buffer));
+	WorkEvent->Trigger();
+}
+
+uint32 FVoskWavWriter::Run()
+{
+	for (;;)
+	{
+		const bool bLastPass = bStopping;
+
+		TArray<uint8> Buffer;
+		while (Pending.Dequeue(Buffer))
+		{
+			if (!bWriteFailed && !File->Write(Buffer.GetData(), Buffer.Num()))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed writing audio to %s"), *FilePath);
+				bWriteFailed = true;
+			}
+
+			DataSize += Buffer.Num();
+			Free.Enqueue(MoveTemp(Buffer));
+		}
+
+		if (bLastPass)
+			break;
+
+		WorkEvent->Wait(100);
+	}
+
+	return 0;
+}
+
+bool FVoskWavWriter::Close()
+{
+	if (Thread == nullptr)
+		return false;
+
+	// writer drains everything queued before it saw the stop flag
+	bStopping = true;
+	WorkEvent->Trigger();
+	Thread->WaitForCompletion();
+
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+
+	Free.Empty();
+
+	// RIFF can't describe more than 4GB, keep the header valid and leave the rest as trailing data
+	const uint32 PatchedDataSize = (uint32)FMath::Min<int64>(DataSize, MAX_uint32 - VoskComponentUtils::WAVE_HEADER_SIZE);
+
+	uint8 Header[VoskComponentUtils::WAVE_HEADER_SIZE];
+	VoskComponentUtils::WriteWaveHeader(Header, PatchedDataSize, SampleRate, NumChannels);
+
+	const bool bPatched = File->Seek(0) && File->Write(Header, sizeof(Header));
+	File.Reset();
+
+	return bPatched && !bWriteFailed;
+}
@@ -0,0 +1,50 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+
+
+/**
+* Incremental 16 bit PCM wave file sink.
+*
+* Append() copies samples into a recycled buffer and hands it to a background thread
+* that writes to disk, so memory stays constant no matter how long the session is.
+* Header is written with zero sizes on Open() and patched on Close().
+*/
+class FVoskWavWriter : public FRunnable
+{
+public:
+	~FVoskWavWriter();
+
+	bool Open(const FString& Path, int32 InSampleRate = 16000, int32 InNumChannels = 1);
+
+	/** Game thread only */
+	void Append(const uint8* Data, int32 Size);
+
+	/** Flushes pending audio, patches RIFF sizes and closes the file */
+	bool Close();
+
+	bool IsOpen() const { return Thread != nullptr; }
+	const FString& GetPath() const { return FilePath; }
+
+	/** FRunnable */
+	virtual uint32 Run() override;
+
+private:
+	TUniquePtr<class IFileHandle> File;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WorkEvent = nullptr;
+
+	TQueue<TArray<uint8>, EQueueMode::Spsc> Pending;
+	TQueue<TArray<uint8>, EQueueMode::Spsc> Free;
+
+	FString FilePath;
+	int64 DataSize = 0;
+	int32 SampleRate = 16000;
+	int32 NumChannels = 1;
+
+	FThreadSafeBool bStopping = false;
+	FThreadSafeBool bWriteFailed = false;
+};
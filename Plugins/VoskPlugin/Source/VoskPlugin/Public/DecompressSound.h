@@ -11,7 +11,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSoundDecompressed, const TArray<u
 
 
 /**
- * 
+ * Decodes sound asset to mono 16 bit PCM on the thread pool.
+ *
+ * Results are kept in a memory budgeted cache keyed by asset and sample rate,
+ * so recognizing the same asset again finishes immediately. Nodes started while
+ * the same asset is still decoding wait for that decode instead of starting their own.
  */
 UCLASS()
 class VOSKPLUGIN_API UDecompressSound final : public UBlueprintAsyncActionBase
@@ -23,11 +27,27 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "VoskPlugin")
 		FOnSoundDecompressed Finished;
 
-	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"), Category = "VoskPlugin")
-	static UDecompressSound* DecompressSound(USoundWave* Sound, bool StopDeviceSounds = true);
+	/**
+	 * @param StopDeviceSounds	Ignored, decoding no longer interrupts playing sounds. Kept for existing graphs
+	 * @param SampleRate		Rate of output samples, 0 keeps rate of the asset
+	 */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", AdvancedDisplay = "StopDeviceSounds"), Category = "VoskPlugin")
+	static UDecompressSound* DecompressSound(USoundWave* Sound, bool StopDeviceSounds = false, int32 SampleRate = 16000);
+
+	UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+	static void SetDecodedSoundCacheBudget(int32 Megabytes = 64);
+
+	UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+	static void ClearDecodedSoundCache();
 
 	virtual void Activate() override;
 
+	UPROPERTY()
 	USoundWave* Sound = nullptr;
-	bool StopDeviceSounds = true;
+
+	bool StopDeviceSounds = false;
+	int32 SampleRate = 16000;
+
+private:
+	void Finish(const TArray<uint8>& Samples);
 };
@@ -0,0 +1,86 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VoskAudioConditioning.generated.h"
+
+
+/**
+* Pre-processing applied to microphone audio before it reaches the recognizer.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskAudioConditioningSettings
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Removes constant offset some microphones add to the signal */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin")
+        bool bRemoveDC = true;
+
+    /** Cuts rumble and handling noise below HighPassCutoff */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin")
+        bool bHighPass = true;
+
+    /** Hz */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin", meta = (ClampMin = "20", ClampMax = "400"))
+        float HighPassCutoff = 80.f;
+
+    /** Attenuates frequency bands that stay close to the tracked noise floor */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin")
+        bool bNoiseGate = true;
+
+    /** dB above noise floor a band has to reach to pass the gate */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin", meta = (ClampMin = "0", ClampMax = "30"))
+        float NoiseGateThreshold = 6.f;
+
+    /** dB applied to gated bands */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin", meta = (ClampMin = "-80", ClampMax = "0"))
+        float NoiseGateAttenuation = -18.f;
+
+    /** Brings quiet or hot microphones to TargetLevel */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin")
+        bool bAutoGain = true;
+
+    /** RMS level in dBFS */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin", meta = (ClampMin = "-40", ClampMax = "-3"))
+        float TargetLevel = -20.f;
+
+    /** dB */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskPlugin", meta = (ClampMin = "0", ClampMax = "40"))
+        float MaxGain = 24.f;
+};
+
+/**
+* Time spent in each conditioning stage since capture started, in milliseconds.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskAudioConditioningStats
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Seconds of audio processed */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float AudioSeconds = 0.f;
+
+    /** int16 <-> float conversion */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Convert = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float DCRemoval = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float HighPass = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float NoiseGate = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float AutoGain = 0.f;
+
+    /** Gain currently applied by automatic gain control, dB */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float CurrentGain = 0.f;
+};
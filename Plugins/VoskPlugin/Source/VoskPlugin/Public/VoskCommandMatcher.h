@@ -0,0 +1,129 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "VoskCommandMatcher.generated.h"
+
+
+UENUM(BlueprintType)
+enum class EVoskMatchMode : uint8
+{
+    /** Compare characters as written */
+    Text,
+
+    /** Compare pinyin syllables with tones, homophones with different hanzi match */
+    Pinyin,
+
+    /** Compare pinyin syllables ignoring tones */
+    PinyinToneless
+};
+
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskCommandMatch
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FString Phrase;
+
+    /** Same scale as CompareStrings, 1 is exact match */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Score = 0.f;
+
+    /** Edit distance in codepoints */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        int32 Distance = 0;
+};
+
+
+/**
+* Fuzzy matcher of recognized text against a known set of command phrases.
+*
+* Phrases are kept in a BK-tree over codepoints, so a lookup only measures distance to the
+* phrases that can still fall within the score threshold instead of the whole list.
+* Phrases are compared lower case with surrounding whitespace trimmed.
+*
+* In pinyin modes every hanzi is replaced by its syllable before measuring distance,
+* so score and distance count syllables rather than characters.
+*/
+UCLASS(BlueprintType)
+class VOSKPLUGIN_API UVoskCommandMatcher : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    static UVoskCommandMatcher* CreateCommandMatcher(const TArray<FString>& Phrases, EVoskMatchMode MatchMode = EVoskMatchMode::Text);
+
+    /**
+    * Re-keys all known phrases. Returns false for pinyin modes when the pinyin table is missing,
+    * the mode is still set but hanzi are then compared as written
+    */
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    bool SetMatchMode(EVoskMatchMode NewMatchMode);
+
+    UFUNCTION(BlueprintPure, Category = "VoskPlugin")
+    EVoskMatchMode GetMatchMode() const { return MatchMode; }
+
+    /** Returns false if phrase is empty or already known */
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    bool AddPhrase(const FString& Phrase);
+
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    bool RemovePhrase(const FString& Phrase);
+
+    UFUNCTION(BlueprintPure, Category = "VoskPlugin")
+    bool ContainsPhrase(const FString& Phrase) const;
+
+    UFUNCTION(BlueprintPure, Category = "VoskPlugin")
+    int32 GetNumPhrases() const { return PhraseToNode.Num(); }
+
+    /**
+    * Up to MaxResults phrases scoring at least MinScore against Text, best first.
+    */
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    TArray<FVoskCommandMatch> FindMatches(const FString& Text, int32 MaxResults = 3, float MinScore = 0.7f) const;
+
+    UFUNCTION(BlueprintCallable, Category = "VoskPlugin")
+    bool FindBestMatch(const FString& Text, FVoskCommandMatch& Match, float MinScore = 0.7f) const;
+
+    /** Space separated pinyin syllables of the text, e.g. "da3 kai1 deng1" */
+    UFUNCTION(BlueprintPure, Category = "VoskPlugin")
+    static FString ConvertToPinyin(const FString& Text, bool bWithTones = true);
+
+    /** False if the built-in pinyin table is empty, pinyin modes then compare text */
+    UFUNCTION(BlueprintPure, Category = "VoskPlugin")
+    static bool IsPinyinAvailable();
+
+private:
+    struct FNode
+    {
+        FString Phrase;
+        TArray<UTF32CHAR> Key;
+
+        /** (distance to this node, child index) */
+        TArray<TPair<int32, int32>, TInlineAllocator<4>> Children;
+
+        /** Removed nodes stay in the tree for routing until the next rebuild */
+        bool bRemoved = false;
+    };
+
+    static FString Normalize(const FString& Phrase);
+    void MakeKey(const FString& Normalized, TArray<UTF32CHAR>& OutKey) const;
+    const TArray<UTF32CHAR>& GetQueryKey(const FString& Normalized) const;
+
+    void Insert(int32 NodeIndex);
+    void Rebuild();
+
+    TArray<FNode> Nodes;
+    TMap<FString, int32> PhraseToNode;
+    int32 NumRemoved = 0;
+
+    EVoskMatchMode MatchMode = EVoskMatchMode::Text;
+
+    /** Partial results repeat a lot, keep their pinyin around */
+    mutable TMap<FString, TArray<UTF32CHAR>> QueryKeyCache;
+    mutable TArray<UTF32CHAR> QueryKey;
+};
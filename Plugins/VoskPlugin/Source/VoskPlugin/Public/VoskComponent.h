@@ -8,6 +8,9 @@
 #include "IWebSocket.h"
 #include "ProcessHandleWrapper.h"
 #include "VoskServerParameters.h"
+#include "VoskWordTiming.h"
+#include "VoskLatencyStats.h"
+#include "VoskAudioConditioning.h"
 
 #include "VoskComponent.generated.h"
 
@@ -34,12 +37,42 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "VoskComponent")
     bool bSendVoiceDataWhenRecording = true;
 
+    /**
+    * Negotiate compact binary result frames with the server on Initialize.
+    * Falls back to json silently if server does not support it
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "VoskComponent")
+    bool bPreferBinaryResults = false;
+
+    /**
+    * Keep everything captured since BeginCapture in memory for FinishCapture.
+    * Turn off for long sessions recorded with StartRecordingToFile
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "VoskComponent")
+    bool bKeepCaptureInMemory = true;
+
+    /** Clean up microphone audio before it is sent, applied on BeginCapture */
+    UPROPERTY(BlueprintReadWrite, Category = "VoskComponent")
+    bool bConditionAudio = false;
+
+    UPROPERTY(BlueprintReadWrite, Category = "VoskComponent")
+    FVoskAudioConditioningSettings ConditioningSettings;
+
     UFUNCTION(BlueprintCallable, Category = "VoskComponent")
     bool BeginCapture();
 
     UFUNCTION(BlueprintCallable, Category = "VoskComponent")
     void FinishCapture(TArray<uint8> &CaptureData, int32 &SamplesRecorded);
 
+    /**
+    * Streams captured audio to a wave file on a background thread until StopRecordingToFile
+    */
+    UFUNCTION(BlueprintCallable, Category = "VoskComponent")
+    bool StartRecordingToFile(const FString& Path);
+
+    UFUNCTION(BlueprintCallable, Category = "VoskComponent")
+    bool StopRecordingToFile();
+
     UFUNCTION(BlueprintCallable, Category = "VoskComponent", meta = (AdvancedDisplay = "PacketSize"))
     /**
     * Splits Voice chunk to pieces of PacketSize and sends them to the server.
@@ -48,6 +81,16 @@ public:
     */
     bool SendVoiceDataToLanguageServer(const TArray<uint8>& VoiceChunk, int32 PacketSize = 4096);
 
+    /**
+    * Decodes and converts sound asset chunk by chunk on worker threads and sends each
+    * chunk to the server as soon as it is ready. Final result is requested at the end
+    */
+    UFUNCTION(BlueprintCallable, Category = "VoskComponent")
+    bool SendSoundToLanguageServer(USoundWave* Sound);
+
+    UFUNCTION(BlueprintCallable, Category = "VoskComponent")
+    void CancelSendSound();
+
     UFUNCTION(BlueprintCallable, Category = "VoskComponent")
     void Initialize(FString Addr = TEXT("127.0.0.1"), int32 Port = 8080);
 
@@ -72,6 +115,18 @@ public:
     UFUNCTION(BlueprintPure, Category = "VoskComponent")
     FString GetFinalResult();
 
+    /** Word timings of the last final result, empty unless server sends words */
+    UFUNCTION(BlueprintPure, Category = "VoskComponent")
+    const TArray<FVoskWordTiming>& GetFinalResultWords() const;
+
+    /** Time spent in each conditioning stage during current capture */
+    UFUNCTION(BlueprintPure, Category = "VoskComponent")
+    FVoskAudioConditioningStats GetConditioningStats() const;
+
+    /** Capture -> send -> result latency percentiles since last Initialize */
+    UFUNCTION(BlueprintPure, Category = "VoskComponent")
+    FVoskLatencyReport GetLatencyReport() const;
+
     UFUNCTION(BlueprintCallable, Category = "VoskComponent")
     static USoundWave* SamplesToSound(
         const TArray<uint8>& samples,
@@ -127,13 +182,21 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-    void DecodeRresult(const FString &raw);
-    TSharedPtr<IWebSocket> Socket;
+    void DecodeRresult(const struct FVoskRecognitionResult& result);
+
+    TSharedPtr<class FVoskServerConnection> _connection;
+    TSharedPtr<class FVoskVoiceCapture> _capture;
+    TSharedPtr<class FVoskWavWriter> _wav_writer;
+    TSharedPtr<class FVoskSoundPipeline, ESPMode::ThreadSafe> _pipeline;
+
+    /** Keeps sound fed by the pipeline alive */
+    UPROPERTY()
+    USoundWave* _pipeline_sound = nullptr;
 
-    TSharedPtr<class IVoiceCapture> _voice_capture;
-    TArray<uint8> _recorded_samples;
+    TArray<uint8> _recorded_chunk;
     FString _res_partial;
     FString _res_final;
+    TArray<FVoskWordTiming> _res_final_words;
 
     const int32 _sample_rate = 16000;
 };
\ No newline at end of file
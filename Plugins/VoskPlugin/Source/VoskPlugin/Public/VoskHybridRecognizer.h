@@ -0,0 +1,172 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "VoskComponent.h"
+
+#include "VoskHybridRecognizer.generated.h"
+
+
+UENUM(BlueprintType)
+enum class EVoskRecognitionBackend : uint8
+{
+    None,
+    Server,
+    Local
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRecognitionBackendChanged, EVoskRecognitionBackend, Backend);
+
+
+/**
+* Front-end recognizer that prefers the language server and falls back to
+* in-process libvosk while the socket is down or the server is too slow.
+*
+* Capture, buffering and result events are shared between both backends, so
+* Blueprints only ever bind to this component.
+*/
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class UVoskHybridRecognizer : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UVoskHybridRecognizer();
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    FString ServerAddress = TEXT("127.0.0.1");
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    int32 ServerPort = 8080;
+
+    /** Model used by the in-process fallback. Leave empty to run server only */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    FString PathToModel;
+
+    /** Server round trip (seconds) above which recognition switches to the local model */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer", meta = (ClampMin = "0.01", UIMin = "0.01"))
+    float MaxServerLatency = 0.5f;
+
+    /** Number of consecutive fast server replies required before switching back */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer", meta = (ClampMin = "1", UIMin = "1"))
+    int32 RecoveryReplies = 5;
+
+    /** Seconds between reconnection attempts while server is down */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer", meta = (ClampMin = "0.1", UIMin = "0.1"))
+    float ReconnectInterval = 2.f;
+
+    /** Seconds of audio kept for replay into the local model when failing over mid-utterance */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer", meta = (ClampMin = "0", UIMin = "0"))
+    float ReplayBufferSeconds = 5.f;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    bool bSendVoiceDataWhenRecording = true;
+
+    /** Negotiate compact binary result frames with the server */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    bool bPreferBinaryResults = false;
+
+    /** Clean up microphone audio before recognition, applied on BeginCapture */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    bool bConditionAudio = false;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VoskHybridRecognizer")
+    FVoskAudioConditioningSettings ConditioningSettings;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskHybridRecognizer")
+    bool bIsCaptureActive = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskHybridRecognizer")
+    EVoskRecognitionBackend ActiveBackend = EVoskRecognitionBackend::None;
+
+    /** Connects to the server and loads the fallback model in background */
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    void Initialize();
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    void Uninitialize();
+
+    UFUNCTION(BlueprintPure, Category = "VoskHybridRecognizer")
+    bool IsServerAvailable() const;
+
+    UFUNCTION(BlueprintPure, Category = "VoskHybridRecognizer")
+    bool IsLocalAvailable() const;
+
+    /** Smoothed server round trip in seconds */
+    UFUNCTION(BlueprintPure, Category = "VoskHybridRecognizer")
+    float GetServerLatency() const { return ServerLatency; }
+
+    /** Capture -> send -> result latency percentiles of the current server session */
+    UFUNCTION(BlueprintPure, Category = "VoskHybridRecognizer")
+    FVoskLatencyReport GetServerLatencyReport() const;
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    bool BeginCapture();
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    void FinishCapture(TArray<uint8>& CaptureData, int32& SamplesRecorded);
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer", meta = (AdvancedDisplay = "PacketSize"))
+    /**
+    * Splits Voice chunk to pieces of PacketSize and sends them to the active backend.
+    */
+    bool FeedVoiceData(const TArray<uint8>& VoiceChunk, int32 PacketSize = 4096);
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    void RequestFinalResult();
+
+    UFUNCTION(BlueprintCallable, Category = "VoskHybridRecognizer")
+    void ResetRecognizer();
+
+    UPROPERTY(BlueprintAssignable, Category = "VoskHybridRecognizer")
+    FOnPartialResultReceived OnPartialResultReceived;
+
+    UPROPERTY(BlueprintAssignable, Category = "VoskHybridRecognizer")
+    FOnFinalResultReceived OnFinalResultReceived;
+
+    UPROPERTY(BlueprintAssignable, Category = "VoskHybridRecognizer")
+    FOnRecognitionBackendChanged OnRecognitionBackendChanged;
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+    void RouteAudio(const uint8* Data, int32 Size, double CaptureTime = 0.0);
+    void UpdateActiveBackend();
+    void SetActiveBackend(EVoskRecognitionBackend Backend);
+
+    void LoadLocalModel();
+    void OnLocalModelLoaded(uint32 Generation);
+
+    void OnServerResult(const struct FVoskRecognitionResult& Result);
+    void OnLocalResult(const struct FVoskRecognitionResult& Result);
+    void BroadcastResult(const struct FVoskRecognitionResult& Result);
+
+    TSharedPtr<class FVoskServerConnection> Server;
+    TSharedPtr<class FVoskLocalRecognizer> Local;
+    TSharedPtr<class FVoskVoiceCapture> Capture;
+
+    /** Audio since the last final result, replayed into the local model on failover */
+    TSharedPtr<class FVoskReplayBuffer> ReplayBuffer;
+    TArray<uint8> CaptureChunk;
+
+    /** Time the oldest unanswered audio packet was sent to the server, 0 if none */
+    double PendingSendTime = 0.0;
+    float ServerLatency = 0.f;
+    int32 FastReplies = 0;
+    bool bServerTooSlow = false;
+
+    float ReconnectTimer = 0.f;
+    bool bWantServer = false;
+    bool bLocalLoading = false;
+
+    /** Bumped by Uninitialize so a model load started before it is discarded */
+    uint32 InitGeneration = 0;
+
+    const int32 SampleRate = 16000;
+};
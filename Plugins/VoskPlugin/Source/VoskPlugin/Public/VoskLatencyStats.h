@@ -0,0 +1,64 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VoskLatencyStats.generated.h"
+
+
+/**
+* Distribution of a single latency stage, in milliseconds.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskLatencyPercentiles
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        int32 Samples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float P50 = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float P90 = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float P99 = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Max = 0.f;
+};
+
+/**
+* Capture -> send -> result timeline of the current server session.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskLatencyReport
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Audio waiting on the client between capture and socket send */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FVoskLatencyPercentiles CaptureToSend;
+
+    /** Network and server side recognition, until the reply arrived */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FVoskLatencyPercentiles SendToResult;
+
+    /** Decoding of the reply on the client */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FVoskLatencyPercentiles Decode;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FVoskLatencyPercentiles CaptureToResult;
+
+    /** Results that arrived with no audio frame left to correlate them to */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        int32 UnmatchedResults = 0;
+
+    /** Server broke the one reply per frame order, later results count as unmatched */
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        bool bPairingDropped = false;
+};
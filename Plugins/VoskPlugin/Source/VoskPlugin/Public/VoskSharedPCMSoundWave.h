@@ -0,0 +1,32 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundWaveProcedural.h"
+#include "VoskSoundUtils.h"
+#include "VoskSharedPCMSoundWave.generated.h"
+
+
+/**
+* Sound wave playing 16 bit PCM out of a buffer shared with other owners.
+* Audio renderer pulls one block at a time, the whole clip is never duplicated.
+*/
+UCLASS()
+class VOSKPLUGIN_API UVoskSharedPCMSoundWave : public USoundWaveProcedural
+{
+    GENERATED_BODY()
+
+public:
+    void SetSamples(const FVoskSharedPCM& InSamples, uint32 InSampleRate, uint16 InNumChannels);
+
+    /** USoundWaveProcedural, every playback starts from the first sample */
+    virtual void OnBeginGenerate() override;
+    virtual int32 OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples) override;
+
+private:
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Samples;
+
+    /** Touched by audio render thread only once playing */
+    int32 ReadOffset = 0;
+};
@@ -3,9 +3,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/** Immutable PCM shared between recognizer, capture and playback without copies */
+typedef TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> FVoskSharedPCM;
 
 namespace VoskComponentUtils {
 
+	/** Size of canonical PCM wave header written by this plugin */
+	const int32 WAVE_HEADER_SIZE = 44;
+
 	/**
 	* Converts byte array to USoundWave ready to be performed by AudioComponent
 	*/
@@ -13,11 +20,31 @@ namespace VoskComponentUtils {
 
 	class USoundWave* CreateSoundFromWaveDataWithoutHeader(const TArray<uint8> &rawData, uint16 InSampleRate=16000, uint8 InNumChannels=1);
 
+	/**
+	* Allocates RawPCMData once and lets Fill write DataSize bytes of 16 bit samples straight into it
+	*/
+	class USoundWave* CreateSoundWithPCM(int32 DataSize, uint32 InSampleRate, uint16 InNumChannels, TFunctionRef<void(uint8*, int32)> Fill);
+
+	/**
+	* Takes ownership of Data, which must come from FMemory::Malloc. Freed even on failure
+	*/
+	class USoundWave* CreateSoundAdoptingPCM(uint8* Data, int32 DataSize, uint32 InSampleRate=16000, uint16 InNumChannels=1);
+
+	/**
+	* Procedural wave that plays straight out of the shared buffer, samples are never copied up front
+	*/
+	class USoundWave* CreateSoundFromSharedPCM(const FVoskSharedPCM& Samples, uint32 InSampleRate=16000, uint16 InNumChannels=1);
+
 	/**
 	* Adds wave header
 	*/
 	const TArray<uint8> GenerateWaveHeader(const TArray<uint8> &rawData, uint16 InSampleRate=16000, uint8 InNumChannels=1);
 
+	/**
+	* Writes WAVE_HEADER_SIZE bytes of 16 bit PCM wave header describing DataSize bytes of samples
+	*/
+	void WriteWaveHeader(uint8* OutHeader, uint32 DataSize, uint32 InSampleRate=16000, uint16 InNumChannels=1);
+
 
 	/**
 	* Wraps raw audio samples with wave header and saves to a file
@@ -26,7 +53,10 @@ namespace VoskComponentUtils {
 
 	static FString GetEnvironmentVariable(FString key);
 
-	void EnsureSoundWaveDecompressed(class USoundWave* Sound, bool StopDeviceSounds=true);
+	/**
+	* Interleaved 16 bit samples of decompressed sound, whether RawPCMData carries wave header or not
+	*/
+	bool GetDecompressedPCM(class USoundWave* Sound, const uint8*& OutData, int32& OutSize, int32& OutSampleRate, int32& OutNumChannels);
 
 	int32 GetSoundSampleRate(USoundWave* Sound);
 
@@ -0,0 +1,26 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VoskTranscriptSegment.generated.h"
+
+
+/**
+* Final result of file transcription with its position in the recording, in seconds.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskTranscriptSegment
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        FString Text;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Start = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float End = 0.f;
+};
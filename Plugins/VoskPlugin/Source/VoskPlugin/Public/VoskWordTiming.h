@@ -0,0 +1,27 @@
+// Copyright Ilgar Lunin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VoskWordTiming.generated.h"
+
+
+/**
+* Timing of a single recognized word, in seconds since recognizer start.
+* Words are in the same order as space separated words of result text.
+*/
+USTRUCT(BlueprintType)
+struct VOSKPLUGIN_API FVoskWordTiming
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Start = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float End = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "VoskPlugin")
+        float Confidence = 0.f;
+};